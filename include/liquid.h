@@ -142,6 +142,13 @@ void AGC(_unlock)(AGC() _q);                                    \
 float AGC(_get_bandwidth)(AGC() _q);                            \
 void  AGC(_set_bandwidth)(AGC() _q, float _bt);                 \
                                                                 \
+/* get/set gain update rate for block execution: for _decim */  \
+/* greater than one, _execute_block() applies a constant    */  \
+/* gain to each group of _decim samples and updates it once */  \
+/* per group, keeping the loop bandwidth (default: 1)       */  \
+unsigned int AGC(_get_decim)(AGC() _q);                         \
+void         AGC(_set_decim)(AGC() _q, unsigned int _decim);    \
+                                                                \
 /* get/set signal level (linear) relative to unity energy   */  \
 float AGC(_get_signal_level)(AGC() _q);                         \
 void  AGC(_set_signal_level)(AGC() _q, float _signal_level);    \
@@ -294,6 +301,20 @@ LIQUID_CBUFFER_DEFINE_API(LIQUID_CBUFFER_MANGLE_CFLOAT, liquid_float_complex)
 
 
 
+// window buffer memory layout
+typedef enum {
+    LIQUID_WINDOW_MODE_LINEAR=0,    // linear array, periodically shifted (memmove)
+    LIQUID_WINDOW_MODE_MIRROR,      // ring with mirrored writes, no memmove
+    LIQUID_WINDOW_MODE_VMRING,      // ring mapped twice into virtual memory
+                                    // (falls back to mirror if unavailable)
+} liquid_window_mode;
+
+// set memory layout used by window objects created with _create()
+void liquid_window_set_default_mode(liquid_window_mode _mode);
+
+// get memory layout used by window objects created with _create()
+liquid_window_mode liquid_window_get_default_mode(void);
+
 // Windowing functions
 #define LIQUID_WINDOW_MANGLE_FLOAT(name)  LIQUID_CONCAT(windowf,  name)
 #define LIQUID_WINDOW_MANGLE_CFLOAT(name) LIQUID_CONCAT(windowcf, name)
@@ -308,6 +329,16 @@ typedef struct WINDOW(_s) * WINDOW();                           \
 /* create window buffer object of length _n                 */  \
 WINDOW() WINDOW(_create)(unsigned int _n);                      \
                                                                 \
+/* create window buffer object with specific memory layout  */  \
+/*  _n      : window length, _n > 0                         */  \
+/*  _mode   : memory layout, e.g. LIQUID_WINDOW_MODE_MIRROR */  \
+WINDOW() WINDOW(_create_mode)(unsigned int       _n,            \
+                              liquid_window_mode _mode);        \
+                                                                \
+/* get memory layout of window object (the requested layout */  \
+/* is replaced if it was not available)                     */  \
+liquid_window_mode WINDOW(_get_mode)(WINDOW() _q);              \
+                                                                \
 /* recreate window buffer object with new length            */  \
 /*  _q      : old window object                             */  \
 /*  _n      : new window length                             */  \
@@ -551,6 +582,31 @@ LIQUID_TVMPCH_DEFINE_API(LIQUID_TVMPCH_MANGLE_CCCF,
 // MODULE : dotprod (vector dot product)
 //
 
+// SIMD instruction set extensions available for structured dot products;
+// the kernel is selected once when the object is created
+#define LIQUID_SIMD_NUM_TYPES   5
+typedef enum {
+    LIQUID_SIMD_AUTO=0,     // best kernel supported by host (default)
+    LIQUID_SIMD_PORTABLE,   // portable C
+    LIQUID_SIMD_SSE,        // SSE/SSE3
+    LIQUID_SIMD_AVX2,       // AVX2 with fused multiply-add
+    LIQUID_SIMD_AVX512      // AVX-512F
+} liquid_simd_type;
+
+// pretty names for SIMD types
+extern const char * liquid_simd_type_str[LIQUID_SIMD_NUM_TYPES][2];
+
+// determine if SIMD type is supported by both the library build and the
+// host processor
+int liquid_simd_is_supported(liquid_simd_type _type);
+
+// set SIMD type to use for objects created hereafter; unsupported types
+// fall back to the best supported type below the one requested
+void liquid_simd_set_type(liquid_simd_type _type);
+
+// get SIMD type set by liquid_simd_set_type() (LIQUID_SIMD_AUTO default)
+liquid_simd_type liquid_simd_get_type(void);
+
 #define LIQUID_DOTPROD_MANGLE_RRRF(name) LIQUID_CONCAT(dotprod_rrrf,name)
 #define LIQUID_DOTPROD_MANGLE_CCCF(name) LIQUID_CONCAT(dotprod_cccf,name)
 #define LIQUID_DOTPROD_MANGLE_CRCF(name) LIQUID_CONCAT(dotprod_crcf,name)
@@ -828,6 +884,84 @@ LIQUID_EQRLS_DEFINE_API(LIQUID_EQRLS_MANGLE_RRRF, float)
 LIQUID_EQRLS_DEFINE_API(LIQUID_EQRLS_MANGLE_CCCF, liquid_float_complex)
 
 
+// fast recursive least-squares (RLS), fast transversal filter form
+#define LIQUID_EQFRLS_MANGLE_RRRF(name) LIQUID_CONCAT(eqfrls_rrrf,name)
+#define LIQUID_EQFRLS_MANGLE_CCCF(name) LIQUID_CONCAT(eqfrls_cccf,name)
+
+// large macro
+//   EQFRLS : name-mangling macro
+//   T      : data type
+#define LIQUID_EQFRLS_DEFINE_API(EQFRLS,T)                      \
+typedef struct EQFRLS(_s) * EQFRLS();                           \
+                                                                \
+/* create fast RLS EQ initialized with external coefficients */ \
+/*  _h  : filter coefficients (NULL for {1,0,0...})         */  \
+/*  _p  : filter length                                     */  \
+EQFRLS() EQFRLS(_create)(T *          _h,                       \
+                         unsigned int _p);                      \
+                                                                \
+/* re-create fast RLS EQ initialized with external coeffs   */  \
+/*  _q  : initial equalizer object                          */  \
+/*  _h  : filter coefficients (NULL for {1,0,0...})         */  \
+/*  _p  : filter length                                     */  \
+EQFRLS() EQFRLS(_recreate)(EQFRLS()     _q,                     \
+                           T *          _h,                     \
+                           unsigned int _p);                    \
+                                                                \
+/* destroy equalizer object, freeing all internal memory    */  \
+void EQFRLS(_destroy)(EQFRLS() _q);                             \
+                                                                \
+/* print equalizer internal state                           */  \
+void EQFRLS(_print)(EQFRLS() _q);                               \
+                                                                \
+/* reset equalizer object, clearing internal state          */  \
+void EQFRLS(_reset)(EQFRLS() _q);                               \
+                                                                \
+/* get/set equalizer learning rate (forgetting factor)      */  \
+float EQFRLS(_get_bw)(EQFRLS() _q);                             \
+void  EQFRLS(_set_bw)(EQFRLS() _q,                              \
+                      float    _lambda);                        \
+                                                                \
+/* get number of times the fast recursion was restarted     */  \
+/* after losing numerical stability                         */  \
+unsigned int EQFRLS(_get_num_rescues)(EQFRLS() _q);             \
+                                                                \
+/* push sample into equalizer internal buffer               */  \
+void EQFRLS(_push)(EQFRLS() _q, T _x);                          \
+                                                                \
+/* execute internal dot product and return result           */  \
+/*  _q      :   equalizer object                            */  \
+/*  _y      :   output sample                               */  \
+void EQFRLS(_execute)(EQFRLS() _q, T * _y);                     \
+                                                                \
+/* step through one cycle of equalizer training             */  \
+/*  _q      :   equalizer object                            */  \
+/*  _d      :   desired output                              */  \
+/*  _d_hat  :   actual output                               */  \
+void EQFRLS(_step)(EQFRLS() _q, T _d, T _d_hat);                \
+                                                                \
+/* retrieve internal filter coefficients                    */  \
+/*  _q      :   equalizer object                            */  \
+/*  _w      :   weights [size: _p x 1]                      */  \
+void EQFRLS(_get_weights)(EQFRLS() _q,                          \
+                          T *      _w);                         \
+                                                                \
+/* train equalizer object on group of samples               */  \
+/*  _q      :   equalizer object                            */  \
+/*  _w      :   input/output weights   [size: _p x 1]       */  \
+/*  _x      :   received sample vector [size: _n x 1]       */  \
+/*  _d      :   desired output vector  [size: _n x 1]       */  \
+/*  _n      :   input, output vector length                 */  \
+void EQFRLS(_train)(EQFRLS()     _q,                            \
+                    T *          _w,                            \
+                    T *          _x,                            \
+                    T *          _d,                            \
+                    unsigned int _n);                           \
+
+LIQUID_EQFRLS_DEFINE_API(LIQUID_EQFRLS_MANGLE_RRRF, float)
+LIQUID_EQFRLS_DEFINE_API(LIQUID_EQFRLS_MANGLE_CCCF, liquid_float_complex)
+
+
 
 
 //
@@ -900,9 +1034,31 @@ int crc_check_key(crc_scheme      _scheme,
 // get size of key (bytes)
 unsigned int crc_sizeof_key(crc_scheme _scheme);
 
+// initialize running error-detection key; the key may then be updated
+// chunk by chunk with crc_update_key() and completed with
+// crc_finalize_key(), yielding the same value as crc_generate_key()
+//  _scheme     :   error-detection scheme
+unsigned int crc_init_key(crc_scheme _scheme);
+
+// update running error-detection key with next portion of message
+//  _scheme     :   error-detection scheme
+//  _key        :   running key
+//  _msg        :   input data message portion, [size: _n x 1]
+//  _n          :   input data message portion size
+unsigned int crc_update_key(crc_scheme      _scheme,
+                            unsigned int    _key,
+                            unsigned char * _msg,
+                            unsigned int    _n);
+
+// finalize running error-detection key
+//  _scheme     :   error-detection scheme
+//  _key        :   running key
+unsigned int crc_finalize_key(crc_scheme   _scheme,
+                              unsigned int _key);
+
 
 // available FEC schemes
-#define LIQUID_FEC_NUM_SCHEMES  28
+#define LIQUID_FEC_NUM_SCHEMES  32
 typedef enum {
     LIQUID_FEC_UNKNOWN=0,       // unknown/unsupported scheme
     LIQUID_FEC_NONE,            // no error-correction
@@ -939,7 +1095,14 @@ typedef enum {
     LIQUID_FEC_CONV_V29P78,     // r7/8, K=9, dfree=4
 
     // Reed-Solomon codes
-    LIQUID_FEC_RS_M8            // m=8, n=255, k=223
+    LIQUID_FEC_RS_M8,           // m=8, n=255, k=223
+
+    // quasi-cyclic low-density parity-check codes (layered min-sum),
+    // codeword length 24*Z for lifting size Z in [8,96]
+    LIQUID_FEC_LDPC_R12,        // r1/2, 12 x 24 base graph
+    LIQUID_FEC_LDPC_R23,        // r2/3,  8 x 24 base graph
+    LIQUID_FEC_LDPC_R34,        // r3/4,  6 x 24 base graph
+    LIQUID_FEC_LDPC_R56         // r5/6,  4 x 24 base graph
 } fec_scheme;
 
 // pretty names for fec schemes
@@ -961,20 +1124,37 @@ typedef struct fec_s * fec;
 unsigned int fec_get_enc_msg_length(fec_scheme _scheme,
                                     unsigned int _msg_len);
 
+// convolutional code options (passed to fec_create() as _opts)
+typedef struct {
+    int tailbiting;     // tail-biting rather than zero-terminated frames
+} fec_conv_opts_s;
+
+// return the encoded message length using a particular error-
+// correction scheme and options (object-independent method); this
+// differs from fec_get_enc_msg_length() only for tail-biting
+// convolutional codes, which carry no tail bits
+//  _scheme     :   forward error-correction scheme
+//  _opts       :   options (see fec_create())
+//  _msg_len    :   raw, uncoded message length
+unsigned int fec_get_enc_msg_length_opts(fec_scheme _scheme,
+                                         void * _opts,
+                                         unsigned int _msg_len);
+
 // get the theoretical rate of a particular forward error-
 // correction scheme (object-independent method)
 float fec_get_rate(fec_scheme _scheme);
 
 // create a fec object of a particular scheme
 //  _scheme     :   error-correction scheme
-//  _opts       :   (ignored)
+//  _opts       :   fec_conv_opts_s pointer for convolutional codes
+//                  (NULL for default), ignored otherwise
 fec fec_create(fec_scheme _scheme,
                void *_opts);
 
 // recreate fec object
 //  _q          :   old fec object
 //  _scheme     :   new error-correction scheme
-//  _opts       :   (ignored)
+//  _opts       :   options (see fec_create())
 fec fec_recreate(fec _q,
                  fec_scheme _scheme,
                  void *_opts);
@@ -1193,8 +1373,16 @@ typedef enum {
     // modified discrete cosine transform
     LIQUID_FFT_MDCT     =  30,  // MDCT
     LIQUID_FFT_IMDCT    =  31,  // IMDCT
+
+    // real-input transforms (non-redundant half spectrum)
+    LIQUID_FFT_R2C      =  40,  // real-to-complex one-dimensional FFT
+    LIQUID_FFT_C2R      =  41,  // complex-to-real one-dimensional inverse FFT
 } liquid_fft_type;
 
+// fft plan flags
+#define LIQUID_FFT_ESTIMATE     (0) // select method from wisdom or heuristic
+#define LIQUID_FFT_MEASURE      (1) // measure methods for sizes without wisdom
+
 #define LIQUID_FFT_MANGLE_FLOAT(name) LIQUID_CONCAT(fft,name)
 
 // Macro    :   FFT
@@ -1229,6 +1417,28 @@ FFT(plan) FFT(_create_plan_r2r_1d)(unsigned int _n,             \
                                    int          _type,          \
                                    int          _flags);        \
                                                                 \
+/* create real-to-complex transform, computing only the     */  \
+/* non-redundant half of the conjugate-symmetric spectrum   */  \
+/*  _n      :   transform size                              */  \
+/*  _x      :   pointer to input array  [size: _n x 1]      */  \
+/*  _y      :   pointer to output array [size: _n/2+1 x 1]  */  \
+/*  _flags  :   options, optimization                       */  \
+FFT(plan) FFT(_create_plan_r2c)(unsigned int _n,                \
+                                T *          _x,                \
+                                TC *         _y,                \
+                                int          _flags);           \
+                                                                \
+/* create complex-to-real inverse transform of half spectrum */ \
+/* (unnormalized: output is scaled by _n)                   */  \
+/*  _n      :   transform size                              */  \
+/*  _x      :   pointer to input array  [size: _n/2+1 x 1]  */  \
+/*  _y      :   pointer to output array [size: _n x 1]      */  \
+/*  _flags  :   options, optimization                       */  \
+FFT(plan) FFT(_create_plan_c2r)(unsigned int _n,                \
+                                TC *         _x,                \
+                                T *          _y,                \
+                                int          _flags);           \
+                                                                \
 /* destroy transform                                        */  \
 void FFT(_destroy_plan)(FFT(plan) _p);                          \
                                                                 \
@@ -1271,6 +1481,23 @@ void FFT(_shift)(TC *         _x,                               \
 
 LIQUID_FFT_DEFINE_API(LIQUID_FFT_MANGLE_FLOAT,float,liquid_float_complex)
 
+// FFT wisdom: the fastest measured method for each transform size, used
+// when creating plans. Wisdom is loaded automatically from the file named
+// by the LIQUID_FFT_WISDOM environment variable when the first plan is
+// created.
+
+// measure all methods for transform size and record fastest in wisdom
+void liquid_fft_wisdom_measure(unsigned int _nfft);
+
+// import wisdom from file, returning 0 on success
+int liquid_fft_wisdom_import(const char * _filename);
+
+// export wisdom to file, returning 0 on success
+int liquid_fft_wisdom_export(const char * _filename);
+
+// clear all wisdom
+void liquid_fft_wisdom_forget(void);
+
 // antiquated fft methods
 // FFT(plan) FFT(_create_plan_mdct)(unsigned int _n,
 //                                  T * _x,
@@ -1372,6 +1599,42 @@ void SPGRAM(_estimate_psd)(unsigned int _nfft,                  \
                            TI *         _x,                     \
                            unsigned int _n,                     \
                            T *          _psd);                  \
+                                                                \
+/* estimate spectrum on input signal with Welch's method,   */  \
+/* splitting the overlapping transforms across a pool of    */  \
+/* threads; the result matches _create(), _write() and      */  \
+/* _get_psd() to within floating-point tolerance and does   */  \
+/* not depend on the number of threads                      */  \
+/*  _nfft        : FFT size                                 */  \
+/*  _wtype       : window type, e.g. LIQUID_WINDOW_HAMMING  */  \
+/*  _window_len  : window length, _window_len in [1,_nfft]  */  \
+/*  _delay       : delay between transforms, _delay > 0     */  \
+/*  _x           : input signal [size: _n x 1]              */  \
+/*  _n           : input signal length                      */  \
+/*  _num_threads : number of threads, > 0                   */  \
+/*  _psd         : output spectrum (dB) [size: _nfft x 1]   */  \
+void SPGRAM(_estimate_psd_welch)(unsigned int _nfft,            \
+                                 int          _wtype,           \
+                                 unsigned int _window_len,      \
+                                 unsigned int _delay,           \
+                                 TI *         _x,               \
+                                 unsigned int _n,               \
+                                 unsigned int _num_threads,     \
+                                 T *          _psd);            \
+                                                                \
+/* estimate spectrum of capture file (raw samples in native */  \
+/* format, memory-mapped where supported) with Welch's      */  \
+/* method, returning 0 on success and -1 if the file could  */  \
+/* not be read or holds more than UINT_MAX samples          */  \
+/*  _filename    : input file name                          */  \
+/*  (see _estimate_psd_welch() for other arguments)         */  \
+int SPGRAM(_estimate_psd_file)(unsigned int _nfft,              \
+                               int          _wtype,             \
+                               unsigned int _window_len,        \
+                               unsigned int _delay,             \
+                               const char * _filename,          \
+                               unsigned int _num_threads,       \
+                               T *          _psd);              \
 
 LIQUID_SPGRAM_DEFINE_API(LIQUID_SPGRAM_MANGLE_CFLOAT,
                          float,
@@ -2069,6 +2332,13 @@ LIQUID_AUTOCORR_DEFINE_API(LIQUID_AUTOCORR_MANGLE_RRRF,
 // Finite impulse response filter
 //
 
+// firfilt implementation method
+typedef enum {
+    LIQUID_FIRFILT_METHOD_AUTO=0,   // select from estimated cost
+    LIQUID_FIRFILT_METHOD_DIRECT,   // direct-form convolution
+    LIQUID_FIRFILT_METHOD_FFT,      // FFT-based (overlap-add) block filtering
+} liquid_firfilt_method;
+
 #define LIQUID_FIRFILT_MANGLE_RRRF(name) LIQUID_CONCAT(firfilt_rrrf,name)
 #define LIQUID_FIRFILT_MANGLE_CRCF(name) LIQUID_CONCAT(firfilt_crcf,name)
 #define LIQUID_FIRFILT_MANGLE_CCCF(name) LIQUID_CONCAT(firfilt_cccf,name)
@@ -2083,6 +2353,18 @@ typedef struct FIRFILT(_s) * FIRFILT();                         \
                                                                 \
 FIRFILT() FIRFILT(_create)(TC * _h, unsigned int _n);           \
                                                                 \
+/* create filter, selecting implementation method; FFT      */  \
+/* filtering buffers input internally, delaying the output  */  \
+/* by the block length (see firfilt_xxxt_get_latency())     */  \
+/*  _h          : filter coefficients [size: _n x 1]        */  \
+/*  _n          : filter length, _n > 0                     */  \
+/*  _method     : method, e.g. LIQUID_FIRFILT_METHOD_AUTO   */  \
+/*  _block_len  : FFT block length, 0 for automatic         */  \
+FIRFILT() FIRFILT(_create_method)(TC *                  _h,     \
+                                  unsigned int          _n,     \
+                                  liquid_firfilt_method _method,\
+                                  unsigned int          _block_len);\
+                                                                \
 /* create using Kaiser-Bessel windowed sinc method          */  \
 /*  _n      : filter length, _n > 0                         */  \
 /*  _fc     : filter cut-off frequency 0 < _fc < 0.5        */  \
@@ -2155,6 +2437,12 @@ void FIRFILT(_execute_block)(FIRFILT()    _q,                   \
 /* return length of filter object                           */  \
 unsigned int FIRFILT(_get_length)(FIRFILT() _q);                \
                                                                 \
+/* return implementation method in use (direct or FFT)      */  \
+liquid_firfilt_method FIRFILT(_get_method)(FIRFILT() _q);       \
+                                                                \
+/* return output latency relative to direct-form filter     */  \
+unsigned int FIRFILT(_get_latency)(FIRFILT() _q);               \
+                                                                \
 /* compute complex frequency response of filter object      */  \
 /*  _q      : filter object                                 */  \
 /*  _fc     : frequency to evaluate                         */  \
@@ -2184,6 +2472,98 @@ LIQUID_FIRFILT_DEFINE_API(LIQUID_FIRFILT_MANGLE_CCCF,
                           liquid_float_complex,
                           liquid_float_complex)
 
+//
+// FIR filter bank: multiple channels sharing one set of coefficients
+//
+#define LIQUID_FIRFILTBANK_MANGLE_RRRF(name) LIQUID_CONCAT(firfiltbank_rrrf,name)
+#define LIQUID_FIRFILTBANK_MANGLE_CRCF(name) LIQUID_CONCAT(firfiltbank_crcf,name)
+#define LIQUID_FIRFILTBANK_MANGLE_CCCF(name) LIQUID_CONCAT(firfiltbank_cccf,name)
+
+// Macro:
+//   FIRFILTBANK    : name-mangling macro
+//   TO             : output data type
+//   TC             : coefficients data type
+//   TI             : input data type
+#define LIQUID_FIRFILTBANK_DEFINE_API(FIRFILTBANK,TO,TC,TI)     \
+typedef struct FIRFILTBANK(_s) * FIRFILTBANK();                 \
+                                                                \
+/* create filter bank from external coefficients            */  \
+/*  _h              : filter coefficients [size: _n x 1]    */  \
+/*  _n              : filter length, _n > 0                 */  \
+/*  _num_channels   : number of channels, _num_channels > 0 */  \
+FIRFILTBANK() FIRFILTBANK(_create)(TC *         _h,             \
+                                   unsigned int _n,             \
+                                   unsigned int _num_channels); \
+                                                                \
+/* create filter bank using Kaiser-Bessel windowed sinc     */  \
+/*  _n              : filter length, _n > 0                 */  \
+/*  _fc             : cutoff frequency, 0 < _fc < 0.5       */  \
+/*  _As             : stop-band attenuation [dB], _As > 0   */  \
+/*  _mu             : fractional sample offset              */  \
+/*  _num_channels   : number of channels, _num_channels > 0 */  \
+FIRFILTBANK() FIRFILTBANK(_create_kaiser)(unsigned int _n,      \
+                                          float        _fc,     \
+                                          float        _As,     \
+                                          float        _mu,     \
+                                          unsigned int _num_channels);\
+                                                                \
+/* destroy filter bank object, freeing all internal memory  */  \
+void FIRFILTBANK(_destroy)(FIRFILTBANK() _q);                   \
+                                                                \
+/* reset internal state of all channels                     */  \
+void FIRFILTBANK(_reset)(FIRFILTBANK() _q);                     \
+                                                                \
+/* print filter bank object properties                      */  \
+void FIRFILTBANK(_print)(FIRFILTBANK() _q);                     \
+                                                                \
+/* set output scaling for all channels                      */  \
+void FIRFILTBANK(_set_scale)(FIRFILTBANK() _q,                  \
+                             TC            _scale);             \
+                                                                \
+/* push one sample for each channel into internal buffer    */  \
+/*  _q      : filter bank object                            */  \
+/*  _x      : input frame [size: num_channels x 1]          */  \
+void FIRFILTBANK(_push)(FIRFILTBANK() _q,                       \
+                        TI *          _x);                      \
+                                                                \
+/* compute one output sample for each channel               */  \
+/*  _q      : filter bank object                            */  \
+/*  _y      : output frame [size: num_channels x 1]         */  \
+void FIRFILTBANK(_execute)(FIRFILTBANK() _q,                    \
+                           TO *          _y);                   \
+                                                                \
+/* execute filter bank on block of frames, each holding one */  \
+/* sample per channel; input and output may be the same     */  \
+/*  _q      : filter bank object                            */  \
+/*  _x      : input array [size: _n*num_channels x 1]       */  \
+/*  _n      : number of input, output frames                */  \
+/*  _y      : output array [size: _n*num_channels x 1]      */  \
+void FIRFILTBANK(_execute_block)(FIRFILTBANK() _q,              \
+                                 TI *          _x,              \
+                                 unsigned int  _n,              \
+                                 TO *          _y);             \
+                                                                \
+/* return length of filter                                  */  \
+unsigned int FIRFILTBANK(_get_length)(FIRFILTBANK() _q);        \
+                                                                \
+/* return number of channels                                */  \
+unsigned int FIRFILTBANK(_get_num_channels)(FIRFILTBANK() _q);  \
+
+LIQUID_FIRFILTBANK_DEFINE_API(LIQUID_FIRFILTBANK_MANGLE_RRRF,
+                              float,
+                              float,
+                              float)
+
+LIQUID_FIRFILTBANK_DEFINE_API(LIQUID_FIRFILTBANK_MANGLE_CRCF,
+                              liquid_float_complex,
+                              float,
+                              liquid_float_complex)
+
+LIQUID_FIRFILTBANK_DEFINE_API(LIQUID_FIRFILTBANK_MANGLE_CCCF,
+                              liquid_float_complex,
+                              liquid_float_complex,
+                              liquid_float_complex)
+
 //
 // FIR Hilbert transform
 //  2:1 real-to-complex decimator
@@ -2441,6 +2821,14 @@ void IIRFILT(_execute_block)(IIRFILT()    _q,                   \
                              unsigned int _n,                   \
                              TO *         _y);                  \
                                                                 \
+/* get/set execution topology of second-order sections     */  \
+/* filter: cascade (0, default) or equivalent parallel-form */  \
+/* bank of sections (1) expanded in partial fractions; the  */  \
+/* filter keeps its cascade if it cannot be expanded (e.g.  */  \
+/* repeated poles); setting resets the internal state       */  \
+int  IIRFILT(_get_parallel)(IIRFILT() _q);                      \
+void IIRFILT(_set_parallel)(IIRFILT() _q, int _parallel);       \
+                                                                \
 /* return iirfilt object's filter length (order + 1)        */  \
 unsigned int IIRFILT(_get_length)(IIRFILT() _q);                \
                                                                 \
@@ -2577,6 +2965,17 @@ void FIRPFB(_execute_block)(FIRPFB()     _q,                    \
                             TI *         _x,                    \
                             unsigned int _n,                    \
                             TO *         _y);                   \
+                                                                \
+/* execute every filter in the bank on a block of input     */  \
+/* samples, producing one output per filter for each input  */  \
+/*  _q      : firpfb object                                 */  \
+/*  _x      : pointer to input array [size: _n x 1]         */  \
+/*  _n      : number of input samples                       */  \
+/*  _y      : output array [size: _n*num_filters x 1]       */  \
+void FIRPFB(_execute_block_bank)(FIRPFB()     _q,               \
+                                 TI *         _x,               \
+                                 unsigned int _n,               \
+                                 TO *         _y);              \
 
 LIQUID_FIRPFB_DEFINE_API(LIQUID_FIRPFB_MANGLE_RRRF,
                          float,
@@ -2724,6 +3123,10 @@ void IIRINTERP(_print)(IIRINTERP() _q);                         \
 /* reset interpolator object                                */  \
 void IIRINTERP(_reset)(IIRINTERP() _q);                         \
                                                                 \
+/* set execution topology of internal filter: cascade (0)   */  \
+/* or parallel-form bank (1) of second-order sections       */  \
+void IIRINTERP(_set_parallel)(IIRINTERP() _q, int _parallel);   \
+                                                                \
 /* execute interpolation on single input sample             */  \
 /*  _q      : iirinterp object                              */  \
 /*  _x      : input sample                                  */  \
@@ -2899,6 +3302,10 @@ void IIRDECIM(_print)(IIRDECIM() _q);                           \
 /* reset decimator object                                   */  \
 void IIRDECIM(_reset)(IIRDECIM() _q);                           \
                                                                 \
+/* set execution topology of internal filter: cascade (0)   */  \
+/* or parallel-form bank (1) of second-order sections       */  \
+void IIRDECIM(_set_parallel)(IIRDECIM() _q, int _parallel);     \
+                                                                \
 /* execute decimator on _M input samples                    */  \
 /*  _q      : decimator object                              */  \
 /*  _x      : input samples [size: _M x 1]                  */  \
@@ -5451,6 +5858,33 @@ void MODEM(_demodulate_soft)(MODEM()         _q,                \
                              unsigned int  * _s,                \
                              unsigned char * _soft_bits);       \
                                                                 \
+/* block soft-decision demodulation; soft bits are stored   */  \
+/* most-significant bit first for each symbol               */  \
+/*  _q          :   modem object                            */  \
+/*  _x          :   input samples [size: _n x 1]            */  \
+/*  _n          :   number of input samples                 */  \
+/*  _s          :   output hard symbols [size: _n x 1]      */  \
+/*  _soft_bits  :   output soft bits [size: _n*bps x 1]     */  \
+void MODEM(_demodulate_soft_block)(MODEM()         _q,          \
+                                   TC *            _x,          \
+                                   unsigned int    _n,          \
+                                   unsigned int *  _s,          \
+                                   unsigned char * _soft_bits); \
+                                                                \
+/* block soft-decision demodulation with log-likelihood     */  \
+/* ratio output; positive values favor a '1' bit and soft   */  \
+/* bits above are 16*LLR + 127, clipped to [0,255]          */  \
+/*  _q          :   modem object                            */  \
+/*  _x          :   input samples [size: _n x 1]            */  \
+/*  _n          :   number of input samples                 */  \
+/*  _s          :   output hard symbols [size: _n x 1]      */  \
+/*  _llr        :   output LLRs [size: _n*bps x 1]          */  \
+void MODEM(_demodulate_llr_block)(MODEM()        _q,            \
+                                  TC *           _x,            \
+                                  unsigned int   _n,            \
+                                  unsigned int * _s,            \
+                                  T *            _llr);         \
+                                                                \
 /* get demodulator's estimated transmit sample */               \
 void MODEM(_get_demodulator_sample)(MODEM() _q,                 \
                                     TC *    _x_hat);            \
@@ -5904,6 +6338,35 @@ void FIRPFBCH(_synthesizer_execute)(FIRPFBCH() _q,              \
 void FIRPFBCH(_analyzer_execute)(FIRPFBCH() _q,                 \
                                  TI *       _x,                 \
                                  TO *       _y);                \
+                                                                \
+/* set number of threads used by block execution methods    */  \
+/* (default: 1, run on calling thread only)                 */  \
+/*  _q          : filterbank channelizer object             */  \
+/*  _num_threads: number of threads, > 0                    */  \
+void FIRPFBCH(_set_num_threads)(FIRPFBCH()   _q,                \
+                                unsigned int _num_threads);     \
+                                                                \
+/* execute filterbank as synthesizer on consecutive blocks, */  \
+/* equivalent to _n calls to _synthesizer_execute()         */  \
+/*  _q      : filterbank channelizer object                 */  \
+/*  _x      : input, [size: _n*num_channels x 1]            */  \
+/*  _n      : number of blocks                              */  \
+/*  _y      : output, [size: _n*num_channels x 1]           */  \
+void FIRPFBCH(_synthesizer_execute_block)(FIRPFBCH()   _q,      \
+                                          TI *         _x,      \
+                                          unsigned int _n,      \
+                                          TO *         _y);     \
+                                                                \
+/* execute filterbank as analyzer on consecutive blocks,    */  \
+/* equivalent to _n calls to _analyzer_execute()            */  \
+/*  _q      : filterbank channelizer object                 */  \
+/*  _x      : input, [size: _n*num_channels x 1]            */  \
+/*  _n      : number of blocks                              */  \
+/*  _y      : output, [size: _n*num_channels x 1]           */  \
+void FIRPFBCH(_analyzer_execute_block)(FIRPFBCH()   _q,         \
+                                       TI *         _x,         \
+                                       unsigned int _n,         \
+                                       TO *         _y);        \
 
 
 LIQUID_FIRPFBCH_DEFINE_API(LIQUID_FIRPFBCH_MANGLE_CRCF,
@@ -5969,6 +6432,25 @@ void FIRPFBCH2(_print)(FIRPFBCH2() _q);                         \
 void FIRPFBCH2(_execute)(FIRPFBCH2() _q,                        \
                          TI *        _x,                        \
                          TO *        _y);                       \
+                                                                \
+/* set number of threads used by block execution            */  \
+/* (default: 1, run on calling thread only)                 */  \
+/*  _q          : filterbank channelizer object             */  \
+/*  _num_threads: number of threads, > 0                    */  \
+void FIRPFBCH2(_set_num_threads)(FIRPFBCH2()  _q,               \
+                                 unsigned int _num_threads);    \
+                                                                \
+/* execute filterbank channelizer on consecutive blocks,    */  \
+/* equivalent to _n calls to _execute()                     */  \
+/* LIQUID_ANALYZER:     input: _n*M/2, output: _n*M         */  \
+/* LIQUID_SYNTHESIZER:  input: _n*M,   output: _n*M/2       */  \
+/*  _x      :   channelizer input                           */  \
+/*  _n      :   number of blocks                            */  \
+/*  _y      :   channelizer output                          */  \
+void FIRPFBCH2(_execute_block)(FIRPFBCH2()  _q,                 \
+                               TI *         _x,                 \
+                               unsigned int _n,                 \
+                               TO *         _y);                \
 
 
 LIQUID_FIRPFBCH2_DEFINE_API(LIQUID_FIRPFBCH2_MANGLE_CRCF,
@@ -6105,11 +6587,14 @@ void ofdmframesync_debug_print(ofdmframesync _q, const char * _filename);
 //
 
 // oscillator type
-//  LIQUID_NCO  :   numerically-controlled oscillator (fast)
-//  LIQUID_VCO  :   "voltage"-controlled oscillator (precise)
+//  LIQUID_NCO          :   numerically-controlled oscillator (fast)
+//  LIQUID_VCO          :   "voltage"-controlled oscillator (precise)
+//  LIQUID_NCO_HIRES    :   32-bit phase accumulator with interpolated
+//                          sine table (fast and precise)
 typedef enum {
     LIQUID_NCO=0,
-    LIQUID_VCO
+    LIQUID_VCO,
+    LIQUID_NCO_HIRES
 } liquid_ncotype;
 
 #define LIQUID_NCO_MANGLE_FLOAT(name) LIQUID_CONCAT(nco_crcf, name)
@@ -6564,6 +7049,62 @@ float randricekf_cdf(float _x, float _K, float _omega);
 float randricekf_pdf(float _x, float _K, float _omega);
 
 
+// Random number generator object with per-instance state: thread-safe
+// (one object per thread) and considerably faster than the functions
+// above, which share the global rand() state so that srand() keeps
+// controlling them. Uniform values are drawn from interleaved
+// xoshiro128+ streams, Gauss values from a Ziggurat.
+typedef struct randgen_s * randgen;
+
+// create random number generator object
+//  _seed   :   seed value; distinct seeds give independent sequences
+randgen randgen_create(uint64_t _seed);
+
+// destroy random number generator object
+void randgen_destroy(randgen _q);
+
+// print random number generator object
+void randgen_print(randgen _q);
+
+// re-seed generator, resetting its sequence
+void randgen_seed(randgen _q, uint64_t _seed);
+
+// generate uniform 32-bit integer
+uint32_t randgen_uint32(randgen _q);
+
+// generate uniform random number in [0,1)
+float randgen_randf(randgen _q);
+
+// generate Gauss random number, N(0,1)
+float randgen_randnf(randgen _q);
+
+// generate complex Gauss random number, each component N(0,1)
+void randgen_crandnf(randgen _q, liquid_float_complex * _y);
+
+// fill array with uniform random numbers in [0,1)
+//  _q      :   random number generator object
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of samples
+void randgen_randf_block(randgen      _q,
+                         float *      _y,
+                         unsigned int _n);
+
+// fill array with Gauss random numbers, N(0,1)
+//  _q      :   random number generator object
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of samples
+void randgen_randnf_block(randgen      _q,
+                          float *      _y,
+                          unsigned int _n);
+
+// fill array with complex Gauss random numbers, each component N(0,1)
+//  _q      :   random number generator object
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of samples
+void randgen_crandnf_block(randgen                _q,
+                           liquid_float_complex * _y,
+                           unsigned int           _n);
+
 // Data scrambler : whiten data sequence
 void scramble_data(unsigned char * _x, unsigned int _len);
 void unscramble_data(unsigned char * _x, unsigned int _len);
@@ -6912,6 +7453,10 @@ void VECTOR(_carg)(T *          _x,                             \
 void VECTOR(_abs)(T *          _x,                              \
                   unsigned int _n,                              \
                   TP *         _y);                             \
+/* compute squared magnitude of each element: y[i] = |x[i]|^2 */ \
+void VECTOR(_abs2)(T *          _x,                             \
+                   unsigned int _n,                             \
+                   TP *         _y);                            \
                                                                 \
 /* compute sum of squares: sum{ |x|^2 }                     */  \
 TP VECTOR(_sumsq)(T *          _x,                              \
@@ -68,11 +68,43 @@
 // MODULE : buffer
 //
 
+// allocate ring of _size bytes mapped twice into consecutive virtual
+// memory so that reads running past the end of the ring wrap around to its
+// beginning; _size must be a multiple of the page size. Returns NULL if
+// not supported by the host.
+void * liquid_vmring_create(unsigned int _size);
+
+// free ring allocated with liquid_vmring_create()
+void liquid_vmring_destroy(void * _ring, unsigned int _size);
+
+// get host page size [bytes]
+unsigned int liquid_vmring_get_page_size(void);
+
 
 //
 // MODULE : dotprod
 //
 
+// AVX2/AVX-512 kernels are compiled with per-function target attributes
+// so that the baseline architecture flags (e.g. -msse4.1) are unchanged
+#if HAVE_IMMINTRIN_H && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define LIQUID_SIMD_X86_TARGETS 1
+#else
+#  define LIQUID_SIMD_X86_TARGETS 0
+#endif
+
+// select SIMD type for a newly-created object: returns the type set by
+// liquid_simd_set_type() if supported, otherwise the best type supported
+// by the host which does not exceed it; in either case the result never
+// exceeds _max (the best kernel available to the calling object)
+liquid_simd_type liquid_simd_select(liquid_simd_type _max);
+
+// incremented each time liquid_simd_set_type() is called; kernels which
+// are resolved once and cached outside of an object (e.g. for the
+// stateless dotprod_xxxt_run4() methods) are resolved again when it
+// changes
+extern unsigned int liquid_simd_generation;
+
 
 //
 // MODULE : fec (forward error-correction)
@@ -91,6 +123,21 @@ unsigned int crc16_generate_key(unsigned char * _msg, unsigned int _msg_len);
 unsigned int crc24_generate_key(unsigned char * _msg, unsigned int _msg_len);
 unsigned int crc32_generate_key(unsigned char * _msg, unsigned int _msg_len);
 
+// running checksum, sum of all bytes modulo 256
+unsigned int checksum_update_key(unsigned int _key, unsigned char * _msg, unsigned int _msg_len);
+
+// get reversed generator polynomial for CRC scheme
+unsigned int crc_get_poly_reversed(crc_scheme _scheme);
+
+// CRC engines operating on running (bit-reversed) register
+//  bitwise :   one bit at a time (reference)
+//  table   :   slicing-by-8 lookup tables
+//  pclmul  :   carry-less multiplication (CRC-32 only, falls back to table)
+unsigned int crc_update_key_bitwise(crc_scheme _scheme, unsigned int _key, unsigned char * _msg, unsigned int _msg_len);
+unsigned int crc_update_key_table(crc_scheme _scheme, unsigned int _key, unsigned char * _msg, unsigned int _msg_len);
+unsigned int crc32_update_key_pclmul(unsigned int _key, unsigned char * _msg, unsigned int _msg_len);
+int crc32_pclmul_is_supported(void);
+
 
 // fec : basic object
 struct fec_s {
@@ -100,7 +147,7 @@ struct fec_s {
     //unsigned int enc_msg_len;
     float rate;
 
-    // lengths: convolutional, Reed-Solomon
+    // lengths: convolutional, Reed-Solomon, LDPC
     unsigned int num_dec_bytes;
     unsigned int num_enc_bytes;
 
@@ -112,6 +159,7 @@ struct fec_s {
     unsigned int K; // constraint length
     unsigned int P; // puncturing rate (e.g. p=3 for 3/4)
     int * puncturing_matrix;
+    int tailbiting; // tail-biting (no tail bits) rather than zero-terminated
 
     // viterbi decoder function pointers
     void*(*create_viterbi)(int);
@@ -144,6 +192,21 @@ struct fec_s {
     int * derrlocs;             // decoded error locations [size: 1 x n]
     int erasures;               // number of erasures
 
+    // LDPC (quasi-cyclic, layered min-sum decoder)
+    unsigned int ldpc_mb;       // number of base graph rows (layers)
+    unsigned int ldpc_nb;       // number of base graph columns
+    int * ldpc_base;            // base graph shifts [size: mb x nb], -1 if empty
+    unsigned int ldpc_Z;        // lifting size for current message length
+    unsigned int ldpc_num_edges;// number of non-empty base graph blocks
+    unsigned int ldpc_max_deg;  // maximum number of blocks in a layer
+    unsigned int * ldpc_layer;  // first edge of each layer [size: mb+1 x 1]
+    unsigned int * ldpc_col;    // base graph column of each edge
+    unsigned int * ldpc_shift;  // cyclic shift of each edge, modulo Z
+    unsigned char * ldpc_c;     // codeword bits [size: nb*Zmax x 1]
+    short * ldpc_L;             // posterior LLRs [size: nb*Zmax x 1]
+    short * ldpc_R;             // check-to-variable messages [size: num_edges*Zmax x 1]
+    short * ldpc_Q;             // layer buffer [size: max_deg*Zmax x 1]
+
     // encode function pointer
     void (*encode_func)(fec _q,
                         unsigned int _dec_msg_len,
@@ -169,6 +232,7 @@ int fec_scheme_is_punctured(fec_scheme _scheme);
 int fec_scheme_is_reedsolomon(fec_scheme _scheme);
 int fec_scheme_is_hamming(fec_scheme _scheme);
 int fec_scheme_is_repeat(fec_scheme _scheme);
+int fec_scheme_is_ldpc(fec_scheme _scheme);
 
 // Pass
 fec fec_pass_create(void *_opts);
@@ -264,6 +328,7 @@ unsigned char fecsoft_hamming84_decode(unsigned char * _soft_bits);
 unsigned int fec_hamming128_encode_symbol(unsigned int _sym_dec);
 unsigned int fec_hamming128_decode_symbol(unsigned int _sym_enc);
 extern unsigned short int hamming128_enc_gentab[256];   // encoding table
+extern unsigned char hamming128_dec_gentab[4096];       // decoding table
 
 fec fec_hamming128_create(void *_opts);
 void fec_hamming128_destroy(fec _q);
@@ -303,6 +368,12 @@ extern unsigned int golay2412_P[12];
 extern unsigned int golay2412_Gt[24];
 extern unsigned int golay2412_H[12];
 
+// generated tables for block encoding/decoding
+extern unsigned short int golay2412_enc_gentab_lo[256];  // parity of message bits [0,7]
+extern unsigned short int golay2412_enc_gentab_hi[16];   // parity of message bits [8,11]
+extern unsigned short int golay2412_syn_gentab[3][256];  // syndrome of each symbol byte
+extern unsigned short int golay2412_err_gentab[4096];    // syndrome-to-error table
+
 // multiply input vector with matrix
 unsigned int golay2412_matrix_mul(unsigned int   _v,
                                   unsigned int * _A,
@@ -355,6 +426,12 @@ extern unsigned char secded2216_P[12];
 // syndrome vectors of errors with weight exactly equal to 1
 extern unsigned char secded2216_syndrome_w1[22];
 
+// parity contribution of each message byte [2 x 256]
+extern unsigned char secded2216_enc_gentab[2][256];
+
+// syndrome-to-error table: 1 + index of single-bit error, or 0 if none
+extern unsigned char secded2216_err_gentab[64];
+
 fec fec_secded2216_create(void *_opts);
 void fec_secded2216_destroy(fec _q);
 void fec_secded2216_print(fec _q);
@@ -399,6 +476,12 @@ extern unsigned char secded3932_P[28];
 // syndrome vectors of errors with weight exactly equal to 1
 extern unsigned char secded3932_syndrome_w1[39];
 
+// parity contribution of each message byte [4 x 256]
+extern unsigned char secded3932_enc_gentab[4][256];
+
+// syndrome-to-error table: 1 + index of single-bit error, or 0 if none
+extern unsigned char secded3932_err_gentab[128];
+
 fec fec_secded3932_create(void *_opts);
 void fec_secded3932_destroy(fec _q);
 void fec_secded3932_print(fec _q);
@@ -440,6 +523,12 @@ int fec_secded7264_decode_symbol(unsigned char * _sym_enc,
 extern unsigned char secded7264_P[64];
 extern unsigned char secded7264_syndrome_w1[72];
 
+// parity contribution of each message byte [8 x 256]
+extern unsigned char secded7264_enc_gentab[8][256];
+
+// syndrome-to-error table: 1 + index of single-bit error, or 0 if none
+extern unsigned char secded7264_err_gentab[256];
+
 fec fec_secded7264_create(void *_opts);
 void fec_secded7264_destroy(fec _q);
 void fec_secded7264_print(fec _q);
@@ -474,6 +563,12 @@ unsigned int fec_conv_get_enc_msg_len(unsigned int _dec_msg_len,
                                       unsigned int _K,
                                       unsigned int _p);
 
+// compute encoded message length for tail-biting convolutional codes
+//  _scheme         :   convolutional scheme (punctured or otherwise)
+//  _dec_msg_len    :   decoded message length
+unsigned int fec_conv_get_enc_msg_len_tailbiting(fec_scheme   _scheme,
+                                                 unsigned int _dec_msg_len);
+
 // convolutional code polynomials
 extern int fec_conv27_poly[2];
 extern int fec_conv29_poly[2];
@@ -495,7 +590,7 @@ extern int fec_conv29p56_matrix[10];    // [2 x 5]
 extern int fec_conv29p67_matrix[12];    // [2 x 6]
 extern int fec_conv29p78_matrix[14];    // [2 x 7]
 
-fec fec_conv_create(fec_scheme _fs);
+fec fec_conv_create(fec_scheme _fs, void * _opts);
 void fec_conv_destroy(fec _q);
 void fec_conv_print(fec _q);
 void fec_conv_encode(fec _q,
@@ -515,14 +610,45 @@ void fec_conv_decode(fec _q,
 void fec_conv_setlength(fec _q,
                         unsigned int _dec_msg_len);
 
+// tail-biting: initial encoder state, given by the final K-1 message
+// bits (repeated circularly for messages shorter than K-1 bits)
+unsigned int fec_conv_tailbiting_state(unsigned int _K,
+                                       unsigned int _dec_msg_len,
+                                       unsigned char * _msg_dec);
+
 // internal initialization methods (sets r, K, viterbi methods)
 void fec_conv_init_v27(fec _q);
 void fec_conv_init_v29(fec _q);
 void fec_conv_init_v39(fec _q);
 void fec_conv_init_v615(fec _q);
 
+// native Viterbi decoder (rate 1/R, constraint length K, 8-bit soft
+// inputs, sliding traceback window); interface mirrors libfec
+void * fec_viterbi_create(unsigned int _R,
+                          unsigned int _K,
+                          int *        _poly,
+                          unsigned int _len);
+void * fec_viterbi27_create(int _len);
+void * fec_viterbi29_create(int _len);
+void * fec_viterbi39_create(int _len);
+void * fec_viterbi615_create(int _len);
+void fec_viterbi_delete(void * _vp);
+int fec_viterbi_init(void * _vp,
+                     int _starting_state);
+int fec_viterbi_update_blk(void * _vp,
+                           unsigned char * _syms,
+                           int _nbits);
+int fec_viterbi_chainback(void * _vp,
+                          unsigned char * _data,
+                          unsigned int _nbits,
+                          unsigned int _endstate);
+int fec_viterbi_decode_tailbiting(void * _vp,
+                                  unsigned char * _syms,
+                                  unsigned int _nbits,
+                                  unsigned char * _data);
+
 // punctured convolutional codes
-fec fec_conv_punctured_create(fec_scheme _fs);
+fec fec_conv_punctured_create(fec_scheme _fs, void * _opts);
 void fec_conv_punctured_destroy(fec _q);
 void fec_conv_punctured_print(fec _q);
 void fec_conv_punctured_encode(fec _q,
@@ -582,6 +708,84 @@ void fec_rs_decode(fec _q,
                    unsigned int _dec_msg_len,
                    unsigned char * _msg_enc,
                    unsigned char * _msg_dec);
+void fec_rs_decode_soft(fec _q,
+                        unsigned int _dec_msg_len,
+                        unsigned char * _msg_enc,
+                        unsigned char * _msg_dec);
+
+// native Reed-Solomon codec over GF(2^8) (errors and erasures, shortened
+// codes); interface mirrors libfec
+void * fec_reedsolomon_create(unsigned int _symsize,
+                              unsigned int _gfpoly,
+                              unsigned int _fcs,
+                              unsigned int _prim,
+                              unsigned int _nroots,
+                              unsigned int _pad);
+void fec_reedsolomon_destroy(void * _rs);
+void fec_reedsolomon_encode(void *          _rs,
+                            unsigned char * _data,
+                            unsigned char * _parity);
+int fec_reedsolomon_decode(void *          _rs,
+                           unsigned char * _data,
+                           int *           _eras_pos,
+                           int             _no_eras);
+
+// LDPC
+
+// quasi-cyclic base graphs [mb x 24]
+extern int fec_ldpc_r12_basegraph[288]; // [12 x 24]
+extern int fec_ldpc_r23_basegraph[192]; // [ 8 x 24]
+extern int fec_ldpc_r34_basegraph[144]; // [ 6 x 24]
+extern int fec_ldpc_r56_basegraph[96];  // [ 4 x 24]
+
+// compute number of codewords and lifting size for a message
+//  _dec_msg_len    :   decoded message length (bytes)
+//  _mb             :   number of base graph rows
+//  _num_blocks     :   number of codewords
+//  _Z              :   lifting size
+void fec_ldpc_get_lifting(unsigned int   _dec_msg_len,
+                          unsigned int   _mb,
+                          unsigned int * _num_blocks,
+                          unsigned int * _Z);
+
+// compute encoded message length for LDPC codes
+//  _dec_msg_len    :   decoded message length (bytes)
+//  _mb             :   number of base graph rows
+unsigned int fec_ldpc_get_enc_msg_len(unsigned int _dec_msg_len,
+                                      unsigned int _mb);
+
+fec fec_ldpc_create(fec_scheme _fs);
+void fec_ldpc_destroy(fec _q);
+void fec_ldpc_print(fec _q);
+void fec_ldpc_setlength(fec _q,
+                        unsigned int _dec_msg_len);
+void fec_ldpc_encode(fec _q,
+                     unsigned int _dec_msg_len,
+                     unsigned char * _msg_dec,
+                     unsigned char * _msg_enc);
+void fec_ldpc_decode(fec _q,
+                     unsigned int _dec_msg_len,
+                     unsigned char * _msg_enc,
+                     unsigned char * _msg_dec);
+void fec_ldpc_decode_soft(fec _q,
+                          unsigned int _dec_msg_len,
+                          unsigned char * _msg_enc,
+                          unsigned char * _msg_dec);
+
+// compute parity bits of a single codeword in place
+void fec_ldpc_encode_block(fec _q,
+                           unsigned char * _c);
+
+// layered min-sum decoding of a single codeword
+void fec_ldpc_update_layer(fec _q,
+                           unsigned int _layer);
+int fec_ldpc_check(fec _q);
+int fec_ldpc_decode_block(fec _q,
+                          unsigned int _max_iterations);
+
+// generate expanded parity-check matrix [size: mb*Z x 24*Z]
+smatrixb fec_ldpc_gen_smatrixb(fec_scheme _fs,
+                               unsigned int _Z);
 
 // phi(x) = -logf( tanhf( x/2 ) )
 float sumproduct_phi(float _x);
@@ -668,6 +872,7 @@ struct packetizer_s {
 typedef enum {
     LIQUID_FFT_METHOD_UNKNOWN=0,    // unknown method
     LIQUID_FFT_METHOD_RADIX2,       // Radix-2 (decimation in time)
+    LIQUID_FFT_METHOD_RADIX4,       // Radix-4 (Stockham, decimation in frequency)
     LIQUID_FFT_METHOD_MIXED_RADIX,  // Cooley-Tukey mixed-radix FFT (decimation in time)
     LIQUID_FFT_METHOD_RADER,        // Rader's method for FFTs of prime length
     LIQUID_FFT_METHOD_RADER2,       // Rader's method for FFTs of prime length (alternate)
@@ -696,6 +901,7 @@ typedef void (FFT(_execute_t))(FFT(plan) _q);                   \
 /* FFT create methods */                                        \
 FFT(_create_t) FFT(_create_plan_dft);                           \
 FFT(_create_t) FFT(_create_plan_radix2);                        \
+FFT(_create_t) FFT(_create_plan_radix4);                        \
 FFT(_create_t) FFT(_create_plan_mixed_radix);                   \
 FFT(_create_t) FFT(_create_plan_rader);                         \
 FFT(_create_t) FFT(_create_plan_rader2);                        \
@@ -703,6 +909,7 @@ FFT(_create_t) FFT(_create_plan_rader2);                        \
 /* FFT destroy methods */                                       \
 FFT(_destroy_t) FFT(_destroy_plan_dft);                         \
 FFT(_destroy_t) FFT(_destroy_plan_radix2);                      \
+FFT(_destroy_t) FFT(_destroy_plan_radix4);                      \
 FFT(_destroy_t) FFT(_destroy_plan_mixed_radix);                 \
 FFT(_destroy_t) FFT(_destroy_plan_rader);                       \
 FFT(_destroy_t) FFT(_destroy_plan_rader2);                      \
@@ -710,6 +917,7 @@ FFT(_destroy_t) FFT(_destroy_plan_rader2);                      \
 /* FFT execute methods */                                       \
 FFT(_execute_t) FFT(_execute_dft);                              \
 FFT(_execute_t) FFT(_execute_radix2);                           \
+FFT(_execute_t) FFT(_execute_radix4);                           \
 FFT(_execute_t) FFT(_execute_mixed_radix);                      \
 FFT(_execute_t) FFT(_execute_rader);                            \
 FFT(_execute_t) FFT(_execute_rader2);                           \
@@ -727,6 +935,30 @@ FFT(_execute_t) FFT(_execute_dft_16);                           \
 /* additional methods */                                        \
 unsigned int FFT(_estimate_mixed_radix)(unsigned int _nfft);    \
                                                                 \
+/* shared read-only tables for plans of the same size,      */  \
+/* direction, and method (reference counted)                */  \
+typedef struct FFT(_cache_s) * FFT(_cache);                     \
+                                                                \
+/* acquire existing tables, returning NULL if none exist    */  \
+FFT(_cache) FFT(_cache_acquire)(liquid_fft_method _method,      \
+                                unsigned int      _nfft,        \
+                                int               _dir);        \
+                                                                \
+/* create new entry with empty tables to be populated       */  \
+FFT(_cache) FFT(_cache_create)(liquid_fft_method _method,       \
+                               unsigned int      _nfft,         \
+                               int               _dir);         \
+                                                                \
+/* insert populated entry and acquire it, returning an      */  \
+/* equivalent existing entry (destroying _c) if present     */  \
+FFT(_cache) FFT(_cache_insert)(FFT(_cache) _c);                 \
+                                                                \
+/* release tables, destroying entry when no longer used     */  \
+void FFT(_cache_release)(FFT(_cache) _c);                       \
+                                                                \
+/* get number of entries in cache                           */  \
+unsigned int FFT(_cache_get_num_entries)(void);                 \
+                                                                \
 /* discrete cosine transform (DCT) prototypes */                \
 void FFT(_execute_REDFT00)(FFT(plan) _q);   /* DCT-I   */       \
 void FFT(_execute_REDFT10)(FFT(plan) _q);   /* DCT-II  */       \
@@ -744,10 +976,29 @@ void FFT(_destroy_plan_r2r_1d)(FFT(plan) _q);                   \
                                                                 \
 /* print real-to-real one-dimensional plan */                   \
 void FFT(_print_plan_r2r_1d)(FFT(plan) _q);                     \
+                                                                \
+/* real-input transforms (half spectrum) */                     \
+void FFT(_execute_r2c)(FFT(plan) _q);                           \
+void FFT(_execute_c2r)(FFT(plan) _q);                           \
+void FFT(_destroy_plan_r2c_1d)(FFT(plan) _q);                   \
+void FFT(_print_plan_r2c_1d)(FFT(plan) _q);                     \
 
 // determine best FFT method based on size
 liquid_fft_method liquid_fft_estimate_method(unsigned int _nfft);
 
+// determine if method can compute transform of size _nfft
+int liquid_fft_method_is_valid(liquid_fft_method _method,
+                               unsigned int      _nfft);
+
+// look up fastest measured method for transform size from wisdom,
+// loading wisdom file named by LIQUID_FFT_WISDOM environment variable
+// on first use; returns LIQUID_FFT_METHOD_UNKNOWN if size not found
+liquid_fft_method liquid_fft_wisdom_lookup(unsigned int _nfft);
+
+// record method for transform size in wisdom
+void liquid_fft_wisdom_set(unsigned int      _nfft,
+                           liquid_fft_method _method);
+
 // is input radix-2?
 int fft_is_radix2(unsigned int _n);
 
@@ -763,6 +1014,8 @@ LIQUID_FFT_DEFINE_INTERNAL_API(LIQUID_FFT_MANGLE_FLOAT, float, liquid_float_comp
 #   include <fftw3.h>
 #   define FFT_PLAN             fftwf_plan
 #   define FFT_CREATE_PLAN      fftwf_plan_dft_1d
+#   define FFT_CREATE_PLAN_R2C  fftwf_plan_dft_r2c_1d
+#   define FFT_CREATE_PLAN_C2R  fftwf_plan_dft_c2r_1d
 #   define FFT_DESTROY_PLAN     fftwf_destroy_plan
 #   define FFT_EXECUTE          fftwf_execute
 #   define FFT_DIR_FORWARD      FFTW_FORWARD
@@ -771,6 +1024,8 @@ LIQUID_FFT_DEFINE_INTERNAL_API(LIQUID_FFT_MANGLE_FLOAT, float, liquid_float_comp
 #else
 #   define FFT_PLAN             fftplan
 #   define FFT_CREATE_PLAN      fft_create_plan
+#   define FFT_CREATE_PLAN_R2C  fft_create_plan_r2c
+#   define FFT_CREATE_PLAN_C2R  fft_create_plan_c2r
 #   define FFT_DESTROY_PLAN     fft_destroy_plan
 #   define FFT_EXECUTE          fft_execute
 #   define FFT_DIR_FORWARD      LIQUID_FFT_FORWARD
@@ -978,6 +1233,19 @@ void liquid_firdes_farcsech_freqresponse(unsigned int _k,
                                          float        _beta,
                                          float *      _H);
 
+// lpc : linear prediction
+
+// compute auto-correlation of real signal for lags [0,_p], using
+// real-input transforms when cheaper than computing directly
+//  _x      :   input signal [size: _n x 1]
+//  _n      :   input signal length
+//  _p      :   maximum lag, _p <= _n
+//  _r      :   auto-correlation array [size: _p+1 x 1]
+void liquid_lpc_autocorr(float *      _x,
+                         unsigned int _n,
+                         unsigned int _p,
+                         float *      _r);
+
 // iirdes : infinite impulse response filter design
 
 // Sorts array _z of complex numbers into complex conjugate pairs to
@@ -1357,6 +1625,31 @@ void MODEM(_demodulate_soft_table)(MODEM()         _q,          \
                                    unsigned int *  _sym_out,    \
                                    unsigned char * _soft_bits); \
                                                                 \
+/* max-log soft demodulation of Gray-coded amplitude axis   */  \
+void MODEM(_demodsoft_pam)(T              _v,                   \
+                           unsigned int   _m,                   \
+                           T              _alpha,               \
+                           T              _gamma,               \
+                           unsigned int * _s,                   \
+                           T *            _llr);                \
+                                                                \
+/* block max-log soft demodulation routines                 */  \
+void MODEM(_demodsoft_block_qam)(MODEM()        _q,             \
+                                 TC *           _x,             \
+                                 unsigned int   _n,             \
+                                 unsigned int * _s,             \
+                                 T *            _llr);          \
+void MODEM(_demodsoft_block_psk)(MODEM()        _q,             \
+                                 TC *           _x,             \
+                                 unsigned int   _n,             \
+                                 unsigned int * _s,             \
+                                 T *            _llr);          \
+void MODEM(_demodsoft_block_search)(MODEM()        _q,          \
+                                    TC *           _x,          \
+                                    unsigned int   _n,          \
+                                    unsigned int * _s,          \
+                                    T *            _llr);       \
+                                                                \
 /* Demodulate a linear symbol constellation using dynamic   */  \
 /* threshold calculation                                    */  \
 /*  _v      :   input value             */                      \
@@ -1492,6 +1785,14 @@ void ofdmframesync_estimate_gain_S1(ofdmframesync _q,
                                     float complex * _x,
                                     float complex * _G);
 
+// get/set complex subcarrier gain estimate
+//  _q      :   ofdmframesync object
+//  _G      :   gain array [size: M x 1]
+void ofdmframesync_get_eqgain(ofdmframesync   _q,
+                              float complex * _G);
+void ofdmframesync_set_eqgain(ofdmframesync   _q,
+                              float complex * _G);
+
 // estimate complex equalizer gain from G0 and G1
 //  _q      :   ofdmframesync object
 //  _ntaps  :   number of time-domain taps for smoothing
@@ -1522,6 +1823,19 @@ void NCO(_constrain_frequency)(NCO() _q);                       \
 /* compute trigonometric functions for nco/vco type     */      \
 void NCO(_compute_sincos_nco)(NCO() _q);                        \
 void NCO(_compute_sincos_vco)(NCO() _q);                        \
+void NCO(_compute_sincos_hires)(NCO() _q);                      \
+                                                                \
+/* convert angle to/from 32-bit phase accumulator units */      \
+uint32_t NCO(_angle_to_phase)(T _theta);                        \
+T        NCO(_phase_to_angle)(uint32_t _theta);                 \
+                                                                \
+/* rotate block by oscillator phase, stepping once per  */      \
+/* sample; _down selects rotation direction             */      \
+void NCO(_mix_block)(NCO()        _q,                           \
+                     TC *         _x,                           \
+                     TC *         _y,                           \
+                     unsigned int _n,                           \
+                     int          _down);                       \
                                                                 \
 /* reset internal phase-locked loop filter              */      \
 void NCO(_pll_reset)(NCO() _q);                                 \
@@ -1700,6 +2014,10 @@ void optim_sort(float *_v,
 
 #define randf_inline() ((float) rand() / (float) RAND_MAX)
 
+// draw seed for randgen object from global rand() state, so that objects
+// owning a generator remain reproducible under srand()
+uint64_t liquid_randgen_seed_rand();
+
 float complex icrandnf();
 
 // generate x ~ Gamma(delta,1)
@@ -1806,5 +2124,104 @@ extern unsigned int liquid_c_leading_zeros[256];
 
 // byte reversal and manipulation
 extern const unsigned char liquid_reverse_byte_gentab[256];
+
+// fixed pool of worker threads for data-parallel block processing; the
+// calling thread acts as worker 0 so a pool of n workers runs n-1
+// helper threads (none if pthreads are unavailable)
+typedef struct liquid_workers_s * liquid_workers;
+
+// task callback: process items [_start,_end) on worker _worker
+typedef void (*liquid_workers_task)(void *       _context,
+                                    unsigned int _worker,
+                                    unsigned int _start,
+                                    unsigned int _end);
+
+// create worker pool
+//  _num_workers    :   number of workers (including calling thread), > 0
+liquid_workers liquid_workers_create(unsigned int _num_workers);
+
+// destroy worker pool, joining all helper threads
+void liquid_workers_destroy(liquid_workers _q);
+
+// get number of workers in pool (1 if _q is NULL)
+unsigned int liquid_workers_get_num_workers(liquid_workers _q);
+
+// run task on [0,_n) split into contiguous ranges, one per worker
+// (worker w receives items [w*_n/W, (w+1)*_n/W)), returning once all
+// workers are finished; a NULL pool runs the task on the calling thread
+void liquid_workers_run(liquid_workers      _q,
+                        liquid_workers_task _task,
+                        void *              _context,
+                        unsigned int        _n);
+
+//
+// MODULE : vector
+//
+
+// SIMD vector kernels (x86 only, see vector_simd.c); operate on arrays
+// of floats with complex arrays as interleaved (real, imaginary) pairs
+// and _n counting complex elements in the complex ('c') kernels
+#define LIQUID_VECTOR_SIMD_DEFINE_INTERNAL_API(VSIMD)               \
+void  VSIMD(_add)        (float * _x, float * _y, unsigned int _n,  \
+                          float * _z);                              \
+void  VSIMD(_addscalar)  (float * _x, unsigned int _n, float _v,    \
+                          float * _y);                              \
+void  VSIMD(_caddscalar) (float * _x, unsigned int _n, float _vr,   \
+                          float _vi, float * _y);                   \
+void  VSIMD(_mul)        (float * _x, float * _y, unsigned int _n,  \
+                          float * _z);                              \
+void  VSIMD(_mulscalar)  (float * _x, unsigned int _n, float _v,    \
+                          float * _y);                              \
+void  VSIMD(_cmul)       (float * _x, float * _y, unsigned int _n,  \
+                          float * _z);                              \
+void  VSIMD(_cmulscalar) (float * _x, unsigned int _n, float _vr,   \
+                          float _vi, float * _y);                   \
+float VSIMD(_sumsq)      (float * _x, unsigned int _n);             \
+void  VSIMD(_abs)        (float * _x, unsigned int _n, float * _y); \
+void  VSIMD(_cabs)       (float * _x, unsigned int _n, float * _y); \
+void  VSIMD(_cabs2)      (float * _x, unsigned int _n, float * _y); \
+void  VSIMD(_cexpj)      (float * _theta, unsigned int _n,          \
+                          float * _x);                              \
+void  VSIMD(_carg)       (float * _x, unsigned int _n,              \
+                          float * _theta);                          \
+
+#define LIQUID_VECTOR_SSE(name)     LIQUID_CONCAT(liquid_vector_sse,   name)
+#define LIQUID_VECTOR_AVX2(name)    LIQUID_CONCAT(liquid_vector_avx2,  name)
+#define LIQUID_VECTOR_AVX512(name)  LIQUID_CONCAT(liquid_vector_avx512,name)
+
+LIQUID_VECTOR_SIMD_DEFINE_INTERNAL_API(LIQUID_VECTOR_SSE)
+LIQUID_VECTOR_SIMD_DEFINE_INTERNAL_API(LIQUID_VECTOR_AVX2)
+LIQUID_VECTOR_SIMD_DEFINE_INTERNAL_API(LIQUID_VECTOR_AVX512)
+
+// run a bank of LIQUID_VECTOR_SOSBANK_LANES independent second-order
+// sections (transposed direct form II, b2 = 0) over a block of samples
+// with _nc interleaved real-valued channels (1, or 2 for complex
+// samples); lane k filters channel k % _nc with
+//   H_k(z) = (b0[k] + b1[k] z^-1) / (1 + a1[k] z^-1 + a2[k] z^-2)
+// and the outputs of all lanes of a channel are added to _y
+//  _h      : coefficients {b0, b1, a1, a2} [size: 4*LANES x 1]
+//  _w1     : state [size: LANES x 1]
+//  _w2     : state [size: LANES x 1]
+//  _nc     : number of channels (1 or 2)
+//  _x      : input [size: _nc*_n x 1]
+//  _n      : number of samples in each channel
+//  _y      : output accumulator [size: _nc*_n x 1]
+#define LIQUID_VECTOR_SOSBANK_LANES (8)
+#define LIQUID_VECTOR_SOSBANK_DEFINE_INTERNAL_API(VECTOR)           \
+void VECTOR(_sosbank)(float *      _h,                              \
+                      float *      _w1,                             \
+                      float *      _w2,                             \
+                      unsigned int _nc,                             \
+                      float *      _x,                              \
+                      unsigned int _n,                              \
+                      float *      _y);                             \
+
+#define LIQUID_VECTOR_PORT_MANGLE_RF(name) LIQUID_CONCAT(liquid_vectorf_port,name)
+
+LIQUID_VECTOR_SOSBANK_DEFINE_INTERNAL_API(LIQUID_VECTOR_MANGLE_RF)
+LIQUID_VECTOR_SOSBANK_DEFINE_INTERNAL_API(LIQUID_VECTOR_PORT_MANGLE_RF)
+LIQUID_VECTOR_SOSBANK_DEFINE_INTERNAL_API(LIQUID_VECTOR_SSE)
+LIQUID_VECTOR_SOSBANK_DEFINE_INTERNAL_API(LIQUID_VECTOR_AVX2)
+
 #endif // __LIQUID_INTERNAL_H__
 
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Golay(24,12) encoding, syndrome and syndrome-to-error table generator
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+// print _n values, _w hex digits each, _k per line, closing with _end
+void print_values(unsigned int * _v,
+                  unsigned int   _n,
+                  unsigned int   _w,
+                  unsigned int   _k,
+                  const char *   _end)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        printf("0x%.*x", _w, _v[i]);
+        if (i != _n-1)
+            printf(", ");
+        else
+            printf("%s\n", _end);
+
+        if ( ((i+1)%_k) == 0 && i != _n-1)
+            printf("\n    ");
+    }
+}
+
+int main()
+{
+    unsigned int i;
+    unsigned int j;
+    unsigned int v[4096];
+
+    // parity bits of 12-bit message by low byte and high nibble
+    printf("unsigned short int golay2412_enc_gentab_lo[256] = {\n    ");
+    for (i=0; i<256; i++)
+        v[i] = fec_golay2412_encode_symbol(i) >> 12;
+    print_values(v, 256, 4, 8, "};\n");
+
+    printf("unsigned short int golay2412_enc_gentab_hi[16] = {\n    ");
+    for (i=0; i<16; i++)
+        v[i] = fec_golay2412_encode_symbol(i << 8) >> 12;
+    print_values(v, 16, 4, 8, "};\n");
+
+    // syndrome contribution of each byte of 24-bit symbol
+    printf("unsigned short int golay2412_syn_gentab[3][256] = {\n");
+    for (j=0; j<3; j++) {
+        printf("  {\n    ");
+        for (i=0; i<256; i++)
+            v[i] = golay2412_matrix_mul(i << (8*j), golay2412_H, 12);
+        print_values(v, 256, 4, 8, j < 2 ? "}," : "}");
+    }
+    printf("};\n\n");
+
+    // Error pattern on message bits for each syndrome: since H = [I P'],
+    // the received symbol [s 0] has syndrome s, and its decoded message
+    // is exactly the estimated error on the message bits.
+    printf("unsigned short int golay2412_err_gentab[4096] = {\n    ");
+    for (i=0; i<4096; i++)
+        v[i] = fec_golay2412_decode_symbol(i << 12);
+    print_values(v, 4096, 4, 8, "};");
+
+    return 0;
+}
@@ -21,7 +21,7 @@
  */
 
 //
-// 2/3-rate (12,8) Hamming code encoding table generator
+// 2/3-rate (12,8) Hamming code encoding/decoding table generator
 //
 
 #include <stdio.h>
@@ -50,6 +50,24 @@ int main()
         if ( ((i+1)%8) == 0)
             printf("\n    ");
     }
+    printf("\n\n");
+
+    printf("unsigned char hamming128_dec_gentab[4096] = {\n    ");
+
+    for (i=0; i<4096; i++) {
+        // decode symbol
+        c = fec_hamming128_decode_symbol(i);
+
+        // print result
+        printf("0x%.2x", c);
+        if (i != 4095)
+            printf(", ");
+        else
+            printf("};");
+
+        if ( ((i+1)%16) == 0)
+            printf("\n    ");
+    }
     printf("\n");
 
     return 0;
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// SEC-DED (22,16), (39,32), (72,64) parity and syndrome-to-error table
+// generator
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// print _n byte values, 16 per line, closing with _end
+void print_values(unsigned char * _v,
+                  unsigned int    _n,
+                  const char *    _end)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        printf("0x%.2x", _v[i]);
+        if (i != _n-1)
+            printf(", ");
+        else
+            printf("%s\n", _end);
+
+        if ( ((i+1)%16) == 0 && i != _n-1)
+            printf("\n    ");
+    }
+}
+
+// generate tables for one code
+//  _name       :   code name, e.g. "secded7264"
+//  _k          :   message bytes per symbol
+//  _num_parity :   number of parity bits
+//  _n          :   number of encoded bits
+//  _parity     :   parity function
+//  _syndrome_w1:   syndromes of weight-1 errors [size: _n x 1]
+void gentab(const char *    _name,
+            unsigned int    _k,
+            unsigned int    _num_parity,
+            unsigned int    _n,
+            unsigned char (*_parity)(unsigned char *),
+            unsigned char * _syndrome_w1)
+{
+    unsigned int i;
+    unsigned int j;
+    unsigned char m[8];
+    unsigned char v[256];
+
+    // parity contribution of each message byte
+    printf("unsigned char %s_enc_gentab[%u][256] = {\n", _name, _k);
+    for (j=0; j<_k; j++) {
+        printf("  {\n    ");
+        for (i=0; i<256; i++) {
+            memset(m, 0x00, sizeof(m));
+            m[j] = i;
+            v[i] = _parity(m);
+        }
+        print_values(v, 256, j < _k-1 ? "}," : "}");
+    }
+    printf("};\n\n");
+
+    // 1 + index of first weight-1 error matching each syndrome
+    memset(v, 0x00, sizeof(v));
+    for (i=0; i < (1u<<_num_parity); i++) {
+        for (j=0; j<_n; j++) {
+            if (_syndrome_w1[j] == i) {
+                v[i] = j+1;
+                break;
+            }
+        }
+    }
+    printf("unsigned char %s_err_gentab[%u] = {\n    ", _name, 1u<<_num_parity);
+    print_values(v, 1u<<_num_parity, "};\n");
+}
+
+int main()
+{
+    gentab("secded2216", 2, 6, 22, fec_secded2216_compute_parity, secded2216_syndrome_w1);
+    gentab("secded3932", 4, 7, 39, fec_secded3932_compute_parity, secded3932_syndrome_w1);
+    gentab("secded7264", 8, 8, 72, fec_secded7264_compute_parity, secded7264_syndrome_w1);
+    return 0;
+}
@@ -230,32 +230,3 @@ int main(int argc, char *argv[]) {
     printf("done.\n");
     return 0;
 }
-
-#if !LIBFEC_ENABLED
-#warning "libfec not installed; this sandbox program won't run"
-//
-// libfec is not installed; need to define internal methods used in this
-// program, even though they don't do anything
-//
-void fec_conv_encode(fec _q,
-                     unsigned int _dec_msg_len,
-                     unsigned char * _msg_dec,
-                     unsigned char * _msg_enc)
-{
-}
-
-void fec_conv_decode_soft(fec _q,
-                          unsigned int _dec_msg_len,
-                          unsigned char * _msg_enc,
-                          unsigned char * _msg_dec)
-{
-}
-
-void fec_conv_punctured_decode_soft(fec _q,
-                                    unsigned int _dec_msg_len,
-                                    unsigned char * _msg_enc,
-                                    unsigned char * _msg_dec)
-{
-}
-#endif
-
@@ -57,3 +57,48 @@ void benchmark_agc_crcf(struct rusage *     _start,
     agc_crcf_destroy(q);
 }
 
+// helper function for block execution
+//  _decim  :   samples per gain update
+void agc_crcf_block_bench(struct rusage *     _start,
+                          struct rusage *     _finish,
+                          unsigned long int * _num_iterations,
+                          unsigned int        _decim)
+{
+    unsigned long int i;
+
+    // initialize AGC object
+    agc_crcf q = agc_crcf_create();
+    agc_crcf_set_bandwidth(q,0.05f);
+    agc_crcf_set_decim(q,_decim);
+
+    // normalize number of iterations
+    unsigned int n = 256;
+    *_num_iterations /= n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float complex x[n];     // input samples
+    float complex y[n];     // output samples
+    for (i=0; i<n; i++)
+        x[i] = 1e-3f*(randnf() + _Complex_I*randnf());
+
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        agc_crcf_execute_block(q, x, n, y);
+    getrusage(RUSAGE_SELF, _finish);
+
+    *_num_iterations *= n;
+
+    // destroy object
+    agc_crcf_destroy(q);
+}
+
+#define AGC_CRCF_BLOCK_BENCHMARK_API(DECIM) \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ agc_crcf_block_bench(_start, _finish, _num_iterations, DECIM); }
+
+void benchmark_agc_crcf_block_decim1    AGC_CRCF_BLOCK_BENCHMARK_API(1)
+void benchmark_agc_crcf_block_decim4    AGC_CRCF_BLOCK_BENCHMARK_API(4)
+void benchmark_agc_crcf_block_decim16   AGC_CRCF_BLOCK_BENCHMARK_API(16)
+void benchmark_agc_crcf_block_decim64   AGC_CRCF_BLOCK_BENCHMARK_API(64)
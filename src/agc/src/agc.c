@@ -45,17 +45,31 @@ struct AGC(_s) {
     // signal level estimate
     T y2_prime;     // filtered output signal energy estimate
 
+    // decimated gain update (block execution)
+    unsigned int decim;         // samples per gain update
+    T alpha_decim;              // feed-back gain per update
+    unsigned int decim_index;   // samples since last update
+    T y2_sum;                   // output energy since last update
+
     // AGC locked flag
     int is_locked;
 };
 
+//
+// internal methods
+//
+
+// update gain from output energy accumulated over decimated block
+void AGC(_update_decim)(AGC() _q);
+
 // create agc object
 AGC() AGC(_create)(void)
 {
     // create object and initialize to default parameters
     AGC() _q = (AGC()) malloc(sizeof(struct AGC(_s)));
 
-    // initialize bandwidth
+    // initialize bandwidth, update gain every sample
+    _q->decim = 1;
     AGC(_set_bandwidth)(_q, AGC_DEFAULT_BW);
 
     // reset object
@@ -87,6 +101,10 @@ void AGC(_reset)(AGC() _q)
     // reset signal level estimate
     _q->y2_prime = 1.0f;
 
+    // reset decimated energy accumulation
+    _q->decim_index = 0;
+    _q->y2_sum      = 0.0f;
+
     // unlock gain control
     AGC(_unlock)(_q);
 }
@@ -132,8 +150,33 @@ void AGC(_execute_block)(AGC()        _q,
                          TC *         _y)
 {
     unsigned int i;
-    for (i=0; i<_n; i++)
-        AGC(_execute)(_q, _x[i], &_y[i]);
+    if (_q->decim == 1) {
+        // update gain on every sample
+        for (i=0; i<_n; i++)
+            AGC(_execute)(_q, _x[i], &_y[i]);
+        return;
+    }
+
+    // apply constant gain to each group of 'decim' samples (carried
+    // across calls), accumulating output energy for the gain update
+    for (i=0; i<_n; ) {
+        unsigned int k = _q->decim - _q->decim_index;
+        if (k > _n - i)
+            k = _n - i;
+
+#if TC_COMPLEX
+        liquid_vectorf_mulscalar((T*)&_x[i], 2*k, _q->g, (T*)&_y[i]);
+        _q->y2_sum += liquid_sumsqcf(&_y[i], k);
+#else
+        liquid_vectorf_mulscalar(&_x[i], k, _q->g, &_y[i]);
+        _q->y2_sum += liquid_sumsqf(&_y[i], k);
+#endif
+        _q->decim_index += k;
+        i += k;
+
+        if (_q->decim_index == _q->decim)
+            AGC(_update_decim)(_q);
+    }
 }
 
 // lock agc
@@ -174,6 +217,36 @@ void AGC(_set_bandwidth)(AGC() _q,
 
     // compute filter coefficient based on bandwidth
     _q->alpha = _q->bandwidth;
+
+    // equivalent coefficient for decimated update: response of
+    // per-sample filter to constant energy over 'decim' samples
+    _q->alpha_decim = 1.0f - powf(1.0f - _q->alpha, (float)_q->decim);
+}
+
+// get gain update rate for block execution
+unsigned int AGC(_get_decim)(AGC() _q)
+{
+    return _q->decim;
+}
+
+// set gain update rate for block execution
+//  _q      :   agc object
+//  _decim  :   number of samples per gain update, _decim > 0
+void AGC(_set_decim)(AGC()        _q,
+                     unsigned int _decim)
+{
+    if (_decim == 0) {
+        fprintf(stderr,"error: agc_%s_set_decim(), decimation rate must be greater than zero\n", EXTENSION_FULL);
+        exit(-1);
+    }
+
+    // set rate, discarding any partial accumulation
+    _q->decim       = _decim;
+    _q->decim_index = 0;
+    _q->y2_sum      = 0.0f;
+
+    // update filter coefficients
+    AGC(_set_bandwidth)(_q, _q->bandwidth);
 }
 
 // get estimated signal level (linear)
@@ -255,11 +328,11 @@ void AGC(_init)(AGC()        _q,
     }
 
     // compute sum squares on input
-    // TODO: use vector methods for this
-    unsigned int i;
-    T x2 = 0;
-    for (i=0; i<_n; i++)
-        x2 += crealf( _x[i]*conjf(_x[i]) );
+#if TC_COMPLEX
+    T x2 = liquid_sumsqcf(_x, _n);
+#else
+    T x2 = liquid_sumsqf(_x, _n);
+#endif
 
     // compute RMS level and ensure result is positive
     x2 = sqrtf( x2 / (float) _n ) + 1e-16f;
@@ -268,3 +341,31 @@ void AGC(_init)(AGC()        _q,
     AGC(_set_signal_level)(_q, x2);
 }
 
+//
+// internal methods
+//
+
+// update gain from output energy accumulated over decimated block
+void AGC(_update_decim)(AGC() _q)
+{
+    // smooth average energy estimate
+    T y2 = _q->y2_sum / (float)_q->decim;
+    _q->y2_prime = (1.0f-_q->alpha_decim)*_q->y2_prime + _q->alpha_decim*y2;
+
+    // reset accumulation
+    _q->decim_index = 0;
+    _q->y2_sum      = 0.0f;
+
+    // return if locked
+    if (_q->is_locked)
+        return;
+
+    // update gain according to output energy, one transcendental
+    // evaluation per block
+    if (_q->y2_prime > 1e-6f)
+        _q->g *= expf( -0.5f*_q->alpha_decim*logf(_q->y2_prime) );
+
+    // clamp to 120 dB gain
+    if (_q->g > 1e6f)
+        _q->g = 1e6f;
+}
@@ -170,3 +170,94 @@ void autotest_agc_crcf_rssi_noise()
 
 
 
+
+// 
+// Test RSSI on noise input with decimated block execution
+//
+void autotest_agc_crcf_rssi_noise_block()
+{
+    // set paramaters
+    float gamma = -30.0f;   // nominal signal level [dB]
+    float bt    =  0.01f;   // agc bandwidth
+    float tol   =  0.2f;    // error tolerance [dB]
+    unsigned int decim = 16;// samples per gain update
+
+    // signal properties
+    float nstd = powf(10.0f, gamma/20);
+
+    // create AGC object and initialize
+    agc_crcf q = agc_crcf_create();
+    agc_crcf_set_bandwidth(q, bt);
+    agc_crcf_set_decim(q, decim);
+    CONTEND_EQUALITY( agc_crcf_get_decim(q), decim );
+
+    unsigned int i;
+    float complex x[3000], y[3000];
+    for (i=0; i<3000; i++)
+        x[i] = nstd*(randnf() + _Complex_I*randnf())*M_SQRT1_2;
+
+    // execute agc
+    agc_crcf_execute_block(q, x, 3000, y);
+
+    // get received signal strength indication
+    float rssi = agc_crcf_get_rssi(q);
+
+    if (liquid_autotest_verbose)
+        printf("gamma : %12.8f, rssi : %12.8f\n", gamma, rssi);
+
+    // Check results
+    CONTEND_DELTA( rssi, gamma, tol );
+
+    // destroy agc object
+    agc_crcf_destroy(q);
+}
+
+// 
+// Test decimated block execution is independent of block size and
+// converges like per-sample execution
+//
+void autotest_agc_crcf_block_decim()
+{
+    // set paramaters
+    float gamma = 0.1f;         // nominal signal level
+    float bt    = 0.02f;        // agc bandwidth
+    float dphi  = 0.1f;         // signal frequency
+    unsigned int n = 1000;      // number of samples
+
+    agc_crcf q0 = agc_crcf_create();    // per-sample execution
+    agc_crcf q1 = agc_crcf_create();    // decimated block, one call
+    agc_crcf q2 = agc_crcf_create();    // decimated block, varying sizes
+    agc_crcf_set_bandwidth(q0, bt);
+    agc_crcf_set_bandwidth(q1, bt);
+    agc_crcf_set_bandwidth(q2, bt);
+    agc_crcf_set_decim(q1, 8);
+    agc_crcf_set_decim(q2, 8);
+
+    unsigned int i;
+    float complex x[n], y0[n], y1[n], y2[n];
+    for (i=0; i<n; i++)
+        x[i] = gamma * cexpf(_Complex_I*dphi*i);
+
+    for (i=0; i<n; i++)
+        agc_crcf_execute(q0, x[i], &y0[i]);
+    agc_crcf_execute_block(q1, x, n, y1);
+    unsigned int k, b = 1;
+    for (i=0; i<n; i+=k, b=(b*5+3)%23) {
+        k = b < n-i ? b : n-i;
+        agc_crcf_execute_block(q2, &x[i], k, &y2[i]);
+    }
+
+    // outputs match regardless of block size (up to order of summation
+    // in energy accumulation)
+    for (i=0; i<n; i++)
+        CONTEND_DELTA( cabsf(y1[i] - y2[i]), 0.0f, 1e-5f );
+
+    // gain and output settle as with per-sample execution
+    CONTEND_DELTA( agc_crcf_get_gain(q1), agc_crcf_get_gain(q0), 0.01f/gamma );
+    CONTEND_DELTA( cabsf(y1[n-1]), cabsf(y0[n-1]), 0.01f );
+
+    agc_crcf_destroy(q0);
+    agc_crcf_destroy(q1);
+    agc_crcf_destroy(q2);
+}
+
@@ -20,27 +20,83 @@
  * THE SOFTWARE.
  */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
-#define WINDOW_PUSH_BENCH_API(N)        \
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#  define WINDOW_PUSH_TIMER()    ((unsigned long int)__rdtsc())
+#  define WINDOW_PUSH_UNITS      "cycles"
+#else
+static unsigned long int window_push_timer_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long int)t.tv_sec*1000000000UL + t.tv_nsec;
+}
+#  define WINDOW_PUSH_TIMER()    window_push_timer_ns()
+#  define WINDOW_PUSH_UNITS      "ns"
+#endif
+
+#define WINDOW_PUSH_BENCH_API(N,MODE)   \
 (   struct rusage *_start,              \
     struct rusage *_finish,             \
     unsigned long int *_num_iterations) \
-{ window_push_bench(_start, _finish, _num_iterations, N); }
+{   static int latency_done = 0;        \
+    window_push_bench(_start, _finish, _num_iterations, N, MODE, &latency_done); }
+
+static int window_push_compare(const void * _a, const void * _b)
+{
+    unsigned long int a = *(const unsigned long int*)_a;
+    unsigned long int b = *(const unsigned long int*)_b;
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+// measure and print distribution of time to push a single sample; the
+// timer overhead is included and equal for all memory layouts
+void window_push_latency(windowcf _w)
+{
+    unsigned int num_samples = 1<<16;
+    unsigned long int * t = (unsigned long int*) malloc(num_samples*sizeof(unsigned long int));
+    unsigned int i;
+    for (i=0; i<num_samples; i++) {
+        unsigned long int t0 = WINDOW_PUSH_TIMER();
+        windowcf_push(_w, 1.0f);
+        t[i] = WINDOW_PUSH_TIMER() - t0;
+    }
+    qsort(t, num_samples, sizeof(unsigned long int), window_push_compare);
+    printf("    push latency [%s] : p50 %6lu, p99 %6lu, p99.9 %6lu, max %6lu\n",
+            WINDOW_PUSH_UNITS,
+            t[num_samples/2],
+            t[num_samples - num_samples/100],
+            t[num_samples - num_samples/1000],
+            t[num_samples-1]);
+    free(t);
+}
 
 // Helper function to keep code base small
 void window_push_bench(struct rusage *_start,
                        struct rusage *_finish,
                        unsigned long int *_num_iterations,
-                       unsigned int _n)
+                       unsigned int _n,
+                       liquid_window_mode _mode,
+                       int * _latency_done)
 {
     // normalize number of iterations
     *_num_iterations *= 8;
     if (*_num_iterations < 1) *_num_iterations = 1;
 
     // initialize port
-    windowcf w = windowcf_create(_n);
+    windowcf w = windowcf_create_mode(_n, _mode);
+
+    // report tail latency once per configuration
+    if (!*_latency_done) {
+        window_push_latency(w);
+        *_latency_done = 1;
+    }
 
     unsigned long int i;
 
@@ -59,10 +115,23 @@ void window_push_bench(struct rusage *_start,
     windowcf_destroy(w);
 }
 
-// 
-void benchmark_windowcf_push_n16     WINDOW_PUSH_BENCH_API(16)
-void benchmark_windowcf_push_n32     WINDOW_PUSH_BENCH_API(32)
-void benchmark_windowcf_push_n64     WINDOW_PUSH_BENCH_API(64)
-void benchmark_windowcf_push_n128    WINDOW_PUSH_BENCH_API(128)
-void benchmark_windowcf_push_n256    WINDOW_PUSH_BENCH_API(256)
+// linear buffer (periodic memmove)
+void benchmark_windowcf_push_n16     WINDOW_PUSH_BENCH_API(16,  LIQUID_WINDOW_MODE_LINEAR)
+void benchmark_windowcf_push_n32     WINDOW_PUSH_BENCH_API(32,  LIQUID_WINDOW_MODE_LINEAR)
+void benchmark_windowcf_push_n64     WINDOW_PUSH_BENCH_API(64,  LIQUID_WINDOW_MODE_LINEAR)
+void benchmark_windowcf_push_n128    WINDOW_PUSH_BENCH_API(128, LIQUID_WINDOW_MODE_LINEAR)
+void benchmark_windowcf_push_n256    WINDOW_PUSH_BENCH_API(256, LIQUID_WINDOW_MODE_LINEAR)
+void benchmark_windowcf_push_n1024   WINDOW_PUSH_BENCH_API(1024,LIQUID_WINDOW_MODE_LINEAR)
+
+// ring with mirrored writes
+void benchmark_windowcf_push_mirror_n16     WINDOW_PUSH_BENCH_API(16,  LIQUID_WINDOW_MODE_MIRROR)
+void benchmark_windowcf_push_mirror_n64     WINDOW_PUSH_BENCH_API(64,  LIQUID_WINDOW_MODE_MIRROR)
+void benchmark_windowcf_push_mirror_n256    WINDOW_PUSH_BENCH_API(256, LIQUID_WINDOW_MODE_MIRROR)
+void benchmark_windowcf_push_mirror_n1024   WINDOW_PUSH_BENCH_API(1024,LIQUID_WINDOW_MODE_MIRROR)
+
+// double-mapped virtual memory ring
+void benchmark_windowcf_push_vmring_n16     WINDOW_PUSH_BENCH_API(16,  LIQUID_WINDOW_MODE_VMRING)
+void benchmark_windowcf_push_vmring_n64     WINDOW_PUSH_BENCH_API(64,  LIQUID_WINDOW_MODE_VMRING)
+void benchmark_windowcf_push_vmring_n256    WINDOW_PUSH_BENCH_API(256, LIQUID_WINDOW_MODE_VMRING)
+void benchmark_windowcf_push_vmring_n1024   WINDOW_PUSH_BENCH_API(1024,LIQUID_WINDOW_MODE_VMRING)
 
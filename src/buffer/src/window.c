@@ -39,16 +39,38 @@ struct WINDOW(_s) {
     unsigned int num_allocated; // number of elements allocated
                                 // in memory
     unsigned int read_index;
+    liquid_window_mode mode;    // memory layout
 };
 
 // create window buffer object of length _n
 WINDOW() WINDOW(_create)(unsigned int _n)
+{
+    return WINDOW(_create_mode)(_n, liquid_window_get_default_mode());
+}
+
+// create window buffer object with specific memory layout
+//  _n      : window length, _n > 0
+//  _mode   : memory layout
+//
+//  LIQUID_WINDOW_MODE_LINEAR : values are appended to a linear array of
+//      n+len-1 elements; when the read index wraps around, the most recent
+//      len-1 values are moved to the beginning of the array.
+//  LIQUID_WINDOW_MODE_MIRROR : same array, treated as a ring of n elements;
+//      values stored in the first len-1 elements are also written n
+//      elements later so the window is always contiguous.
+//  LIQUID_WINDOW_MODE_VMRING : ring of at least one page mapped twice
+//      into consecutive virtual memory; each value is written once.
+WINDOW() WINDOW(_create_mode)(unsigned int       _n,
+                              liquid_window_mode _mode)
 {
     // validate input
     if (_n == 0) {
         fprintf(stderr,"error: window%s_create(), window size must be greater than zero\n",
                 EXTENSION);
         exit(1);
+    } else if (_mode > LIQUID_WINDOW_MODE_VMRING) {
+        fprintf(stderr,"error: window%s_create_mode(), invalid mode\n", EXTENSION);
+        exit(1);
     }
 
     // create initial object
@@ -58,13 +80,32 @@ WINDOW() WINDOW(_create)(unsigned int _n)
     q->len  = _n;                   // nominal window size
     q->m    = liquid_msb_index(_n); // effectively floor(log2(len))+1
     q->n    = 1<<(q->m);            // 2^m
+    q->mode = _mode;
+    q->v    = NULL;
+
+    if (q->mode == LIQUID_WINDOW_MODE_VMRING) {
+        // ring size must be a multiple of the page size
+        unsigned int page_len = liquid_vmring_get_page_size() / sizeof(T);
+        if (q->n < page_len)
+            q->n = page_len;
+        q->v = (T*) liquid_vmring_create(q->n*sizeof(T));
+        q->num_allocated = q->n;
+
+        // fall back to mirrored writes if not available
+        if (q->v == NULL) {
+            q->mode = LIQUID_WINDOW_MODE_MIRROR;
+            q->n    = 1<<(q->m);
+        }
+    }
     q->mask = q->n - 1;             // bit mask
 
-    // number of elements to allocate to memory
-    q->num_allocated = q->n + q->len - 1;
+    if (q->v == NULL) {
+        // number of elements to allocate to memory
+        q->num_allocated = q->n + q->len - 1;
 
-    // allocte memory
-    q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+        // allocte memory
+        q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+    }
     q->read_index = 0;
 
     // reset window
@@ -84,8 +125,8 @@ WINDOW() WINDOW(_recreate)(WINDOW() _q, unsigned int _n)
     if (_n == _q->len)
         return _q;
 
-    // create new window
-    WINDOW() w = WINDOW(_create)(_n);
+    // create new window with same memory layout
+    WINDOW() w = WINDOW(_create_mode)(_n, _q->mode);
 
     // copy old values
     T* r;
@@ -114,7 +155,10 @@ WINDOW() WINDOW(_recreate)(WINDOW() _q, unsigned int _n)
 void WINDOW(_destroy)(WINDOW() _q)
 {
     // free internal memory array
-    free(_q->v);
+    if (_q->mode == LIQUID_WINDOW_MODE_VMRING)
+        liquid_vmring_destroy(_q->v, _q->n*sizeof(T));
+    else
+        free(_q->v);
 
     // free main object memory
     free(_q);
@@ -150,7 +194,7 @@ void WINDOW(_debug_print)(WINDOW() _q)
     }
     printf("----------------------------------\n");
 
-    // print excess window memory
+    // print excess window memory (ring is mapped twice in vmring mode)
     for (i=_q->len; i<_q->num_allocated; i++) {
         BUFFER_PRINT_LINE(_q,i)
         printf("\n");
@@ -194,6 +238,12 @@ void WINDOW(_index)(WINDOW()     _q,
     *_v = _q->v[_q->read_index + _i];
 }
 
+// get memory layout of window object
+liquid_window_mode WINDOW(_get_mode)(WINDOW() _q)
+{
+    return _q->mode;
+}
+
 // push single element onto window buffer
 //  _q      : window object
 //  _v      : single input element
@@ -205,12 +255,26 @@ void WINDOW(_push)(WINDOW() _q, T _v)
     // wrap around pointer
     _q->read_index &= _q->mask;
 
-    // if pointer wraps around, copy excess memory
-    if (_q->read_index == 0)
-        memmove(_q->v, _q->v + _q->n, (_q->len-1)*sizeof(T));
-
-    // append value to end of buffer
-    _q->v[_q->read_index + _q->len - 1] = _v;
+    switch (_q->mode) {
+    case LIQUID_WINDOW_MODE_MIRROR: {
+        // write value into ring, mirroring the first len-1 elements
+        unsigned int k = (_q->read_index + _q->len - 1) & _q->mask;
+        _q->v[k] = _v;
+        if (k < _q->len - 1)
+            _q->v[k + _q->n] = _v;
+        } break;
+    case LIQUID_WINDOW_MODE_VMRING:
+        // virtual memory mapping mirrors the ring
+        _q->v[(_q->read_index + _q->len - 1) & _q->mask] = _v;
+        break;
+    default:
+        // if pointer wraps around, copy excess memory
+        if (_q->read_index == 0)
+            memmove(_q->v, _q->v + _q->n, (_q->len-1)*sizeof(T));
+
+        // append value to end of buffer
+        _q->v[_q->read_index + _q->len - 1] = _v;
+    }
 }
 
 // write array of elements onto window buffer
@@ -221,9 +285,21 @@ void WINDOW(_write)(WINDOW()     _q,
                     T *          _v,
                     unsigned int _n)
 {
-    // TODO make this more efficient
     unsigned int i;
-    for (i=0; i<_n; i++)
-        WINDOW(_push)(_q, _v[i]);
+    if (_n < _q->len) {
+        // push values one at a time
+        for (i=0; i<_n; i++)
+            WINDOW(_push)(_q, _v[i]);
+        return;
+    }
+
+    // only the most recent len values are retained: copy these to the
+    // beginning of the buffer and reset the read index
+    _q->read_index = 0;
+    memmove(_q->v, _v + _n - _q->len, (_q->len)*sizeof(T));
+
+    // mirror the first len-1 values
+    if (_q->mode == LIQUID_WINDOW_MODE_MIRROR)
+        memmove(_q->v + _q->n, _q->v, (_q->len-1)*sizeof(T));
 }
 
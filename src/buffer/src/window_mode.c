@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2007 - 2016 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Window buffer memory layouts
+//
+
+// memfd_create() is a GNU extension
+#ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_SYS_MMAN_H && HAVE_MEMFD_CREATE && HAVE_UNISTD_H
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  define LIQUID_VMRING_ENABLED 1
+#else
+#  define LIQUID_VMRING_ENABLED 0
+#endif
+
+// memory layout for window objects created with _create()
+static liquid_window_mode liquid_window_default_mode = LIQUID_WINDOW_MODE_LINEAR;
+
+// set memory layout used by window objects created with _create()
+void liquid_window_set_default_mode(liquid_window_mode _mode)
+{
+    if (_mode > LIQUID_WINDOW_MODE_VMRING) {
+        fprintf(stderr,"error: liquid_window_set_default_mode(), invalid mode\n");
+        exit(1);
+    }
+    liquid_window_default_mode = _mode;
+}
+
+// get memory layout used by window objects created with _create()
+liquid_window_mode liquid_window_get_default_mode(void)
+{
+    return liquid_window_default_mode;
+}
+
+// get host page size [bytes]
+unsigned int liquid_vmring_get_page_size(void)
+{
+#if LIQUID_VMRING_ENABLED
+    long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? (unsigned int)page_size : 4096;
+#else
+    return 4096;
+#endif
+}
+
+// allocate ring of _size bytes mapped twice into consecutive virtual
+// memory; returns NULL if not supported by the host
+void * liquid_vmring_create(unsigned int _size)
+{
+#if LIQUID_VMRING_ENABLED
+    if (_size == 0 || (_size % liquid_vmring_get_page_size()) != 0)
+        return NULL;
+
+    // anonymous shared-memory file backing the ring
+    int fd = memfd_create("liquid-vmring", MFD_CLOEXEC);
+    if (fd < 0)
+        return NULL;
+    if (ftruncate(fd, (off_t)_size) != 0) {
+        close(fd);
+        return NULL;
+    }
+
+    // reserve contiguous address space for both copies
+    unsigned char * base = (unsigned char*) mmap(NULL, 2*(size_t)_size, PROT_NONE,
+                                                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+
+    // map file onto each half of reserved space
+    void * p0 = mmap(base,       _size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void * p1 = mmap(base+_size, _size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    close(fd);
+    if (p0 != (void*)base || p1 != (void*)(base+_size)) {
+        munmap(base, 2*(size_t)_size);
+        return NULL;
+    }
+    return base;
+#else
+    return NULL;
+#endif
+}
+
+// free ring allocated with liquid_vmring_create()
+void liquid_vmring_destroy(void *       _ring,
+                           unsigned int _size)
+{
+#if LIQUID_VMRING_ENABLED
+    if (_ring != NULL)
+        munmap(_ring, 2*(size_t)_size);
+#endif
+}
+
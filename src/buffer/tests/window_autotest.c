@@ -141,3 +141,59 @@ void autotest_windowf()
     printf("done.\n");
 }
 
+
+// 
+// AUTOTEST: windowcf memory layouts against linear layout
+//
+void windowcf_mode_test(liquid_window_mode _mode,
+                        unsigned int       _n)
+{
+    windowcf w0 = windowcf_create_mode(_n, LIQUID_WINDOW_MODE_LINEAR);
+    windowcf w1 = windowcf_create_mode(_n, _mode);
+
+    // vmring falls back to mirrored writes if unavailable
+    if (_mode == LIQUID_WINDOW_MODE_VMRING) {
+        CONTEND_EXPRESSION( (windowcf_get_mode(w1) != LIQUID_WINDOW_MODE_LINEAR) );
+    } else {
+        CONTEND_EQUALITY(windowcf_get_mode(w1), _mode);
+    }
+
+    // push values (several times around ring) and compare contents
+    float complex * r0;
+    float complex * r1;
+    unsigned int i;
+    unsigned int num_samples = 4*_n + 4100;
+    for (i=0; i<num_samples; i++) {
+        float complex x = (float)i + _Complex_I*(float)(num_samples-i);
+        windowcf_push(w0, x);
+        windowcf_push(w1, x);
+
+        windowcf_read(w0, &r0);
+        windowcf_read(w1, &r1);
+        CONTEND_SAME_DATA(r0, r1, _n*sizeof(float complex));
+
+        // reset and recreate part way through
+        if (i == _n + 3) {
+            windowcf_reset(w0);
+            windowcf_reset(w1);
+        } else if (i == 2*_n + 5) {
+            // recreate to larger size and back, retaining memory layout
+            liquid_window_mode mode = windowcf_get_mode(w1);
+            w0 = windowcf_recreate(w0, _n+7);
+            w1 = windowcf_recreate(w1, _n+7);
+            CONTEND_EQUALITY(windowcf_get_mode(w1), mode);
+            w0 = windowcf_recreate(w0, _n);
+            w1 = windowcf_recreate(w1, _n);
+        }
+    }
+
+    windowcf_destroy(w0);
+    windowcf_destroy(w1);
+}
+
+void autotest_windowcf_mirror_n1()    { windowcf_mode_test(LIQUID_WINDOW_MODE_MIRROR,    1); }
+void autotest_windowcf_mirror_n13()   { windowcf_mode_test(LIQUID_WINDOW_MODE_MIRROR,   13); }
+void autotest_windowcf_mirror_n64()   { windowcf_mode_test(LIQUID_WINDOW_MODE_MIRROR,   64); }
+void autotest_windowcf_vmring_n1()    { windowcf_mode_test(LIQUID_WINDOW_MODE_VMRING,    1); }
+void autotest_windowcf_vmring_n13()   { windowcf_mode_test(LIQUID_WINDOW_MODE_VMRING,   13); }
+void autotest_windowcf_vmring_n1000() { windowcf_mode_test(LIQUID_WINDOW_MODE_VMRING, 1000); }
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2007 - 2016 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+#define CHANNEL_CCCF_BENCH_API(BLOCK,MULTIPATH,SHADOWING)   \
+(   struct rusage *_start,                                  \
+    struct rusage *_finish,                                 \
+    unsigned long int *_num_iterations)                     \
+{ channel_cccf_bench(_start, _finish, _num_iterations, BLOCK, MULTIPATH, SHADOWING); }
+
+// number of samples per call
+#define CHANNEL_CCCF_BENCH_BLOCK_LEN (1024)
+
+// Helper function to keep code base small
+void channel_cccf_bench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        int                 _block,
+                        unsigned int        _multipath_len,
+                        float               _fd)
+{
+    // create channel with carrier offset and noise, and
+    // optionally multi-path and shadowing
+    channel_cccf q = channel_cccf_create();
+    channel_cccf_add_awgn(q, -40.0f, 20.0f);
+    channel_cccf_add_carrier_offset(q, 0.01f, 0.0f);
+    if (_multipath_len > 0) channel_cccf_add_multipath(q, NULL, _multipath_len);
+    if (_fd > 0)            channel_cccf_add_shadowing(q, 1.0f, _fd);
+
+    unsigned long int i;
+    unsigned int j;
+    unsigned int n = CHANNEL_CCCF_BENCH_BLOCK_LEN;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    for (j=0; j<n; j++)
+        x[j] = 1.0f + _Complex_I*1.0f;
+
+    // each trial is one sample
+    *_num_iterations /= n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        if (_block) {
+            channel_cccf_execute_block(q, x, n, y);
+        } else {
+            for (j=0; j<n; j++)
+                channel_cccf_execute(q, x[j], &y[j]);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    channel_cccf_destroy(q);
+    free(x);
+    free(y);
+}
+
+// carrier offset and noise only
+void benchmark_channel_cccf_sample_awgn        CHANNEL_CCCF_BENCH_API(0, 0, 0.0f  )
+void benchmark_channel_cccf_block_awgn         CHANNEL_CCCF_BENCH_API(1, 0, 0.0f  )
+
+// carrier offset, noise, shadowing
+void benchmark_channel_cccf_sample_shadowing   CHANNEL_CCCF_BENCH_API(0, 0, 0.001f)
+void benchmark_channel_cccf_block_shadowing    CHANNEL_CCCF_BENCH_API(1, 0, 0.001f)
+
+// all impairments, 7-tap multi-path
+void benchmark_channel_cccf_sample_all_h7      CHANNEL_CCCF_BENCH_API(0, 7, 0.001f)
+void benchmark_channel_cccf_block_all_h7       CHANNEL_CCCF_BENCH_API(1, 7, 0.001f)
+
+// all impairments, 64-tap multi-path
+void benchmark_channel_cccf_sample_all_h64     CHANNEL_CCCF_BENCH_API(0,64, 0.001f)
+void benchmark_channel_cccf_block_all_h64      CHANNEL_CCCF_BENCH_API(1,64, 0.001f)
+
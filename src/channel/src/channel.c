@@ -29,6 +29,20 @@
 #include <stdio.h>
 #include <math.h>
 
+// number of samples processed per stage in execute_block()
+#define CHANNEL_BLOCK_LEN           (256)
+
+// maximum shadowing decimation rate
+#define CHANNEL_SHADOWING_DEC_MAX   (64)
+
+// internal methods for block processing
+void CHANNEL(_shadowing_block)(CHANNEL()    _q,
+                               TO *         _y,
+                               unsigned int _n);
+void CHANNEL(_awgn_block)(CHANNEL()    _q,
+                          TO *         _y,
+                          unsigned int _n);
+
 // portable structured channel object
 struct CHANNEL(_s) {
     // additive white Gauss noise
@@ -52,9 +66,18 @@ struct CHANNEL(_s) {
 
     // shadowing channel
     int             enabled_shadowing;  // enable shadowing?
-    IIRFILT()       shadowing_filter;   // shadowing filter object
     float           shadowing_std;      // shadowing standard deviation
     float           shadowing_fd;       // shadowing Doppler frequency
+    float           shadowing_state;    // single-pole shadowing filter state
+    unsigned int    shadowing_dec;      // block shadowing decimation rate
+    float           shadowing_pd;       // filter pole raised to decimation rate
+    float           shadowing_sd;       // filter noise std. dev. at decimation rate
+
+    // random number generator (noise, shadowing)
+    randgen         rng;
+
+    // noise buffer for block processing
+    TC *            buf;
 };
 
 // create structured channel object with default parameters
@@ -69,12 +92,14 @@ CHANNEL() CHANNEL(_create)(void)
     q->enabled_shadowing = 0;
 
     // create internal objects
-    q->nco              = NCO(_create)(LIQUID_VCO);
+    q->nco              = NCO(_create)(LIQUID_NCO_HIRES);
     q->h_len            = 1;
     q->h                = (TC*) malloc(q->h_len*sizeof(TC));
     q->h[0]             = 1.0f;
     q->channel_filter   = FIRFILT(_create)(q->h, q->h_len);
-    q->shadowing_filter = NULL;
+    q->shadowing_state  = 0.0f;
+    q->rng              = randgen_create(liquid_randgen_seed_rand());
+    q->buf              = (TC*) malloc(CHANNEL_BLOCK_LEN*sizeof(TC));
 
     // return object
     return q;
@@ -86,9 +111,9 @@ void CHANNEL(_destroy)(CHANNEL() _q)
     // destroy internal objects
     NCO(_destroy)(_q->nco);
     FIRFILT(_destroy)(_q->channel_filter);
-    if (_q->shadowing_filter != NULL)
-        IIRFILT(_destroy)(_q->shadowing_filter);
+    randgen_destroy(_q->rng);
     free(_q->h);
+    free(_q->buf);
 
     // free main object memory
     free(_q);
@@ -219,13 +244,25 @@ void CHANNEL(_add_shadowing)(CHANNEL() _q,
     _q->shadowing_std = _sigma;
     _q->shadowing_fd  = _fd;
 
-    // re-create channel filter
+    // single-pole shadowing filter, H(z) = alpha / (1 - (1-alpha) z^-1)
     // TODO: adjust gain
-    //_q->shadowing_filter = IIRFILT(_create_lowpass)(11, _q->shadowing_fd);
+    _q->shadowing_state = 0.0f;
+
+    // Block processing runs the filter at a decimated rate and
+    // interpolates the gain in between. Stepping the filter D
+    // samples at once is exact in distribution:
+    //   s[n+D] = p^D s[n] + alpha*sigma*sqrt((1-p^2D)/(1-p^2)) v
+    // with p = 1-alpha and v ~ N(0,1). The rate is kept well below
+    // the filter's correlation time so interpolation is smooth.
     float alpha = _q->shadowing_fd;
-    float a[2] = {1.0f, alpha-1.0f};
-    float b[2] = {alpha, 0};
-    _q->shadowing_filter = IIRFILT(_create)(b,2,a,2);
+    unsigned int dec = (unsigned int) floorf(1.0f / (16.0f*alpha));
+    if (dec < 1)                         dec = 1;
+    if (dec > CHANNEL_SHADOWING_DEC_MAX) dec = CHANNEL_SHADOWING_DEC_MAX;
+    float p = 1.0f - alpha;
+    _q->shadowing_dec = dec;
+    _q->shadowing_pd  = powf(p, dec);
+    _q->shadowing_sd  = alpha * _q->shadowing_std *
+                        sqrtf((1.0f - powf(p,2*dec)) / (1.0f - p*p));
 }
 
 // apply channel impairments on single input sample
@@ -248,9 +285,10 @@ void CHANNEL(_execute)(CHANNEL() _q,
     // apply shadowing if enabled
     if (_q->enabled_shadowing) {
         // TODO: use type-specific value other than float
-        float g = 0;
-        IIRFILT(_execute)(_q->shadowing_filter, randnf()*_q->shadowing_std, &g);
-        g /= _q->shadowing_fd * 6.9f;
+        float alpha = _q->shadowing_fd;
+        _q->shadowing_state = alpha * randgen_randnf(_q->rng) * _q->shadowing_std +
+                              (1.0f - alpha) * _q->shadowing_state;
+        float g = _q->shadowing_state / (_q->shadowing_fd * 6.9f);
         g = powf(10.0f, g/20.0f);
         r *= g;
     }
@@ -263,15 +301,18 @@ void CHANNEL(_execute)(CHANNEL() _q,
 
     // apply AWGN if enabled
     if (_q->enabled_awgn) {
+        float complex v;
+        randgen_crandnf(_q->rng, &v);
         r *= _q->gamma;
-        r += _q->nstd * ( randnf() + _Complex_I*randnf() ) * M_SQRT1_2;
+        r += _q->nstd * v * M_SQRT1_2;
     }
 
     // set output value
     *_y = r;
 }
 
-// apply channel impairments on single input sample
+// apply channel impairments on block of samples; the
+// input and output buffers may be the same
 //  _q      : channel object
 //  _x      : input array [size: _n x 1]
 //  _n      : input array length
@@ -281,10 +322,88 @@ void CHANNEL(_execute_block)(CHANNEL()    _q,
                              unsigned int _n,
                              TO *         _y)
 {
-    // apply channel effects on each input sample
-    // TODO: apply in blocks
+    // apply each impairment stage across a block of samples
+    // at a time, in the same order as execute()
+    unsigned int i;
+    for (i=0; i<_n; i+=CHANNEL_BLOCK_LEN) {
+        unsigned int n = _n - i < CHANNEL_BLOCK_LEN ? _n - i : CHANNEL_BLOCK_LEN;
+
+        // apply filter
+        if (_q->enabled_multipath)
+            FIRFILT(_execute_block)(_q->channel_filter, &_x[i], n, &_y[i]);
+        else if (_x != _y)
+            memmove(&_y[i], &_x[i], n*sizeof(TO));
+
+        // apply remaining impairments in place
+        if (_q->enabled_shadowing) CHANNEL(_shadowing_block)(_q, &_y[i], n);
+        if (_q->enabled_carrier)   NCO(_mix_block_up)(_q->nco, &_y[i], &_y[i], n);
+        if (_q->enabled_awgn)      CHANNEL(_awgn_block)     (_q, &_y[i], n);
+    }
+}
+
+//
+// internal methods
+//
+
+// apply shadowing to block of samples in place; the filter is
+// stepped at the decimated rate and the gain is interpolated
+// geometrically (linearly in dB) between filter outputs
+//  _q      : channel object
+//  _y      : sample array [size: _n x 1]
+//  _n      : sample array length
+void CHANNEL(_shadowing_block)(CHANNEL()    _q,
+                               TO *         _y,
+                               unsigned int _n)
+{
+    // scale from filter state to gain exponent (base 10)
+    float  scale = 1.0f / (_q->shadowing_fd * 6.9f * 20.0f);
+    float  s0    = _q->shadowing_state;
+    float  g     = powf(10.0f, s0*scale);
+    unsigned int i;
+    for (i=0; i<_n; i+=_q->shadowing_dec) {
+        unsigned int d = _n - i < _q->shadowing_dec ? _n - i : _q->shadowing_dec;
+
+        // step filter d samples at once
+        float pd = _q->shadowing_pd;
+        float sd = _q->shadowing_sd;
+        if (d != _q->shadowing_dec) {
+            float p = 1.0f - _q->shadowing_fd;
+            pd = powf(p, d);
+            sd = _q->shadowing_fd * _q->shadowing_std *
+                 sqrtf((1.0f - pd*pd) / (1.0f - p*p));
+        }
+        float s1 = pd*s0 + sd*randgen_randnf(_q->rng);
+
+        // interpolate gain across decimated interval
+        float r = powf(10.0f, (s1 - s0)*scale / (float)d);
+        unsigned int k;
+        for (k=0; k<d; k++) {
+            g *= r;
+            _y[i+k] *= g;
+        }
+        s0 = s1;
+    }
+    _q->shadowing_state = s0;
+}
+
+// apply gain and additive white Gauss noise to block of
+// samples in place
+//  _q      : channel object
+//  _y      : sample array [size: _n x 1]
+//  _n      : sample array length
+void CHANNEL(_awgn_block)(CHANNEL()    _q,
+                          TO *         _y,
+                          unsigned int _n)
+{
+    // generate noise in bulk
+    randgen_crandnf_block(_q->rng, _q->buf, _n);
+
+    float         gamma = _q->gamma;
+    float         nstd  = _q->nstd * M_SQRT1_2;
+    float *       v     = (float*)       _y;
+    const float * w     = (const float*) _q->buf;
     unsigned int i;
-    for (i=0; i<_n; i++)
-        CHANNEL(_execute)(_q, _x[i], &_y[i]);
+    for (i=0; i<2*_n; i++)
+        v[i] = gamma*v[i] + nstd*w[i];
 }
 
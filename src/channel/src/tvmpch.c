@@ -40,6 +40,10 @@ struct TVMPCH(_s) {
     float std;
     float alpha;
     float beta;
+
+    // random number generator and coefficient innovations
+    randgen rng;
+    TC * v;             // [size: h_len x 1]
 };
 
 // create time-varying multi-path channel emulator object
@@ -79,6 +83,10 @@ TVMPCH() TVMPCH(_create)(unsigned int _n,
     // create window (internal buffer)
     q->w = WINDOW(_create)(q->h_len);
 
+    // create random number generator
+    q->rng = randgen_create(liquid_randgen_seed_rand());
+    q->v   = (TC *) malloc((q->h_len)*sizeof(TC));
+
     // reset filter state (clear buffer)
     TVMPCH(_reset)(q);
 
@@ -90,6 +98,8 @@ TVMPCH() TVMPCH(_create)(unsigned int _n,
 void TVMPCH(_destroy)(TVMPCH() _q)
 {
     WINDOW(_destroy)(_q->w);
+    randgen_destroy(_q->rng);
+    free(_q->v);
     free(_q->h);
     free(_q);
 }
@@ -122,8 +132,9 @@ void TVMPCH(_push)(TVMPCH() _q,
 {
     // update coefficients
     unsigned int i;
+    randgen_crandnf_block(_q->rng, _q->v, _q->h_len-1);
     for (i=0; i<_q->h_len-1; i++)
-        _q->h[i] = _q->alpha*_q->h[i] + _q->beta*(randnf() + _Complex_I*randnf()) * _q->std * M_SQRT1_2;
+        _q->h[i] = _q->alpha*_q->h[i] + _q->beta*_q->v[i] * _q->std * M_SQRT1_2;
 
     // push sample into window buffer
     WINDOW(_push)(_q->w, _x);
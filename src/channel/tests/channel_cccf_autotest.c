@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2007 - 2016 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// run channel on block of samples, either sample-wise or in
+// blocks of (odd) length _block_len
+void channel_cccf_autotest_run(channel_cccf          _q,
+                               float complex *       _x,
+                               unsigned int          _n,
+                               float complex *       _y,
+                               unsigned int          _block_len)
+{
+    unsigned int i;
+    if (_block_len == 0) {
+        for (i=0; i<_n; i++)
+            channel_cccf_execute(_q, _x[i], &_y[i]);
+        return;
+    }
+    for (i=0; i<_n; i+=_block_len) {
+        unsigned int n = _n - i < _block_len ? _n - i : _block_len;
+        channel_cccf_execute_block(_q, &_x[i], n, &_y[i]);
+    }
+}
+
+// multi-path and carrier offset are deterministic; block
+// output must match sample-wise output
+void autotest_channel_cccf_block_deterministic()
+{
+    unsigned int n = 4000;
+    float complex h[5] = {1.0f, 0.2f-0.1f*_Complex_I, 0, -0.05f*_Complex_I, 0.01f};
+    float complex * x  = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(n*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = cosf(0.01f*i*i) + _Complex_I*sinf(0.3f*i);
+
+    channel_cccf q0 = channel_cccf_create();
+    channel_cccf q1 = channel_cccf_create();
+    channel_cccf_add_multipath     (q0, h, 5);
+    channel_cccf_add_multipath     (q1, h, 5);
+    channel_cccf_add_carrier_offset(q0, 0.0123f, 2.0f);
+    channel_cccf_add_carrier_offset(q1, 0.0123f, 2.0f);
+
+    channel_cccf_autotest_run(q0, x, n, y0, 0);
+    channel_cccf_autotest_run(q1, x, n, y1, 301);
+
+    // retain state across calls: continue sample-wise on both
+    channel_cccf_autotest_run(q0, x, 100, y0, 0);
+    channel_cccf_autotest_run(q1, x, 100, y1, 0);
+
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA(crealf(y0[i]), crealf(y1[i]), 2e-3f);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(y1[i]), 2e-3f);
+    }
+
+    channel_cccf_destroy(q0);
+    channel_cccf_destroy(q1);
+    free(x);
+    free(y0);
+    free(y1);
+}
+
+// additive noise power and gain must match
+void autotest_channel_cccf_block_awgn()
+{
+    unsigned int n = 100000;
+    float noise_floor = -20.0f;
+    float SNRdB       =  10.0f;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = 1.0f;
+
+    float nstd  = powf(10.0f, noise_floor/20.0f);
+    float gamma = powf(10.0f, (noise_floor+SNRdB)/20.0f);
+    unsigned int b;
+    for (b=0; b<2; b++) {
+        channel_cccf q = channel_cccf_create();
+        channel_cccf_add_awgn(q, noise_floor, SNRdB);
+        channel_cccf_autotest_run(q, x, n, y, b ? 1013 : 0);
+        channel_cccf_destroy(q);
+
+        // estimate mean and variance
+        float complex m = 0;
+        for (i=0; i<n; i++) m += y[i];
+        m /= (float)n;
+        float v = 0;
+        for (i=0; i<n; i++) v += crealf((y[i]-m)*conjf(y[i]-m));
+        v /= (float)n;
+
+        if (liquid_autotest_verbose)
+            printf("  %-12s: mean=%8.5f, var=%8.6f (expected %8.6f)\n",
+                    b ? "block" : "sample-wise", crealf(m), v, nstd*nstd);
+        CONTEND_DELTA(crealf(m), gamma, 0.01f*gamma);
+        CONTEND_DELTA(cimagf(m), 0.0f,  0.01f*gamma);
+        CONTEND_DELTA(v, nstd*nstd, 0.05f*nstd*nstd);
+    }
+    free(x);
+    free(y);
+}
+
+// log-normal shadowing statistics must match; the block path
+// runs the shadowing filter at a decimated rate
+void autotest_channel_cccf_block_shadowing()
+{
+    unsigned int n = 500000;
+    float sigma = 1.0f;
+    float fd    = 0.01f;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = 1.0f;
+
+    // variance of the single-pole filter output, scaled to dB
+    float v_exp = sigma*sigma / (fd*(2.0f-fd)) / (6.9f*6.9f);
+
+    unsigned int b;
+    for (b=0; b<2; b++) {
+        channel_cccf q = channel_cccf_create();
+        channel_cccf_add_shadowing(q, sigma, fd);
+        channel_cccf_autotest_run(q, x, n, y, b ? 1013 : 0);
+        channel_cccf_destroy(q);
+
+        // gain statistics [dB]
+        double m1 = 0, m2 = 0;
+        for (i=0; i<n; i++) {
+            double g = 20*log10(crealf(y[i]));
+            m1 += g;
+            m2 += g*g;
+        }
+        m1 /= (double)n;
+        m2 = m2 / (double)n - m1*m1;
+
+        if (liquid_autotest_verbose)
+            printf("  %-12s: mean=%8.5f dB, var=%8.5f dB^2 (expected %8.5f)\n",
+                    b ? "block" : "sample-wise", m1, m2, v_exp);
+        CONTEND_DELTA(m1, 0.0f,  0.15f);
+        CONTEND_DELTA(m2, v_exp, 0.15f*v_exp);
+        CONTEND_DELTA(cimagf(y[n/2]), 0.0f, 1e-6f);
+    }
+    free(x);
+    free(y);
+}
+
@@ -20,14 +20,16 @@
  * THE SOFTWARE.
  */
 
+#include <stdio.h>
 #include <sys/resource.h>
-#include "liquid.h"
+#include "liquid.internal.h"
 
 // Helper function to keep code base small
 void dotprod_rrrf_bench(struct rusage *_start,
                         struct rusage *_finish,
                         unsigned long int *_num_iterations,
-                        unsigned int _n)
+                        unsigned int _n,
+                        liquid_simd_type _simd)
 {
     // normalize number of iterations
     *_num_iterations *= 128;
@@ -41,9 +43,24 @@ void dotprod_rrrf_bench(struct rusage *_start,
         h[i] = 1.0f;
     }
 
-    // create dotprod structure;
+    // create dotprod structure using specified SIMD type (falls
+    // back to best available if unsupported by host)
+    liquid_simd_type simd = liquid_simd_get_type();
+    liquid_simd_set_type(_simd);
     dotprod_rrrf dp = dotprod_rrrf_create(h,_n);
 
+    // report kernel actually selected (same selection as in
+    // dotprod_rrrf_create()), once for each requested type
+    static int reported[LIQUID_SIMD_NUM_TYPES] = {0};
+    if (_simd != LIQUID_SIMD_AUTO && !reported[_simd]) {
+        liquid_simd_type kernel = liquid_simd_select(_n < 16 ? LIQUID_SIMD_SSE : LIQUID_SIMD_AVX512);
+        printf("    dotprod_rrrf [%-8s] : running %s kernel\n",
+                liquid_simd_type_str[_simd][0],
+                liquid_simd_type_str[kernel][0]);
+        reported[_simd] = 1;
+    }
+    liquid_simd_set_type(simd);
+
     // start trials
     getrusage(RUSAGE_SELF, _start);
     for (i=0; i<(*_num_iterations); i++) {
@@ -63,10 +80,22 @@ void dotprod_rrrf_bench(struct rusage *_start,
 (   struct rusage *_start,              \
     struct rusage *_finish,             \
     unsigned long int *_num_iterations) \
-{ dotprod_rrrf_bench(_start, _finish, _num_iterations, N); }
+{ dotprod_rrrf_bench(_start, _finish, _num_iterations, N, LIQUID_SIMD_AUTO); }
+
+#define DOTPROD_RRRF_SIMD_BENCHMARK_API(N,SIMD)  \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ dotprod_rrrf_bench(_start, _finish, _num_iterations, N, SIMD); }
 
 void benchmark_dotprod_rrrf_4       DOTPROD_RRRF_BENCHMARK_API(4)
 void benchmark_dotprod_rrrf_16      DOTPROD_RRRF_BENCHMARK_API(16)
 void benchmark_dotprod_rrrf_64      DOTPROD_RRRF_BENCHMARK_API(64)
 void benchmark_dotprod_rrrf_256     DOTPROD_RRRF_BENCHMARK_API(256)
 
+// compare instruction set extensions side by side
+void benchmark_dotprod_rrrf_portable_256  DOTPROD_RRRF_SIMD_BENCHMARK_API(256, LIQUID_SIMD_PORTABLE)
+void benchmark_dotprod_rrrf_sse_256       DOTPROD_RRRF_SIMD_BENCHMARK_API(256, LIQUID_SIMD_SSE)
+void benchmark_dotprod_rrrf_avx2_256      DOTPROD_RRRF_SIMD_BENCHMARK_API(256, LIQUID_SIMD_AVX2)
+void benchmark_dotprod_rrrf_avx512_256    DOTPROD_RRRF_SIMD_BENCHMARK_API(256, LIQUID_SIMD_AVX512)
+
@@ -49,6 +49,10 @@
 #include <pmmintrin.h>  // SSE3
 #endif
 
+#if LIQUID_SIMD_X86_TARGETS
+#include <immintrin.h>  // AVX2, FMA, AVX-512
+#endif
+
 #define DEBUG_DOTPROD_CCCF_MMX   0
 
 // forward declaration of internal methods
@@ -60,6 +64,27 @@ void dotprod_cccf_execute_mmx4(dotprod_cccf    _q,
                                float complex * _x,
                                float complex * _y);
 
+void dotprod_cccf_execute_portable(dotprod_cccf    _q,
+                                   float complex * _x,
+                                   float complex * _y);
+
+#if LIQUID_SIMD_X86_TARGETS
+void dotprod_cccf_run_avx2(float complex * _h,
+                           float complex * _x,
+                           unsigned int    _n,
+                           float complex * _y);
+void dotprod_cccf_run_avx512(float complex * _h,
+                             float complex * _x,
+                             unsigned int    _n,
+                             float complex * _y);
+void dotprod_cccf_execute_avx2(dotprod_cccf    _q,
+                               float complex * _x,
+                               float complex * _y);
+void dotprod_cccf_execute_avx512(dotprod_cccf    _q,
+                                 float complex * _x,
+                                 float complex * _y);
+#endif
+
 // basic dot product (ordinal calculation)
 void dotprod_cccf_run(float complex * _h,
                       float complex * _x,
@@ -74,10 +99,10 @@ void dotprod_cccf_run(float complex * _h,
 }
 
 // basic dot product (ordinal calculation) with loop unrolled
-void dotprod_cccf_run4(float complex * _h,
-                       float complex * _x,
-                       unsigned int    _n,
-                       float complex * _y)
+static void dotprod_cccf_run4_portable(float complex * _h,
+                                       float complex * _x,
+                                       unsigned int    _n,
+                                       float complex * _y)
 {
     float complex r = 0;
 
@@ -100,6 +125,43 @@ void dotprod_cccf_run4(float complex * _h,
     *_y = r;
 }
 
+// wide kernel used by dotprod_cccf_run4() for long vectors, resolved on
+// first use and again after liquid_simd_set_type(); the pointer always
+// holds a valid kernel so that a concurrent update is harmless
+static void (*dotprod_cccf_run4_wide)(float complex*, float complex*, unsigned int, float complex*) =
+    dotprod_cccf_run4_portable;
+static unsigned int dotprod_cccf_run4_generation = 0;
+
+// resolve wide kernel for dotprod_cccf_run4()
+static void dotprod_cccf_run4_resolve(void)
+{
+    unsigned int generation = liquid_simd_generation;
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: dotprod_cccf_run4_wide = dotprod_cccf_run_avx512;   break;
+    case LIQUID_SIMD_AVX2:   dotprod_cccf_run4_wide = dotprod_cccf_run_avx2;     break;
+#endif
+    default:                 dotprod_cccf_run4_wide = dotprod_cccf_run4_portable;
+    }
+    dotprod_cccf_run4_generation = generation;
+}
+
+// basic dot product with loop unrolled, using wide extensions if
+// available and the vectors are long enough to benefit
+void dotprod_cccf_run4(float complex * _h,
+                       float complex * _x,
+                       unsigned int    _n,
+                       float complex * _y)
+{
+    if (_n < 8) {
+        dotprod_cccf_run4_portable(_h, _x, _n, _y);
+        return;
+    }
+    if (dotprod_cccf_run4_generation != liquid_simd_generation)
+        dotprod_cccf_run4_resolve();
+    dotprod_cccf_run4_wide(_h, _x, _n, _y);
+}
+
 
 //
 // structured MMX dot product
@@ -109,6 +171,10 @@ struct dotprod_cccf_s {
     unsigned int n;     // length
     float * hi;         // in-phase
     float * hq;         // quadrature
+
+    // kernel selected at time of creation
+    liquid_simd_type simd;
+    void (*execute)(dotprod_cccf, float complex *, float complex *);
 };
 
 dotprod_cccf dotprod_cccf_create(float complex * _h,
@@ -117,9 +183,9 @@ dotprod_cccf dotprod_cccf_create(float complex * _h,
     dotprod_cccf q = (dotprod_cccf)malloc(sizeof(struct dotprod_cccf_s));
     q->n = _n;
 
-    // allocate memory for coefficients, 16-byte aligned
-    q->hi = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
-    q->hq = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
+    // allocate memory for coefficients, 64-byte (cache line) aligned
+    q->hi = (float*) _mm_malloc( 2*q->n*sizeof(float), 64 );
+    q->hq = (float*) _mm_malloc( 2*q->n*sizeof(float), 64 );
 
     // set coefficients, repeated
     //  hi = { crealf(_h[0]), crealf(_h[0]), ... crealf(_h[n-1]), crealf(_h[n-1])}
@@ -133,6 +199,20 @@ dotprod_cccf dotprod_cccf_create(float complex * _h,
         q->hq[2*i+1] = cimagf(_h[i]);
     }
 
+    // select kernel based on host processor and size; short filters
+    // do not benefit from wide registers
+    q->simd = liquid_simd_select(q->n < 8 ? LIQUID_SIMD_SSE : LIQUID_SIMD_AVX512);
+    switch (q->simd) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: q->execute = dotprod_cccf_execute_avx512; break;
+    case LIQUID_SIMD_AVX2:   q->execute = dotprod_cccf_execute_avx2;   break;
+#endif
+    case LIQUID_SIMD_PORTABLE: q->execute = dotprod_cccf_execute_portable; break;
+    default:
+        q->simd = LIQUID_SIMD_SSE;
+        q->execute = q->n < 32 ? dotprod_cccf_execute_mmx : dotprod_cccf_execute_mmx4;
+    }
+
     // return object
     return q;
 }
@@ -157,7 +237,8 @@ void dotprod_cccf_destroy(dotprod_cccf _q)
 
 void dotprod_cccf_print(dotprod_cccf _q)
 {
-    printf("dotprod_cccf [mmx, %u coefficients]\n", _q->n);
+    printf("dotprod_cccf [%s, %u coefficients]\n",
+            liquid_simd_type_str[_q->simd][0], _q->n);
     unsigned int i;
     for (i=0; i<_q->n; i++)
         printf("  %3u : %12.9f +j%12.9f\n", i, _q->hi[i], _q->hq[i]);
@@ -171,12 +252,20 @@ void dotprod_cccf_execute(dotprod_cccf    _q,
                           float complex * _x,
                           float complex * _y)
 {
-    // switch based on size
-    if (_q->n < 32) {
-        dotprod_cccf_execute_mmx(_q, _x, _y);
-    } else {
-        dotprod_cccf_execute_mmx4(_q, _x, _y);
-    }
+    // invoke kernel selected at time of creation
+    _q->execute(_q, _x, _y);
+}
+
+// portable C (reference), skipping repeated coefficients
+void dotprod_cccf_execute_portable(dotprod_cccf    _q,
+                                   float complex * _x,
+                                   float complex * _y)
+{
+    float complex r = 0;
+    unsigned int i;
+    for (i=0; i<_q->n; i++)
+        r += _x[i] * ( _q->hi[2*i] + _q->hq[2*i]*_Complex_I );
+    *_y = r;
 }
 
 // use MMX/SSE extensions
@@ -380,3 +469,231 @@ void dotprod_cccf_execute_mmx4(dotprod_cccf    _q,
     *_y = total;
 }
 
+#if LIQUID_SIMD_X86_TARGETS
+// use AVX2/FMA extensions
+//
+// (a + jb)(c + jd) = (ac - bd) + j(ad + bc)
+//
+// coefficients are split into repeated real and imaginary parts either
+// on the fly (moveldup/movehdup) or at creation (hi/hq), then
+//
+// sum_i = { x[0].real * h[0].real, x[0].imag * h[0].real, ... }
+// sum_q = { x[0].real * h[0].imag, x[0].imag * h[0].imag, ... }
+//
+// and the result is addsub(sum_i, swap(sum_q)), folded down
+__attribute__((target("avx2,fma")))
+void dotprod_cccf_run_avx2(float complex * _h,
+                           float complex * _x,
+                           unsigned int    _n,
+                           float complex * _y)
+{
+    // type cast input as floating point array
+    float * h = (float*) _h;
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_n;
+
+    // load zeros into sum registers
+    __m256 sumi0 = _mm256_setzero_ps();
+    __m256 sumq0 = _mm256_setzero_ps();
+    __m256 sumi1 = _mm256_setzero_ps();
+    __m256 sumq1 = _mm256_setzero_ps();
+
+    unsigned int i = 0;
+    for ( ; i+16<=n; i+=16) {
+        __m256 h0 = _mm256_loadu_ps(&h[i  ]);
+        __m256 h1 = _mm256_loadu_ps(&h[i+8]);
+        __m256 v0 = _mm256_loadu_ps(&x[i  ]);
+        __m256 v1 = _mm256_loadu_ps(&x[i+8]);
+        sumi0 = _mm256_fmadd_ps(v0, _mm256_moveldup_ps(h0), sumi0);
+        sumq0 = _mm256_fmadd_ps(v0, _mm256_movehdup_ps(h0), sumq0);
+        sumi1 = _mm256_fmadd_ps(v1, _mm256_moveldup_ps(h1), sumi1);
+        sumq1 = _mm256_fmadd_ps(v1, _mm256_movehdup_ps(h1), sumq1);
+    }
+    for ( ; i+8<=n; i+=8) {
+        __m256 h0 = _mm256_loadu_ps(&h[i]);
+        __m256 v0 = _mm256_loadu_ps(&x[i]);
+        sumi0 = _mm256_fmadd_ps(v0, _mm256_moveldup_ps(h0), sumi0);
+        sumq0 = _mm256_fmadd_ps(v0, _mm256_movehdup_ps(h0), sumq0);
+    }
+    sumi0 = _mm256_add_ps(sumi0, sumi1);
+    sumq0 = _mm256_add_ps(sumq0, sumq1);
+
+    // combine, fold down: {re, im, re, im} -> {re, im}
+    __m256 s8 = _mm256_addsub_ps(sumi0, _mm256_permute_ps(sumq0, _MM_SHUFFLE(2,3,0,1)));
+    __m128 s  = _mm_add_ps(_mm256_castps256_ps128(s8), _mm256_extractf128_ps(s8, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    float w[4] __attribute__((aligned(16)));
+    _mm_store_ps(w, s);
+    float complex total = w[0] + w[1] * _Complex_I;
+
+    // cleanup
+    for (i/=2; i<_n; i++)
+        total += _h[i] * _x[i];
+
+    // set return value
+    *_y = total;
+}
+
+// use AVX-512 extensions (see notes above)
+__attribute__((target("avx512f")))
+void dotprod_cccf_run_avx512(float complex * _h,
+                             float complex * _x,
+                             unsigned int    _n,
+                             float complex * _y)
+{
+    // type cast input as floating point array
+    float * h = (float*) _h;
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_n;
+
+    // load zeros into sum registers
+    __m512 sumi0 = _mm512_setzero_ps();
+    __m512 sumq0 = _mm512_setzero_ps();
+    __m512 sumi1 = _mm512_setzero_ps();
+    __m512 sumq1 = _mm512_setzero_ps();
+
+    unsigned int i = 0;
+    for ( ; i+32<=n; i+=32) {
+        __m512 h0 = _mm512_loadu_ps(&h[i   ]);
+        __m512 h1 = _mm512_loadu_ps(&h[i+16]);
+        __m512 v0 = _mm512_loadu_ps(&x[i   ]);
+        __m512 v1 = _mm512_loadu_ps(&x[i+16]);
+        sumi0 = _mm512_fmadd_ps(v0, _mm512_moveldup_ps(h0), sumi0);
+        sumq0 = _mm512_fmadd_ps(v0, _mm512_movehdup_ps(h0), sumq0);
+        sumi1 = _mm512_fmadd_ps(v1, _mm512_moveldup_ps(h1), sumi1);
+        sumq1 = _mm512_fmadd_ps(v1, _mm512_movehdup_ps(h1), sumq1);
+    }
+    for ( ; i+16<=n; i+=16) {
+        __m512 h0 = _mm512_loadu_ps(&h[i]);
+        __m512 v0 = _mm512_loadu_ps(&x[i]);
+        sumi0 = _mm512_fmadd_ps(v0, _mm512_moveldup_ps(h0), sumi0);
+        sumq0 = _mm512_fmadd_ps(v0, _mm512_movehdup_ps(h0), sumq0);
+    }
+
+    // cleanup using masked loads (masked-off elements are zero)
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        __m512 h0 = _mm512_maskz_loadu_ps(m, &h[i]);
+        __m512 v0 = _mm512_maskz_loadu_ps(m, &x[i]);
+        sumi1 = _mm512_fmadd_ps(v0, _mm512_moveldup_ps(h0), sumi1);
+        sumq1 = _mm512_fmadd_ps(v0, _mm512_movehdup_ps(h0), sumq1);
+    }
+    sumi0 = _mm512_add_ps(sumi0, sumi1);
+    sumq0 = _mm512_add_ps(sumq0, sumq1);
+
+    // combine: subtract in even (real) lanes, add in odd (imaginary) lanes
+    sumq0 = _mm512_permute_ps(sumq0, _MM_SHUFFLE(2,3,0,1));
+    __m512 s = _mm512_mask_sub_ps(_mm512_add_ps(sumi0, sumq0), 0x5555, sumi0, sumq0);
+
+    // fold down
+    *_y = _mm512_mask_reduce_add_ps(0x5555, s) +
+          _mm512_mask_reduce_add_ps(0xaaaa, s) * _Complex_I;
+}
+
+// use AVX2/FMA extensions on split coefficients
+__attribute__((target("avx2,fma")))
+void dotprod_cccf_execute_avx2(dotprod_cccf    _q,
+                               float complex * _x,
+                               float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // load zeros into sum registers
+    __m256 sumi0 = _mm256_setzero_ps();
+    __m256 sumq0 = _mm256_setzero_ps();
+    __m256 sumi1 = _mm256_setzero_ps();
+    __m256 sumq1 = _mm256_setzero_ps();
+
+    unsigned int i = 0;
+    for ( ; i+16<=n; i+=16) {
+        __m256 v0 = _mm256_loadu_ps(&x[i  ]);
+        __m256 v1 = _mm256_loadu_ps(&x[i+8]);
+        sumi0 = _mm256_fmadd_ps(v0, _mm256_load_ps(&_q->hi[i  ]), sumi0);
+        sumq0 = _mm256_fmadd_ps(v0, _mm256_load_ps(&_q->hq[i  ]), sumq0);
+        sumi1 = _mm256_fmadd_ps(v1, _mm256_load_ps(&_q->hi[i+8]), sumi1);
+        sumq1 = _mm256_fmadd_ps(v1, _mm256_load_ps(&_q->hq[i+8]), sumq1);
+    }
+    for ( ; i+8<=n; i+=8) {
+        __m256 v0 = _mm256_loadu_ps(&x[i]);
+        sumi0 = _mm256_fmadd_ps(v0, _mm256_load_ps(&_q->hi[i]), sumi0);
+        sumq0 = _mm256_fmadd_ps(v0, _mm256_load_ps(&_q->hq[i]), sumq0);
+    }
+    sumi0 = _mm256_add_ps(sumi0, sumi1);
+    sumq0 = _mm256_add_ps(sumq0, sumq1);
+
+    // combine, fold down: {re, im, re, im} -> {re, im}
+    __m256 s8 = _mm256_addsub_ps(sumi0, _mm256_permute_ps(sumq0, _MM_SHUFFLE(2,3,0,1)));
+    __m128 s  = _mm_add_ps(_mm256_castps256_ps128(s8), _mm256_extractf128_ps(s8, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    float w[4] __attribute__((aligned(16)));
+    _mm_store_ps(w, s);
+    float complex total = w[0] + w[1] * _Complex_I;
+
+    // cleanup
+    for (i/=2; i<_q->n; i++)
+        total += _x[i] * ( _q->hi[2*i] + _q->hq[2*i]*_Complex_I );
+
+    // set return value
+    *_y = total;
+}
+
+// use AVX-512 extensions on split coefficients
+__attribute__((target("avx512f")))
+void dotprod_cccf_execute_avx512(dotprod_cccf    _q,
+                                 float complex * _x,
+                                 float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // load zeros into sum registers
+    __m512 sumi0 = _mm512_setzero_ps();
+    __m512 sumq0 = _mm512_setzero_ps();
+    __m512 sumi1 = _mm512_setzero_ps();
+    __m512 sumq1 = _mm512_setzero_ps();
+
+    unsigned int i = 0;
+    for ( ; i+32<=n; i+=32) {
+        __m512 v0 = _mm512_loadu_ps(&x[i   ]);
+        __m512 v1 = _mm512_loadu_ps(&x[i+16]);
+        sumi0 = _mm512_fmadd_ps(v0, _mm512_load_ps(&_q->hi[i   ]), sumi0);
+        sumq0 = _mm512_fmadd_ps(v0, _mm512_load_ps(&_q->hq[i   ]), sumq0);
+        sumi1 = _mm512_fmadd_ps(v1, _mm512_load_ps(&_q->hi[i+16]), sumi1);
+        sumq1 = _mm512_fmadd_ps(v1, _mm512_load_ps(&_q->hq[i+16]), sumq1);
+    }
+    for ( ; i+16<=n; i+=16) {
+        __m512 v0 = _mm512_loadu_ps(&x[i]);
+        sumi0 = _mm512_fmadd_ps(v0, _mm512_load_ps(&_q->hi[i]), sumi0);
+        sumq0 = _mm512_fmadd_ps(v0, _mm512_load_ps(&_q->hq[i]), sumq0);
+    }
+
+    // cleanup using masked loads (masked-off elements are zero)
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        __m512 v0 = _mm512_maskz_loadu_ps(m, &x[i]);
+        sumi1 = _mm512_fmadd_ps(v0, _mm512_maskz_loadu_ps(m, &_q->hi[i]), sumi1);
+        sumq1 = _mm512_fmadd_ps(v0, _mm512_maskz_loadu_ps(m, &_q->hq[i]), sumq1);
+    }
+    sumi0 = _mm512_add_ps(sumi0, sumi1);
+    sumq0 = _mm512_add_ps(sumq0, sumq1);
+
+    // combine: subtract in even (real) lanes, add in odd (imaginary) lanes
+    sumq0 = _mm512_permute_ps(sumq0, _MM_SHUFFLE(2,3,0,1));
+    __m512 s = _mm512_mask_sub_ps(_mm512_add_ps(sumi0, sumq0), 0x5555, sumi0, sumq0);
+
+    // fold down
+    *_y = _mm512_mask_reduce_add_ps(0x5555, s) +
+          _mm512_mask_reduce_add_ps(0xaaaa, s) * _Complex_I;
+}
+#endif
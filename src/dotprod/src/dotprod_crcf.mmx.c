@@ -32,6 +32,10 @@
 
 #include "liquid.internal.h"
 
+#if LIQUID_SIMD_X86_TARGETS
+#include <immintrin.h>  // AVX2, FMA, AVX-512
+#endif
+
 #define DEBUG_DOTPROD_CRCF_MMX   0
 
 // forward declaration of internal methods
@@ -41,6 +45,25 @@ void dotprod_crcf_execute_mmx(dotprod_crcf    _q,
 void dotprod_crcf_execute_mmx4(dotprod_crcf    _q,
                                float complex * _x,
                                float complex * _y);
+void dotprod_crcf_execute_portable(dotprod_crcf    _q,
+                                   float complex * _x,
+                                   float complex * _y);
+#if LIQUID_SIMD_X86_TARGETS
+void dotprod_crcf_run_avx2(float *         _h,
+                           float complex * _x,
+                           unsigned int    _n,
+                           float complex * _y);
+void dotprod_crcf_run_avx512(float *         _h,
+                             float complex * _x,
+                             unsigned int    _n,
+                             float complex * _y);
+void dotprod_crcf_execute_avx2(dotprod_crcf    _q,
+                               float complex * _x,
+                               float complex * _y);
+void dotprod_crcf_execute_avx512(dotprod_crcf    _q,
+                                 float complex * _x,
+                                 float complex * _y);
+#endif
 
 // basic dot product (ordinal calculation)
 void dotprod_crcf_run(float *         _h,
@@ -56,10 +79,10 @@ void dotprod_crcf_run(float *         _h,
 }
 
 // basic dot product (ordinal calculation) with loop unrolled
-void dotprod_crcf_run4(float *         _h,
-                       float complex * _x,
-                       unsigned int    _n,
-                       float complex * _y)
+static void dotprod_crcf_run4_portable(float *         _h,
+                                       float complex * _x,
+                                       unsigned int    _n,
+                                       float complex * _y)
 {
     float complex r = 0;
 
@@ -82,6 +105,43 @@ void dotprod_crcf_run4(float *         _h,
     *_y = r;
 }
 
+// wide kernel used by dotprod_crcf_run4() for long vectors, resolved on
+// first use and again after liquid_simd_set_type(); the pointer always
+// holds a valid kernel so that a concurrent update is harmless
+static void (*dotprod_crcf_run4_wide)(float*, float complex*, unsigned int, float complex*) =
+    dotprod_crcf_run4_portable;
+static unsigned int dotprod_crcf_run4_generation = 0;
+
+// resolve wide kernel for dotprod_crcf_run4()
+static void dotprod_crcf_run4_resolve(void)
+{
+    unsigned int generation = liquid_simd_generation;
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: dotprod_crcf_run4_wide = dotprod_crcf_run_avx512;   break;
+    case LIQUID_SIMD_AVX2:   dotprod_crcf_run4_wide = dotprod_crcf_run_avx2;     break;
+#endif
+    default:                 dotprod_crcf_run4_wide = dotprod_crcf_run4_portable;
+    }
+    dotprod_crcf_run4_generation = generation;
+}
+
+// basic dot product with loop unrolled, using wide extensions if
+// available and the vectors are long enough to benefit
+void dotprod_crcf_run4(float *         _h,
+                       float complex * _x,
+                       unsigned int    _n,
+                       float complex * _y)
+{
+    if (_n < 8) {
+        dotprod_crcf_run4_portable(_h, _x, _n, _y);
+        return;
+    }
+    if (dotprod_crcf_run4_generation != liquid_simd_generation)
+        dotprod_crcf_run4_resolve();
+    dotprod_crcf_run4_wide(_h, _x, _n, _y);
+}
+
 
 //
 // structured MMX dot product
@@ -90,6 +150,10 @@ void dotprod_crcf_run4(float *         _h,
 struct dotprod_crcf_s {
     unsigned int n;     // length
     float * h;          // coefficients array
+
+    // kernel selected at time of creation
+    liquid_simd_type simd;
+    void (*execute)(dotprod_crcf, float complex *, float complex *);
 };
 
 dotprod_crcf dotprod_crcf_create(float *      _h,
@@ -98,8 +162,8 @@ dotprod_crcf dotprod_crcf_create(float *      _h,
     dotprod_crcf q = (dotprod_crcf)malloc(sizeof(struct dotprod_crcf_s));
     q->n = _n;
 
-    // allocate memory for coefficients, 16-byte aligned
-    q->h = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
+    // allocate memory for coefficients, 64-byte (cache line) aligned
+    q->h = (float*) _mm_malloc( 2*q->n*sizeof(float), 64 );
 
     // set coefficients, repeated
     //  h = { _h[0], _h[0], _h[1], _h[1], ... _h[n-1], _h[n-1]}
@@ -109,6 +173,20 @@ dotprod_crcf dotprod_crcf_create(float *      _h,
         q->h[2*i+1] = _h[i];
     }
 
+    // select kernel based on host processor and size; short filters
+    // do not benefit from wide registers
+    q->simd = liquid_simd_select(q->n < 8 ? LIQUID_SIMD_SSE : LIQUID_SIMD_AVX512);
+    switch (q->simd) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: q->execute = dotprod_crcf_execute_avx512; break;
+    case LIQUID_SIMD_AVX2:   q->execute = dotprod_crcf_execute_avx2;   break;
+#endif
+    case LIQUID_SIMD_PORTABLE: q->execute = dotprod_crcf_execute_portable; break;
+    default:
+        q->simd = LIQUID_SIMD_SSE;
+        q->execute = q->n < 32 ? dotprod_crcf_execute_mmx : dotprod_crcf_execute_mmx4;
+    }
+
     // return object
     return q;
 }
@@ -134,7 +212,8 @@ void dotprod_crcf_print(dotprod_crcf _q)
 {
     // print coefficients to screen, skipping odd entries (due
     // to repeated coefficients)
-    printf("dotprod_crcf [mmx, %u coefficients]\n", _q->n);
+    printf("dotprod_crcf [%s, %u coefficients]\n",
+            liquid_simd_type_str[_q->simd][0], _q->n);
     unsigned int i;
     for (i=0; i<_q->n; i++)
         printf("  %3u : %12.9f\n", i, _q->h[2*i]);
@@ -145,12 +224,20 @@ void dotprod_crcf_execute(dotprod_crcf    _q,
                           float complex * _x,
                           float complex * _y)
 {
-    // switch based on size
-    if (_q->n < 32) {
-        dotprod_crcf_execute_mmx(_q, _x, _y);
-    } else {
-        dotprod_crcf_execute_mmx4(_q, _x, _y);
-    }
+    // invoke kernel selected at time of creation
+    _q->execute(_q, _x, _y);
+}
+
+// portable C (reference), skipping repeated coefficients
+void dotprod_crcf_execute_portable(dotprod_crcf    _q,
+                                   float complex * _x,
+                                   float complex * _y)
+{
+    float complex r = 0;
+    unsigned int i;
+    for (i=0; i<_q->n; i++)
+        r += _q->h[2*i] * _x[i];
+    *_y = r;
 }
 
 // use MMX/SSE extensions
@@ -285,3 +372,202 @@ void dotprod_crcf_execute_mmx4(dotprod_crcf    _q,
     *_y = w[0] + w[1]*_Complex_I;
 }
 
+#if LIQUID_SIMD_X86_TARGETS
+// use AVX2/FMA extensions, expanding coefficients on the fly
+__attribute__((target("avx2,fma")))
+void dotprod_crcf_run_avx2(float *         _h,
+                           float complex * _x,
+                           unsigned int    _n,
+                           float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // permutation to repeat coefficients: {h[0], h[0], ... h[3], h[3]}
+    __m256i p = _mm256_setr_epi32(0,0,1,1,2,2,3,3);
+
+    // load zeros into sum registers
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+
+    // t = 4*floor(n/4)
+    unsigned int t = (_n >> 2) << 2;
+
+    unsigned int i = 0;
+    for ( ; i+8<=t; i+=8) {
+        __m256 h0 = _mm256_permutevar8x32_ps(_mm256_castps128_ps256(_mm_loadu_ps(&_h[i  ])), p);
+        __m256 h1 = _mm256_permutevar8x32_ps(_mm256_castps128_ps256(_mm_loadu_ps(&_h[i+4])), p);
+        sum0 = _mm256_fmadd_ps(h0, _mm256_loadu_ps(&x[2*i  ]), sum0);
+        sum1 = _mm256_fmadd_ps(h1, _mm256_loadu_ps(&x[2*i+8]), sum1);
+    }
+    for ( ; i<t; i+=4) {
+        __m256 h0 = _mm256_permutevar8x32_ps(_mm256_castps128_ps256(_mm_loadu_ps(&_h[i])), p);
+        sum0 = _mm256_fmadd_ps(h0, _mm256_loadu_ps(&x[2*i]), sum0);
+    }
+    sum0 = _mm256_add_ps(sum0, sum1);
+
+    // fold down: {re, im, re, im} -> {re, im}
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    float w[4] __attribute__((aligned(16)));
+    _mm_store_ps(w, s);
+
+    // cleanup
+    for ( ; i<_n; i++) {
+        w[0] += _h[i] * x[2*i  ];
+        w[1] += _h[i] * x[2*i+1];
+    }
+
+    // set return value
+    *_y = w[0] + _Complex_I*w[1];
+}
+
+// use AVX-512 extensions, expanding coefficients on the fly
+__attribute__((target("avx512f")))
+void dotprod_crcf_run_avx512(float *         _h,
+                             float complex * _x,
+                             unsigned int    _n,
+                             float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // permutation to repeat coefficients: {h[0], h[0], ... h[7], h[7]}
+    __m512i p = _mm512_setr_epi32(0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7);
+
+    // load zeros into sum registers
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+
+    unsigned int i = 0;
+    for ( ; i+16<=_n; i+=16) {
+        __m512 h0 = _mm512_permutexvar_ps(p, _mm512_castps256_ps512(_mm256_loadu_ps(&_h[i  ])));
+        __m512 h1 = _mm512_permutexvar_ps(p, _mm512_castps256_ps512(_mm256_loadu_ps(&_h[i+8])));
+        sum0 = _mm512_fmadd_ps(h0, _mm512_loadu_ps(&x[2*i   ]), sum0);
+        sum1 = _mm512_fmadd_ps(h1, _mm512_loadu_ps(&x[2*i+16]), sum1);
+    }
+    for ( ; i+8<=_n; i+=8) {
+        __m512 h0 = _mm512_permutexvar_ps(p, _mm512_castps256_ps512(_mm256_loadu_ps(&_h[i])));
+        sum0 = _mm512_fmadd_ps(h0, _mm512_loadu_ps(&x[2*i]), sum0);
+    }
+
+    // cleanup using masked loads (masked-off elements are zero)
+    if (i < _n) {
+        unsigned int k = _n - i;
+        __m512 h0 = _mm512_permutexvar_ps(p, _mm512_maskz_loadu_ps((__mmask16)((1u<<k)-1), &_h[i]));
+        __m512 v0 = _mm512_maskz_loadu_ps((__mmask16)((1u<<(2*k))-1), &x[2*i]);
+        sum1 = _mm512_fmadd_ps(h0, v0, sum1);
+    }
+    sum0 = _mm512_add_ps(sum0, sum1);
+
+    // fold down even (real) and odd (imaginary) lanes
+    *_y = _mm512_mask_reduce_add_ps(0x5555, sum0) +
+          _mm512_mask_reduce_add_ps(0xaaaa, sum0) * _Complex_I;
+}
+
+// use AVX2/FMA extensions on repeated coefficients
+__attribute__((target("avx2,fma")))
+void dotprod_crcf_execute_avx2(dotprod_crcf    _q,
+                               float complex * _x,
+                               float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // load zeros into sum registers
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+
+    // r = 32*floor(n/32)
+    unsigned int r = (n >> 5) << 5;
+
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        sum0 = _mm256_fmadd_ps(_mm256_load_ps(&_q->h[i   ]), _mm256_loadu_ps(&x[i   ]), sum0);
+        sum1 = _mm256_fmadd_ps(_mm256_load_ps(&_q->h[i+ 8]), _mm256_loadu_ps(&x[i+ 8]), sum1);
+        sum2 = _mm256_fmadd_ps(_mm256_load_ps(&_q->h[i+16]), _mm256_loadu_ps(&x[i+16]), sum2);
+        sum3 = _mm256_fmadd_ps(_mm256_load_ps(&_q->h[i+24]), _mm256_loadu_ps(&x[i+24]), sum3);
+    }
+
+    // t = 8*floor(n/8)
+    unsigned int t = (n >> 3) << 3;
+    for ( ; i<t; i+=8)
+        sum0 = _mm256_fmadd_ps(_mm256_load_ps(&_q->h[i]), _mm256_loadu_ps(&x[i]), sum0);
+
+    // fold down into single 8-element register
+    sum0 = _mm256_add_ps(sum0, sum1);
+    sum2 = _mm256_add_ps(sum2, sum3);
+    sum0 = _mm256_add_ps(sum0, sum2);
+
+    // fold down: {re, im, re, im} -> {re, im}
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    float w[4] __attribute__((aligned(16)));
+    _mm_store_ps(w, s);
+
+    // cleanup (note: n _must_ be even)
+    for ( ; i<n; i+=2) {
+        w[0] += x[i  ] * _q->h[i  ];
+        w[1] += x[i+1] * _q->h[i+1];
+    }
+
+    // set return value
+    *_y = w[0] + _Complex_I*w[1];
+}
+
+// use AVX-512 extensions on repeated coefficients
+__attribute__((target("avx512f")))
+void dotprod_crcf_execute_avx512(dotprod_crcf    _q,
+                                 float complex * _x,
+                                 float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // load zeros into sum registers
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    __m512 sum2 = _mm512_setzero_ps();
+    __m512 sum3 = _mm512_setzero_ps();
+
+    // r = 64*floor(n/64)
+    unsigned int r = (n >> 6) << 6;
+
+    unsigned int i;
+    for (i=0; i<r; i+=64) {
+        sum0 = _mm512_fmadd_ps(_mm512_load_ps(&_q->h[i   ]), _mm512_loadu_ps(&x[i   ]), sum0);
+        sum1 = _mm512_fmadd_ps(_mm512_load_ps(&_q->h[i+16]), _mm512_loadu_ps(&x[i+16]), sum1);
+        sum2 = _mm512_fmadd_ps(_mm512_load_ps(&_q->h[i+32]), _mm512_loadu_ps(&x[i+32]), sum2);
+        sum3 = _mm512_fmadd_ps(_mm512_load_ps(&_q->h[i+48]), _mm512_loadu_ps(&x[i+48]), sum3);
+    }
+
+    // t = 16*floor(n/16)
+    unsigned int t = (n >> 4) << 4;
+    for ( ; i<t; i+=16)
+        sum0 = _mm512_fmadd_ps(_mm512_load_ps(&_q->h[i]), _mm512_loadu_ps(&x[i]), sum0);
+
+    // cleanup using masked loads (masked-off elements are zero)
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        sum1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &_q->h[i]),
+                               _mm512_maskz_loadu_ps(m, &x[i]), sum1);
+    }
+
+    // fold down into single register
+    sum0 = _mm512_add_ps(sum0, sum1);
+    sum2 = _mm512_add_ps(sum2, sum3);
+    sum0 = _mm512_add_ps(sum0, sum2);
+
+    // fold down even (real) and odd (imaginary) lanes
+    *_y = _mm512_mask_reduce_add_ps(0x5555, sum0) +
+          _mm512_mask_reduce_add_ps(0xaaaa, sum0) * _Complex_I;
+}
+#endif
@@ -50,6 +50,10 @@
 #include <pmmintrin.h>  // SSE3
 #endif
 
+#if LIQUID_SIMD_X86_TARGETS
+#include <immintrin.h>  // AVX2, FMA, AVX-512
+#endif
+
 #define DEBUG_DOTPROD_RRRF_MMX   0
 
 // internal methods
@@ -59,6 +63,25 @@ void dotprod_rrrf_execute_mmx(dotprod_rrrf _q,
 void dotprod_rrrf_execute_mmx4(dotprod_rrrf _q,
                                float *      _x,
                                float *      _y);
+void dotprod_rrrf_execute_portable(dotprod_rrrf _q,
+                                   float *      _x,
+                                   float *      _y);
+#if LIQUID_SIMD_X86_TARGETS
+void dotprod_rrrf_run_avx2(float *      _h,
+                           float *      _x,
+                           unsigned int _n,
+                           float *      _y);
+void dotprod_rrrf_run_avx512(float *      _h,
+                             float *      _x,
+                             unsigned int _n,
+                             float *      _y);
+void dotprod_rrrf_execute_avx2(dotprod_rrrf _q,
+                               float *      _x,
+                               float *      _y);
+void dotprod_rrrf_execute_avx512(dotprod_rrrf _q,
+                                 float *      _x,
+                                 float *      _y);
+#endif
 
 // basic dot product (ordinal calculation)
 void dotprod_rrrf_run(float *      _h,
@@ -74,10 +97,10 @@ void dotprod_rrrf_run(float *      _h,
 }
 
 // basic dot product (ordinal calculation) with loop unrolled
-void dotprod_rrrf_run4(float *      _h,
-                       float *      _x,
-                       unsigned int _n,
-                       float *      _y)
+static void dotprod_rrrf_run4_portable(float *      _h,
+                                       float *      _x,
+                                       unsigned int _n,
+                                       float *      _y)
 {
     float r=0;
 
@@ -100,6 +123,43 @@ void dotprod_rrrf_run4(float *      _h,
     *_y = r;
 }
 
+// wide kernel used by dotprod_rrrf_run4() for long vectors, resolved on
+// first use and again after liquid_simd_set_type(); the pointer always
+// holds a valid kernel so that a concurrent update is harmless
+static void (*dotprod_rrrf_run4_wide)(float*, float*, unsigned int, float*) =
+    dotprod_rrrf_run4_portable;
+static unsigned int dotprod_rrrf_run4_generation = 0;
+
+// resolve wide kernel for dotprod_rrrf_run4()
+static void dotprod_rrrf_run4_resolve(void)
+{
+    unsigned int generation = liquid_simd_generation;
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: dotprod_rrrf_run4_wide = dotprod_rrrf_run_avx512;   break;
+    case LIQUID_SIMD_AVX2:   dotprod_rrrf_run4_wide = dotprod_rrrf_run_avx2;     break;
+#endif
+    default:                 dotprod_rrrf_run4_wide = dotprod_rrrf_run4_portable;
+    }
+    dotprod_rrrf_run4_generation = generation;
+}
+
+// basic dot product with loop unrolled, using wide extensions if
+// available and the vectors are long enough to benefit
+void dotprod_rrrf_run4(float *      _h,
+                       float *      _x,
+                       unsigned int _n,
+                       float *      _y)
+{
+    if (_n < 16) {
+        dotprod_rrrf_run4_portable(_h, _x, _n, _y);
+        return;
+    }
+    if (dotprod_rrrf_run4_generation != liquid_simd_generation)
+        dotprod_rrrf_run4_resolve();
+    dotprod_rrrf_run4_wide(_h, _x, _n, _y);
+}
+
 
 //
 // structured MMX dot product
@@ -108,6 +168,10 @@ void dotprod_rrrf_run4(float *      _h,
 struct dotprod_rrrf_s {
     unsigned int n;     // length
     float * h;          // coefficients array
+
+    // kernel selected at time of creation
+    liquid_simd_type simd;
+    void (*execute)(dotprod_rrrf, float *, float *);
 };
 
 dotprod_rrrf dotprod_rrrf_create(float *      _h,
@@ -116,12 +180,26 @@ dotprod_rrrf dotprod_rrrf_create(float *      _h,
     dotprod_rrrf q = (dotprod_rrrf)malloc(sizeof(struct dotprod_rrrf_s));
     q->n = _n;
 
-    // allocate memory for coefficients, 16-byte aligned
-    q->h = (float*) _mm_malloc( q->n*sizeof(float), 16);
+    // allocate memory for coefficients, 64-byte (cache line) aligned
+    q->h = (float*) _mm_malloc( q->n*sizeof(float), 64);
 
     // set coefficients
     memmove(q->h, _h, _n*sizeof(float));
 
+    // select kernel based on host processor and size; short filters
+    // do not benefit from wide registers
+    q->simd = liquid_simd_select(q->n < 16 ? LIQUID_SIMD_SSE : LIQUID_SIMD_AVX512);
+    switch (q->simd) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: q->execute = dotprod_rrrf_execute_avx512; break;
+    case LIQUID_SIMD_AVX2:   q->execute = dotprod_rrrf_execute_avx2;   break;
+#endif
+    case LIQUID_SIMD_PORTABLE: q->execute = dotprod_rrrf_execute_portable; break;
+    default:
+        q->simd = LIQUID_SIMD_SSE;
+        q->execute = q->n < 16 ? dotprod_rrrf_execute_mmx : dotprod_rrrf_execute_mmx4;
+    }
+
     // return object
     return q;
 }
@@ -145,7 +223,8 @@ void dotprod_rrrf_destroy(dotprod_rrrf _q)
 
 void dotprod_rrrf_print(dotprod_rrrf _q)
 {
-    printf("dotprod_rrrf [mmx, %u coefficients]\n", _q->n);
+    printf("dotprod_rrrf [%s, %u coefficients]\n",
+            liquid_simd_type_str[_q->simd][0], _q->n);
     unsigned int i;
     for (i=0; i<_q->n; i++)
         printf("%3u : %12.9f\n", i, _q->h[i]);
@@ -156,12 +235,16 @@ void dotprod_rrrf_execute(dotprod_rrrf _q,
                           float *      _x,
                           float *      _y)
 {
-    // switch based on size
-    if (_q->n < 16) {
-        dotprod_rrrf_execute_mmx(_q, _x, _y);
-    } else {
-        dotprod_rrrf_execute_mmx4(_q, _x, _y);
-    }
+    // invoke kernel selected at time of creation
+    _q->execute(_q, _x, _y);
+}
+
+// portable C (reference)
+void dotprod_rrrf_execute_portable(dotprod_rrrf _q,
+                                   float *      _x,
+                                   float *      _y)
+{
+    dotprod_rrrf_run(_q->h, _x, _q->n, _y);
 }
 
 // use MMX/SSE extensions
@@ -299,3 +382,115 @@ void dotprod_rrrf_execute_mmx4(dotprod_rrrf _q,
     *_y = total;
 }
 
+#if LIQUID_SIMD_X86_TARGETS
+// use AVX2/FMA extensions, unrolled loop
+__attribute__((target("avx2,fma")))
+void dotprod_rrrf_run_avx2(float *      _h,
+                           float *      _x,
+                           unsigned int _n,
+                           float *      _y)
+{
+    // load zeros into sum registers
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+
+    // r = 32*floor(n/32)
+    unsigned int r = (_n >> 5) << 5;
+
+    // fused multiply-add, four independent accumulators
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(&_h[i   ]), _mm256_loadu_ps(&_x[i   ]), sum0);
+        sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(&_h[i+ 8]), _mm256_loadu_ps(&_x[i+ 8]), sum1);
+        sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(&_h[i+16]), _mm256_loadu_ps(&_x[i+16]), sum2);
+        sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(&_h[i+24]), _mm256_loadu_ps(&_x[i+24]), sum3);
+    }
+
+    // t = 8*floor(n/8)
+    unsigned int t = (_n >> 3) << 3;
+    for ( ; i<t; i+=8)
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(&_h[i]), _mm256_loadu_ps(&_x[i]), sum0);
+
+    // fold down into single 8-element register
+    sum0 = _mm256_add_ps(sum0, sum1);
+    sum2 = _mm256_add_ps(sum2, sum3);
+    sum0 = _mm256_add_ps(sum0, sum2);
+
+    // fold down to single value
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1));
+    s = _mm_hadd_ps(s, s);
+    s = _mm_hadd_ps(s, s);
+    float total = _mm_cvtss_f32(s);
+
+    // cleanup
+    for ( ; i<_n; i++)
+        total += _h[i] * _x[i];
+
+    // set return value
+    *_y = total;
+}
+
+// use AVX-512 extensions, unrolled loop
+__attribute__((target("avx512f")))
+void dotprod_rrrf_run_avx512(float *      _h,
+                             float *      _x,
+                             unsigned int _n,
+                             float *      _y)
+{
+    // load zeros into sum registers
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    __m512 sum2 = _mm512_setzero_ps();
+    __m512 sum3 = _mm512_setzero_ps();
+
+    // r = 64*floor(n/64)
+    unsigned int r = (_n >> 6) << 6;
+
+    // fused multiply-add, four independent accumulators
+    unsigned int i;
+    for (i=0; i<r; i+=64) {
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(&_h[i   ]), _mm512_loadu_ps(&_x[i   ]), sum0);
+        sum1 = _mm512_fmadd_ps(_mm512_loadu_ps(&_h[i+16]), _mm512_loadu_ps(&_x[i+16]), sum1);
+        sum2 = _mm512_fmadd_ps(_mm512_loadu_ps(&_h[i+32]), _mm512_loadu_ps(&_x[i+32]), sum2);
+        sum3 = _mm512_fmadd_ps(_mm512_loadu_ps(&_h[i+48]), _mm512_loadu_ps(&_x[i+48]), sum3);
+    }
+
+    // t = 16*floor(n/16)
+    unsigned int t = (_n >> 4) << 4;
+    for ( ; i<t; i+=16)
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(&_h[i]), _mm512_loadu_ps(&_x[i]), sum0);
+
+    // cleanup using masked loads (masked-off elements are zero)
+    if (i < _n) {
+        __mmask16 m = (__mmask16)((1u << (_n - i)) - 1);
+        sum1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &_h[i]),
+                               _mm512_maskz_loadu_ps(m, &_x[i]), sum1);
+    }
+
+    // fold down to single value
+    sum0 = _mm512_add_ps(sum0, sum1);
+    sum2 = _mm512_add_ps(sum2, sum3);
+    sum0 = _mm512_add_ps(sum0, sum2);
+
+    // set return value
+    *_y = _mm512_reduce_add_ps(sum0);
+}
+
+// use AVX2/FMA extensions
+void dotprod_rrrf_execute_avx2(dotprod_rrrf _q,
+                               float *      _x,
+                               float *      _y)
+{
+    dotprod_rrrf_run_avx2(_q->h, _x, _q->n, _y);
+}
+
+// use AVX-512 extensions
+void dotprod_rrrf_execute_avx512(dotprod_rrrf _q,
+                                 float *      _x,
+                                 float *      _y)
+{
+    dotprod_rrrf_run_avx512(_q->h, _x, _q->n, _y);
+}
+#endif
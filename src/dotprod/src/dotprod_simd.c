@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Run-time SIMD kernel selection
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+const char * liquid_simd_type_str[LIQUID_SIMD_NUM_TYPES][2] = {
+    // short name,  long name
+    {"auto",        "best available"},
+    {"portable",    "portable C"},
+    {"sse",         "SSE/SSE3"},
+    {"avx2",        "AVX2 with fused multiply-add"},
+    {"avx512",      "AVX-512F"}};
+
+// SIMD type requested by user
+static liquid_simd_type liquid_simd_type_user = LIQUID_SIMD_AUTO;
+
+// incremented by liquid_simd_set_type(); kernels resolved outside of an
+// object are cached until this changes
+unsigned int liquid_simd_generation = 1;
+
+// best SIMD type supported by host (resolved on first use)
+static liquid_simd_type liquid_simd_type_host = LIQUID_SIMD_AUTO;
+
+// determine if SIMD type is supported by both the library build and the
+// host processor
+int liquid_simd_is_supported(liquid_simd_type _type)
+{
+    switch (_type) {
+    case LIQUID_SIMD_AUTO:
+    case LIQUID_SIMD_PORTABLE:
+        return 1;
+#if !defined LIQUID_SIMDOVERRIDE && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    case LIQUID_SIMD_SSE:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2");
+#  if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX2:
+        __builtin_cpu_init();
+        // __builtin_cpu_supports() also verifies the operating system has
+        // enabled the extended register state (xgetbv)
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case LIQUID_SIMD_AVX512:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f");
+#  endif
+#endif
+    default:;
+    }
+    return 0;
+}
+
+// set SIMD type to use for objects created hereafter
+void liquid_simd_set_type(liquid_simd_type _type)
+{
+    if (_type >= LIQUID_SIMD_NUM_TYPES) {
+        fprintf(stderr,"error: liquid_simd_set_type(), invalid type\n");
+        exit(1);
+    }
+    liquid_simd_type_user = _type;
+    liquid_simd_generation++;
+}
+
+// get SIMD type set by liquid_simd_set_type()
+liquid_simd_type liquid_simd_get_type(void)
+{
+    return liquid_simd_type_user;
+}
+
+// select SIMD type for a newly-created object
+liquid_simd_type liquid_simd_select(liquid_simd_type _max)
+{
+    // resolve best type supported by host only once
+    if (liquid_simd_type_host == LIQUID_SIMD_AUTO) {
+        liquid_simd_type type = LIQUID_SIMD_AVX512;
+        while (type > LIQUID_SIMD_PORTABLE && !liquid_simd_is_supported(type))
+            type--;
+        liquid_simd_type_host = type;
+    }
+
+    // start from requested type, limited by calling object and host
+    liquid_simd_type type = liquid_simd_type_user;
+    if (type == LIQUID_SIMD_AUTO || type > _max)
+        type = _max;
+    if (type > liquid_simd_type_host)
+        type = liquid_simd_type_host;
+
+    return type;
+}
@@ -220,3 +220,51 @@ void autotest_dotprod_cccf_struct_vs_ordinal()
         runtest_dotprod_cccf(i);
 }
 
+// compare structured object and unrolled loop to ordinal computation for
+// each SIMD type supported by the host
+void autotest_dotprod_cccf_simd()
+{
+    float tol = 1e-3;
+    liquid_simd_type simd = liquid_simd_get_type();
+
+    unsigned int t;
+    for (t=LIQUID_SIMD_PORTABLE; t<LIQUID_SIMD_NUM_TYPES; t++) {
+        if (!liquid_simd_is_supported(t)) {
+            if (liquid_autotest_verbose)
+                printf("  dotprod-cccf [%-8s] : not supported\n", liquid_simd_type_str[t][0]);
+            continue;
+        }
+        liquid_simd_set_type(t);
+
+        // test lengths covering all unrolled loops and cleanup paths
+        unsigned int n;
+        for (n=1; n<=80; n++) {
+            float complex h[n];
+            float complex x[n];
+            float complex y, y_test = 0;
+            unsigned int i;
+            for (i=0; i<n; i++) {
+                h[i] = randnf() + randnf() * _Complex_I;
+                x[i] = randnf() + randnf() * _Complex_I;
+                y_test += h[i] * x[i];
+            }
+
+            // structured object
+            dotprod_cccf dp = dotprod_cccf_create(h,n);
+            dotprod_cccf_execute(dp, x, &y);
+            dotprod_cccf_destroy(dp);
+            CONTEND_DELTA(crealf(y), crealf(y_test), tol);
+            CONTEND_DELTA(cimagf(y), cimagf(y_test), tol);
+
+            // unrolled loop
+            dotprod_cccf_run4(h, x, n, &y);
+            CONTEND_DELTA(crealf(y), crealf(y_test), tol);
+            CONTEND_DELTA(cimagf(y), cimagf(y_test), tol);
+        }
+        if (liquid_autotest_verbose)
+            printf("  dotprod-cccf [%-8s] : pass\n", liquid_simd_type_str[t][0]);
+    }
+
+    // restore original SIMD type
+    liquid_simd_set_type(simd);
+}
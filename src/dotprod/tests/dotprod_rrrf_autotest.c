@@ -370,3 +370,49 @@ void autotest_dotprod_rrrf_struct_vs_ordinal()
         runtest_dotprod_rrrf(i);
 }
 
+// compare structured object and unrolled loop to ordinal computation for
+// each SIMD type supported by the host
+void autotest_dotprod_rrrf_simd()
+{
+    float tol = 1e-4;
+    liquid_simd_type simd = liquid_simd_get_type();
+
+    unsigned int t;
+    for (t=LIQUID_SIMD_PORTABLE; t<LIQUID_SIMD_NUM_TYPES; t++) {
+        if (!liquid_simd_is_supported(t)) {
+            if (liquid_autotest_verbose)
+                printf("  dotprod-rrrf [%-8s] : not supported\n", liquid_simd_type_str[t][0]);
+            continue;
+        }
+        liquid_simd_set_type(t);
+
+        // test lengths covering all unrolled loops and cleanup paths
+        unsigned int n;
+        for (n=1; n<=80; n++) {
+            float h[n];
+            float x[n];
+            float y, y_test = 0;
+            unsigned int i;
+            for (i=0; i<n; i++) {
+                h[i] = randnf();
+                x[i] = randnf();
+                y_test += h[i] * x[i];
+            }
+
+            // structured object
+            dotprod_rrrf dp = dotprod_rrrf_create(h,n);
+            dotprod_rrrf_execute(dp, x, &y);
+            dotprod_rrrf_destroy(dp);
+            CONTEND_DELTA(y, y_test, tol);
+
+            // unrolled loop
+            dotprod_rrrf_run4(h, x, n, &y);
+            CONTEND_DELTA(y, y_test, tol);
+        }
+        if (liquid_autotest_verbose)
+            printf("  dotprod-rrrf [%-8s] : pass\n", liquid_simd_type_str[t][0]);
+    }
+
+    // restore original SIMD type
+    liquid_simd_set_type(simd);
+}
@@ -31,6 +31,12 @@
     unsigned long int *_num_iterations) \
 { eqrls_cccf_train_bench(_start, _finish, _num_iterations, N); }
 
+#define EQFRLS_CCCF_TRAIN_BENCH_API(N)  \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ eqfrls_cccf_train_bench(_start, _finish, _num_iterations, N); }
+
 // Helper function to keep code base small
 void eqrls_cccf_train_bench(struct rusage *_start,
                             struct rusage *_finish,
@@ -77,6 +83,52 @@ void eqrls_cccf_train_bench(struct rusage *_start,
     eqrls_cccf_destroy(eq);
 }
 
+// Helper function to keep code base small
+void eqfrls_cccf_train_bench(struct rusage *_start,
+                             struct rusage *_finish,
+                             unsigned long int *_num_iterations,
+                             unsigned int _h_len)
+{
+    // scale number of iterations appropriately; complexity is linear
+    // in the filter length
+    *_num_iterations *= 40;
+    *_num_iterations /= 20 + _h_len;
+    *_num_iterations = (*_num_iterations < 4) ? 4 : *_num_iterations;
+
+    eqfrls_cccf eq = eqfrls_cccf_create(NULL,_h_len);
+
+    unsigned long int i;
+
+    // set up initial arrays to 'randomize' inputs/outputs
+    float complex y[11];
+    for (i=0; i<11; i++)
+        y[i] = randnf() + _Complex_I*randnf();
+
+    float complex d[13];
+    for (i=0; i<13; i++)
+        d[i] = randnf() + _Complex_I*randnf();
+
+    unsigned int iy=0;
+    unsigned int id=0;
+
+    float complex z;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        eqfrls_cccf_push(eq, y[iy]);    // push input into equalizer
+        eqfrls_cccf_execute(eq, &z);    // compute equalizer output
+        eqfrls_cccf_step(eq, d[id], z); // step equalizer internals
+
+        // update counters
+        iy = (iy+1)%11;
+        id = (id+1)%13;
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    eqfrls_cccf_destroy(eq);
+}
+
 // 
 void benchmark_eqrls_cccf_n4    EQRLS_CCCF_TRAIN_BENCH_API(4)
 void benchmark_eqrls_cccf_n8    EQRLS_CCCF_TRAIN_BENCH_API(8)
@@ -84,3 +136,12 @@ void benchmark_eqrls_cccf_n16   EQRLS_CCCF_TRAIN_BENCH_API(16)
 void benchmark_eqrls_cccf_n32   EQRLS_CCCF_TRAIN_BENCH_API(32)
 void benchmark_eqrls_cccf_n64   EQRLS_CCCF_TRAIN_BENCH_API(64)
 
+// fast transversal filter form
+void benchmark_eqfrls_cccf_n4   EQFRLS_CCCF_TRAIN_BENCH_API(4)
+void benchmark_eqfrls_cccf_n8   EQFRLS_CCCF_TRAIN_BENCH_API(8)
+void benchmark_eqfrls_cccf_n16  EQFRLS_CCCF_TRAIN_BENCH_API(16)
+void benchmark_eqfrls_cccf_n32  EQFRLS_CCCF_TRAIN_BENCH_API(32)
+void benchmark_eqfrls_cccf_n64  EQFRLS_CCCF_TRAIN_BENCH_API(64)
+void benchmark_eqfrls_cccf_n128 EQFRLS_CCCF_TRAIN_BENCH_API(128)
+void benchmark_eqfrls_cccf_n256 EQFRLS_CCCF_TRAIN_BENCH_API(256)
+
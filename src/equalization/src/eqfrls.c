@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2007 - 2016 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Fast recursive least-squares (RLS) equalizer
+//
+// Stabilized fast transversal filter (FTF) form of the RLS recursion,
+// requiring O(p) operations per step rather than the O(p^2) of eqrls.
+// The inverse correlation matrix is never formed; the gain vector is
+// propagated through a forward and a backward linear predictor of
+// order p, exploiting the shift structure of the input regressor. The
+// predictors are time-updated on every sample pushed, and each step
+// only updates the weights using the gain of the most recent regressor;
+// any number of samples may thus be pushed between steps (e.g. for a
+// fractionally-spaced equalizer). The a priori backward prediction
+// error is computed both from the order-update recursion and directly,
+// and the two are mixed to feed back round-off error (Slock & Kailath,
+// 1991). This is stable for forgetting factors close to one (roughly
+// lambda > 1 - 1/(2p)). As a rescue mechanism, the predictors are
+// restarted whenever the recursion loses numerical consistency (the
+// two backward errors diverge, the conversion factor leaves (0,1], or
+// a prediction error energy is not positive). The filter weights are
+// retained across a restart.
+//
+// All vectors are stored in window order (oldest sample first) to
+// operate directly on the input buffer. The weights follow the same
+// convention as eqrls: the output is the dot product of the weights
+// with the buffer, without conjugation.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+// error feedback constants for backward prediction error
+#define EQFRLS_K1   (1.5f)      // gain vector extraction
+#define EQFRLS_K2   (2.5f)      // backward error energy update
+
+// rescue threshold on squared difference between backward errors,
+// relative to the average backward error energy
+#define EQFRLS_RESCUE_THRESH    (1e-2f)
+
+struct EQFRLS(_s) {
+    unsigned int p;     // filter order
+    float lambda;       // RLS forgetting factor
+    float delta;        // RLS initialization factor
+
+    T * h0;             // initial coefficients
+    T * w;              // weights [px1]
+
+    // fast transversal filter state
+    T * a;              // forward predictor [(p+1)x1], a[p] = 1
+    T * c;              // backward predictor [(p+1)x1], c[0] = 1
+    T * k;              // normalized a priori gain [px1]
+    T * k1;             // order-extended gain [(p+1)x1]
+    float gamma;        // conversion factor, (0,1]
+    float F;            // forward prediction error energy
+    float B;            // backward prediction error energy
+
+    unsigned int n;             // samples pushed since restart
+    unsigned int num_rescues;   // number of restarts
+    WINDOW() buffer;    // input buffer [(p+1)x1]
+};
+
+// restart predictors, retaining filter weights
+void EQFRLS(_restart)(EQFRLS() _q);
+
+// time-update predictors and gain vector with most recent sample
+void EQFRLS(_update_predictors)(EQFRLS() _q);
+
+// create fast recursive least-squares (RLS) equalizer object
+//  _h      :   initial coefficients [size: _p x 1], default if NULL
+//  _p      :   equalizer length (number of taps)
+EQFRLS() EQFRLS(_create)(T *          _h,
+                         unsigned int _p)
+{
+    if (_p == 0) {
+        fprintf(stderr,"error: eqfrls_%s_create(), equalizer length must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    EQFRLS() q = (EQFRLS()) malloc(sizeof(struct EQFRLS(_s)));
+
+    // set filter order, other parameters
+    q->p      = _p;     // filter order
+    q->lambda = 0.99f;  // learning rate
+    q->delta  = 0.1f;   // initialization factor
+
+    // allocate memory for vectors
+    q->h0 = (T*) malloc((q->p  )*sizeof(T));
+    q->w  = (T*) malloc((q->p  )*sizeof(T));
+    q->a  = (T*) malloc((q->p+1)*sizeof(T));
+    q->c  = (T*) malloc((q->p+1)*sizeof(T));
+    q->k  = (T*) malloc((q->p  )*sizeof(T));
+    q->k1 = (T*) malloc((q->p+1)*sizeof(T));
+
+    q->buffer = WINDOW(_create)(q->p+1);
+
+    // copy coefficients (if not NULL)
+    if (_h == NULL) {
+        // initial coefficients with delta at first index
+        unsigned int i;
+        for (i=0; i<q->p; i++)
+            q->h0[i] = (i==0) ? 1.0 : 0.0;
+    } else {
+        // copy user-defined initial coefficients
+        memmove(q->h0, _h, (q->p)*sizeof(T));
+    }
+
+    // reset equalizer
+    EQFRLS(_reset)(q);
+
+    // return object
+    return q;
+}
+
+// re-create fast recursive least-squares (RLS) equalizer object
+//  _q  : old equalizer object
+//  _h  : filter coefficients (NULL for {1,0,0...})
+//  _p  : equalizer length (number of taps)
+EQFRLS() EQFRLS(_recreate)(EQFRLS()     _q,
+                           T *          _h,
+                           unsigned int _p)
+{
+    if (_q->p == _p && _h != NULL) {
+        // length hasn't changed; copy default coefficients
+        // and return object
+        memmove(_q->h0, _h, (_q->p)*sizeof(T));
+        return _q;
+    }
+
+    // completely destroy old equalizer object
+    EQFRLS(_destroy)(_q);
+
+    // create new one and return
+    return EQFRLS(_create)(_h,_p);
+}
+
+// destroy eqfrls object
+void EQFRLS(_destroy)(EQFRLS() _q)
+{
+    // free vectors
+    free(_q->h0);
+    free(_q->w);
+    free(_q->a);
+    free(_q->c);
+    free(_q->k);
+    free(_q->k1);
+
+    // destroy window buffer
+    WINDOW(_destroy)(_q->buffer);
+
+    // free main object memory
+    free(_q);
+}
+
+// print eqfrls object internals
+void EQFRLS(_print)(EQFRLS() _q)
+{
+    printf("equalizer (fast RLS):\n");
+    printf("    order:      %u\n", _q->p);
+    printf("    lambda:     %f\n", _q->lambda);
+    printf("    gamma:      %f\n", _q->gamma);
+    printf("    F, B:       %f, %f\n", _q->F, _q->B);
+    printf("    rescues:    %u\n", _q->num_rescues);
+}
+
+// reset equalizer
+void EQFRLS(_reset)(EQFRLS() _q)
+{
+    // reset predictors and counters
+    EQFRLS(_restart)(_q);
+    _q->num_rescues = 0;
+
+    // copy default coefficients
+    memmove(_q->w, _q->h0, (_q->p)*sizeof(T));
+
+    // clear window object
+    WINDOW(_reset)(_q->buffer);
+}
+
+// get learning rate of equalizer
+float EQFRLS(_get_bw)(EQFRLS() _q)
+{
+    return _q->lambda;
+}
+
+// set learning rate of equalizer
+//  _q      :   equalizer object
+//  _lambda :   RLS learning rate (should be close to 1.0), 0 < _lambda < 1
+void EQFRLS(_set_bw)(EQFRLS() _q,
+                     float    _lambda)
+{
+    if (_lambda < 0.0f || _lambda > 1.0f) {
+        printf("error: eqfrls_%s_set_bw(), learning rate must be in (0,1)\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // set internal value
+    _q->lambda = _lambda;
+
+    // soft-constrained initialization of predictors depends on the
+    // forgetting factor; restart them to keep the recursion consistent
+    EQFRLS(_restart)(_q);
+}
+
+// get number of times predictors were restarted
+unsigned int EQFRLS(_get_num_rescues)(EQFRLS() _q)
+{
+    return _q->num_rescues;
+}
+
+// push sample into equalizer internal buffer
+//  _q  :   equalizer object
+//  _x  :   received sample
+void EQFRLS(_push)(EQFRLS() _q,
+                   T        _x)
+{
+    // push value into buffer
+    WINDOW(_push)(_q->buffer, _x);
+
+    // update counter
+    if (_q->n <= _q->p)
+        _q->n++;
+
+    // time-update predictors with new regressor
+    EQFRLS(_update_predictors)(_q);
+}
+
+// execute internal dot product
+//  _q      :   equalizer object
+//  _y      :   output sample
+void EQFRLS(_execute)(EQFRLS() _q,
+                      T *      _y)
+{
+    // compute vector dot product with p most recent samples
+    T * r;      // read buffer
+    WINDOW(_read)(_q->buffer, &r);
+    DOTPROD(_run)(_q->w, r+1, _q->p, _y);
+}
+
+// execute cycle of equalizer, filtering output
+//  _q      :   equalizer object
+//  _d      :   desired output
+//  _d_hat  :   filtered output
+void EQFRLS(_step)(EQFRLS() _q,
+                   T        _d,
+                   T        _d_hat)
+{
+    // update weights with a posteriori error; the gain vector and
+    // conversion factor correspond to the most recent regressor
+    unsigned int i;
+    T alpha = _q->gamma * (_d - _d_hat);
+    for (i=0; i<_q->p; i++)
+        _q->w[i] += CONJ(_q->k[i]) * alpha;
+}
+
+// retrieve internal filter coefficients
+//  _q      :   equalizer object
+//  _w      :   weights [size: _p x 1]
+void EQFRLS(_get_weights)(EQFRLS() _q,
+                          T *      _w)
+{
+    // copy output weight vector, reversing order
+    unsigned int i;
+    for (i=0; i<_q->p; i++)
+        _w[i] = _q->w[_q->p-i-1];
+}
+
+// train equalizer object
+//  _q      :   equalizer object
+//  _w      :   initial weights / output weights
+//  _x      :   received sample vector
+//  _d      :   desired output vector
+//  _n      :   vector length
+void EQFRLS(_train)(EQFRLS()     _q,
+                    T *          _w,
+                    T *          _x,
+                    T *          _d,
+                    unsigned int _n)
+{
+    unsigned int i;
+    if (_n < _q->p) {
+        printf("warning: eqfrls_%s_train(), traning sequence less than filter order\n",
+                EXTENSION_FULL);
+        return;
+    }
+
+    // reset equalizer state
+    EQFRLS(_reset)(_q);
+
+    // copy initial weights into buffer
+    for (i=0; i<_q->p; i++)
+        _q->w[i] = _w[_q->p - i - 1];
+
+    T d_hat;
+    for (i=0; i<_n; i++) {
+        // push sample into internal buffer
+        EQFRLS(_push)(_q, _x[i]);
+
+        // execute vector dot product
+        EQFRLS(_execute)(_q, &d_hat);
+
+        // step through training cycle
+        EQFRLS(_step)(_q, _d[i], d_hat);
+    }
+
+    // copy output weight vector
+    EQFRLS(_get_weights)(_q, _w);
+}
+
+//
+// internal methods
+//
+
+// restart predictors with soft-constrained initialization,
+// retaining filter weights
+void EQFRLS(_restart)(EQFRLS() _q)
+{
+    unsigned int i;
+    for (i=0; i<=_q->p; i++) {
+        _q->a[i]  = (i==_q->p) ? 1.0 : 0.0;
+        _q->c[i]  = (i==0)     ? 1.0 : 0.0;
+        _q->k1[i] = 0;
+    }
+    for (i=0; i<_q->p; i++)
+        _q->k[i] = 0;
+
+    _q->n     = 0;
+    _q->gamma = 1.0f;
+    _q->F     = _q->delta;
+    _q->B     = _q->delta * powf(_q->lambda, -(float)(_q->p));
+}
+
+// time-update predictors and gain vector with most recent sample
+void EQFRLS(_update_predictors)(EQFRLS() _q)
+{
+    unsigned int i;
+    unsigned int p = _q->p;
+    float lambda   = _q->lambda;
+
+    // read buffer: r[0] = x(n-p), ..., r[p] = x(n)
+    T * r;
+    WINDOW(_read)(_q->buffer, &r);
+
+    // the predictors treat samples from before the most recent
+    // restart as zero (pre-windowed), consistent with their
+    // initialization; only the direct errors need to be masked
+    unsigned int i0 = p + 1 - _q->n;
+
+    // forward prediction: a priori and a posteriori errors
+    T eta = 0;
+    for (i=i0; i<=p; i++)
+        eta += CONJ(_q->a[i]) * r[i];
+    T f = _q->gamma * eta;
+
+    // order-extended gain [(p+1)x1] using previous forward predictor
+    T g = eta / (lambda*_q->F);
+    for (i=0; i<p; i++)
+        _q->k1[i] = _q->k[i] + _q->a[i]*g;
+    _q->k1[p] = g;
+
+    // order-extended conversion factor (inverse) and forward energy
+    float gamma_inv = 1.0f/_q->gamma + REAL(CONJ(g)*eta);
+    _q->F = lambda*_q->F + REAL(f*CONJ(eta));
+
+    // update forward predictor; a[p] = 1 is unchanged
+    for (i=0; i<p; i++)
+        _q->a[i] -= _q->k[i] * CONJ(f);
+
+    // backward prediction error from the order recursion and
+    // computed directly, mixed to feed back round-off error
+    T kp    = _q->k1[0];
+    T psi_f = lambda * _q->B * kp;
+    T psi_s = 0;
+    for (i=i0; i<=p; i++)
+        psi_s += CONJ(_q->c[i]) * r[i];
+    T psi_1 = EQFRLS_K1*psi_s + (1.0f-EQFRLS_K1)*psi_f;
+    T psi_2 = EQFRLS_K2*psi_s + (1.0f-EQFRLS_K2)*psi_f;
+
+    // order-p conversion factor and backward energy
+    gamma_inv -= REAL(CONJ(kp)*psi_s);
+    _q->gamma  = 1.0f / gamma_inv;
+    _q->B      = lambda*_q->B + _q->gamma * REAL(psi_2*CONJ(psi_2));
+
+    // rescue: restart predictors if recursion has lost stability;
+    // the gain vector is cleared and the next step leaves the
+    // weights unchanged
+    T     dpsi = psi_f - psi_s;
+    float disc = REAL(dpsi*CONJ(dpsi));
+    if ( !(_q->gamma > 0.0f && _q->gamma <= 1.0f) ||
+         !(_q->F > 0.0f && _q->F < HUGE_VALF) ||
+         !(_q->B > 0.0f && _q->B < HUGE_VALF) ||
+         !(disc <= EQFRLS_RESCUE_THRESH * (1.0f-lambda+1e-4f) * _q->B) )
+    {
+        EQFRLS(_restart)(_q);
+        _q->num_rescues++;
+        return;
+    }
+
+    // extract order-p gain aligned with r[1..p]
+    for (i=0; i<p; i++)
+        _q->k[i] = _q->k1[i+1] - _q->c[i+1]*kp;
+
+    // update backward predictor; c[0] = 1 is unchanged
+    T b = _q->gamma * psi_1;
+    for (i=0; i<p; i++)
+        _q->c[i+1] -= _q->k[i] * CONJ(b);
+}
@@ -32,6 +32,7 @@
 
 #define EQLMS(name)     LIQUID_CONCAT(eqlms_cccf,name)
 #define EQRLS(name)     LIQUID_CONCAT(eqrls_cccf,name)
+#define EQFRLS(name)    LIQUID_CONCAT(eqfrls_cccf,name)
 
 #define DOTPROD(name)   LIQUID_CONCAT(dotprod_cccf,name)
 #define WINDOW(name)    LIQUID_CONCAT(windowcf,name)
@@ -39,8 +40,11 @@
 
 #define T_COMPLEX       1
 #define T               float complex
+#define CONJ(X)         conjf(X)
+#define REAL(X)         crealf(X)
 
 #define PRINTVAL(V)     printf("%5.2f+j%5.2f ", crealf(V), cimagf(V));
 
 #include "eqlms.c"
 #include "eqrls.c"
+#include "eqfrls.c"
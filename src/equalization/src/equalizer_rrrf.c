@@ -32,6 +32,7 @@
 
 #define EQLMS(name)     LIQUID_CONCAT(eqlms_rrrf,name)
 #define EQRLS(name)     LIQUID_CONCAT(eqrls_rrrf,name)
+#define EQFRLS(name)    LIQUID_CONCAT(eqfrls_rrrf,name)
 
 #define DOTPROD(name)   LIQUID_CONCAT(dotprod_rrrf,name)
 #define WINDOW(name)    LIQUID_CONCAT(windowf,name)
@@ -39,8 +40,11 @@
 
 #define T_COMPLEX       0
 #define T               float
+#define CONJ(X)         (X)
+#define REAL(X)         (X)
 
 #define PRINTVAL(V)     printf("%5.2f ", V);
 
 #include "eqlms.c"
 #include "eqrls.c"
+#include "eqfrls.c"
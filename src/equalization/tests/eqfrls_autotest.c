@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2007 - 2016 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// generate received QPSK sequence through fixed channel
+//  _rng    :   random number generator
+//  _x      :   received samples [size: _n x 1]
+//  _d      :   transmitted symbols, delayed by 2 [size: _n x 1]
+//  _n      :   number of samples
+void eqfrls_autotest_gen(randgen         _rng,
+                         float complex * _x,
+                         float complex * _d,
+                         unsigned int    _n)
+{
+    float complex h[4] = {1.0f, 0.3f+0.2f*_Complex_I, -0.1f*_Complex_I, 0.05f};
+    firfilt_cccf f = firfilt_cccf_create(h,4);
+    float complex s[3] = {0,0,0};
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        uint32_t u = randgen_uint32(_rng);
+        s[2] = s[1];
+        s[1] = s[0];
+        s[0] = ((u&1 ? 1 : -1) + _Complex_I*(u&2 ? 1 : -1)) * M_SQRT1_2;
+
+        float complex v;
+        randgen_crandnf(_rng, &v);
+        firfilt_cccf_push(f, s[0]);
+        firfilt_cccf_execute(f, &_x[i]);
+        _x[i] += 0.01f*v;
+        _d[i]  = s[2];
+    }
+    firfilt_cccf_destroy(f);
+}
+
+// channel filter: delta with zero delay
+void autotest_eqfrls_rrrf_delta()
+{
+    float tol=1e-2f;        // error tolerance
+    unsigned int p=6;       // equalizer order
+    unsigned int n=64;      // number of symbols to observe
+    float d[n];             // transmitted data sequence
+    float w[p];             // equalizer filter coefficients
+    unsigned int i;
+
+    msequence ms = msequence_create_default(6);
+    for (i=0; i<n; i++)
+        d[i] = msequence_advance(ms) ? 1.0f : -1.0f;
+    msequence_destroy(ms);
+
+    // initialize weights, train equalizer
+    for (i=0; i<p; i++)
+        w[i] = 0;
+    eqfrls_rrrf eq = eqfrls_rrrf_create(NULL, p);
+    eqfrls_rrrf_train(eq, w, d, d, n);
+    CONTEND_EQUALITY(eqfrls_rrrf_get_num_rescues(eq), 0);
+    eqfrls_rrrf_destroy(eq);
+
+    // compare filter taps
+    CONTEND_DELTA(w[0], 1.0f, tol);
+    for (i=1; i<p; i++)
+        CONTEND_DELTA(w[i], 0.0f, tol);
+}
+
+// fast recursion must track the O(p^2) recursion
+void eqfrls_cccf_test_rls(unsigned int _p,
+                          float        _lambda)
+{
+    float tol = 1e-3f;
+    unsigned int n = 400;
+    float complex x[n], d[n];
+    randgen rng = randgen_create(_p);
+    eqfrls_autotest_gen(rng, x, d, n);
+    randgen_destroy(rng);
+
+    eqrls_cccf  q0 = eqrls_cccf_create (NULL, _p);
+    eqfrls_cccf q1 = eqfrls_cccf_create(NULL, _p);
+    eqrls_cccf_set_bw (q0, _lambda);
+    eqfrls_cccf_set_bw(q1, _lambda);
+
+    float complex w0[_p], w1[_p];
+    unsigned int i;
+    for (i=0; i<_p; i++)
+        w0[i] = w1[i] = 0;
+    eqrls_cccf_train (q0, w0, x, d, n);
+    eqfrls_cccf_train(q1, w1, x, d, n);
+    CONTEND_EQUALITY(eqfrls_cccf_get_num_rescues(q1), 0);
+
+    for (i=0; i<_p; i++) {
+        CONTEND_DELTA(crealf(w1[i]), crealf(w0[i]), tol);
+        CONTEND_DELTA(cimagf(w1[i]), cimagf(w0[i]), tol);
+    }
+    eqrls_cccf_destroy(q0);
+    eqfrls_cccf_destroy(q1);
+}
+void autotest_eqfrls_cccf_rls_p4()  { eqfrls_cccf_test_rls( 4, 0.99f ); }
+void autotest_eqfrls_cccf_rls_p12() { eqfrls_cccf_test_rls(12, 0.99f ); }
+void autotest_eqfrls_cccf_rls_p24() { eqfrls_cccf_test_rls(24, 0.995f); }
+
+// long run outside the stable range of forgetting factors must be
+// rescued and keep converging
+void autotest_eqfrls_cccf_rescue()
+{
+    unsigned int p = 16;
+    unsigned int n = 50000;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * d = (float complex*) malloc(n*sizeof(float complex));
+    randgen rng = randgen_create(7);
+    eqfrls_autotest_gen(rng, x, d, n);
+    randgen_destroy(rng);
+
+    eqfrls_cccf q = eqfrls_cccf_create(NULL, p);
+    eqfrls_cccf_set_bw(q, 0.9f);
+    unsigned int i;
+    float mse = 0;
+    for (i=0; i<n; i++) {
+        float complex y;
+        eqfrls_cccf_push(q, x[i]);
+        eqfrls_cccf_execute(q, &y);
+        eqfrls_cccf_step(q, d[i], y);
+        if (i >= n/2)
+            mse += crealf((d[i]-y)*conjf(d[i]-y));
+    }
+    mse /= (float)(n/2);
+    unsigned int num_rescues = eqfrls_cccf_get_num_rescues(q);
+    if (liquid_autotest_verbose)
+        printf("  mse: %12.4e, rescues: %u\n", mse, num_rescues);
+    CONTEND_GREATER_THAN(num_rescues, 0);
+    CONTEND_LESS_THAN(mse, 1e-2f);
+
+    eqfrls_cccf_destroy(q);
+    free(x);
+    free(d);
+}
+
+// predictors are updated on every push; weights must converge when
+// more than one sample is pushed for each step
+void autotest_eqfrls_cccf_multipush()
+{
+    unsigned int p = 8;
+    unsigned int n = 4000;
+    float complex x[n], d[n];
+    randgen rng = randgen_create(11);
+    eqfrls_autotest_gen(rng, x, d, n);
+    randgen_destroy(rng);
+
+    eqfrls_cccf q = eqfrls_cccf_create(NULL, p);
+    unsigned int i;
+    float mse = 0;
+    for (i=1; i<n; i+=2) {
+        float complex y;
+        eqfrls_cccf_push(q, x[i-1]);
+        eqfrls_cccf_push(q, x[i  ]);
+        eqfrls_cccf_execute(q, &y);
+        eqfrls_cccf_step(q, d[i], y);
+        if (i >= n/2)
+            mse += crealf((d[i]-y)*conjf(d[i]-y));
+    }
+    mse /= (float)(n/4);
+    if (liquid_autotest_verbose)
+        printf("  mse: %12.4e\n", mse);
+    CONTEND_EQUALITY(eqfrls_cccf_get_num_rescues(q), 0);
+    CONTEND_LESS_THAN(mse, 1e-2f);
+
+    eqfrls_cccf_destroy(q);
+}
+
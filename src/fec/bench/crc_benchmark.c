@@ -27,22 +27,32 @@
 
 #include "liquid.internal.h"
 
-#define CRC_BENCH_API(CRC,N)                \
+// CRC engines
+#define CRC_ENGINE_AUTO     0   // crc_generate_key()
+#define CRC_ENGINE_BITWISE  1   // one bit at a time
+#define CRC_ENGINE_TABLE    2   // slicing-by-8
+#define CRC_ENGINE_PCLMUL   3   // carry-less multiply (CRC-32 only)
+
+#define CRC_BENCH_API(CRC,N,ENGINE)         \
 (   struct rusage *_start,                  \
     struct rusage *_finish,                 \
     unsigned long int *_num_iterations)     \
-{ crc_bench(_start, _finish, _num_iterations, CRC, N); }
+{ crc_bench(_start, _finish, _num_iterations, CRC, N, ENGINE); }
 
-// Helper function to keep code base small
+// Helper function to keep code base small; each trial represents one
+// byte so the reported rate is in bytes per second (G t/s ~ GB/s)
 void crc_bench(struct rusage *_start,
                struct rusage *_finish,
                unsigned long int *_num_iterations,
                crc_scheme _crc,
-               unsigned int _n)
+               unsigned int _n,
+               int _engine)
 {
     // normalize number of iterations
-    if (_crc != LIQUID_CRC_CHECKSUM)
+    if (_engine == CRC_ENGINE_BITWISE)
         *_num_iterations /= 8;
+    *_num_iterations = *_num_iterations * 16 / _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
 
     unsigned long int i;
 
@@ -56,23 +66,68 @@ void crc_bench(struct rusage *_start,
 
     // start trials
     getrusage(RUSAGE_SELF, _start);
-    for (i=0; i<(*_num_iterations); i++) {
-        key ^= crc_generate_key(_crc, msg, _n);
-        key ^= crc_generate_key(_crc, msg, _n);
-        key ^= crc_generate_key(_crc, msg, _n);
-        key ^= crc_generate_key(_crc, msg, _n);
+    switch (_engine) {
+    case CRC_ENGINE_AUTO:
+        for (i=0; i<(*_num_iterations); i++) {
+            key ^= crc_generate_key(_crc, msg, _n);
+            key ^= crc_generate_key(_crc, msg, _n);
+            key ^= crc_generate_key(_crc, msg, _n);
+            key ^= crc_generate_key(_crc, msg, _n);
+        }
+        break;
+    case CRC_ENGINE_BITWISE:
+        for (i=0; i<(*_num_iterations); i++) {
+            key = crc_update_key_bitwise(_crc, key, msg, _n);
+            key = crc_update_key_bitwise(_crc, key, msg, _n);
+            key = crc_update_key_bitwise(_crc, key, msg, _n);
+            key = crc_update_key_bitwise(_crc, key, msg, _n);
+        }
+        break;
+    case CRC_ENGINE_TABLE:
+        for (i=0; i<(*_num_iterations); i++) {
+            key = crc_update_key_table(_crc, key, msg, _n);
+            key = crc_update_key_table(_crc, key, msg, _n);
+            key = crc_update_key_table(_crc, key, msg, _n);
+            key = crc_update_key_table(_crc, key, msg, _n);
+        }
+        break;
+    case CRC_ENGINE_PCLMUL:
+        for (i=0; i<(*_num_iterations); i++) {
+            key = crc32_update_key_pclmul(key, msg, _n);
+            key = crc32_update_key_pclmul(key, msg, _n);
+            key = crc32_update_key_pclmul(key, msg, _n);
+            key = crc32_update_key_pclmul(key, msg, _n);
+        }
+        break;
+    default:;
     }
     getrusage(RUSAGE_SELF, _finish);
-    *_num_iterations *= 4;
+    *_num_iterations *= 4 * _n;
+
+    // ensure key is used
+    if (key == 0x12345678)
+        printf("key: 0x%.8x\n", key);
 }
 
 //
 // BENCHMARKS
 //
-void benchmark_crc_checksum_n256    CRC_BENCH_API(LIQUID_CRC_CHECKSUM,  256)
+void benchmark_crc_checksum_n256        CRC_BENCH_API(LIQUID_CRC_CHECKSUM,  256, CRC_ENGINE_AUTO)
+
+void benchmark_crc_crc8_n256            CRC_BENCH_API(LIQUID_CRC_8,         256, CRC_ENGINE_AUTO)
+void benchmark_crc_crc16_n256           CRC_BENCH_API(LIQUID_CRC_16,        256, CRC_ENGINE_AUTO)
+void benchmark_crc_crc24_n256           CRC_BENCH_API(LIQUID_CRC_24,        256, CRC_ENGINE_AUTO)
+void benchmark_crc_crc32_n256           CRC_BENCH_API(LIQUID_CRC_32,        256, CRC_ENGINE_AUTO)
 
-void benchmark_crc_crc8_n256        CRC_BENCH_API(LIQUID_CRC_8,         256)
-void benchmark_crc_crc16_n256       CRC_BENCH_API(LIQUID_CRC_16,        256)
-void benchmark_crc_crc24_n256       CRC_BENCH_API(LIQUID_CRC_24,        256)
-void benchmark_crc_crc32_n256       CRC_BENCH_API(LIQUID_CRC_32,        256)
+// individual engines
+void benchmark_crc_crc8_bitwise_n1024   CRC_BENCH_API(LIQUID_CRC_8,        1024, CRC_ENGINE_BITWISE)
+void benchmark_crc_crc8_table_n1024     CRC_BENCH_API(LIQUID_CRC_8,        1024, CRC_ENGINE_TABLE)
+void benchmark_crc_crc16_bitwise_n1024  CRC_BENCH_API(LIQUID_CRC_16,       1024, CRC_ENGINE_BITWISE)
+void benchmark_crc_crc16_table_n1024    CRC_BENCH_API(LIQUID_CRC_16,       1024, CRC_ENGINE_TABLE)
+void benchmark_crc_crc24_bitwise_n1024  CRC_BENCH_API(LIQUID_CRC_24,       1024, CRC_ENGINE_BITWISE)
+void benchmark_crc_crc24_table_n1024    CRC_BENCH_API(LIQUID_CRC_24,       1024, CRC_ENGINE_TABLE)
+void benchmark_crc_crc32_bitwise_n1024  CRC_BENCH_API(LIQUID_CRC_32,       1024, CRC_ENGINE_BITWISE)
+void benchmark_crc_crc32_table_n1024    CRC_BENCH_API(LIQUID_CRC_32,       1024, CRC_ENGINE_TABLE)
+void benchmark_crc_crc32_pclmul_n1024   CRC_BENCH_API(LIQUID_CRC_32,       1024, CRC_ENGINE_PCLMUL)
+void benchmark_crc_crc32_pclmul_n65536  CRC_BENCH_API(LIQUID_CRC_32,      65536, CRC_ENGINE_PCLMUL)
 
@@ -42,32 +42,6 @@ void fec_decode_bench(
     unsigned int _n,
     void * _opts)
 {
-#if !LIBFEC_ENABLED
-    if ( _fs == LIQUID_FEC_CONV_V27    ||
-         _fs == LIQUID_FEC_CONV_V29    ||
-         _fs == LIQUID_FEC_CONV_V39    ||
-         _fs == LIQUID_FEC_CONV_V615   ||
-         _fs == LIQUID_FEC_CONV_V27P23 ||
-         _fs == LIQUID_FEC_CONV_V27P34 ||
-         _fs == LIQUID_FEC_CONV_V27P45 ||
-         _fs == LIQUID_FEC_CONV_V27P56 ||
-         _fs == LIQUID_FEC_CONV_V27P67 ||
-         _fs == LIQUID_FEC_CONV_V27P78 ||
-         _fs == LIQUID_FEC_CONV_V29P23 ||
-         _fs == LIQUID_FEC_CONV_V29P34 ||
-         _fs == LIQUID_FEC_CONV_V29P45 ||
-         _fs == LIQUID_FEC_CONV_V29P56 ||
-         _fs == LIQUID_FEC_CONV_V29P67 ||
-         _fs == LIQUID_FEC_CONV_V29P78 ||
-         _fs == LIQUID_FEC_RS_M8)
-    {
-        fprintf(stderr,"warning: convolutional, Reed-Solomon codes unavailable (install libfec)\n");
-        getrusage(RUSAGE_SELF, _start);
-        memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
-        return;
-    }
-#endif
-
     // normalize number of iterations
     *_num_iterations /= _n;
 
@@ -149,15 +123,22 @@ void benchmark_fec_dec_none_n64         FEC_DECODE_BENCH_API(LIQUID_FEC_NONE,
 void benchmark_fec_dec_rep3_n64         FEC_DECODE_BENCH_API(LIQUID_FEC_REP3,      64,  NULL)
 void benchmark_fec_dec_rep5_n64         FEC_DECODE_BENCH_API(LIQUID_FEC_REP5,      64,  NULL)
 void benchmark_fec_dec_hamming74_n64    FEC_DECODE_BENCH_API(LIQUID_FEC_HAMMING74, 64,  NULL)
+void benchmark_fec_dec_hamming74_n1024  FEC_DECODE_BENCH_API(LIQUID_FEC_HAMMING74,1024, NULL)
 void benchmark_fec_dec_hamming84_n64    FEC_DECODE_BENCH_API(LIQUID_FEC_HAMMING84, 64,  NULL)
+void benchmark_fec_dec_hamming84_n1024  FEC_DECODE_BENCH_API(LIQUID_FEC_HAMMING84,1024, NULL)
 void benchmark_fec_dec_hamming128_n64   FEC_DECODE_BENCH_API(LIQUID_FEC_HAMMING128,64,  NULL)
+void benchmark_fec_dec_hamming128_n1024 FEC_DECODE_BENCH_API(LIQUID_FEC_HAMMING128,1024,NULL)
 
 // SEC-DED block codes
 void benchmark_fec_dec_secded2216_n64   FEC_DECODE_BENCH_API(LIQUID_FEC_SECDED2216,64,  NULL)
+void benchmark_fec_dec_secded2216_n1024 FEC_DECODE_BENCH_API(LIQUID_FEC_SECDED2216,1024,NULL)
 void benchmark_fec_dec_secded3932_n64   FEC_DECODE_BENCH_API(LIQUID_FEC_SECDED3932,64,  NULL)
+void benchmark_fec_dec_secded3932_n1024 FEC_DECODE_BENCH_API(LIQUID_FEC_SECDED3932,1024,NULL)
 void benchmark_fec_dec_secded7264_n64   FEC_DECODE_BENCH_API(LIQUID_FEC_SECDED7264,64,  NULL)
+void benchmark_fec_dec_secded7264_n1024 FEC_DECODE_BENCH_API(LIQUID_FEC_SECDED7264,1024,NULL)
 
 void benchmark_fec_dec_golay2412_n64    FEC_DECODE_BENCH_API(LIQUID_FEC_GOLAY2412, 64,  NULL)
+void benchmark_fec_dec_golay2412_n1024  FEC_DECODE_BENCH_API(LIQUID_FEC_GOLAY2412,1024, NULL)
 
 void benchmark_fec_dec_conv27_n64       FEC_DECODE_BENCH_API(LIQUID_FEC_CONV_V27,  64,  NULL)
 void benchmark_fec_dec_conv29_n64       FEC_DECODE_BENCH_API(LIQUID_FEC_CONV_V29,  64,  NULL)
@@ -179,4 +160,10 @@ void benchmark_fec_dec_conv29p67_n64    FEC_DECODE_BENCH_API(LIQUID_FEC_CONV_V29
 void benchmark_fec_dec_conv29p78_n64    FEC_DECODE_BENCH_API(LIQUID_FEC_CONV_V29P78,64, NULL)
 
 void benchmark_fec_dec_rs8_n64          FEC_DECODE_BENCH_API(LIQUID_FEC_RS_M8,      64,  NULL)
+void benchmark_fec_dec_rs8_n223         FEC_DECODE_BENCH_API(LIQUID_FEC_RS_M8,     223, NULL)
+void benchmark_fec_dec_rs8_n1024        FEC_DECODE_BENCH_API(LIQUID_FEC_RS_M8,    1024, NULL)
 
+void benchmark_fec_dec_ldpc12_n64       FEC_DECODE_BENCH_API(LIQUID_FEC_LDPC_R12,   64,  NULL)
+void benchmark_fec_dec_ldpc23_n64       FEC_DECODE_BENCH_API(LIQUID_FEC_LDPC_R23,   64,  NULL)
+void benchmark_fec_dec_ldpc34_n64       FEC_DECODE_BENCH_API(LIQUID_FEC_LDPC_R34,   64,  NULL)
+void benchmark_fec_dec_ldpc56_n64       FEC_DECODE_BENCH_API(LIQUID_FEC_LDPC_R56,   64,  NULL)
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// benchmark layered min-sum LDPC decoder on noisy input
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include "liquid.internal.h"
+
+#define FEC_LDPC_BENCH_API(FS,N,SIGMA)  \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ fec_ldpc_bench(_start, _finish, _num_iterations, FS, N, SIGMA); }
+
+// Helper function to keep code base small
+void fec_ldpc_bench(struct rusage *     _start,
+                    struct rusage *     _finish,
+                    unsigned long int * _num_iterations,
+                    fec_scheme          _fs,
+                    unsigned int        _n,
+                    float               _sigma)
+{
+    // normalize number of iterations
+    *_num_iterations /= 20*_n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // generate fec object
+    fec q = fec_create(_fs,NULL);
+
+    // create arrays
+    unsigned int n_enc = fec_get_enc_msg_length(_fs,_n);
+    unsigned char msg[_n];          // original message
+    unsigned char msg_enc[n_enc];   // encoded message
+    unsigned char msg_soft[8*n_enc];// received message (soft bits)
+    unsigned char msg_dec[_n];      // decoded message
+
+    // initialze message
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        msg[i] = rand() & 0xff;
+
+    // encode message
+    fec_encode(q,_n,msg,msg_enc);
+
+    // modulate (BPSK), add noise, and compute soft bits
+    for (i=0; i<8*n_enc; i++) {
+        unsigned int bit = (msg_enc[i/8] >> (7-(i%8))) & 1;
+        float y = (bit ? -1.0f : 1.0f) + _sigma*randnf();
+        int soft = (int)(127.5f - 64.0f*y);
+        msg_soft[i] = soft < 0 ? 0 : (soft > 255 ? 255 : soft);
+    }
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        fec_decode_soft(q, _n, msg_soft, msg_dec);
+        fec_decode_soft(q, _n, msg_soft, msg_dec);
+        fec_decode_soft(q, _n, msg_soft, msg_dec);
+        fec_decode_soft(q, _n, msg_soft, msg_dec);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    // clean up objects
+    fec_destroy(q);
+}
+
+//
+// BENCHMARKS
+//
+void benchmark_fec_ldpc12_n16   FEC_LDPC_BENCH_API(LIQUID_FEC_LDPC_R12,  16, 0.60f)
+void benchmark_fec_ldpc12_n64   FEC_LDPC_BENCH_API(LIQUID_FEC_LDPC_R12,  64, 0.60f)
+void benchmark_fec_ldpc12_n144  FEC_LDPC_BENCH_API(LIQUID_FEC_LDPC_R12, 144, 0.60f)
+void benchmark_fec_ldpc23_n144  FEC_LDPC_BENCH_API(LIQUID_FEC_LDPC_R23, 144, 0.50f)
+void benchmark_fec_ldpc34_n144  FEC_LDPC_BENCH_API(LIQUID_FEC_LDPC_R34, 144, 0.45f)
+void benchmark_fec_ldpc56_n144  FEC_LDPC_BENCH_API(LIQUID_FEC_LDPC_R56, 144, 0.40f)
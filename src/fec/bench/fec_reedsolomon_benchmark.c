@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+//
+// benchmark native Reed-Solomon codec (8-bit symbols, 32 roots) on blocks
+// with errors and erasures; throughput [Mbps] = 8*(255-pad)*(trials/s)/1e6
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include "liquid.internal.h"
+
+#define FEC_RS_ENCODE_BENCH_API(PAD)        \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ fec_reedsolomon_encode_bench(_start, _finish, _num_iterations, PAD); }
+
+#define FEC_RS_DECODE_BENCH_API(PAD,E,X)    \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ fec_reedsolomon_decode_bench(_start, _finish, _num_iterations, PAD, E, X); }
+
+// Helper function to keep code base small
+void fec_reedsolomon_encode_bench(struct rusage *     _start,
+                                  struct rusage *     _finish,
+                                  unsigned long int * _num_iterations,
+                                  unsigned int        _pad)
+{
+    // normalize number of iterations
+    *_num_iterations /= 40;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    unsigned int n = 255 - _pad;
+    unsigned int k = n - 32;
+    void * q = fec_reedsolomon_create(8, 0x11d, 1, 1, 32, _pad);
+
+    unsigned char msg[n];
+    unsigned long int i;
+    for (i=0; i<k; i++)
+        msg[i] = rand() & 0xff;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        fec_reedsolomon_encode(q, msg, &msg[k]);
+        fec_reedsolomon_encode(q, msg, &msg[k]);
+        fec_reedsolomon_encode(q, msg, &msg[k]);
+        fec_reedsolomon_encode(q, msg, &msg[k]);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    fec_reedsolomon_destroy(q);
+}
+
+// Helper function to keep code base small
+void fec_reedsolomon_decode_bench(struct rusage *     _start,
+                                  struct rusage *     _finish,
+                                  unsigned long int * _num_iterations,
+                                  unsigned int        _pad,
+                                  unsigned int        _num_errors,
+                                  unsigned int        _num_erasures)
+{
+    // normalize number of iterations
+    *_num_iterations /= _num_errors + _num_erasures > 0 ? 200 : 40;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    unsigned int n = 255 - _pad;
+    unsigned int k = n - 32;
+    void * q = fec_reedsolomon_create(8, 0x11d, 1, 1, 32, _pad);
+
+    unsigned char msg[n];   // encoded block
+    unsigned char rec[n];   // received block
+    unsigned char buf[n];   // decoder buffer
+    int eras_pos[32];       // erasure positions
+    int pos[32];            // erasure positions (decoder copy)
+    unsigned long int i;
+    for (i=0; i<k; i++)
+        msg[i] = rand() & 0xff;
+    fec_reedsolomon_encode(q, msg, &msg[k]);
+
+    // corrupt evenly-spaced symbols: erasures first, then errors
+    memmove(rec, msg, n);
+    unsigned int step = n / (_num_errors + _num_erasures + 1);
+    for (i=0; i<_num_errors + _num_erasures; i++) {
+        rec[i*step] ^= 1 + rand() % 255;
+        if (i < _num_erasures)
+            eras_pos[i] = i*step;
+    }
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        memmove(buf, rec, n);
+        memmove(pos, eras_pos, _num_erasures*sizeof(int));
+        fec_reedsolomon_decode(q, buf, pos, _num_erasures);
+
+        memmove(buf, rec, n);
+        memmove(pos, eras_pos, _num_erasures*sizeof(int));
+        fec_reedsolomon_decode(q, buf, pos, _num_erasures);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 2;
+
+    fec_reedsolomon_destroy(q);
+}
+
+//
+// BENCHMARKS
+//
+void benchmark_fec_rs_enc_n255          FEC_RS_ENCODE_BENCH_API(  0)
+void benchmark_fec_rs_enc_n96           FEC_RS_ENCODE_BENCH_API(159)
+
+void benchmark_fec_rs_dec_n255_e0       FEC_RS_DECODE_BENCH_API(  0,  0,  0)
+void benchmark_fec_rs_dec_n255_e4       FEC_RS_DECODE_BENCH_API(  0,  4,  0)
+void benchmark_fec_rs_dec_n255_e16      FEC_RS_DECODE_BENCH_API(  0, 16,  0)
+void benchmark_fec_rs_dec_n255_e8_x16   FEC_RS_DECODE_BENCH_API(  0,  8, 16)
+void benchmark_fec_rs_dec_n255_x32      FEC_RS_DECODE_BENCH_API(  0,  0, 32)
+void benchmark_fec_rs_dec_n96_e0        FEC_RS_DECODE_BENCH_API(159,  0,  0)
+void benchmark_fec_rs_dec_n96_e16       FEC_RS_DECODE_BENCH_API(159, 16,  0)
@@ -48,32 +48,6 @@ void fecsoft_decode_bench(
     unsigned int _n,
     void * _opts)
 {
-#if !LIBFEC_ENABLED
-    if ( _fs == LIQUID_FEC_CONV_V27    ||
-         _fs == LIQUID_FEC_CONV_V29    ||
-         _fs == LIQUID_FEC_CONV_V39    ||
-         _fs == LIQUID_FEC_CONV_V615   ||
-         _fs == LIQUID_FEC_CONV_V27P23 ||
-         _fs == LIQUID_FEC_CONV_V27P34 ||
-         _fs == LIQUID_FEC_CONV_V27P45 ||
-         _fs == LIQUID_FEC_CONV_V27P56 ||
-         _fs == LIQUID_FEC_CONV_V27P67 ||
-         _fs == LIQUID_FEC_CONV_V27P78 ||
-         _fs == LIQUID_FEC_CONV_V29P23 ||
-         _fs == LIQUID_FEC_CONV_V29P34 ||
-         _fs == LIQUID_FEC_CONV_V29P45 ||
-         _fs == LIQUID_FEC_CONV_V29P56 ||
-         _fs == LIQUID_FEC_CONV_V29P67 ||
-         _fs == LIQUID_FEC_CONV_V29P78 ||
-         _fs == LIQUID_FEC_RS_M8)
-    {
-        fprintf(stderr,"warning: convolutional, Reed-Solomon codes unavailable (install libfec)\n");
-        getrusage(RUSAGE_SELF, _start);
-        memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
-        return;
-    }
-#endif
-
     // normalize number of iterations
     *_num_iterations /= _n;
 
@@ -159,6 +133,8 @@ void fecsoft_decode_bench(
 //
 // BENCHMARKS
 //
+// decoded throughput [Mbps] = 8 * N * (trials/s) / 1e6
+//
 void benchmark_fecsoft_dec_none_n64       FECSOFT_DECODE_BENCH_API(LIQUID_FEC_NONE,      64,  NULL)
 
 void benchmark_fecsoft_dec_rep3_n64       FECSOFT_DECODE_BENCH_API(LIQUID_FEC_REP3,      64,  NULL)
@@ -171,6 +147,8 @@ void benchmark_fecsoft_dec_conv27_n64     FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CO
 void benchmark_fecsoft_dec_conv29_n64     FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CONV_V29,  64,  NULL)
 void benchmark_fecsoft_dec_conv39_n64     FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CONV_V39,  64,  NULL)
 void benchmark_fecsoft_dec_conv615_n64    FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CONV_V615, 64,  NULL)
+void benchmark_fecsoft_dec_conv27_n1024   FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CONV_V27,  1024,NULL)
+void benchmark_fecsoft_dec_conv29_n1024   FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CONV_V29,  1024,NULL)
 
 void benchmark_fecsoft_dec_conv27p23_n64  FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CONV_V27P23,64, NULL)
 void benchmark_fecsoft_dec_conv27p34_n64  FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CONV_V27P34,64, NULL)
@@ -187,4 +165,10 @@ void benchmark_fecsoft_dec_conv29p67_n64  FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CO
 void benchmark_fecsoft_dec_conv29p78_n64  FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CONV_V29P78,64, NULL)
 
 void benchmark_fecsoft_dec_rs8_n64        FECSOFT_DECODE_BENCH_API(LIQUID_FEC_RS_M8,      64, NULL)
+void benchmark_fecsoft_dec_rs8_n223       FECSOFT_DECODE_BENCH_API(LIQUID_FEC_RS_M8,     223, NULL)
+void benchmark_fecsoft_dec_rs8_n1024      FECSOFT_DECODE_BENCH_API(LIQUID_FEC_RS_M8,    1024, NULL)
 
+void benchmark_fecsoft_dec_ldpc12_n64     FECSOFT_DECODE_BENCH_API(LIQUID_FEC_LDPC_R12,   64, NULL)
+void benchmark_fecsoft_dec_ldpc23_n64     FECSOFT_DECODE_BENCH_API(LIQUID_FEC_LDPC_R23,   64, NULL)
+void benchmark_fecsoft_dec_ldpc34_n64     FECSOFT_DECODE_BENCH_API(LIQUID_FEC_LDPC_R34,   64, NULL)
+void benchmark_fecsoft_dec_ldpc56_n64     FECSOFT_DECODE_BENCH_API(LIQUID_FEC_LDPC_R56,   64, NULL)
@@ -27,9 +27,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
 #include "liquid.internal.h"
 
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#  include <pthread.h>
+#endif
 
 // object-independent methods
 
@@ -127,6 +131,88 @@ unsigned int crc_generate_key(crc_scheme      _scheme,
     return 0;
 }
 
+// initialize running error-detection key for incremental computation
+//  _scheme     :   error-detection scheme
+unsigned int crc_init_key(crc_scheme _scheme)
+{
+    switch (_scheme) {
+    case LIQUID_CRC_UNKNOWN:
+        fprintf(stderr,"error: crc_init_key(), cannot generate key with CRC type \"UNKNOWN\"\n");
+        exit(-1);
+    case LIQUID_CRC_NONE:      return 0;
+    case LIQUID_CRC_CHECKSUM:  return 0;
+    case LIQUID_CRC_8:         return 0xff;
+    case LIQUID_CRC_16:        return 0xffff;
+    case LIQUID_CRC_24:        return 0xffffff;
+    case LIQUID_CRC_32:        return 0xffffffff;
+    default:
+        fprintf(stderr,"error: crc_init_key(), unknown/unsupported scheme: %d\n", _scheme);
+        exit(1);
+    }
+
+    return 0;
+}
+
+// update running error-detection key with next portion of message
+//  _scheme     :   error-detection scheme
+//  _key        :   running key from crc_init_key() or crc_update_key()
+//  _msg        :   input data message portion, [size: _n x 1]
+//  _n          :   input data message portion size
+unsigned int crc_update_key(crc_scheme      _scheme,
+                            unsigned int    _key,
+                            unsigned char * _msg,
+                            unsigned int    _n)
+{
+    switch (_scheme) {
+    case LIQUID_CRC_UNKNOWN:
+        fprintf(stderr,"error: crc_update_key(), cannot generate key with CRC type \"UNKNOWN\"\n");
+        exit(-1);
+    case LIQUID_CRC_NONE:
+        return 0;
+    case LIQUID_CRC_CHECKSUM:
+        return checksum_update_key(_key, _msg, _n);
+    case LIQUID_CRC_8:
+    case LIQUID_CRC_16:
+    case LIQUID_CRC_24:
+        return crc_update_key_table(_scheme, _key, _msg, _n);
+    case LIQUID_CRC_32:
+        // carry-less multiply folding pays off only for longer messages
+        if (_n >= 64 && crc32_pclmul_is_supported())
+            return crc32_update_key_pclmul(_key, _msg, _n);
+        return crc_update_key_table(_scheme, _key, _msg, _n);
+    default:
+        fprintf(stderr,"error: crc_update_key(), unknown/unsupported scheme: %d\n", _scheme);
+        exit(1);
+    }
+
+    return 0;
+}
+
+// finalize running error-detection key, returning same value as
+// crc_generate_key() would over the entire message
+//  _scheme     :   error-detection scheme
+//  _key        :   running key
+unsigned int crc_finalize_key(crc_scheme   _scheme,
+                              unsigned int _key)
+{
+    switch (_scheme) {
+    case LIQUID_CRC_UNKNOWN:
+        fprintf(stderr,"error: crc_finalize_key(), cannot generate key with CRC type \"UNKNOWN\"\n");
+        exit(-1);
+    case LIQUID_CRC_NONE:      return 0;
+    case LIQUID_CRC_CHECKSUM:  return (~_key + 1) & 0xff;
+    case LIQUID_CRC_8:         return (~_key) & 0xff;
+    case LIQUID_CRC_16:        return (~_key) & 0xffff;
+    case LIQUID_CRC_24:        return (~_key) & 0xffffff;
+    case LIQUID_CRC_32:        return (~_key) & 0xffffffff;
+    default:
+        fprintf(stderr,"error: crc_finalize_key(), unknown/unsupported scheme: %d\n", _scheme);
+        exit(1);
+    }
+
+    return 0;
+}
+
 // generate error-detection key and append to end of message
 //  _scheme     :   error-detection scheme (resulting in 'p' bytes)
 //  _msg        :   input data message, [size: _n+p x 1]
@@ -225,139 +311,348 @@ unsigned int crc_sizeof_key(crc_scheme _scheme)
 unsigned int checksum_generate_key(unsigned char *_data,
                                    unsigned int _n)
 {
-    unsigned int i, sum=0;
-    for (i=0; i<_n; i++)
-        sum += (unsigned int) (_data[i]);
-    //sum &= 0x00ff;
+    return crc_finalize_key(LIQUID_CRC_CHECKSUM, checksum_update_key(0, _data, _n));
+}
 
-    // mask and convert to 2's complement
-    unsigned char key = ~(sum&0x00ff) + 1;
+// update running 8-bit checksum (sum of all bytes, modulo 256)
+//  _key    :   running key
+//  _msg    :   input data message [size: _n x 1]
+//  _n      :   input data message size
+unsigned int checksum_update_key(unsigned int    _key,
+                                 unsigned char * _msg,
+                                 unsigned int    _n)
+{
+    unsigned int i, sum=_key;
+    for (i=0; i<_n; i++)
+        sum += (unsigned int) (_msg[i]);
 
-    return key;
+    return sum & 0x00ff;
 }
 
 
 // 
-// CRC-8
+// CRC-8, CRC-16, CRC-24, CRC-32
+//
+// All keys are computed on the bit-reversed register, processing the
+// least-significant bit of each byte first.
 //
 
-// generate 8-bit cyclic redundancy check key.
+// get reversed generator polynomial
+unsigned int crc_get_poly_reversed(crc_scheme _scheme)
+{
+    switch (_scheme) {
+    case LIQUID_CRC_8:  return liquid_reverse_byte_gentab[CRC8_POLY];
+    case LIQUID_CRC_16: return liquid_reverse_uint16(CRC16_POLY);
+    case LIQUID_CRC_24: return liquid_reverse_uint24(CRC24_POLY);
+    case LIQUID_CRC_32: return liquid_reverse_uint32(CRC32_POLY);
+    default:
+        fprintf(stderr,"error: crc_get_poly_reversed(), unknown/unsupported scheme: %d\n", _scheme);
+        exit(1);
+    }
+
+    return 0;
+}
+
+// update running CRC key
 //
 // slow method, operates one bit at a time
 // algorithm from: http://www.hackersdelight.org/crc.pdf
 //
+//  _scheme :   CRC scheme
+//  _key    :   running key
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
-unsigned int crc8_generate_key(unsigned char *_msg,
-                               unsigned int _n)
+unsigned int crc_update_key_bitwise(crc_scheme      _scheme,
+                                    unsigned int    _key,
+                                    unsigned char * _msg,
+                                    unsigned int    _n)
 {
-    unsigned int i, j, b, mask, key8=~0;
-    unsigned int poly = liquid_reverse_byte_gentab[CRC8_POLY];
+    unsigned int i, j, b, mask, key=_key;
+    unsigned int poly = crc_get_poly_reversed(_scheme);
     for (i=0; i<_n; i++) {
         b = _msg[i];
-        key8 ^= b;
+        key ^= b;
         for (j=0; j<8; j++) {
-            mask = -(key8 & 1);
-            key8 = (key8>>1) ^ (poly & mask);
+            mask = -(key & 1);
+            key = (key>>1) ^ (poly & mask);
         }
     }
-    return (~key8) & 0xff;
+    return key;
 }
 
+// slicing-by-8 tables for each CRC scheme; entry [k][b] holds the register
+// contribution of byte value b followed by k zero bytes
+static uint32_t crc_table[4][8][256];
 
-// 
-// CRC-16
-//
+// generate slicing-by-8 tables for CRC scheme
+static void crc_table_generate(crc_scheme _scheme)
+{
+    unsigned int s = _scheme - LIQUID_CRC_8;
+    unsigned int i, k;
+    unsigned char b;
+    for (i=0; i<256; i++) {
+        // shift register value i through one zero byte
+        b = 0;
+        crc_table[s][0][i] = crc_update_key_bitwise(_scheme, i, &b, 1);
+    }
+    for (k=1; k<8; k++) {
+        for (i=0; i<256; i++) {
+            uint32_t v = crc_table[s][k-1][i];
+            crc_table[s][k][i] = crc_table[s][0][v & 0xff] ^ (v >> 8);
+        }
+    }
+}
 
-// generate 16-bit cyclic redundancy check key.
-//
-// slow method, operates one bit at a time
-// algorithm from: http://www.hackersdelight.org/crc.pdf
-//
+// tables are generated on first use of each scheme; with pthreads,
+// pthread_once() guarantees that concurrent first calls generate a table
+// only once and that no caller reads it before it is complete
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+static pthread_once_t crc_table_once[4] = {
+    PTHREAD_ONCE_INIT, PTHREAD_ONCE_INIT, PTHREAD_ONCE_INIT, PTHREAD_ONCE_INIT};
+static void crc_table_generate_crc8 (void) { crc_table_generate(LIQUID_CRC_8);  }
+static void crc_table_generate_crc16(void) { crc_table_generate(LIQUID_CRC_16); }
+static void crc_table_generate_crc24(void) { crc_table_generate(LIQUID_CRC_24); }
+static void crc_table_generate_crc32(void) { crc_table_generate(LIQUID_CRC_32); }
+static void (*crc_table_generate_scheme[4])(void) = {
+    crc_table_generate_crc8,  crc_table_generate_crc16,
+    crc_table_generate_crc24, crc_table_generate_crc32};
+#  define CRC_TABLE_INIT(s) pthread_once(&crc_table_once[s], crc_table_generate_scheme[s])
+#else
+static int crc_table_init[4] = {0,0,0,0};
+#  define CRC_TABLE_INIT(s)                                 \
+    do {                                                    \
+        if (!crc_table_init[s]) {                           \
+            crc_table_generate(LIQUID_CRC_8 + (s));         \
+            crc_table_init[s] = 1;                          \
+        }                                                   \
+    } while (0)
+#endif
+
+// update running CRC key, slicing-by-8 method (eight bytes per iteration)
+//  _scheme :   CRC scheme
+//  _key    :   running key
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
-unsigned int crc16_generate_key(unsigned char *_msg,
-                                unsigned int _n)
+unsigned int crc_update_key_table(crc_scheme      _scheme,
+                                  unsigned int    _key,
+                                  unsigned char * _msg,
+                                  unsigned int    _n)
 {
-    unsigned int i, j, b, mask, key16=~0;
-    unsigned int poly = liquid_reverse_uint16(CRC16_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key16 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key16 & 1);
-            key16 = (key16>>1) ^ (poly & mask);
-        }
+    unsigned int s = _scheme - LIQUID_CRC_8;
+    if (s > 3) {
+        fprintf(stderr,"error: crc_update_key_table(), unknown/unsupported scheme: %d\n", _scheme);
+        exit(1);
+    }
+
+    // generate tables on first use
+    CRC_TABLE_INIT(s);
+
+    uint32_t (*t)[256] = crc_table[s];
+    uint32_t key = _key;
+    unsigned char * p = _msg;
+
+    // process eight bytes at a time; the register is at most 32 bits wide
+    // so it overlaps the first four bytes only
+    while (_n >= 8) {
+        uint32_t v0 = key ^ ( (uint32_t)p[0]        | ((uint32_t)p[1] << 8) |
+                             ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24) );
+        key = t[7][ v0        & 0xff] ^ t[6][(v0 >>  8) & 0xff] ^
+              t[5][(v0 >> 16) & 0xff] ^ t[4][ v0 >> 24        ] ^
+              t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+        p  += 8;
+        _n -= 8;
     }
-    return (~key16) & 0xffff;
+
+    // remaining bytes
+    while (_n--)
+        key = t[0][(key ^ *p++) & 0xff] ^ (key >> 8);
+
+    return key;
 }
 
+// generate 8-bit cyclic redundancy check key
+//  _msg    :   input data message [size: _n x 1]
+//  _n      :   input data message size
+unsigned int crc8_generate_key(unsigned char *_msg,
+                               unsigned int _n)
+{
+    unsigned int key = crc_init_key(LIQUID_CRC_8);
+    key = crc_update_key(LIQUID_CRC_8, key, _msg, _n);
+    return crc_finalize_key(LIQUID_CRC_8, key);
+}
 
-// 
-// CRC-24
-//
+// generate 16-bit cyclic redundancy check key
+//  _msg    :   input data message [size: _n x 1]
+//  _n      :   input data message size
+unsigned int crc16_generate_key(unsigned char *_msg,
+                                unsigned int _n)
+{
+    unsigned int key = crc_init_key(LIQUID_CRC_16);
+    key = crc_update_key(LIQUID_CRC_16, key, _msg, _n);
+    return crc_finalize_key(LIQUID_CRC_16, key);
+}
 
-// generate 24-bit cyclic redundancy check key.
-//
-// slow method, operates one bit at a time
-// algorithm from: http://www.hackersdelight.org/crc.pdf
-//
+// generate 24-bit cyclic redundancy check key
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
 unsigned int crc24_generate_key(unsigned char *_msg,
                                 unsigned int _n)
 {
-    unsigned int i, j, b, mask, key24=~0;
-    unsigned int poly = liquid_reverse_uint24(CRC24_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key24 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key24 & 1);
-            key24 = (key24>>1) ^ (poly & mask);
-        }
-    }
-    return (~key24) & 0xffffff;
+    unsigned int key = crc_init_key(LIQUID_CRC_24);
+    key = crc_update_key(LIQUID_CRC_24, key, _msg, _n);
+    return crc_finalize_key(LIQUID_CRC_24, key);
 }
 
-
-// 
-// CRC-32
-//
-
-// generate 32-bit cyclic redundancy check key.
-//
-// slow method, operates one bit at a time
-// algorithm from: http://www.hackersdelight.org/crc.pdf
-//
+// generate 32-bit cyclic redundancy check key
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
 unsigned int crc32_generate_key(unsigned char *_msg,
                                 unsigned int _n)
 {
-    unsigned int i, j, b, mask, key32=~0;
-    unsigned int poly = liquid_reverse_uint32(CRC32_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key32 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key32 & 1);
-            key32 = (key32>>1) ^ (poly & mask);
-        }
+    unsigned int key = crc_init_key(LIQUID_CRC_32);
+    key = crc_update_key(LIQUID_CRC_32, key, _msg, _n);
+    return crc_finalize_key(LIQUID_CRC_32, key);
+}
+
+
+//
+// CRC-32, carry-less multiplication (PCLMULQDQ)
+//
+// Folds the message 64 bytes at a time into four 128-bit accumulators,
+// reduces to 32 bits with a Barrett reduction, and finishes any trailing
+// bytes with the slicing-by-8 tables; see "Fast CRC Computation for
+// Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009).
+//
+
+#if LIQUID_SIMD_X86_TARGETS
+#include <immintrin.h>
+
+// fold 16-byte multiples of message, _n >= 64
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t crc32_fold_pclmul(uint32_t              _key,
+                                  const unsigned char * _msg,
+                                  unsigned int          _n)
+{
+    // folding constants for reversed polynomial 0x04C11DB7
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000LL, 0x0163cd6124LL);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+    const __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+    // load first 64 bytes and combine with running key
+    x1 = _mm_loadu_si128((const __m128i*)(_msg + 0x00));
+    x2 = _mm_loadu_si128((const __m128i*)(_msg + 0x10));
+    x3 = _mm_loadu_si128((const __m128i*)(_msg + 0x20));
+    x4 = _mm_loadu_si128((const __m128i*)(_msg + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)_key));
+    _msg += 64;
+    _n   -= 64;
+
+    // fold 64 bytes at a time
+    x0 = k1k2;
+    while (_n >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i*)(_msg + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i*)(_msg + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i*)(_msg + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i*)(_msg + 0x30)));
+
+        _msg += 64;
+        _n   -= 64;
     }
-    return (~key32) & 0xffffffff;
+
+    // fold four accumulators into one
+    x0 = k3k4;
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // fold remaining 16-byte blocks
+    while (_n >= 16) {
+        x2 = _mm_loadu_si128((const __m128i*)_msg);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        _msg += 16;
+        _n   -= 16;
+    }
+
+    // fold 128 bits to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+
+    x0 = k5k0;
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = poly;
+    x2 = _mm_and_si128(x1, mask);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, mask);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (uint32_t) _mm_extract_epi32(x1, 1);
 }
+#endif
 
-#if 0
-void crc32_generate_key(unsigned char *_msg,
-                        unsigned int _n,
-                        unsigned char *_key)
+// determine if carry-less multiply CRC-32 engine is supported by host and
+// permitted by liquid_simd_set_type()
+int crc32_pclmul_is_supported(void)
 {
-    unsigned int key32 = crc32_generate_key32(_msg,_n);
-    _key[0] = (key32 & 0xFF000000) >> 24;
-    _key[1] = (key32 & 0x00FF0000) >> 16;
-    _key[2] = (key32 & 0x0000FF00) >> 8;
-    _key[3] = (key32 & 0x000000FF);
+#if LIQUID_SIMD_X86_TARGETS && !defined LIQUID_SIMDOVERRIDE
+    static int supported = -1;
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("pclmul") &&
+                    __builtin_cpu_supports("sse4.1") ? 1 : 0;
+    }
+    return supported && liquid_simd_select(LIQUID_SIMD_SSE) == LIQUID_SIMD_SSE;
+#else
+    return 0;
+#endif
 }
+
+// update running CRC-32 key using carry-less multiplication
+//  _key    :   running key
+//  _msg    :   input data message [size: _n x 1]
+//  _n      :   input data message size
+unsigned int crc32_update_key_pclmul(unsigned int    _key,
+                                     unsigned char * _msg,
+                                     unsigned int    _n)
+{
+#if LIQUID_SIMD_X86_TARGETS
+    if (_n >= 64 && crc32_pclmul_is_supported()) {
+        unsigned int m = _n & ~0x0fu;   // multiple of 16 bytes
+        _key = crc32_fold_pclmul(_key, _msg, m);
+        _msg += m;
+        _n   -= m;
+    }
 #endif
+    return crc_update_key_table(LIQUID_CRC_32, _key, _msg, _n);
+}
 
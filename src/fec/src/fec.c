@@ -61,7 +61,11 @@ const char * fec_scheme_str[LIQUID_FEC_NUM_SCHEMES][2] = {
     {"v29p56",      "convolutional r5/6 K=9 (punctured)"},
     {"v29p67",      "convolutional r6/7 K=9 (punctured)"},
     {"v29p78",      "convolutional r7/8 K=9 (punctured)"},
-    {"rs8",         "Reed-Solomon, 223/255"}
+    {"rs8",         "Reed-Solomon, 223/255"},
+    {"ldpc12",      "LDPC r1/2 (quasi-cyclic)"},
+    {"ldpc23",      "LDPC r2/3 (quasi-cyclic)"},
+    {"ldpc34",      "LDPC r3/4 (quasi-cyclic)"},
+    {"ldpc56",      "LDPC r5/6 (quasi-cyclic)"}
 };
 
 // Print compact list of existing and available fec schemes
@@ -73,10 +77,6 @@ void liquid_print_fec_schemes()
     // print all available MOD schemes
     printf("          ");
     for (i=0; i<LIQUID_FEC_NUM_SCHEMES; i++) {
-#if !LIBFEC_ENABLED
-        if ( fec_scheme_is_convolutional(i) || fec_scheme_is_reedsolomon(i) )
-            continue;
-#endif
         printf("%s", fec_scheme_str[i][0]);
 
         if (i != LIQUID_FEC_NUM_SCHEMES-1)
@@ -200,6 +200,21 @@ int fec_scheme_is_repeat(fec_scheme _scheme)
 }
 
 
+// is scheme LDPC?
+int fec_scheme_is_ldpc(fec_scheme _scheme)
+{
+    switch (_scheme) {
+    case LIQUID_FEC_LDPC_R12:
+    case LIQUID_FEC_LDPC_R23:
+    case LIQUID_FEC_LDPC_R34:
+    case LIQUID_FEC_LDPC_R56:
+        return 1;
+    default:;
+    }
+    return 0;
+}
+
+
 // return the encoded message length using a particular error-
 // correction scheme (object-independent method)
 //  _scheme     :   forward error-correction scheme
@@ -220,7 +235,12 @@ unsigned int fec_get_enc_msg_length(fec_scheme _scheme,
     case LIQUID_FEC_SECDED3932:     return _msg_len + _msg_len/4 + ((_msg_len%4) ? 1 : 0);
     case LIQUID_FEC_SECDED7264:     return _msg_len + _msg_len/8 + ((_msg_len%8) ? 1 : 0);
 
-#if LIBFEC_ENABLED
+    // LDPC codes
+    case LIQUID_FEC_LDPC_R12:       return fec_ldpc_get_enc_msg_len(_msg_len,12);
+    case LIQUID_FEC_LDPC_R23:       return fec_ldpc_get_enc_msg_len(_msg_len,8);
+    case LIQUID_FEC_LDPC_R34:       return fec_ldpc_get_enc_msg_len(_msg_len,6);
+    case LIQUID_FEC_LDPC_R56:       return fec_ldpc_get_enc_msg_len(_msg_len,4);
+
     // convolutional codes
     case LIQUID_FEC_CONV_V27:       return 2*_msg_len + 2;  // (K-1)/r=12, round up to 2 bytes
     case LIQUID_FEC_CONV_V29:       return 2*_msg_len + 2;  // (K-1)/r=16, 2 bytes
@@ -242,32 +262,6 @@ unsigned int fec_get_enc_msg_length(fec_scheme _scheme,
 
     // Reed-Solomon codes
     case LIQUID_FEC_RS_M8:          return fec_rs_get_enc_msg_len(_msg_len,32,255,223);
-#else
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
-        fprintf(stderr, "error: fec_get_enc_msg_length(), convolutional codes unavailable (install libfec)\n");
-        exit(-1);
-
-    case LIQUID_FEC_RS_M8:
-        fprintf(stderr, "error: fec_get_enc_msg_length(), Reed-Solomon codes unavailable (install libfec)\n");
-        exit(-1);
-#endif
     default:
         printf("error: fec_get_enc_msg_length(), unknown/unsupported scheme: %d\n", _scheme);
         exit(-1);
@@ -276,6 +270,25 @@ unsigned int fec_get_enc_msg_length(fec_scheme _scheme,
     return 0;
 }
 
+// return the encoded message length using a particular error-
+// correction scheme and options (object-independent method)
+//  _scheme     :   forward error-correction scheme
+//  _opts       :   options (see fec_create())
+//  _msg_len    :   raw, uncoded message length
+unsigned int fec_get_enc_msg_length_opts(fec_scheme _scheme,
+                                         void * _opts,
+                                         unsigned int _msg_len)
+{
+    // tail-biting convolutional codes carry no tail bits
+    if (fec_scheme_is_convolutional(_scheme) && _opts != NULL &&
+        ((fec_conv_opts_s*)_opts)->tailbiting)
+    {
+        return fec_conv_get_enc_msg_len_tailbiting(_scheme, _msg_len);
+    }
+
+    return fec_get_enc_msg_length(_scheme, _msg_len);
+}
+
 // compute encoded message length for block codes
 //  _dec_msg_len    :   decoded message length (bytes)
 //  _m              :   input block size (bits)
@@ -340,6 +353,38 @@ unsigned int fec_conv_get_enc_msg_len(unsigned int _dec_msg_len,
     return num_bytes_out;
 }
 
+// compute encoded message length for tail-biting convolutional codes;
+// equivalent to a zero-terminated code with no tail (K=1)
+//  _scheme         :   convolutional scheme (punctured or otherwise)
+//  _dec_msg_len    :   decoded message length
+unsigned int fec_conv_get_enc_msg_len_tailbiting(fec_scheme   _scheme,
+                                                 unsigned int _dec_msg_len)
+{
+    switch (_scheme) {
+    case LIQUID_FEC_CONV_V27:       return 2*_dec_msg_len;
+    case LIQUID_FEC_CONV_V29:       return 2*_dec_msg_len;
+    case LIQUID_FEC_CONV_V39:       return 3*_dec_msg_len;
+    case LIQUID_FEC_CONV_V615:      return 6*_dec_msg_len;
+    case LIQUID_FEC_CONV_V27P23:
+    case LIQUID_FEC_CONV_V29P23:    return fec_conv_get_enc_msg_len(_dec_msg_len,1,2);
+    case LIQUID_FEC_CONV_V27P34:
+    case LIQUID_FEC_CONV_V29P34:    return fec_conv_get_enc_msg_len(_dec_msg_len,1,3);
+    case LIQUID_FEC_CONV_V27P45:
+    case LIQUID_FEC_CONV_V29P45:    return fec_conv_get_enc_msg_len(_dec_msg_len,1,4);
+    case LIQUID_FEC_CONV_V27P56:
+    case LIQUID_FEC_CONV_V29P56:    return fec_conv_get_enc_msg_len(_dec_msg_len,1,5);
+    case LIQUID_FEC_CONV_V27P67:
+    case LIQUID_FEC_CONV_V29P67:    return fec_conv_get_enc_msg_len(_dec_msg_len,1,6);
+    case LIQUID_FEC_CONV_V27P78:
+    case LIQUID_FEC_CONV_V29P78:    return fec_conv_get_enc_msg_len(_dec_msg_len,1,7);
+    default:
+        fprintf(stderr,"error: fec_conv_get_enc_msg_len_tailbiting(), invalid scheme: %d\n", _scheme);
+        exit(1);
+    }
+
+    return 0;
+}
+
 // compute encoded message length for Reed-Solomon codes
 //  _dec_msg_len    :   decoded message length
 //  _nroots         :   number of roots in polynomial
@@ -414,8 +459,13 @@ float fec_get_rate(fec_scheme _scheme)
     case LIQUID_FEC_SECDED3932:     return 4./5.;   // ultimately 32/39 ~ 0.82051
     case LIQUID_FEC_SECDED7264:     return 8./9.;
 
+    // LDPC codes
+    case LIQUID_FEC_LDPC_R12:       return 1./2.;
+    case LIQUID_FEC_LDPC_R23:       return 2./3.;
+    case LIQUID_FEC_LDPC_R34:       return 3./4.;
+    case LIQUID_FEC_LDPC_R56:       return 5./6.;
+
     // convolutional codes
-#if LIBFEC_ENABLED
     case LIQUID_FEC_CONV_V27:       return 1./2.;
     case LIQUID_FEC_CONV_V29:       return 1./2.;
     case LIQUID_FEC_CONV_V39:       return 1./3.;
@@ -435,32 +485,6 @@ float fec_get_rate(fec_scheme _scheme)
 
     // Reed-Solomon codes
     case LIQUID_FEC_RS_M8:          return 223./255.;
-#else
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
-        fprintf(stderr,"error: fec_get_rate(), convolutional codes unavailable (install libfec)\n");
-        exit(-1);
-
-    case LIQUID_FEC_RS_M8:
-        fprintf(stderr,"error: fec_get_rate(), Reed-Solomon codes unavailable (install libfec)\n");
-        exit(-1);
-#endif
 
     default:
         printf("error: fec_get_rate(), unknown/unsupported scheme: %d\n", _scheme);
@@ -471,7 +495,7 @@ float fec_get_rate(fec_scheme _scheme)
 
 // create a fec object of a particular scheme
 //  _scheme     :   error-correction scheme
-//  _opts       :   (ignored)
+//  _opts       :   options (fec_conv_opts_s for convolutional codes)
 fec fec_create(fec_scheme _scheme, void *_opts)
 {
     switch (_scheme) {
@@ -502,13 +526,19 @@ fec fec_create(fec_scheme _scheme, void *_opts)
     case LIQUID_FEC_SECDED7264:
         return fec_secded7264_create(_opts);
 
+    // LDPC codes
+    case LIQUID_FEC_LDPC_R12:
+    case LIQUID_FEC_LDPC_R23:
+    case LIQUID_FEC_LDPC_R34:
+    case LIQUID_FEC_LDPC_R56:
+        return fec_ldpc_create(_scheme);
+
     // convolutional codes
-#if LIBFEC_ENABLED
     case LIQUID_FEC_CONV_V27:
     case LIQUID_FEC_CONV_V29:
     case LIQUID_FEC_CONV_V39:
     case LIQUID_FEC_CONV_V615:
-        return fec_conv_create(_scheme);
+        return fec_conv_create(_scheme,_opts);
 
     // punctured
     case LIQUID_FEC_CONV_V27P23:
@@ -524,37 +554,11 @@ fec fec_create(fec_scheme _scheme, void *_opts)
     case LIQUID_FEC_CONV_V29P56:
     case LIQUID_FEC_CONV_V29P67:
     case LIQUID_FEC_CONV_V29P78:
-        return fec_conv_punctured_create(_scheme);
+        return fec_conv_punctured_create(_scheme,_opts);
 
     // Reed-Solomon codes
     case LIQUID_FEC_RS_M8:
         return fec_rs_create(_scheme);
-#else
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
-        fprintf(stderr,"error: fec_create(), convolutional codes unavailable (install libfec)\n");
-        exit(-1);
-
-    case LIQUID_FEC_RS_M8:
-        fprintf(stderr,"error: fec_create(), Reed-Solomon codes unavailable (install libfec)\n");
-        exit(-1);
-#endif
 
     default:
         printf("error: fec_create(), unknown/unsupported scheme: %d\n", _scheme);
@@ -569,12 +573,17 @@ fec fec_create(fec_scheme _scheme, void *_opts)
 // recreate a fec object
 //  _q      :   initial fec object
 //  _scheme :   new scheme
-//  _opts   :   options (ignored)
+//  _opts   :   options (fec_conv_opts_s for convolutional codes)
 fec fec_recreate(fec _q,
                  fec_scheme _scheme,
                  void *_opts)
 {
-    if (_q->scheme != _scheme) {
+    // convolutional codes must also be re-created when the framing changes
+    int tailbiting = _opts != NULL && ((fec_conv_opts_s*)_opts)->tailbiting;
+    int reframe = _q->scheme == _scheme && fec_scheme_is_convolutional(_scheme) &&
+                  _q->tailbiting != tailbiting;
+
+    if (_q->scheme != _scheme || reframe) {
         // destroy old object and create new one
         fec_destroy(_q);
         _q = fec_create(_scheme,_opts);
@@ -625,8 +634,15 @@ void fec_destroy(fec _q)
         fec_secded7264_destroy(_q);
         return;
 
+    // LDPC codes
+    case LIQUID_FEC_LDPC_R12:
+    case LIQUID_FEC_LDPC_R23:
+    case LIQUID_FEC_LDPC_R34:
+    case LIQUID_FEC_LDPC_R56:
+        fec_ldpc_destroy(_q);
+        return;
+
     // convolutional codes
-#if LIBFEC_ENABLED
     case LIQUID_FEC_CONV_V27:
     case LIQUID_FEC_CONV_V29:
     case LIQUID_FEC_CONV_V39:
@@ -655,32 +671,6 @@ void fec_destroy(fec _q)
     case LIQUID_FEC_RS_M8:
         fec_rs_destroy(_q);
         return;
-#else
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
-        fprintf(stderr,"error: fec_destroy(), convolutional codes unavailable (install libfec)\n");
-        exit(-1);
-
-    case LIQUID_FEC_RS_M8:
-        fprintf(stderr,"error: fec_destroy(), Reed-Solomon codes unavailable (install libfec)\n");
-        exit(-1);
-#endif
 
     default:
         printf("error: fec_destroy(), unknown/unsupported scheme: %d\n", _q->scheme);
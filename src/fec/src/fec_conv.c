@@ -32,10 +32,8 @@
 
 #define VERBOSE_FEC_CONV    0
 
-#if LIBFEC_ENABLED
-#include "fec.h"
-
-fec fec_conv_create(fec_scheme _fs)
+fec fec_conv_create(fec_scheme _fs,
+                    void *     _opts)
 {
     fec q = (fec) malloc(sizeof(struct fec_s));
 
@@ -56,6 +54,9 @@ fec fec_conv_create(fec_scheme _fs)
         exit(1);
     }
 
+    // framing options
+    q->tailbiting = _opts == NULL ? 0 : ((fec_conv_opts_s*)_opts)->tailbiting;
+
     // convolutional-specific decoding
     q->num_dec_bytes = 0;
     q->enc_bits = NULL;
@@ -89,6 +90,10 @@ void fec_conv_encode(fec _q,
     unsigned char byte_in;
     unsigned char byte_out=0;
 
+    // tail-biting: start in final encoder state
+    if (_q->tailbiting)
+        sr = fec_conv_tailbiting_state(_q->K, _dec_msg_len, _msg_dec);
+
     for (i=0; i<_dec_msg_len; i++) {
         byte_in = _msg_dec[i];
 
@@ -100,21 +105,21 @@ void fec_conv_encode(fec _q,
 
             // compute parity bits for each polynomial
             for (r=0; r<_q->R; r++) {
-                byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+                byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
                 _msg_enc[n/8] = byte_out;
                 n++;
             }
         }
     }
 
-    // tail bits
-    for (i=0; i<(_q->K)-1; i++) {
+    // tail bits (none when tail-biting)
+    for (i=0; i<(_q->tailbiting ? 0 : (_q->K)-1); i++) {
         // shift register: push zeros
         sr = (sr << 1);
 
         // compute parity bits for each polynomial
         for (r=0; r<_q->R; r++) {
-            byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+            byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
             _msg_enc[n/8] = byte_out;
             n++;
         }
@@ -128,7 +133,9 @@ void fec_conv_encode(fec _q,
         n++;
     }
 
-    assert(n == 8*fec_get_enc_msg_length(_q->scheme,_dec_msg_len));
+    assert(n == 8*(_q->tailbiting ?
+                   fec_conv_get_enc_msg_len_tailbiting(_q->scheme,_dec_msg_len) :
+                   fec_get_enc_msg_length(_q->scheme,_dec_msg_len)));
 }
 
 //unsigned int
@@ -191,9 +198,13 @@ void fec_conv_decode(fec _q,
                      unsigned char *_msg_dec)
 {
     // run decoder
-    _q->init_viterbi(_q->vp,0);
-    _q->update_viterbi_blk(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
-    _q->chainback_viterbi(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
+    if (_q->tailbiting) {
+        fec_viterbi_decode_tailbiting(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes, _msg_dec);
+    } else {
+        _q->init_viterbi(_q->vp,0);
+        _q->update_viterbi_blk(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
+        _q->chainback_viterbi(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
+    }
 
 #if VERBOSE_FEC_CONV
     for (i=0; i<_dec_msg_len; i++)
@@ -217,8 +228,9 @@ void fec_conv_setlength(fec _q, unsigned int _dec_msg_len)
 
     // reset number of framebits
     _q->num_dec_bytes = num_dec_bytes;
-    _q->num_enc_bytes = fec_get_enc_msg_length(_q->scheme,
-                                               _dec_msg_len);
+    _q->num_enc_bytes = _q->tailbiting ?
+        fec_conv_get_enc_msg_len_tailbiting(_q->scheme, _dec_msg_len) :
+        fec_get_enc_msg_length(_q->scheme, _dec_msg_len);
 
     // delete old decoder if necessary
     if (_q->vp != NULL)
@@ -230,6 +242,29 @@ void fec_conv_setlength(fec _q, unsigned int _dec_msg_len)
                                             _q->num_enc_bytes*8*sizeof(unsigned char));
 }
 
+// tail-biting: initial encoder state, given by the final K-1 message
+// bits (repeated circularly for messages shorter than K-1 bits)
+//  _K              :   constraint length
+//  _dec_msg_len    :   decoded message length (bytes)
+//  _msg_dec        :   decoded message [size: _dec_msg_len x 1]
+unsigned int fec_conv_tailbiting_state(unsigned int    _K,
+                                       unsigned int    _dec_msg_len,
+                                       unsigned char * _msg_dec)
+{
+    unsigned int num_bits = 8*_dec_msg_len;
+    if (num_bits == 0)
+        return 0;
+
+    unsigned int sr = 0;
+    unsigned int i0 = num_bits - (_K-1) % num_bits;
+    unsigned int i;
+    for (i=0; i<_K-1; i++) {
+        unsigned int k = (i0 + i) % num_bits;
+        sr = (sr << 1) | ((_msg_dec[k/8] >> (7-(k%8))) & 0x01);
+    }
+    return sr;
+}
+
 // 
 // internal
 //
@@ -239,11 +274,11 @@ void fec_conv_init_v27(fec _q)
     _q->R=2;
     _q->K=7;
     _q->poly = fec_conv27_poly;
-    _q->create_viterbi = create_viterbi27;
-    _q->init_viterbi = init_viterbi27;
-    _q->update_viterbi_blk = update_viterbi27_blk;
-    _q->chainback_viterbi = chainback_viterbi27;
-    _q->delete_viterbi = delete_viterbi27;
+    _q->create_viterbi = fec_viterbi27_create;
+    _q->init_viterbi = fec_viterbi_init;
+    _q->update_viterbi_blk = fec_viterbi_update_blk;
+    _q->chainback_viterbi = fec_viterbi_chainback;
+    _q->delete_viterbi = fec_viterbi_delete;
 }
 
 void fec_conv_init_v29(fec _q)
@@ -251,11 +286,11 @@ void fec_conv_init_v29(fec _q)
     _q->R=2;
     _q->K=9;
     _q->poly = fec_conv29_poly;
-    _q->create_viterbi = create_viterbi29;
-    _q->init_viterbi = init_viterbi29;
-    _q->update_viterbi_blk = update_viterbi29_blk;
-    _q->chainback_viterbi = chainback_viterbi29;
-    _q->delete_viterbi = delete_viterbi29;
+    _q->create_viterbi = fec_viterbi29_create;
+    _q->init_viterbi = fec_viterbi_init;
+    _q->update_viterbi_blk = fec_viterbi_update_blk;
+    _q->chainback_viterbi = fec_viterbi_chainback;
+    _q->delete_viterbi = fec_viterbi_delete;
 }
 
 void fec_conv_init_v39(fec _q)
@@ -263,11 +298,11 @@ void fec_conv_init_v39(fec _q)
     _q->R=3;
     _q->K=9;
     _q->poly = fec_conv39_poly;
-    _q->create_viterbi = create_viterbi39;
-    _q->init_viterbi = init_viterbi39;
-    _q->update_viterbi_blk = update_viterbi39_blk;
-    _q->chainback_viterbi = chainback_viterbi39;
-    _q->delete_viterbi = delete_viterbi39;
+    _q->create_viterbi = fec_viterbi39_create;
+    _q->init_viterbi = fec_viterbi_init;
+    _q->update_viterbi_blk = fec_viterbi_update_blk;
+    _q->chainback_viterbi = fec_viterbi_chainback;
+    _q->delete_viterbi = fec_viterbi_delete;
 }
 
 void fec_conv_init_v615(fec _q)
@@ -275,25 +310,9 @@ void fec_conv_init_v615(fec _q)
     _q->R=6;
     _q->K=15;
     _q->poly = fec_conv615_poly;
-    _q->create_viterbi = create_viterbi615;
-    _q->init_viterbi = init_viterbi615;
-    _q->update_viterbi_blk = update_viterbi615_blk;
-    _q->chainback_viterbi = chainback_viterbi615;
-    _q->delete_viterbi = delete_viterbi615;
-}
-
-
-
-#else   // LIBFEC_ENABLED
-
-fec fec_conv_create(fec_scheme _fs)
-{
-    return NULL;
+    _q->create_viterbi = fec_viterbi615_create;
+    _q->init_viterbi = fec_viterbi_init;
+    _q->update_viterbi_blk = fec_viterbi_update_blk;
+    _q->chainback_viterbi = fec_viterbi_chainback;
+    _q->delete_viterbi = fec_viterbi_delete;
 }
-
-void fec_conv_destroy(fec _q)
-{
-}
-
-#endif  // LIBFEC_ENABLED
-
@@ -22,6 +22,15 @@
 
 #include "liquid.internal.h"
 
+// Rows correspond to the polynomials in fec_conv_poly.c, in libfec
+// order. The rows of the 7/8-rate K=7 and 6/7-rate K=9 matrices are
+// swapped with respect to earlier releases: with the original order,
+// which punctures mostly the second polynomial (0x6d, 0x11d), these two
+// codes are catastrophic. Their punctured trellis has a zero-weight
+// cycle through non-zero states, so an input sequence of unbounded
+// weight maps to an encoded sequence of finite weight and a few channel
+// errors can cause an unbounded number of decoded bit errors.
+
 // 2/3-rate K=7 punctured convolutional code
 int fec_conv27p23_matrix[4] = {
     1, 1,
@@ -54,8 +63,8 @@ int fec_conv27p67_matrix[12] = {
 
 // 7/8-rate K=7 punctured convolutional code
 int fec_conv27p78_matrix[14] = {
-    1, 1, 1, 1, 0, 1, 0,
-    1, 0, 0, 0, 1, 0, 1
+    1, 0, 0, 0, 1, 0, 1,
+    1, 1, 1, 1, 0, 1, 0
 };
 
 
@@ -87,8 +96,8 @@ int fec_conv29p56_matrix[10] = {
 
 // 6/7-rate K=9 punctured convolutional code
 int fec_conv29p67_matrix[12] = {
-    1, 1, 0, 1, 1, 0,
-    1, 0, 1, 0, 0, 1
+    1, 0, 1, 0, 0, 1,
+    1, 1, 0, 1, 1, 0
 };
 
 // 7/8-rate K=9 punctured convolutional code
@@ -26,32 +26,28 @@
 
 #include "liquid.internal.h"
 
-#if LIBFEC_ENABLED
-#include <fec.h>
-
-int fec_conv27_poly[2]  = {V27POLYA,
-                           V27POLYB};
-
-int fec_conv29_poly[2]  = {V29POLYA,
-                           V29POLYB};
-
-int fec_conv39_poly[3]  = {V39POLYA,
-                           V39POLYB,
-                           V39POLYC};
-
-int fec_conv615_poly[6] = {V615POLYA,
-                           V615POLYB,
-                           V615POLYC,
-                           V615POLYD,
-                           V615POLYE,
-                           V615POLYF};
-
-#else
-
-int fec_conv27_poly[2]  = {0,0};
-int fec_conv29_poly[2]  = {0,0};
-int fec_conv39_poly[3]  = {0,0,0};
-int fec_conv615_poly[6] = {0,0,0,0,0,0};
-
-#endif
-
+// Polynomials and their order match libfec (V27POLYA, V27POLYB, etc.)
+// so that encoded bitstreams are compatible with libfec builds. The
+// puncturing matrices (see fec_conv_pmatrix.c) index these polynomials
+// by row.
+
+// r1/2, K=7
+int fec_conv27_poly[2]  = {0x4f,
+                           0x6d};
+
+// r1/2, K=9
+int fec_conv29_poly[2]  = {0x1af,
+                           0x11d};
+
+// r1/3, K=9
+int fec_conv39_poly[3]  = {0x1ed,
+                           0x19b,
+                           0x127};
+
+// r1/6, K=15
+int fec_conv615_poly[6] = {042631,
+                           047245,
+                           056507,
+                           073363,
+                           077267,
+                           064537};
@@ -32,10 +32,8 @@
 
 #define VERBOSE_FEC_CONV_PUNCTURED    0
 
-#if LIBFEC_ENABLED
-#include "fec.h"
-
-fec fec_conv_punctured_create(fec_scheme _fs)
+fec fec_conv_punctured_create(fec_scheme _fs,
+                              void *     _opts)
 {
     fec q = (fec) malloc(sizeof(struct fec_s));
 
@@ -65,6 +63,9 @@ fec fec_conv_punctured_create(fec_scheme _fs)
         exit(1);
     }
 
+    // framing options
+    q->tailbiting = _opts == NULL ? 0 : ((fec_conv_opts_s*)_opts)->tailbiting;
+
     // convolutional-specific decoding
     q->num_dec_bytes = 0;
     q->enc_bits = NULL;
@@ -99,6 +100,10 @@ void fec_conv_punctured_encode(fec _q,
     unsigned char byte_in;
     unsigned char byte_out=0;
 
+    // tail-biting: start in final encoder state
+    if (_q->tailbiting)
+        sr = fec_conv_tailbiting_state(_q->K, _dec_msg_len, _msg_dec);
+
     for (i=0; i<_dec_msg_len; i++) {
         byte_in = _msg_dec[i];
 
@@ -112,7 +117,7 @@ void fec_conv_punctured_encode(fec _q,
             for (r=0; r<_q->R; r++) {
                 // enable output determined by puncturing matrix
                 if (_q->puncturing_matrix[r*(_q->P)+p]) {
-                    byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+                    byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
                     _msg_enc[n/8] = byte_out;
                     n++;
                 } else {
@@ -126,15 +131,15 @@ void fec_conv_punctured_encode(fec _q,
     //printf("\n");
     //printf("*** n = %u\n", n);
 
-    // tail bits
-    for (i=0; i<_q->K-1; i++) {
+    // tail bits (none when tail-biting)
+    for (i=0; i<(_q->tailbiting ? 0 : _q->K-1); i++) {
         // shift register: push zeros
         sr = (sr << 1);
 
         // compute parity bits for each polynomial
         for (r=0; r<_q->R; r++) {
             if (_q->puncturing_matrix[r*(_q->P)+p]) {
-                byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+                byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
                 _msg_enc[n/8] = byte_out;
                 n++;
             }
@@ -154,7 +159,9 @@ void fec_conv_punctured_encode(fec _q,
     }
 
     //printf("n = %u (expected %u)\n", n, 8*fec_get_enc_msg_length(LIQUID_FEC_CONV(_mode),_dec_msg_len));
-    assert(n == 8*fec_get_enc_msg_length(_q->scheme,_dec_msg_len));
+    assert(n == 8*(_q->tailbiting ?
+                   fec_conv_get_enc_msg_len_tailbiting(_q->scheme,_dec_msg_len) :
+                   fec_get_enc_msg_length(_q->scheme,_dec_msg_len)));
 }
 
 //unsigned int
@@ -167,7 +174,7 @@ void fec_conv_punctured_decode_hard(fec _q,
     fec_conv_punctured_setlength(_q, _dec_msg_len);
 
     // unpack bytes, adding erasures at punctured indices
-    unsigned int num_dec_bits = _q->num_dec_bytes * 8 + _q->K - 1;
+    unsigned int num_dec_bits = _q->num_dec_bytes * 8 + (_q->tailbiting ? 0 : _q->K - 1);
     unsigned int num_enc_bits = num_dec_bits * _q->R;
     unsigned int i,r;
     unsigned int n=0;   // input byte index
@@ -186,7 +193,7 @@ void fec_conv_punctured_decode_hard(fec _q,
                 if (k==8) {
                     k = 0;
                     n++;
-                    byte_in = _msg_enc[n];
+                    byte_in = n < _q->num_enc_bytes ? _msg_enc[n] : 0;
                 }
             } else {
                 // push erasure
@@ -208,10 +215,14 @@ void fec_conv_punctured_decode_hard(fec _q,
 #endif
 
     // run decoder
-    _q->init_viterbi(_q->vp,0);
-    // TODO : check to see if this shouldn't be num_enc_bits (punctured)
-    _q->update_viterbi_blk(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
-    _q->chainback_viterbi(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
+    if (_q->tailbiting) {
+        fec_viterbi_decode_tailbiting(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes, _msg_dec);
+    } else {
+        _q->init_viterbi(_q->vp,0);
+        // TODO : check to see if this shouldn't be num_enc_bits (punctured)
+        _q->update_viterbi_blk(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
+        _q->chainback_viterbi(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
+    }
 
 #if VERBOSE_FEC_CONV_PUNCTURED
     for (ii=0; ii<_dec_msg_len; ii++)
@@ -230,7 +241,7 @@ void fec_conv_punctured_decode_soft(fec _q,
     fec_conv_punctured_setlength(_q, _dec_msg_len);
 
     // unpack bytes, adding erasures at punctured indices
-    unsigned int num_dec_bits = _q->num_dec_bytes * 8 + _q->K - 1;
+    unsigned int num_dec_bits = _q->num_dec_bytes * 8 + (_q->tailbiting ? 0 : _q->K - 1);
     unsigned int num_enc_bits = num_dec_bits * _q->R;
     unsigned int i,r;
     unsigned int n=0;   // input soft bit index
@@ -261,10 +272,14 @@ void fec_conv_punctured_decode_soft(fec _q,
 #endif
 
     // run decoder
-    _q->init_viterbi(_q->vp,0);
-    // TODO : check to see if this shouldn't be num_enc_bits (punctured)
-    _q->update_viterbi_blk(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
-    _q->chainback_viterbi(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
+    if (_q->tailbiting) {
+        fec_viterbi_decode_tailbiting(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes, _msg_dec);
+    } else {
+        _q->init_viterbi(_q->vp,0);
+        // TODO : check to see if this shouldn't be num_enc_bits (punctured)
+        _q->update_viterbi_blk(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
+        _q->chainback_viterbi(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
+    }
 
 #if VERBOSE_FEC_CONV_PUNCTURED
     for (ii=0; ii<_dec_msg_len; ii++)
@@ -284,8 +299,9 @@ void fec_conv_punctured_setlength(fec _q, unsigned int _dec_msg_len)
 
     // reset number of framebits
     _q->num_dec_bytes = num_dec_bytes;
-    _q->num_enc_bytes = fec_get_enc_msg_length(_q->scheme,
-                                               _dec_msg_len);
+    _q->num_enc_bytes = _q->tailbiting ?
+        fec_conv_get_enc_msg_len_tailbiting(_q->scheme, _dec_msg_len) :
+        fec_get_enc_msg_length(_q->scheme, _dec_msg_len);
 
     // puncturing: need to expand to full length (decoder
     //             injects erasures at punctured values)
@@ -426,33 +442,3 @@ void fec_conv_init_v29p78(fec _q)
     _q->P = 7;
     _q->puncturing_matrix = fec_conv29p78_matrix;
 }
-
-
-#else   // LIBFEC_ENABLED
-
-fec fec_conv_punctured_create(fec_scheme _fs)
-{
-    return NULL;
-}
-
-void fec_conv_punctured_destroy(fec _q)
-{
-}
-
-void fec_conv_punctured_encode(fec _q,
-                               unsigned int _dec_msg_len,
-                               unsigned char *_msg_dec,
-                               unsigned char *_msg_enc)
-{
-}
-
-//unsigned int
-void fec_conv_punctured_decode(fec _q,
-                               unsigned int _dec_msg_len,
-                               unsigned char *_msg_enc,
-                               unsigned char *_msg_dec)
-{
-}
-
-#endif  // LIBFEC_ENABLED
-
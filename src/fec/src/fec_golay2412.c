@@ -234,6 +234,28 @@ unsigned int fec_golay2412_decode_symbol(unsigned int _sym_enc)
     return m_hat;
 }
 
+// table-driven encoding of 12-bit symbol, equivalent to
+// fec_golay2412_encode_symbol() without input validation
+static inline unsigned int golay2412_encode_lut(unsigned int _m)
+{
+    unsigned int p = golay2412_enc_gentab_lo[_m & 0xff] ^
+                     golay2412_enc_gentab_hi[_m >> 8];
+    return (p << 12) | _m;
+}
+
+// table-driven decoding of 24-bit symbol, equivalent to
+// fec_golay2412_decode_symbol() without input validation
+static inline unsigned int golay2412_decode_lut(unsigned int _v)
+{
+    // compute syndrome one byte at a time
+    unsigned int s = golay2412_syn_gentab[0][(_v      ) & 0xff] ^
+                     golay2412_syn_gentab[1][(_v >>  8) & 0xff] ^
+                     golay2412_syn_gentab[2][(_v >> 16)       ];
+
+    // correct message bits with estimated error vector
+    return (_v ^ golay2412_err_gentab[s]) & 0x0fff;
+}
+
 // create Golay(24,12) codec object
 fec fec_golay2412_create(void * _opts)
 {
@@ -288,8 +310,8 @@ void fec_golay2412_encode(fec _q,
         m1 = ((s1 << 8) & 0x0f00) | ((s2     ) & 0x00ff);
 
         // encode each 12-bit symbol into a 24-bit symbol
-        v0 = fec_golay2412_encode_symbol(m0);
-        v1 = fec_golay2412_encode_symbol(m1);
+        v0 = golay2412_encode_lut(m0);
+        v1 = golay2412_encode_lut(m1);
 
         // unpack two 24-bit symbols into six 8-bit bytes
         // retaining order of bits in output
@@ -312,7 +334,7 @@ void fec_golay2412_encode(fec _q,
         m0 = s0;
 
         // encode into 24-bit symbol
-        v0 = fec_golay2412_encode_symbol(m0);
+        v0 = golay2412_encode_lut(m0);
 
         // unpack one 24-bit symbol into three 8-bit bytes, and
         // append to output array
@@ -363,8 +385,8 @@ void fec_golay2412_decode(fec _q,
         v1 = ((r3 << 16) & 0xff0000) | ((r4 <<  8) & 0x00ff00) | ((r5 << 0) & 0x0000ff);
 
         // decode each symbol into a 12-bit symbol
-        m0_hat = fec_golay2412_decode_symbol(v0);
-        m1_hat = fec_golay2412_decode_symbol(v1);
+        m0_hat = golay2412_decode_lut(v0);
+        m1_hat = golay2412_decode_lut(v1);
 
         // unpack two 12-bit symbols into three 8-bit bytes
         _msg_dec[i+0] = ((m0_hat >> 4) & 0xff);
@@ -385,7 +407,7 @@ void fec_golay2412_decode(fec _q,
         v0 = ((r0 << 16) & 0xff0000) | ((r1 <<  8) & 0x00ff00) | ((r2     ) & 0x0000ff);
 
         // decode into a 12-bit symbol
-        m0_hat = fec_golay2412_decode_symbol(v0);
+        m0_hat = golay2412_decode_lut(v0);
 
         // retain last 8 bits of 12-bit symbol
         _msg_dec[i] = m0_hat & 0xff;
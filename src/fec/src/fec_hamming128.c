@@ -255,8 +255,8 @@ void fec_hamming128_decode(fec _q,
         m1 = ((r1 << 8) & 0x0f00) | ((r2     ) & 0x00ff);
 
         // decode each symbol into an 8-bit byte
-        _msg_dec[i+0] = fec_hamming128_decode_symbol(m0);
-        _msg_dec[i+1] = fec_hamming128_decode_symbol(m1);
+        _msg_dec[i+0] = hamming128_dec_gentab[m0];
+        _msg_dec[i+1] = hamming128_dec_gentab[m1];
 
         j += 3;
     }
@@ -272,7 +272,7 @@ void fec_hamming128_decode(fec _q,
         m0 = ((r0 << 4) & 0x0ff0) | ((r1 >> 4) & 0x000f);
 
         // decode symbol into an 8-bit byte
-        _msg_dec[i++] = fec_hamming128_decode_symbol(m0);
+        _msg_dec[i++] = hamming128_dec_gentab[m0];
 
         j += 2;
     }
@@ -97,7 +97,22 @@ void fec_hamming74_encode(fec _q,
     unsigned char s0, s1;   // decoded symbols
     unsigned char m0, m1;   // encoded symbols
 
-    for (i=0; i<_dec_msg_len; i++) {
+    // encode four input bytes (eight 7-bit symbols) at a time into
+    // seven byte-aligned output bytes
+    for (i=0; i+4<=_dec_msg_len; i+=4) {
+        uint64_t v = 0;
+        unsigned int n;
+        for (n=0; n<4; n++) {
+            v = (v << 7) | hamming74_enc_gentab[(_msg_dec[i+n] >> 4) & 0x0f];
+            v = (v << 7) | hamming74_enc_gentab[(_msg_dec[i+n]     ) & 0x0f];
+        }
+        for (n=0; n<7; n++)
+            _msg_enc[k/8 + n] = (v >> (48 - 8*n)) & 0xff;
+        k += 56;
+    }
+
+    // encode remaining bytes one symbol at a time
+    for ( ; i<_dec_msg_len; i++) {
         // strip two 4-bit symbols from input byte
         s0 = (_msg_dec[i] >> 4) & 0x0f;
         s1 = (_msg_dec[i] >> 0) & 0x0f;
@@ -138,8 +153,23 @@ void fec_hamming74_decode(fec _q,
     unsigned char r0, r1;   // received 7-bit symbols
     unsigned char s0, s1;   // decoded 4-bit symbols
 
+    // decode seven byte-aligned input bytes (eight 7-bit symbols)
+    // at a time into four output bytes
+    for (i=0; i+4<=_dec_msg_len; i+=4) {
+        uint64_t v = 0;
+        unsigned int n;
+        for (n=0; n<7; n++)
+            v = (v << 8) | _msg_enc[k/8 + n];
+        for (n=0; n<4; n++) {
+            s0 = hamming74_dec_gentab[(v >> (49 - 14*n)) & 0x7f];
+            s1 = hamming74_dec_gentab[(v >> (42 - 14*n)) & 0x7f];
+            _msg_dec[i+n] = (s0 << 4) | s1;
+        }
+        k += 56;
+    }
+
     //unsigned char num_errors=0;
-    for (i=0; i<_dec_msg_len; i++) {
+    for ( ; i<_dec_msg_len; i++) {
         // strip two 7-bit symbols from 
         liquid_unpack_array(_msg_enc, enc_msg_len, k, 7, &r0);
         k += 7;
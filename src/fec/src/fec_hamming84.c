@@ -30,6 +30,13 @@
 
 #include "liquid.internal.h"
 
+#if HAVE_TMMINTRIN_H && defined(__SSSE3__)
+#  include <tmmintrin.h>
+#  define FEC_HAMMING84_SSSE3 1
+#else
+#  define FEC_HAMMING84_SSSE3 0
+#endif
+
 // encoder look-up table
 unsigned char hamming84_enc_gentab[16] = {
     0x00, 0xd2, 0x55, 0x87, 0x99, 0x4b, 0xcc, 0x1e,
@@ -104,9 +111,24 @@ void fec_hamming84_encode(fec _q,
                           unsigned char *_msg_dec,
                           unsigned char *_msg_enc)
 {
-    unsigned int i, j=0;
+    unsigned int i=0, j=0;
     unsigned char s0, s1;
-    for (i=0; i<_dec_msg_len; i++) {
+#if FEC_HAMMING84_SSSE3
+    // encode sixteen bytes at a time: look up both nibbles of each
+    // input byte in the (16-entry) encoding table with PSHUFB, then
+    // interleave the upper- and lower-nibble codewords
+    __m128i tab  = _mm_loadu_si128((__m128i*)hamming84_enc_gentab);
+    __m128i mask = _mm_set1_epi8(0x0f);
+    for (i=0; i+16<=_dec_msg_len; i+=16) {
+        __m128i x  = _mm_loadu_si128((__m128i*)&_msg_dec[i]);
+        __m128i v0 = _mm_shuffle_epi8(tab, _mm_and_si128(_mm_srli_epi16(x,4), mask));
+        __m128i v1 = _mm_shuffle_epi8(tab, _mm_and_si128(x, mask));
+        _mm_storeu_si128((__m128i*)&_msg_enc[j+ 0], _mm_unpacklo_epi8(v0,v1));
+        _mm_storeu_si128((__m128i*)&_msg_enc[j+16], _mm_unpackhi_epi8(v0,v1));
+        j += 32;
+    }
+#endif
+    for ( ; i<_dec_msg_len; i++) {
         s0 = (_msg_dec[i] >> 4) & 0x0f;
         s1 = (_msg_dec[i] >> 0) & 0x0f;
         _msg_enc[j+0] = hamming84_enc_gentab[s0];
@@ -0,0 +1,648 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+//
+// quasi-cyclic low-density parity-check codes
+//
+// Codes are described by a base graph of cyclic shifts (see
+// fec_ldpc_basegraph.c) lifted by a factor Z chosen from the message
+// length. Long messages are split into several codewords; the last
+// information bits of each codeword are shortened (known zeros which
+// are not transmitted).
+//
+// Decoding uses layered normalized min-sum: each block row of the base
+// graph is processed in turn, updating the posterior log-likelihood
+// ratios immediately, which roughly halves the number of iterations
+// relative to flooding belief propagation. Messages are 16-bit integers
+// organized so that the Z rows of a layer are updated in parallel.
+//
+// References:
+//  [Hocevar:2004] D. E. Hocevar, "A Reduced Complexity Decoder
+//      Architecture via Layered Decoding of LDPC Codes," IEEE Workshop
+//      on Signal Processing Systems, 2004.
+//  [Chen:2005] J. Chen, et al., "Reduced-Complexity Decoding of LDPC
+//      Codes," IEEE Transactions on Communications, vol. 53, no. 8,
+//      August 2005.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "liquid.internal.h"
+
+#define DEBUG_FEC_LDPC 0
+
+#if HAVE_EMMINTRIN_H && defined(__SSE2__)
+#  include <emmintrin.h>
+#  define FEC_LDPC_SSE 1
+#else
+#  define FEC_LDPC_SSE 0
+#endif
+
+#define FEC_LDPC_NB             (24)    // number of base graph columns
+#define FEC_LDPC_ZMAX           (96)    // maximum lifting size
+#define FEC_LDPC_MAX_ITERATIONS (20)    // maximum number of decoder iterations
+#define FEC_LDPC_LLR_SHORTENED  (0x3fff)// LLR of shortened (known zero) bits
+
+// available lifting sizes (each a multiple of 8)
+static const unsigned int fec_ldpc_lifting[] = {8, 16, 24, 32, 40, 48, 56, 64, 80, 96};
+#define FEC_LDPC_NUM_LIFTING (sizeof(fec_ldpc_lifting)/sizeof(fec_ldpc_lifting[0]))
+
+// get number of base graph rows and shift table for LDPC scheme
+static unsigned int fec_ldpc_get_basegraph(fec_scheme _fs,
+                                           int **     _base)
+{
+    switch (_fs) {
+    case LIQUID_FEC_LDPC_R12: *_base = fec_ldpc_r12_basegraph; return 12;
+    case LIQUID_FEC_LDPC_R23: *_base = fec_ldpc_r23_basegraph; return 8;
+    case LIQUID_FEC_LDPC_R34: *_base = fec_ldpc_r34_basegraph; return 6;
+    case LIQUID_FEC_LDPC_R56: *_base = fec_ldpc_r56_basegraph; return 4;
+    default:
+        fprintf(stderr,"error: fec_ldpc_get_basegraph(), invalid type\n");
+        exit(1);
+    }
+    return 0;
+}
+
+// compute number of codewords and lifting size for a message
+//  _dec_msg_len    :   decoded message length (bytes)
+//  _mb             :   number of base graph rows
+//  _num_blocks     :   number of codewords
+//  _Z              :   lifting size
+void fec_ldpc_get_lifting(unsigned int   _dec_msg_len,
+                          unsigned int   _mb,
+                          unsigned int * _num_blocks,
+                          unsigned int * _Z)
+{
+    unsigned int kb = FEC_LDPC_NB - _mb;
+    unsigned int num_bits = 8*_dec_msg_len;
+
+    // number of codewords: ceil(num_bits / (kb*Zmax))
+    unsigned int kmax = kb*FEC_LDPC_ZMAX;
+    unsigned int num_blocks = (num_bits + kmax - 1) / kmax;
+    if (num_blocks == 0)
+        num_blocks = 1;
+
+    // information bits in largest codeword: ceil(num_bits / num_blocks)
+    unsigned int k = (num_bits + num_blocks - 1) / num_blocks;
+
+    // smallest lifting size which can hold this many bits
+    unsigned int i;
+    for (i=0; i<FEC_LDPC_NUM_LIFTING-1; i++) {
+        if (kb*fec_ldpc_lifting[i] >= k)
+            break;
+    }
+
+    *_num_blocks = num_blocks;
+    *_Z          = fec_ldpc_lifting[i];
+}
+
+// compute encoded message length for LDPC codes
+//  _dec_msg_len    :   decoded message length (bytes)
+//  _mb             :   number of base graph rows
+unsigned int fec_ldpc_get_enc_msg_len(unsigned int _dec_msg_len,
+                                      unsigned int _mb)
+{
+    unsigned int num_blocks;
+    unsigned int Z;
+    fec_ldpc_get_lifting(_dec_msg_len, _mb, &num_blocks, &Z);
+
+    // systematic bits plus parity bits for each codeword
+    unsigned int num_bits = 8*_dec_msg_len + num_blocks*_mb*Z;
+    return (num_bits + 7) / 8;
+}
+
+// create LDPC codec object
+fec fec_ldpc_create(fec_scheme _fs)
+{
+    fec q = (fec) malloc(sizeof(struct fec_s));
+
+    q->scheme = _fs;
+    q->rate = fec_get_rate(q->scheme);
+
+    q->encode_func      = &fec_ldpc_encode;
+    q->decode_func      = &fec_ldpc_decode;
+    q->decode_soft_func = &fec_ldpc_decode_soft;
+
+    // base graph
+    q->ldpc_mb = fec_ldpc_get_basegraph(_fs, &q->ldpc_base);
+    q->ldpc_nb = FEC_LDPC_NB;
+
+    // count edges (non-empty blocks) and find the largest layer
+    unsigned int r;
+    unsigned int c;
+    q->ldpc_num_edges = 0;
+    q->ldpc_max_deg   = 0;
+    for (r=0; r<q->ldpc_mb; r++) {
+        unsigned int deg = 0;
+        for (c=0; c<q->ldpc_nb; c++)
+            deg += q->ldpc_base[r*q->ldpc_nb + c] >= 0 ? 1 : 0;
+        q->ldpc_num_edges += deg;
+        q->ldpc_max_deg = deg > q->ldpc_max_deg ? deg : q->ldpc_max_deg;
+    }
+
+    // list edges layer by layer
+    q->ldpc_layer = (unsigned int*) malloc((q->ldpc_mb+1)*sizeof(unsigned int));
+    q->ldpc_col   = (unsigned int*) malloc(q->ldpc_num_edges*sizeof(unsigned int));
+    q->ldpc_shift = (unsigned int*) malloc(q->ldpc_num_edges*sizeof(unsigned int));
+    unsigned int e = 0;
+    for (r=0; r<q->ldpc_mb; r++) {
+        q->ldpc_layer[r] = e;
+        for (c=0; c<q->ldpc_nb; c++) {
+            if (q->ldpc_base[r*q->ldpc_nb + c] >= 0)
+                q->ldpc_col[e++] = c;
+        }
+    }
+    q->ldpc_layer[q->ldpc_mb] = e;
+
+    // allocate memory for decoder state at the maximum lifting size
+    q->ldpc_c = (unsigned char*) malloc(q->ldpc_nb*FEC_LDPC_ZMAX*sizeof(unsigned char));
+    q->ldpc_L = (short*) malloc(q->ldpc_nb*FEC_LDPC_ZMAX*sizeof(short));
+    q->ldpc_R = (short*) malloc(q->ldpc_num_edges*FEC_LDPC_ZMAX*sizeof(short));
+    q->ldpc_Q = (short*) malloc(q->ldpc_max_deg*FEC_LDPC_ZMAX*sizeof(short));
+
+    // lengths
+    q->num_dec_bytes = 0;
+    q->ldpc_Z = 0;
+
+    return q;
+}
+
+// destroy LDPC object
+void fec_ldpc_destroy(fec _q)
+{
+    free(_q->ldpc_layer);
+    free(_q->ldpc_col);
+    free(_q->ldpc_shift);
+    free(_q->ldpc_c);
+    free(_q->ldpc_L);
+    free(_q->ldpc_R);
+    free(_q->ldpc_Q);
+    free(_q);
+}
+
+// print LDPC object
+void fec_ldpc_print(fec _q)
+{
+    printf("fec_ldpc [r: %3.2f, base graph: %u x %u, Z: %u]\n",
+            _q->rate, _q->ldpc_mb, _q->ldpc_nb, _q->ldpc_Z);
+}
+
+// set message length, computing lifting size and number of codewords
+void fec_ldpc_setlength(fec          _q,
+                        unsigned int _dec_msg_len)
+{
+    // return if length has not changed
+    if (_dec_msg_len == _q->num_dec_bytes)
+        return;
+
+    _q->num_dec_bytes = _dec_msg_len;
+    _q->num_enc_bytes = fec_ldpc_get_enc_msg_len(_dec_msg_len, _q->ldpc_mb);
+    fec_ldpc_get_lifting(_dec_msg_len, _q->ldpc_mb, &_q->num_blocks, &_q->ldpc_Z);
+
+    // reduce shifts modulo lifting size
+    unsigned int r;
+    unsigned int e;
+    for (r=0; r<_q->ldpc_mb; r++) {
+        for (e=_q->ldpc_layer[r]; e<_q->ldpc_layer[r+1]; e++)
+            _q->ldpc_shift[e] = _q->ldpc_base[r*_q->ldpc_nb + _q->ldpc_col[e]] % _q->ldpc_Z;
+    }
+
+#if DEBUG_FEC_LDPC
+    printf("dec_msg_len     :   %u\n", _q->num_dec_bytes);
+    printf("num_blocks      :   %u\n", _q->num_blocks);
+    printf("Z               :   %u\n", _q->ldpc_Z);
+    printf("enc_msg_len     :   %u\n", _q->num_enc_bytes);
+#endif
+}
+
+// encode block of data using LDPC encoder
+//
+//  _q              :   encoder/decoder object
+//  _dec_msg_len    :   decoded message length (number of bytes)
+//  _msg_dec        :   decoded message [size: 1 x _dec_msg_len]
+//  _msg_enc        :   encoded message [size: 1 x num_enc_bytes]
+void fec_ldpc_encode(fec             _q,
+                     unsigned int    _dec_msg_len,
+                     unsigned char * _msg_dec,
+                     unsigned char * _msg_enc)
+{
+    // validate input
+    if (_dec_msg_len == 0) {
+        fprintf(stderr,"error: fec_ldpc_encode(), input length must be > 0\n");
+        exit(1);
+    }
+
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    unsigned int Z  = _q->ldpc_Z;
+    unsigned int mb = _q->ldpc_mb;
+    unsigned int kb = _q->ldpc_nb - mb;
+    unsigned int num_bits = 8*_dec_msg_len;
+
+    memset(_msg_enc, 0x00, _q->num_enc_bytes);
+
+    unsigned int b;
+    unsigned int i;
+    unsigned int n0 = 0;    // input bit index
+    unsigned int n1 = 0;    // output bit index
+    for (b=0; b<_q->num_blocks; b++) {
+        // number of information bits in this codeword
+        unsigned int k = num_bits/_q->num_blocks + (b < num_bits%_q->num_blocks ? 1 : 0);
+
+        // unpack information bits, shortening remainder with zeros
+        for (i=0; i<k; i++, n0++)
+            _q->ldpc_c[i] = (_msg_dec[n0/8] >> (7-(n0%8))) & 1;
+        memset(&_q->ldpc_c[k], 0x00, (kb*Z-k)*sizeof(unsigned char));
+
+        // compute parity bits
+        fec_ldpc_encode_block(_q, _q->ldpc_c);
+
+        // pack systematic and parity bits
+        for (i=0; i<k; i++, n1++)
+            _msg_enc[n1/8] |= _q->ldpc_c[i] << (7-(n1%8));
+        for (i=kb*Z; i<_q->ldpc_nb*Z; i++, n1++)
+            _msg_enc[n1/8] |= _q->ldpc_c[i] << (7-(n1%8));
+    }
+
+    // sanity check
+    assert( n0 == num_bits );
+    assert( (n1+7)/8 == _q->num_enc_bytes );
+}
+
+// decode block of data using LDPC decoder (hard decision)
+//
+//  _q              :   encoder/decoder object
+//  _dec_msg_len    :   decoded message length (number of bytes)
+//  _msg_enc        :   encoded message [size: 1 x num_enc_bytes]
+//  _msg_dec        :   decoded message [size: 1 x _dec_msg_len]
+void fec_ldpc_decode(fec             _q,
+                     unsigned int    _dec_msg_len,
+                     unsigned char * _msg_enc,
+                     unsigned char * _msg_dec)
+{
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    // expand to soft bits with full confidence and run soft decoder
+    unsigned int num_enc_bits = 8*_q->num_enc_bytes;
+    unsigned char * msg_soft = (unsigned char*) malloc(num_enc_bits*sizeof(unsigned char));
+    unsigned int i;
+    for (i=0; i<num_enc_bits; i++)
+        msg_soft[i] = ((_msg_enc[i/8] >> (7-(i%8))) & 1) ? LIQUID_SOFTBIT_1 : LIQUID_SOFTBIT_0;
+
+    fec_ldpc_decode_soft(_q, _dec_msg_len, msg_soft, _msg_dec);
+    free(msg_soft);
+}
+
+// decode block of data using LDPC decoder (soft decision)
+//
+//  _q              :   encoder/decoder object
+//  _dec_msg_len    :   decoded message length (number of bytes)
+//  _msg_enc        :   encoded message (soft bits) [size: 8 x num_enc_bytes]
+//  _msg_dec        :   decoded message [size: 1 x _dec_msg_len]
+void fec_ldpc_decode_soft(fec             _q,
+                          unsigned int    _dec_msg_len,
+                          unsigned char * _msg_enc,
+                          unsigned char * _msg_dec)
+{
+    // validate input
+    if (_dec_msg_len == 0) {
+        fprintf(stderr,"error: fec_ldpc_decode_soft(), input length must be > 0\n");
+        exit(1);
+    }
+
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    unsigned int Z  = _q->ldpc_Z;
+    unsigned int mb = _q->ldpc_mb;
+    unsigned int kb = _q->ldpc_nb - mb;
+    unsigned int num_bits = 8*_dec_msg_len;
+
+    memset(_msg_dec, 0x00, _dec_msg_len);
+
+    unsigned int b;
+    unsigned int i;
+    unsigned int n0 = 0;    // input soft bit index
+    unsigned int n1 = 0;    // output bit index
+    for (b=0; b<_q->num_blocks; b++) {
+        // number of information bits in this codeword
+        unsigned int k = num_bits/_q->num_blocks + (b < num_bits%_q->num_blocks ? 1 : 0);
+
+        // convert soft bits to log-likelihood ratios, log(P(0)/P(1))
+        for (i=0; i<k; i++)
+            _q->ldpc_L[i] = 127 - (short)_msg_enc[n0++];
+        for (i=k; i<kb*Z; i++)
+            _q->ldpc_L[i] = FEC_LDPC_LLR_SHORTENED;
+        for (i=kb*Z; i<_q->ldpc_nb*Z; i++)
+            _q->ldpc_L[i] = 127 - (short)_msg_enc[n0++];
+
+        // run decoder
+        fec_ldpc_decode_block(_q, FEC_LDPC_MAX_ITERATIONS);
+
+        // hard decision on information bits
+        for (i=0; i<k; i++, n1++)
+            _msg_dec[n1/8] |= (_q->ldpc_L[i] < 0 ? 1 : 0) << (7-(n1%8));
+    }
+
+    // sanity check
+    assert( n1 == num_bits );
+}
+
+// compute parity bits for a single codeword
+//  _q      :   LDPC object (lifting size set)
+//  _c      :   codeword bits, information bits set on input [size: nb*Z x 1]
+void fec_ldpc_encode_block(fec             _q,
+                           unsigned char * _c)
+{
+    unsigned int Z  = _q->ldpc_Z;
+    unsigned int mb = _q->ldpc_mb;
+    unsigned int kb = _q->ldpc_nb - mb;
+    unsigned char * p = &_c[kb*Z];  // parity blocks p[0], ..., p[mb-1]
+    unsigned int r;
+    unsigned int e;
+    unsigned int t;
+
+    // use parity blocks p[1..mb-1] and p[0] to hold lambda[r], the
+    // syndrome of the information bits for layer r, as lambda is
+    // consumed in order: lambda[r] is stored in p[r+1] for r < mb-1
+    // and lambda[mb-1] is accumulated directly into p[0]
+    unsigned char lambda_last[FEC_LDPC_ZMAX];
+    memset(p, 0x00, mb*Z*sizeof(unsigned char));
+    for (r=0; r<mb; r++) {
+        unsigned char * lambda = (r < mb-1) ? &p[(r+1)*Z] : lambda_last;
+        if (r == mb-1)
+            memset(lambda, 0x00, Z*sizeof(unsigned char));
+        for (e=_q->ldpc_layer[r]; e<_q->ldpc_layer[r+1]; e++) {
+            unsigned int c = _q->ldpc_col[e];
+            if (c >= kb) break;
+            unsigned int s = _q->ldpc_shift[e];
+            for (t=0; t<Z-s; t++) lambda[t] ^= _c[c*Z + t + s];
+            for (   ; t<Z;   t++) lambda[t] ^= _c[c*Z + t + s - Z];
+        }
+        // p[0] is the sum of all lambda
+        for (t=0; t<Z; t++)
+            p[t] ^= lambda[t];
+    }
+
+    // locate middle row of weight-3 parity column; top and bottom
+    // rows share the same shift a
+    unsigned int x = 0;
+    for (r=1; r<mb-1; r++) {
+        if (_q->ldpc_base[r*_q->ldpc_nb + kb] >= 0)
+            x = r;
+    }
+    unsigned int a = _q->ldpc_base[kb] % Z;
+
+    // p[1] = lambda[0] + P^a p[0]
+    for (t=0; t<Z; t++)
+        p[Z + t] ^= p[(t+a)%Z];
+
+    // p[r+1] = lambda[r] + p[r] + (r==x ? p[0] : 0)
+    for (r=1; r<mb-1; r++) {
+        for (t=0; t<Z; t++)
+            p[(r+1)*Z + t] ^= p[r*Z + t] ^ (r==x ? p[t] : 0);
+    }
+}
+
+// gather cyclically-shifted posteriors of a layer into row order
+//  _q      :   LDPC object
+//  _layer  :   base graph row
+//  _Q      :   output [size: deg*Z x 1]
+static void fec_ldpc_gather(fec          _q,
+                            unsigned int _layer,
+                            short *      _Q)
+{
+    unsigned int Z = _q->ldpc_Z;
+    unsigned int e;
+    for (e=_q->ldpc_layer[_layer]; e<_q->ldpc_layer[_layer+1]; e++) {
+        short *      L = &_q->ldpc_L[_q->ldpc_col[e]*Z];
+        unsigned int s = _q->ldpc_shift[e];
+        memcpy(_Q,         &L[s], (Z-s)*sizeof(short));
+        memcpy(&_Q[Z - s], L,     s*sizeof(short));
+        _Q += Z;
+    }
+}
+
+// scatter row-ordered posteriors of a layer back to columns
+static void fec_ldpc_scatter(fec          _q,
+                             unsigned int _layer,
+                             short *      _Q)
+{
+    unsigned int Z = _q->ldpc_Z;
+    unsigned int e;
+    for (e=_q->ldpc_layer[_layer]; e<_q->ldpc_layer[_layer+1]; e++) {
+        short *      L = &_q->ldpc_L[_q->ldpc_col[e]*Z];
+        unsigned int s = _q->ldpc_shift[e];
+        memcpy(&L[s], _Q,         (Z-s)*sizeof(short));
+        memcpy(L,     &_Q[Z - s], s*sizeof(short));
+        _Q += Z;
+    }
+}
+
+// update check nodes of a single layer using normalized min-sum
+//  _q      :   LDPC object
+//  _layer  :   base graph row
+void fec_ldpc_update_layer(fec          _q,
+                           unsigned int _layer)
+{
+    unsigned int Z  = _q->ldpc_Z;
+    unsigned int e0 = _q->ldpc_layer[_layer];
+    unsigned int dc = _q->ldpc_layer[_layer+1] - e0;
+    short * Q = _q->ldpc_Q;
+    short * R = &_q->ldpc_R[e0*Z];
+    unsigned int e;
+    unsigned int t;
+
+    // load posteriors for this layer
+    fec_ldpc_gather(_q, _layer, Q);
+
+#if FEC_LDPC_SSE
+    __m128i zero = _mm_setzero_si128();
+    for (t=0; t<Z; t+=8) {
+        // variable-to-check messages: Q = L - R; track the two smallest
+        // magnitudes, the index of the smallest, and the sign product
+        __m128i min1 = _mm_set1_epi16(0x7fff);
+        __m128i min2 = _mm_set1_epi16(0x7fff);
+        __m128i imin = zero;
+        __m128i sgn  = zero;
+        for (e=0; e<dc; e++) {
+            __m128i q = _mm_subs_epi16(_mm_loadu_si128((__m128i*)&Q[e*Z+t]),
+                                       _mm_loadu_si128((__m128i*)&R[e*Z+t]));
+            _mm_storeu_si128((__m128i*)&Q[e*Z+t], q);
+            __m128i v = _mm_max_epi16(q, _mm_subs_epi16(zero, q));
+            __m128i m = _mm_cmplt_epi16(v, min1);
+            sgn  = _mm_xor_si128(sgn, q);
+            min2 = _mm_min_epi16(min2, _mm_max_epi16(min1, v));
+            min1 = _mm_min_epi16(min1, v);
+            imin = _mm_or_si128(_mm_andnot_si128(m, imin),
+                                _mm_and_si128(m, _mm_set1_epi16(e)));
+        }
+
+        // normalize by 3/4
+        min1 = _mm_sub_epi16(min1, _mm_srai_epi16(min1, 2));
+        min2 = _mm_sub_epi16(min2, _mm_srai_epi16(min2, 2));
+
+        // check-to-variable messages and updated posteriors
+        for (e=0; e<dc; e++) {
+            __m128i q = _mm_loadu_si128((__m128i*)&Q[e*Z+t]);
+            __m128i m = _mm_cmpeq_epi16(imin, _mm_set1_epi16(e));
+            __m128i v = _mm_or_si128(_mm_andnot_si128(m, min1), _mm_and_si128(m, min2));
+            __m128i s = _mm_srai_epi16(_mm_xor_si128(sgn, q), 15);
+            __m128i r = _mm_sub_epi16(_mm_xor_si128(v, s), s);
+            _mm_storeu_si128((__m128i*)&R[e*Z+t], r);
+            _mm_storeu_si128((__m128i*)&Q[e*Z+t], _mm_adds_epi16(q, r));
+        }
+    }
+#else
+    for (t=0; t<Z; t++) {
+        int min1 = 0x7fff;
+        int min2 = 0x7fff;
+        unsigned int imin = 0;
+        int sgn = 0;
+        for (e=0; e<dc; e++) {
+            int q = (int)Q[e*Z+t] - (int)R[e*Z+t];
+            q = q > 32767 ? 32767 : (q < -32768 ? -32768 : q);
+            Q[e*Z+t] = q;
+            int v = q < 0 ? (q == -32768 ? 32767 : -q) : q;
+            sgn ^= q;
+            if (v < min1) {
+                min2 = min1;
+                min1 = v;
+                imin = e;
+            } else if (v < min2) {
+                min2 = v;
+            }
+        }
+
+        // normalize by 3/4
+        min1 -= min1 >> 2;
+        min2 -= min2 >> 2;
+
+        for (e=0; e<dc; e++) {
+            int q = Q[e*Z+t];
+            int v = e == imin ? min2 : min1;
+            int r = (sgn ^ q) < 0 ? -v : v;
+            int p = q + r;
+            R[e*Z+t] = r;
+            Q[e*Z+t] = p > 32767 ? 32767 : (p < -32768 ? -32768 : p);
+        }
+    }
+#endif
+
+    // store updated posteriors
+    fec_ldpc_scatter(_q, _layer, Q);
+}
+
+// check parity of hard decisions on posteriors, returning 1 if all
+// parity checks are satisfied, 0 otherwise
+int fec_ldpc_check(fec _q)
+{
+    unsigned int Z = _q->ldpc_Z;
+    short * Q = _q->ldpc_Q;
+    unsigned int r;
+    unsigned int e;
+    unsigned int t;
+    for (r=0; r<_q->ldpc_mb; r++) {
+        unsigned int dc = _q->ldpc_layer[r+1] - _q->ldpc_layer[r];
+        fec_ldpc_gather(_q, r, Q);
+
+        // sign bit of exclusive-or across edges gives check parity
+#if FEC_LDPC_SSE
+        __m128i v = _mm_setzero_si128();
+        for (t=0; t<Z; t+=8) {
+            __m128i x = _mm_loadu_si128((__m128i*)&Q[t]);
+            for (e=1; e<dc; e++)
+                x = _mm_xor_si128(x, _mm_loadu_si128((__m128i*)&Q[e*Z+t]));
+            v = _mm_or_si128(v, x);
+        }
+        if (_mm_movemask_epi8(_mm_srai_epi16(v, 15)))
+            return 0;
+#else
+        for (t=0; t<Z; t++) {
+            short x = Q[t];
+            for (e=1; e<dc; e++)
+                x ^= Q[e*Z+t];
+            if (x < 0)
+                return 0;
+        }
+#endif
+    }
+    return 1;
+}
+
+// run layered decoder on channel LLRs stored in internal posterior
+// buffer, returning 1 if parity checks were satisfied, 0 otherwise
+//  _q              :   LDPC object (lifting size set, posteriors loaded)
+//  _max_iterations :   maximum number of iterations
+int fec_ldpc_decode_block(fec          _q,
+                          unsigned int _max_iterations)
+{
+    // reset check-to-variable messages
+    memset(_q->ldpc_R, 0x00, _q->ldpc_num_edges*_q->ldpc_Z*sizeof(short));
+
+    // stop early if received codeword is already valid
+    if (fec_ldpc_check(_q))
+        return 1;
+
+    unsigned int n;
+    unsigned int r;
+    for (n=0; n<_max_iterations; n++) {
+        for (r=0; r<_q->ldpc_mb; r++)
+            fec_ldpc_update_layer(_q, r);
+
+        // early termination
+        if (fec_ldpc_check(_q)) {
+#if DEBUG_FEC_LDPC
+            printf("fec_ldpc_decode_block(), converged after %u iterations\n", n+1);
+#endif
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// generate expanded parity-check matrix for LDPC scheme
+//  _fs     :   LDPC scheme
+//  _Z      :   lifting size
+smatrixb fec_ldpc_gen_smatrixb(fec_scheme   _fs,
+                               unsigned int _Z)
+{
+    int * base = NULL;
+    unsigned int mb = fec_ldpc_get_basegraph(_fs, &base);
+    smatrixb H = smatrixb_create(mb*_Z, FEC_LDPC_NB*_Z);
+    unsigned int r;
+    unsigned int c;
+    unsigned int t;
+    for (r=0; r<mb; r++) {
+        for (c=0; c<FEC_LDPC_NB; c++) {
+            int s = base[r*FEC_LDPC_NB + c];
+            if (s < 0) continue;
+            for (t=0; t<_Z; t++)
+                smatrixb_set(H, r*_Z + t, c*_Z + (t + s)%_Z, 1);
+        }
+    }
+    return H;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+//
+// quasi-cyclic LDPC base graphs
+//
+// Each base graph has 24 block columns; the last mb columns form the
+// dual-diagonal parity structure (weight-3 column with shifts 1,0,1
+// followed by a staircase of identities) which allows linear-time
+// encoding. Entries are cyclic shifts of the Z x Z identity reduced
+// modulo the lifting size Z; -1 denotes an all-zero block. Shifts were
+// chosen to avoid length-4 cycles for all lifting sizes Z >= 16.
+//
+
+#include "liquid.internal.h"
+
+// rate 1/2, base graph [12 x 24]
+int fec_ldpc_r12_basegraph[288] = {
+     91, 43, 27, -1, 57, -1, -1, -1, -1, -1, 27, 40,  1,  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     21, 89, 70, -1, -1, -1, 84, 31, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     76, 31, 20, -1, -1, -1, 94, -1, -1,  2, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1, -1, -1,
+      7, 84, 86, -1, -1, -1, 10, -1, -1, -1, -1, 14, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1, -1,
+     58, 81, -1, 78, 34, -1, -1, -1, -1, 69, -1, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1,
+     71, -1, 57, 61, -1, -1, -1, 22, -1, -1, 77, -1, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1,
+     -1, 33, 32, -1, -1, -1, -1, 19,  4, -1, -1, -1,  0, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1,
+     71, 51, 14, -1, -1, 22, -1, -1, -1,  8, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1,
+     29, 63,  3, -1, 14, -1, -1, -1, 93, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0, -1, -1,
+     27, 25, 23, -1, -1, 48, -1, -1, 34, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0, -1,
+     41, 10, 54, 56, -1, -1, -1, -1, -1, -1, 43, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0,
+     53, 79, 88, -1, -1, 13, -1, -1, -1, -1, -1, 83,  1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0
+};
+
+// rate 2/3, base graph [8 x 24]
+int fec_ldpc_r23_basegraph[192] = {
+     -1, 95, 77, 19, 29, -1, 20, -1, -1, 84, -1, -1, -1, 66, 55, -1,  1,  0, -1, -1, -1, -1, -1, -1,
+     62, 81, -1, 38, -1, 29, -1, 77, -1, -1, -1, 53, 92, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1,
+     10, -1, 11, 64, -1, -1,  6, -1, 62, 40, -1, -1, -1, -1, 16, 25, -1, -1,  0,  0, -1, -1, -1, -1,
+     69, 14, -1, 78, 35, -1, -1, 47, -1,  1, -1, -1, 90, -1, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1,
+     -1, 37,  8, -1, -1, 68, 52, -1, -1, -1, 68, 85, -1, -1, -1, 27,  0, -1, -1, -1,  0,  0, -1, -1,
+     31, -1, 79, 46, 33, -1, -1, 50, -1, -1, 40, -1, -1, 35, 95, -1, -1, -1, -1, -1, -1,  0,  0, -1,
+     24, 44, 53, 77, -1, -1, -1, -1,  5, -1, 18, -1, 90, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0,
+     23, 81,  6, -1, -1, 65, -1, -1, 87, -1, -1, 16, -1, 62, -1, 43,  1, -1, -1, -1, -1, -1, -1,  0
+};
+
+// rate 3/4, base graph [6 x 24]
+int fec_ldpc_r34_basegraph[144] = {
+     18, 39, 80, -1, 84, 85, -1, 30, 68, -1, -1, 58, -1, 94, -1, 39, 37, -1,  1,  0, -1, -1, -1, -1,
+      3, 29, 39,  4, -1, 74, -1, -1, 23,  4, -1,  6, -1, -1, 88, -1, 71, 81, -1,  0,  0, -1, -1, -1,
+     62, 44, 83, 38, -1, 35, 43, -1, -1, -1, 11, -1,  7, 37, -1, 24, -1, 22, -1, -1,  0,  0, -1, -1,
+     80, 19, 33, -1, -1, -1, 54, 27, -1, 27,  0, -1, -1,  9, 44, -1, -1, -1,  0, -1, -1,  0,  0, -1,
+     69, 81, 93, -1, 60, -1, 57, -1,  0, 12, -1, -1, 35, -1, 51, -1,  6, 38, -1, -1, -1, -1,  0,  0,
+     89, 80, 11, 77, 49, -1, -1, 10, -1, -1,  0, 56, 45, -1, -1, 81, -1, -1,  1, -1, -1, -1, -1,  0
+};
+
+// rate 5/6, base graph [4 x 24]
+int fec_ldpc_r56_basegraph[96] = {
+     27, 92, 87, 77, 46, 67, 56, 66, -1, 70, 73, 54, -1, 40, 60, -1, 48, -1, 79, 53,  1,  0, -1, -1,
+     29, 84, 66, 43, -1, 74, 50, -1, 33, 74, -1, 12, 62, 77, 13,  6, -1,  0, -1,  2,  0,  0,  0, -1,
+     26, 86, 76, 14, 25, -1,  8, 47, 45, -1, 59, 61, 23, 12, -1, 29, 89, 46, 45, -1, -1, -1,  0,  0,
+     73, 81, 84,  1, 71, 10, -1,  3, 79, 81,  8, -1, 77, -1, 72, 78,  2, 85, 71, 91,  1, -1, -1,  0
+};
@@ -0,0 +1,569 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Reed-Solomon codec over GF(2^8)
+//
+// A codeword holds n = nn - pad symbols: k = n - nroots data symbols
+// followed by nroots parity symbols, the first symbol being the
+// coefficient of the highest power of x. Shortened codes (pad > 0) never
+// store or process the implicit leading zeros.
+//
+// Multiplication by a constant c is split on the nibbles of the operand,
+// c*x = c*(x & 0x0f) ^ c*(x & 0xf0), each half being read from a 16-entry
+// table; with SSSE3 this is two PSHUFB lookups for sixteen symbols. The
+// encoder register, the syndromes (accumulated over sixteen interleaved
+// sub-sequences and folded at the end) and the Chien search (sixteen
+// candidate locations at a time) are all reduced to such products. The
+// Berlekamp-Massey iteration is short and remains scalar.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_TMMINTRIN_H && defined(__SSSE3__)
+#  include <tmmintrin.h>
+#  define FEC_REEDSOLOMON_SSSE3 1
+#else
+#  define FEC_REEDSOLOMON_SSSE3 0
+#endif
+
+#define FEC_RS_NN   (255)   // symbols in a full codeword
+#define FEC_RS_A0   (255)   // log of zero
+
+// Reed-Solomon codec object
+struct fec_reedsolomon_s {
+    unsigned int nroots;        // number of parity symbols
+    unsigned int fcs;           // first consecutive root (log)
+    unsigned int prim;          // primitive element generating the roots (log)
+    unsigned int pad;           // number of implicit leading zeros
+    unsigned int n;             // stored codeword length, nn - pad
+    unsigned int k;             // data symbols per codeword, n - nroots
+    unsigned int nv;            // nroots rounded up to a multiple of 16
+    unsigned int nb;            // n rounded up to a multiple of 16
+
+    unsigned char alpha_to[2*FEC_RS_NN];    // antilog table (repeated)
+    unsigned char index_of[256];            // log table
+    unsigned char * mul_lo;     // c*x for x in [0,15]        [size: 256 x 16]
+    unsigned char * mul_hi;     // c*(x<<4) for x in [0,15]   [size: 256 x 16]
+
+    // encoder
+    unsigned char * genpoly;    // generator coefficients g(nroots-1-j) [size: nv]
+    unsigned char * gen_lo;     // low nibbles of genpoly  [size: nv]
+    unsigned char * gen_hi;     // high nibbles of genpoly [size: nv]
+    unsigned char * reg;        // parity shift register   [size: nv]
+
+    // decoder
+    unsigned char * syn_mul;    // b^16, b^8, b^4, b^2, b for each root b [size: 5 x nroots]
+    unsigned char * block;      // zero-prefixed received block [size: nb]
+    unsigned char * syn;        // syndromes                    [size: nroots]
+    unsigned char * lambda;     // errata locator polynomial    [size: nroots+1]
+    unsigned char * b;          // Berlekamp-Massey correction  [size: nroots+1]
+    unsigned char * t;          // temporary polynomial         [size: nroots+1]
+    unsigned char * omega;      // errata evaluator polynomial  [size: nroots]
+    unsigned char * chien;      // Chien search terms           [size: 16 x (nroots+1)]
+    unsigned char * chien_mul;  // Chien search step per term   [size: nroots+1]
+    unsigned int  * loc;        // errata locations (degree)    [size: nroots]
+};
+
+// multiply two field elements
+static unsigned char fec_reedsolomon_mul(struct fec_reedsolomon_s * _q,
+                                         unsigned char _a,
+                                         unsigned char _b)
+{
+    if (_a == 0 || _b == 0)
+        return 0;
+    return _q->alpha_to[_q->index_of[_a] + _q->index_of[_b]];
+}
+
+// alpha^_e and alpha^-_e
+static unsigned char fec_reedsolomon_pow(struct fec_reedsolomon_s * _q,
+                                         unsigned int _e)
+{
+    return _q->alpha_to[_e % FEC_RS_NN];
+}
+
+static unsigned char fec_reedsolomon_pow_neg(struct fec_reedsolomon_s * _q,
+                                             unsigned int _e)
+{
+    return _q->alpha_to[FEC_RS_NN - (_e % FEC_RS_NN)];
+}
+
+// multiplicative inverse of non-zero field element
+static unsigned char fec_reedsolomon_inv(struct fec_reedsolomon_s * _q,
+                                         unsigned char _a)
+{
+    return _q->alpha_to[FEC_RS_NN - _q->index_of[_a]];
+}
+
+#if FEC_REEDSOLOMON_SSSE3
+// multiply sixteen symbols by the constant whose nibble tables are _lo, _hi
+static inline __m128i fec_reedsolomon_mul_sse(__m128i _x,
+                                              __m128i _lo,
+                                              __m128i _hi)
+{
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    __m128i xl = _mm_and_si128(_x, mask);
+    __m128i xh = _mm_and_si128(_mm_srli_epi64(_x, 4), mask);
+    return _mm_xor_si128(_mm_shuffle_epi8(_lo, xl), _mm_shuffle_epi8(_hi, xh));
+}
+
+// load nibble tables for constant _c
+#define FEC_RS_LOAD_LO(Q,C) _mm_loadu_si128((const __m128i*)&(Q)->mul_lo[16*(C)])
+#define FEC_RS_LOAD_HI(Q,C) _mm_loadu_si128((const __m128i*)&(Q)->mul_hi[16*(C)])
+#endif
+
+// create Reed-Solomon codec object
+//  _symsize    :   bits per symbol (must be 8)
+//  _gfpoly     :   field generator polynomial, e.g. 0x11d
+//  _fcs        :   first consecutive root of the generator (log)
+//  _prim       :   primitive element used to generate roots (log)
+//  _nroots     :   number of parity symbols, 0 < _nroots < 255
+//  _pad        :   number of implicit leading zeros (shortening)
+void * fec_reedsolomon_create(unsigned int _symsize,
+                              unsigned int _gfpoly,
+                              unsigned int _fcs,
+                              unsigned int _prim,
+                              unsigned int _nroots,
+                              unsigned int _pad)
+{
+    // validate input
+    if (_symsize != 8) {
+        fprintf(stderr,"error: fec_reedsolomon_create(), only 8-bit symbols are supported\n");
+        exit(1);
+    } else if (_gfpoly < 0x100 || _gfpoly > 0x1ff) {
+        fprintf(stderr,"error: fec_reedsolomon_create(), field polynomial must have degree 8\n");
+        exit(1);
+    } else if (_fcs >= FEC_RS_NN) {
+        fprintf(stderr,"error: fec_reedsolomon_create(), first consecutive root out of range\n");
+        exit(1);
+    } else if (_prim == 0 || _prim >= FEC_RS_NN ||
+               (_prim % 3) == 0 || (_prim % 5) == 0 || (_prim % 17) == 0) {
+        fprintf(stderr,"error: fec_reedsolomon_create(), primitive element must be co-prime with 255\n");
+        exit(1);
+    } else if (_nroots == 0 || _nroots >= FEC_RS_NN) {
+        fprintf(stderr,"error: fec_reedsolomon_create(), number of roots out of range\n");
+        exit(1);
+    } else if (_pad >= FEC_RS_NN - _nroots) {
+        fprintf(stderr,"error: fec_reedsolomon_create(), padding leaves no data symbols\n");
+        exit(1);
+    }
+
+    struct fec_reedsolomon_s * q = (struct fec_reedsolomon_s*) malloc(sizeof(struct fec_reedsolomon_s));
+    q->nroots = _nroots;
+    q->fcs    = _fcs;
+    q->prim   = _prim;
+    q->pad    = _pad;
+    q->n      = FEC_RS_NN - _pad;
+    q->k      = q->n - _nroots;
+    q->nv     = 16*((_nroots + 15)/16);
+    q->nb     = 16*((q->n    + 15)/16);
+
+    // generate log/antilog tables
+    unsigned int i, j;
+    unsigned int sr = 1;
+    for (i=0; i<FEC_RS_NN; i++) {
+        q->alpha_to[i]  = (unsigned char) sr;
+        q->index_of[sr] = (unsigned char) i;
+        sr <<= 1;
+        if (sr & 0x100)
+            sr ^= _gfpoly;
+    }
+    if (sr != 1) {
+        fprintf(stderr,"error: fec_reedsolomon_create(), field polynomial 0x%x is not primitive\n", _gfpoly);
+        exit(1);
+    }
+    for (i=0; i<FEC_RS_NN; i++)
+        q->alpha_to[FEC_RS_NN + i] = q->alpha_to[i];
+    q->index_of[0] = FEC_RS_A0;
+
+    // nibble product tables
+    q->mul_lo = (unsigned char*) malloc(256*16*sizeof(unsigned char));
+    q->mul_hi = (unsigned char*) malloc(256*16*sizeof(unsigned char));
+    for (i=0; i<256; i++) {
+        for (j=0; j<16; j++) {
+            q->mul_lo[16*i+j] = fec_reedsolomon_mul(q, i, j);
+            q->mul_hi[16*i+j] = fec_reedsolomon_mul(q, i, j<<4);
+        }
+    }
+
+    // generator polynomial: g(x) = prod_i (x - alpha^((fcs+i)*prim))
+    unsigned char g[_nroots+1];
+    memset(g, 0x00, sizeof(g));
+    g[0] = 1;
+    for (i=0; i<_nroots; i++) {
+        unsigned char root = fec_reedsolomon_pow(q, (_fcs + i)*_prim);
+        for (j=i+1; j>0; j--)
+            g[j] = g[j-1] ^ fec_reedsolomon_mul(q, g[j], root);
+        g[0] = fec_reedsolomon_mul(q, g[0], root);
+    }
+    q->genpoly = (unsigned char*) calloc(q->nv, sizeof(unsigned char));
+    q->gen_lo  = (unsigned char*) calloc(q->nv, sizeof(unsigned char));
+    q->gen_hi  = (unsigned char*) calloc(q->nv, sizeof(unsigned char));
+    q->reg     = (unsigned char*) calloc(q->nv, sizeof(unsigned char));
+    for (i=0; i<_nroots; i++) {
+        q->genpoly[i] = g[_nroots-1-i];
+        q->gen_lo[i]  = q->genpoly[i] & 0x0f;
+        q->gen_hi[i]  = q->genpoly[i] >> 4;
+    }
+
+    // syndrome constants
+    q->syn_mul = (unsigned char*) malloc(5*_nroots*sizeof(unsigned char));
+    for (i=0; i<_nroots; i++) {
+        unsigned int e = ((_fcs + i)*_prim) % FEC_RS_NN;
+        q->syn_mul[5*i+0] = fec_reedsolomon_pow(q, 16*e);
+        q->syn_mul[5*i+1] = fec_reedsolomon_pow(q,  8*e);
+        q->syn_mul[5*i+2] = fec_reedsolomon_pow(q,  4*e);
+        q->syn_mul[5*i+3] = fec_reedsolomon_pow(q,  2*e);
+        q->syn_mul[5*i+4] = fec_reedsolomon_pow(q,    e);
+    }
+
+    // decoder buffers
+    q->block     = (unsigned char*) calloc(q->nb, sizeof(unsigned char));
+    q->syn       = (unsigned char*) malloc(_nroots*sizeof(unsigned char));
+    q->lambda    = (unsigned char*) malloc((_nroots+1)*sizeof(unsigned char));
+    q->b         = (unsigned char*) malloc((_nroots+1)*sizeof(unsigned char));
+    q->t         = (unsigned char*) malloc((_nroots+1)*sizeof(unsigned char));
+    q->omega     = (unsigned char*) malloc(_nroots*sizeof(unsigned char));
+    q->chien     = (unsigned char*) malloc(16*(_nroots+1)*sizeof(unsigned char));
+    q->chien_mul = (unsigned char*) malloc((_nroots+1)*sizeof(unsigned char));
+    q->loc       = (unsigned int *) malloc(_nroots*sizeof(unsigned int));
+
+    return (void*) q;
+}
+
+// destroy Reed-Solomon codec object
+void fec_reedsolomon_destroy(void * _rs)
+{
+    struct fec_reedsolomon_s * q = (struct fec_reedsolomon_s*) _rs;
+    free(q->mul_lo);
+    free(q->mul_hi);
+    free(q->genpoly);
+    free(q->gen_lo);
+    free(q->gen_hi);
+    free(q->reg);
+    free(q->syn_mul);
+    free(q->block);
+    free(q->syn);
+    free(q->lambda);
+    free(q->b);
+    free(q->t);
+    free(q->omega);
+    free(q->chien);
+    free(q->chien_mul);
+    free(q->loc);
+    free(q);
+}
+
+// encode block, computing parity symbols
+//  _rs     :   Reed-Solomon codec object
+//  _data   :   data symbols [size: (nn-pad-nroots) x 1]
+//  _parity :   output parity symbols [size: nroots x 1]
+void fec_reedsolomon_encode(void *          _rs,
+                            unsigned char * _data,
+                            unsigned char * _parity)
+{
+    struct fec_reedsolomon_s * q = (struct fec_reedsolomon_s*) _rs;
+    unsigned int i;
+#if FEC_REEDSOLOMON_SSSE3
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int v;
+    memset(q->reg, 0x00, q->nv);
+    if (q->nv == 32) {
+        // common case: keep the register in two vectors
+        __m128i r0  = zero;
+        __m128i r1  = zero;
+        __m128i gl0 = _mm_loadu_si128((const __m128i*)&q->gen_lo[ 0]);
+        __m128i gl1 = _mm_loadu_si128((const __m128i*)&q->gen_lo[16]);
+        __m128i gh0 = _mm_loadu_si128((const __m128i*)&q->gen_hi[ 0]);
+        __m128i gh1 = _mm_loadu_si128((const __m128i*)&q->gen_hi[16]);
+        for (i=0; i<q->k; i++) {
+            unsigned char fb = _data[i] ^ (unsigned char)_mm_cvtsi128_si32(r0);
+            __m128i lo = FEC_RS_LOAD_LO(q, fb);
+            __m128i hi = FEC_RS_LOAD_HI(q, fb);
+            r0 = _mm_xor_si128(_mm_alignr_epi8(r1, r0, 1),
+                               _mm_xor_si128(_mm_shuffle_epi8(lo, gl0), _mm_shuffle_epi8(hi, gh0)));
+            r1 = _mm_xor_si128(_mm_srli_si128(r1, 1),
+                               _mm_xor_si128(_mm_shuffle_epi8(lo, gl1), _mm_shuffle_epi8(hi, gh1)));
+        }
+        _mm_storeu_si128((__m128i*)&q->reg[ 0], r0);
+        _mm_storeu_si128((__m128i*)&q->reg[16], r1);
+    } else {
+        for (i=0; i<q->k; i++) {
+            unsigned char fb = _data[i] ^ q->reg[0];
+            __m128i lo = FEC_RS_LOAD_LO(q, fb);
+            __m128i hi = FEC_RS_LOAD_HI(q, fb);
+            for (v=0; v<q->nv; v+=16) {
+                __m128i r0 = _mm_loadu_si128((const __m128i*)&q->reg[v]);
+                __m128i r1 = v + 16 < q->nv ? _mm_loadu_si128((const __m128i*)&q->reg[v+16]) : zero;
+                __m128i gl = _mm_loadu_si128((const __m128i*)&q->gen_lo[v]);
+                __m128i gh = _mm_loadu_si128((const __m128i*)&q->gen_hi[v]);
+                r0 = _mm_xor_si128(_mm_alignr_epi8(r1, r0, 1),
+                                   _mm_xor_si128(_mm_shuffle_epi8(lo, gl), _mm_shuffle_epi8(hi, gh)));
+                _mm_storeu_si128((__m128i*)&q->reg[v], r0);
+            }
+        }
+    }
+#else
+    unsigned int j;
+    memset(q->reg, 0x00, q->nv);
+    for (i=0; i<q->k; i++) {
+        unsigned char fb = _data[i] ^ q->reg[0];
+        for (j=0; j<q->nroots-1; j++)
+            q->reg[j] = q->reg[j+1] ^ fec_reedsolomon_mul(q, fb, q->genpoly[j]);
+        q->reg[q->nroots-1] = fec_reedsolomon_mul(q, fb, q->genpoly[q->nroots-1]);
+    }
+#endif
+    memmove(_parity, q->reg, q->nroots*sizeof(unsigned char));
+}
+
+// compute syndromes S(i) = r(alpha^((fcs+i)*prim)), returning non-zero
+// if any syndrome is non-zero
+static int fec_reedsolomon_syndromes(struct fec_reedsolomon_s * _q,
+                                     unsigned char *            _r)
+{
+    unsigned int i;
+    unsigned char any = 0;
+#if FEC_REEDSOLOMON_SSSE3
+    // Prefix the block with zeros to a multiple of 16 symbols; lane l then
+    // accumulates the sub-sequence r(16m+l) by Horner's rule in b^16, and
+    // the sixteen partial sums are folded with b^8, b^4, b^2 and b.
+    unsigned int j;
+    unsigned int offset = _q->nb - _q->n;
+    memmove(&_q->block[offset], _r, _q->n*sizeof(unsigned char));
+    for (i=0; i<_q->nroots; i++) {
+        const unsigned char * c = &_q->syn_mul[5*i];
+        __m128i lo = FEC_RS_LOAD_LO(_q, c[0]);
+        __m128i hi = FEC_RS_LOAD_HI(_q, c[0]);
+        __m128i p  = _mm_loadu_si128((const __m128i*)&_q->block[0]);
+        for (j=16; j<_q->nb; j+=16) {
+            p = _mm_xor_si128(fec_reedsolomon_mul_sse(p, lo, hi),
+                              _mm_loadu_si128((const __m128i*)&_q->block[j]));
+        }
+        p = _mm_xor_si128(fec_reedsolomon_mul_sse(p, FEC_RS_LOAD_LO(_q,c[1]), FEC_RS_LOAD_HI(_q,c[1])), _mm_srli_si128(p,8));
+        p = _mm_xor_si128(fec_reedsolomon_mul_sse(p, FEC_RS_LOAD_LO(_q,c[2]), FEC_RS_LOAD_HI(_q,c[2])), _mm_srli_si128(p,4));
+        p = _mm_xor_si128(fec_reedsolomon_mul_sse(p, FEC_RS_LOAD_LO(_q,c[3]), FEC_RS_LOAD_HI(_q,c[3])), _mm_srli_si128(p,2));
+        p = _mm_xor_si128(fec_reedsolomon_mul_sse(p, FEC_RS_LOAD_LO(_q,c[4]), FEC_RS_LOAD_HI(_q,c[4])), _mm_srli_si128(p,1));
+        _q->syn[i] = (unsigned char) _mm_cvtsi128_si32(p);
+        any |= _q->syn[i];
+    }
+#else
+    unsigned int j;
+    for (i=0; i<_q->nroots; i++) {
+        unsigned char root = _q->syn_mul[5*i+4];
+        unsigned char s = 0;
+        for (j=0; j<_q->n; j++)
+            s = fec_reedsolomon_mul(_q, s, root) ^ _r[j];
+        _q->syn[i] = s;
+        any |= s;
+    }
+#endif
+    return any != 0;
+}
+
+// Chien search: find locations p in [0,n-1] for which lambda(alpha^-(prim*p))
+// is zero, storing them in _q->loc; returns the number of roots found, stopping
+// as soon as it exceeds the degree of lambda
+static unsigned int fec_reedsolomon_chien(struct fec_reedsolomon_s * _q,
+                                          unsigned int               _deg)
+{
+    unsigned int k;
+    unsigned int count = 0;
+#if FEC_REEDSOLOMON_SSSE3
+    // lane l of term k holds lambda(k) alpha^-(prim*k*(p+l)); advancing to
+    // the next sixteen locations multiplies each term by alpha^-(16*prim*k)
+    unsigned int l, p;
+    for (k=0; k<=_deg; k++) {
+        unsigned char step = fec_reedsolomon_pow_neg(_q, _q->prim*k);
+        _q->chien[16*k] = _q->lambda[k];
+        for (l=1; l<16; l++)
+            _q->chien[16*k+l] = fec_reedsolomon_mul(_q, _q->chien[16*k+l-1], step);
+        _q->chien_mul[k] = fec_reedsolomon_pow_neg(_q, 16*_q->prim*k);
+    }
+    for (p=0; p<_q->n; p+=16) {
+        __m128i sum = _mm_setzero_si128();
+        for (k=0; k<=_deg; k++) {
+            __m128i v = _mm_loadu_si128((const __m128i*)&_q->chien[16*k]);
+            sum = _mm_xor_si128(sum, v);
+            v = fec_reedsolomon_mul_sse(v, FEC_RS_LOAD_LO(_q,_q->chien_mul[k]),
+                                           FEC_RS_LOAD_HI(_q,_q->chien_mul[k]));
+            _mm_storeu_si128((__m128i*)&_q->chien[16*k], v);
+        }
+        unsigned int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(sum, _mm_setzero_si128()));
+        if (_q->n - p < 16)
+            mask &= (1u << (_q->n - p)) - 1;
+        for (l=0; mask != 0; l++, mask >>= 1) {
+            if ((mask & 1) == 0)
+                continue;
+            if (count == _deg)
+                return count + 1;
+            _q->loc[count++] = p + l;
+        }
+    }
+#else
+    unsigned int p;
+    for (k=0; k<=_deg; k++) {
+        _q->chien[k]     = _q->lambda[k];
+        _q->chien_mul[k] = fec_reedsolomon_pow_neg(_q, _q->prim*k);
+    }
+    for (p=0; p<_q->n; p++) {
+        unsigned char sum = 0;
+        for (k=0; k<=_deg; k++) {
+            sum ^= _q->chien[k];
+            _q->chien[k] = fec_reedsolomon_mul(_q, _q->chien[k], _q->chien_mul[k]);
+        }
+        if (sum != 0)
+            continue;
+        if (count == _deg)
+            return count + 1;
+        _q->loc[count++] = p;
+    }
+#endif
+    return count;
+}
+
+// decode block in place, correcting errors and erasures
+//  _rs         :   Reed-Solomon codec object
+//  _data       :   received codeword [size: (nn-pad) x 1]
+//  _eras_pos   :   erasure positions in [0,nn-pad-1] on input; corrected
+//                  positions on output (may be NULL if _no_eras is 0)
+//                  [size: nroots x 1]
+//  _no_eras    :   number of erasures
+// returns the number of corrected symbols, or -1 if the block could not
+// be decoded, in which case _data is left untouched
+int fec_reedsolomon_decode(void *          _rs,
+                           unsigned char * _data,
+                           int *           _eras_pos,
+                           int             _no_eras)
+{
+    struct fec_reedsolomon_s * q = (struct fec_reedsolomon_s*) _rs;
+    unsigned int nroots = q->nroots;
+    unsigned int i, j, r;
+
+    if (_no_eras < 0 || _no_eras > (int)nroots)
+        return -1;
+
+    // a valid codeword has all-zero syndromes
+    if (!fec_reedsolomon_syndromes(q, _data))
+        return 0;
+
+    // initialize errata locator with erasures: prod_k (1 - X(k) x)
+    memset(q->lambda, 0x00, (nroots+1)*sizeof(unsigned char));
+    q->lambda[0] = 1;
+    for (i=0; i<(unsigned int)_no_eras; i++) {
+        if (_eras_pos[i] < 0 || _eras_pos[i] >= (int)q->n) {
+            fprintf(stderr,"error: fec_reedsolomon_decode(), erasure position out of range\n");
+            exit(1);
+        }
+        unsigned char x = fec_reedsolomon_pow(q, q->prim*(q->n - 1 - _eras_pos[i]));
+        for (j=i+1; j>0; j--)
+            q->lambda[j] ^= fec_reedsolomon_mul(q, x, q->lambda[j-1]);
+    }
+
+    // Berlekamp-Massey; at step r neither lambda(x) nor x b(x) has degree
+    // above r
+    memmove(q->b, q->lambda, (nroots+1)*sizeof(unsigned char));
+    unsigned int el = _no_eras;
+    for (r=_no_eras+1; r<=nroots; r++) {
+        // discrepancy
+        unsigned char discr = 0;
+        for (j=0; j<r; j++)
+            discr ^= fec_reedsolomon_mul(q, q->lambda[j], q->syn[r-1-j]);
+
+        // b(x) <- x b(x)
+        memmove(&q->b[1], &q->b[0], r*sizeof(unsigned char));
+        q->b[0] = 0;
+        if (discr == 0)
+            continue;
+
+        // t(x) = lambda(x) - discr x b(x)
+        for (j=0; j<=r; j++)
+            q->t[j] = q->lambda[j] ^ fec_reedsolomon_mul(q, discr, q->b[j]);
+
+        if (2*el <= r + _no_eras - 1) {
+            el = r + _no_eras - el;
+            unsigned char dinv = fec_reedsolomon_inv(q, discr);
+            for (j=0; j<=r; j++)
+                q->b[j] = fec_reedsolomon_mul(q, q->lambda[j], dinv);
+        }
+        memmove(q->lambda, q->t, (r+1)*sizeof(unsigned char));
+    }
+
+    // degree of errata locator
+    unsigned int deg = 0;
+    for (j=0; j<=nroots; j++) {
+        if (q->lambda[j] != 0)
+            deg = j;
+    }
+    if (deg == 0)
+        return -1;
+
+    // the number of roots within the block must match the degree
+    unsigned int count = fec_reedsolomon_chien(q, deg);
+    if (count != deg)
+        return -1;
+
+    // errata evaluator: omega(x) = S(x) lambda(x) mod x^nroots, whose degree
+    // is below that of lambda for a correctable block
+    for (i=0; i<deg; i++) {
+        unsigned char v = 0;
+        for (j=0; j<=i && j<=deg; j++)
+            v ^= fec_reedsolomon_mul(q, q->syn[i-j], q->lambda[j]);
+        q->omega[i] = v;
+    }
+
+    // Forney: e = X^(1-fcs) omega(X^-1) / lambda'(X^-1); compute all values
+    // before modifying the block
+    for (i=0; i<count; i++) {
+        unsigned int lx = (q->prim * q->loc[i]) % FEC_RS_NN;
+        unsigned char xinv = fec_reedsolomon_pow_neg(q, lx);
+
+        unsigned char num = 0;
+        for (j=deg; j>0; j--)
+            num = fec_reedsolomon_mul(q, num, xinv) ^ q->omega[j-1];
+
+        unsigned char den = 0;
+        unsigned char xinv2 = fec_reedsolomon_mul(q, xinv, xinv);
+        unsigned char xp = 1;   // xinv^(k-1) for odd k
+        for (j=1; j<=deg; j+=2) {
+            den ^= fec_reedsolomon_mul(q, q->lambda[j], xp);
+            xp = fec_reedsolomon_mul(q, xp, xinv2);
+        }
+        if (den == 0)
+            return -1;
+
+        unsigned char e = fec_reedsolomon_mul(q, num, fec_reedsolomon_inv(q, den));
+        q->t[i] = fec_reedsolomon_mul(q, e, fec_reedsolomon_pow(q, lx*((FEC_RS_NN + 1 - q->fcs) % FEC_RS_NN)));
+    }
+
+    // apply corrections
+    for (i=0; i<count; i++) {
+        unsigned int pos = q->n - 1 - q->loc[i];
+        _data[pos] ^= q->t[i];
+        if (_eras_pos != NULL)
+            _eras_pos[i] = pos;
+    }
+    return count;
+}
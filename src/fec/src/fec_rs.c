@@ -33,8 +33,10 @@
 
 #define VERBOSE_FEC_RS    0
 
-#if LIBFEC_ENABLED
-#include "fec.h"
+// Soft decoding: symbols containing a bit whose soft value lies within
+// this distance of the decision threshold are declared erasures, up to
+// nroots/2 of the least reliable symbols per block.
+#define FEC_RS_ERASURE_THRESHOLD    (32)
 
 fec fec_rs_create(fec_scheme _fs)
 {
@@ -45,7 +47,7 @@ fec fec_rs_create(fec_scheme _fs)
 
     q->encode_func      = &fec_rs_encode;
     q->decode_func      = &fec_rs_decode;
-    q->decode_soft_func = NULL;
+    q->decode_soft_func = &fec_rs_decode_soft;
 
     switch (q->scheme) {
     case LIQUID_FEC_RS_M8: fec_rs_init_p8(q);   break;
@@ -74,7 +76,7 @@ void fec_rs_destroy(fec _q)
 {
     // delete internal Reed-Solomon decoder object
     if (_q->rs != NULL) {
-        free_rs_char(_q->rs);
+        fec_reedsolomon_destroy(_q->rs);
     }
 
     // delete internal memory arrays
@@ -117,7 +119,7 @@ void fec_rs_encode(fec _q,
         // necessary as these bits are going to be thrown away anyway
 
         // encode data, appending parity bits to end of sequence
-        encode_rs_char(_q->rs, _q->tblock, &_q->tblock[_q->dec_block_len]);
+        fec_reedsolomon_encode(_q->rs, _q->tblock, &_q->tblock[_q->dec_block_len]);
 
         // copy result to output
         memmove(&_msg_enc[n1], _q->tblock, _q->enc_block_len*sizeof(unsigned char));
@@ -148,8 +150,8 @@ void fec_rs_decode(fec _q,
     fec_rs_setlength(_q, _dec_msg_len);
 
     // set erasures, error locations to zero
-    memset(_q->errlocs,  0x00, _q->nn*sizeof(unsigned char));
-    memset(_q->derrlocs, 0x00, _q->nn*sizeof(unsigned char));
+    memset(_q->errlocs,  0x00, _q->nn*sizeof(int));
+    memset(_q->derrlocs, 0x00, _q->nn*sizeof(int));
     _q->erasures = 0;
 
     unsigned int i;
@@ -168,10 +170,90 @@ void fec_rs_decode(fec _q,
 
         // decode block
         //derrors = 
-        decode_rs_char(_q->rs,
-                       _q->tblock,
-                       _q->derrlocs,
-                       _q->erasures);
+        fec_reedsolomon_decode(_q->rs,
+                               _q->tblock,
+                               _q->derrlocs,
+                               _q->erasures);
+
+        // copy result
+        memmove(&_msg_dec[n1], _q->tblock, block_size*sizeof(unsigned char));
+
+        // increment counters
+        n0 += _q->enc_block_len;
+        n1 += block_size;
+    }
+
+    // sanity check
+    assert( n0 == _q->num_enc_bytes );
+    assert( n1 == _q->num_dec_bytes );
+}
+
+// decode soft bits, declaring the least reliable symbols of each block as
+// erasures; blocks which cannot be decoded this way are retried using hard
+// decisions alone
+void fec_rs_decode_soft(fec _q,
+                        unsigned int _dec_msg_len,
+                        unsigned char *_msg_enc,
+                        unsigned char *_msg_dec)
+{
+    // validate input
+    if (_dec_msg_len == 0) {
+        fprintf(stderr,"error: fec_rs_decode_soft(), input lenght must be > 0\n");
+        exit(1);
+    }
+
+    // re-allocate resources if necessary
+    fec_rs_setlength(_q, _dec_msg_len);
+
+    unsigned int max_erasures = _q->nroots / 2;
+    unsigned char reliability[max_erasures+1];
+
+    unsigned int i;
+    unsigned int j;
+    unsigned int k;
+    unsigned int n0=0;
+    unsigned int n1=0;
+    unsigned int block_size = _q->dec_block_len;
+    for (i=0; i<_q->num_blocks; i++) {
+
+        // the last block is smaller by the residual block length
+        if (i == _q->num_blocks-1)
+            block_size -= _q->res_block_len;
+
+        // pack hard decisions and find least reliable symbols, keeping
+        // erasure list sorted by increasing reliability
+        _q->erasures = 0;
+        for (j=0; j<_q->enc_block_len; j++) {
+            unsigned char * s = &_msg_enc[8*(n0+j)];
+            unsigned char sym = 0;
+            unsigned char rmin = 127;
+            for (k=0; k<8; k++) {
+                unsigned char r = s[k] > 127 ? s[k] - 128 : 127 - s[k];
+                rmin = r < rmin ? r : rmin;
+                sym = (sym << 1) | (s[k] >> 7);
+            }
+            _q->tblock[j] = sym;
+
+            if (rmin >= FEC_RS_ERASURE_THRESHOLD || max_erasures == 0)
+                continue;
+            if (_q->erasures == max_erasures && rmin >= reliability[max_erasures-1])
+                continue;
+            k = _q->erasures < max_erasures ? _q->erasures++ : max_erasures-1;
+            for ( ; k>0 && reliability[k-1] > rmin; k--) {
+                reliability[k]  = reliability[k-1];
+                _q->errlocs[k]  = _q->errlocs[k-1];
+            }
+            reliability[k] = rmin;
+            _q->errlocs[k] = j;
+        }
+
+        // decode block using erasures, falling back to errors only
+        memmove(_q->derrlocs, _q->errlocs, _q->erasures*sizeof(int));
+        if (fec_reedsolomon_decode(_q->rs, _q->tblock, _q->derrlocs, _q->erasures) < 0 &&
+            _q->erasures > 0)
+        {
+            fec_reedsolomon_decode(_q->rs, _q->tblock, _q->derrlocs, 0);
+        }
 
         // copy result
         memmove(&_msg_dec[n1], _q->tblock, block_size*sizeof(unsigned char));
@@ -214,9 +296,9 @@ void fec_rs_decode(fec _q,
 // Thus, the 1024-byte input message is broken into 5 blocks, the first
 // four have a length 205, and the last block has a length 204 (which is
 // externally padded to 205, e.g. res_block_len = 1). This code adds 32
-// parity symbols, so each block is extended to 237 bytes. libfec auto-
-// matically extends the internal data to 255 bytes by padding with 18
-// symbols.  Therefore, the final output length is 237 * 5 = 1185 symbols.
+// parity symbols, so each block is extended to 237 bytes. The codec treats
+// this as a shortened code, implicitly extending the internal data to 255
+// bytes by padding with 18 symbols.  Therefore, the final output length is 237 * 5 = 1185 symbols.
 void fec_rs_setlength(fec _q,
                       unsigned int _dec_msg_len)
 {
@@ -244,7 +326,7 @@ void fec_rs_setlength(fec _q,
     // mod(num_blocks*dec_block_len, num_dec_bytes)
     _q->res_block_len = (_q->num_blocks*_q->dec_block_len) % _q->num_dec_bytes;
 
-    // compute the internal libfec padding factor: kk - dec_block_len
+    // compute the internal padding factor: kk - dec_block_len
     _q->pad = _q->kk - _q->dec_block_len;
 
     // compute the final encoded block length: enc_block_len * num_blocks
@@ -262,15 +344,15 @@ void fec_rs_setlength(fec _q,
 
     // delete old decoder if necessary
     if (_q->rs != NULL)
-        free_rs_char(_q->rs);
+        fec_reedsolomon_destroy(_q->rs);
 
     // Reed-Solomon specific decoding
-    _q->rs = init_rs_char(_q->symsize,
-                          _q->genpoly,
-                          _q->fcs,
-                          _q->prim,
-                          _q->nroots,
-                          _q->pad);
+    _q->rs = fec_reedsolomon_create(_q->symsize,
+                                    _q->genpoly,
+                                    _q->fcs,
+                                    _q->prim,
+                                    _q->nroots,
+                                    _q->pad);
 }
 
 // 
@@ -285,32 +367,3 @@ void fec_rs_init_p8(fec _q)
     _q->prim = 1;
     _q->nroots = 32;
 }
-
-#else   // LIBFEC_ENABLED
-
-fec fec_rs_create(fec_scheme _fs)
-{
-    return NULL;
-}
-
-void fec_rs_destroy(fec _q)
-{
-}
-
-void fec_rs_encode(fec _q,
-                   unsigned int _dec_msg_len,
-                   unsigned char *_msg_dec,
-                   unsigned char *_msg_enc)
-{
-}
-
-//unsigned int
-void fec_rs_decode(fec _q,
-                   unsigned int _dec_msg_len,
-                   unsigned char *_msg_enc,
-                   unsigned char *_msg_dec)
-{
-}
-
-#endif  // LIBFEC_ENABLED
-
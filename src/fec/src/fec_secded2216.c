@@ -194,6 +194,34 @@ int fec_secded2216_estimate_ehat(unsigned char * _sym_enc,
     return 2;
 }
 
+// table-driven parity computation, equivalent to
+// fec_secded2216_compute_parity()
+static inline unsigned char secded2216_encode_lut(unsigned char * _m)
+{
+    return secded2216_enc_gentab[0][_m[0]] ^
+           secded2216_enc_gentab[1][_m[1]];
+}
+
+// table-driven symbol decoding, equivalent to
+// fec_secded2216_decode_symbol()
+static inline void secded2216_decode_lut(unsigned char * _v,
+                                         unsigned char * _m)
+{
+    // compute syndrome (6 bits) from parity of received message bytes
+    unsigned char s = (_v[0] & 0x3f) ^
+                      secded2216_enc_gentab[0][_v[1]] ^
+                      secded2216_enc_gentab[1][_v[2]];
+
+    _m[0] = _v[1];
+    _m[1] = _v[2];
+
+    // look up single-bit error location; errors in the parity
+    // byte do not affect the decoded message
+    unsigned int n = secded2216_err_gentab[s];
+    if (n > 0 && n <= 16)
+        _m[1 - (n-1)/8] ^= 1 << ((n-1) & 7);
+}
+
 // create SEC-DED (22,16) codec object
 fec fec_secded2216_create(void * _opts)
 {
@@ -236,11 +264,10 @@ void fec_secded2216_encode(fec _q,
 
     // for now simply encode as 2/3-rate codec (eat
     // 2 bits of parity)
-    // TODO : make more efficient
 
     for (i=0; i<_dec_msg_len-r; i+=2) {
         // compute parity (6 bits) on two input bytes (16 bits)
-        _msg_enc[j+0] = fec_secded2216_compute_parity(&_msg_dec[i]);
+        _msg_enc[j+0] = secded2216_encode_lut(&_msg_dec[i]);
 
         // copy remaining two input bytes (16 bits)
         _msg_enc[j+1] = _msg_dec[i+0];
@@ -296,7 +323,7 @@ void fec_secded2216_decode(fec _q,
 
     for (i=0; i<_dec_msg_len-r; i+=2) {
         // decode straight to output
-        fec_secded2216_decode_symbol(&_msg_enc[j], &_msg_dec[i]);
+        secded2216_decode_lut(&_msg_enc[j], &_msg_dec[i]);
 
         j += 3;
     }
@@ -311,7 +338,7 @@ void fec_secded2216_decode(fec _q,
         unsigned char m_hat[2];
 
         // decode symbol
-        fec_secded2216_decode_symbol(v, m_hat);
+        secded2216_decode_lut(v, m_hat);
 
         // copy just first byte to output
         _msg_dec[i] = m_hat[0];
@@ -210,6 +210,40 @@ int fec_secded3932_estimate_ehat(unsigned char * _sym_enc,
     return 2;
 }
 
+// table-driven parity computation, equivalent to
+// fec_secded3932_compute_parity()
+static inline unsigned char secded3932_encode_lut(unsigned char * _m)
+{
+    return secded3932_enc_gentab[0][_m[0]] ^
+           secded3932_enc_gentab[1][_m[1]] ^
+           secded3932_enc_gentab[2][_m[2]] ^
+           secded3932_enc_gentab[3][_m[3]];
+}
+
+// table-driven symbol decoding, equivalent to
+// fec_secded3932_decode_symbol()
+static inline void secded3932_decode_lut(unsigned char * _v,
+                                         unsigned char * _m)
+{
+    // compute syndrome (7 bits) from parity of received message bytes
+    unsigned char s = (_v[0] & 0x7f) ^
+                      secded3932_enc_gentab[0][_v[1]] ^
+                      secded3932_enc_gentab[1][_v[2]] ^
+                      secded3932_enc_gentab[2][_v[3]] ^
+                      secded3932_enc_gentab[3][_v[4]];
+
+    _m[0] = _v[1];
+    _m[1] = _v[2];
+    _m[2] = _v[3];
+    _m[3] = _v[4];
+
+    // look up single-bit error location; errors in the parity
+    // byte do not affect the decoded message
+    unsigned int n = secded3932_err_gentab[s];
+    if (n > 0 && n <= 32)
+        _m[3 - (n-1)/8] ^= 1 << ((n-1) & 7);
+}
+
 // create SEC-DED (39,32) codec object
 fec fec_secded3932_create(void * _opts)
 {
@@ -252,11 +286,10 @@ void fec_secded3932_encode(fec _q,
 
     // for now simply encode as 4/5-rate codec (eat
     // last parity bit)
-    // TODO : make more efficient
 
     for (i=0; i<_dec_msg_len-r; i+=4) {
         // compute parity (7 bits) on two input bytes (32 bits)
-        _msg_enc[j+0] = fec_secded3932_compute_parity(&_msg_dec[i]);
+        _msg_enc[j+0] = secded3932_encode_lut(&_msg_dec[i]);
 
         // copy remaining two input bytes (32 bits)
         _msg_enc[j+1] = _msg_dec[i+0];
@@ -318,7 +351,7 @@ void fec_secded3932_decode(fec _q,
 
     for (i=0; i<_dec_msg_len-r; i+=4) {
         // decode straight to output
-        fec_secded3932_decode_symbol(&_msg_enc[j], &_msg_dec[i]);
+        secded3932_decode_lut(&_msg_enc[j], &_msg_dec[i]);
 
         j += 5;
     }
@@ -335,7 +368,7 @@ void fec_secded3932_decode(fec _q,
         unsigned char m_hat[4];
 
         // decode symbol
-        fec_secded3932_decode_symbol(v, m_hat);
+        secded3932_decode_lut(v, m_hat);
 
         // copy non-zero bytes to output (ignore zeros artifically
         // inserted at receiver)
@@ -213,6 +213,52 @@ int fec_secded7264_estimate_ehat(unsigned char * _sym_enc,
     return 2;
 }
 
+// table-driven parity computation, equivalent to
+// fec_secded7264_compute_parity()
+static inline unsigned char secded7264_encode_lut(unsigned char * _m)
+{
+    return secded7264_enc_gentab[0][_m[0]] ^
+           secded7264_enc_gentab[1][_m[1]] ^
+           secded7264_enc_gentab[2][_m[2]] ^
+           secded7264_enc_gentab[3][_m[3]] ^
+           secded7264_enc_gentab[4][_m[4]] ^
+           secded7264_enc_gentab[5][_m[5]] ^
+           secded7264_enc_gentab[6][_m[6]] ^
+           secded7264_enc_gentab[7][_m[7]];
+}
+
+// table-driven symbol decoding, equivalent to
+// fec_secded7264_decode_symbol()
+static inline void secded7264_decode_lut(unsigned char * _v,
+                                         unsigned char * _m)
+{
+    // compute syndrome (8 bits) from parity of received message bytes
+    unsigned char s = _v[0] ^
+                      secded7264_enc_gentab[0][_v[1]] ^
+                      secded7264_enc_gentab[1][_v[2]] ^
+                      secded7264_enc_gentab[2][_v[3]] ^
+                      secded7264_enc_gentab[3][_v[4]] ^
+                      secded7264_enc_gentab[4][_v[5]] ^
+                      secded7264_enc_gentab[5][_v[6]] ^
+                      secded7264_enc_gentab[6][_v[7]] ^
+                      secded7264_enc_gentab[7][_v[8]];
+
+    _m[0] = _v[1];
+    _m[1] = _v[2];
+    _m[2] = _v[3];
+    _m[3] = _v[4];
+    _m[4] = _v[5];
+    _m[5] = _v[6];
+    _m[6] = _v[7];
+    _m[7] = _v[8];
+
+    // look up single-bit error location; errors in the parity
+    // byte do not affect the decoded message
+    unsigned int n = secded7264_err_gentab[s];
+    if (n > 0 && n <= 64)
+        _m[7 - (n-1)/8] ^= 1 << ((n-1) & 7);
+}
+
 // create SEC-DED (72,64) codec object
 fec fec_secded7264_create(void * _opts)
 {
@@ -254,10 +300,10 @@ void fec_secded7264_encode(fec _q,
     // determine remainder of input length / 8
     unsigned int r = _dec_msg_len % 8;
 
-    // TODO : devise more efficient way of doing this
     for (i=0; i<_dec_msg_len-r; i+=8) {
-        // encode directly to output
-        fec_secded7264_encode_symbol(&_msg_dec[i], &_msg_enc[j]);
+        // compute parity byte and copy eight input bytes to output
+        _msg_enc[j] = secded7264_encode_lut(&_msg_dec[i]);
+        memmove(&_msg_enc[j+1], &_msg_dec[i], 8);
 
         j += 9;
     }
@@ -270,7 +316,7 @@ void fec_secded7264_encode(fec _q,
             v[n] = _msg_dec[i+n];
 
         // compute parity
-        parity = fec_secded7264_compute_parity(v);
+        parity = secded7264_encode_lut(v);
         
         // there is no need to actually send all the bytes; the
         // last 8-r bytes are zeros and can be added at the
@@ -308,7 +354,7 @@ void fec_secded7264_decode(fec _q,
 
     for (i=0; i<_dec_msg_len-r; i+=8) {
         // decode nine input bytes
-        fec_secded7264_decode_symbol(&_msg_enc[j], &_msg_dec[i]);
+        secded7264_decode_lut(&_msg_enc[j], &_msg_dec[i]);
 
         j += 9;
     }
@@ -325,7 +371,7 @@ void fec_secded7264_decode(fec _q,
             v[n] = _msg_enc[j+n];
 
         // decode symbol
-        fec_secded7264_decode_symbol(v,c);
+        secded7264_decode_lut(v,c);
 
         // store only relevant bytes
         for (n=0; n<r; n++)
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// SEC-DED (22,16), (39,32) and (72,64) block code generated tables
+//
+
+// SEC-DED (22,16) parity contribution of each message byte
+unsigned char secded2216_enc_gentab[2][256] = {
+  {
+    0x00, 0x26, 0x1a, 0x3c, 0x19, 0x3f, 0x03, 0x25, 0x38, 0x1e, 0x22, 0x04, 0x21, 0x07, 0x3b, 0x1d, 
+    0x32, 0x14, 0x28, 0x0e, 0x2b, 0x0d, 0x31, 0x17, 0x0a, 0x2c, 0x10, 0x36, 0x13, 0x35, 0x09, 0x2f, 
+    0x1c, 0x3a, 0x06, 0x20, 0x05, 0x23, 0x1f, 0x39, 0x24, 0x02, 0x3e, 0x18, 0x3d, 0x1b, 0x27, 0x01, 
+    0x2e, 0x08, 0x34, 0x12, 0x37, 0x11, 0x2d, 0x0b, 0x16, 0x30, 0x0c, 0x2a, 0x0f, 0x29, 0x15, 0x33, 
+    0x0d, 0x2b, 0x17, 0x31, 0x14, 0x32, 0x0e, 0x28, 0x35, 0x13, 0x2f, 0x09, 0x2c, 0x0a, 0x36, 0x10, 
+    0x3f, 0x19, 0x25, 0x03, 0x26, 0x00, 0x3c, 0x1a, 0x07, 0x21, 0x1d, 0x3b, 0x1e, 0x38, 0x04, 0x22, 
+    0x11, 0x37, 0x0b, 0x2d, 0x08, 0x2e, 0x12, 0x34, 0x29, 0x0f, 0x33, 0x15, 0x30, 0x16, 0x2a, 0x0c, 
+    0x23, 0x05, 0x39, 0x1f, 0x3a, 0x1c, 0x20, 0x06, 0x1b, 0x3d, 0x01, 0x27, 0x02, 0x24, 0x18, 0x3e, 
+    0x2c, 0x0a, 0x36, 0x10, 0x35, 0x13, 0x2f, 0x09, 0x14, 0x32, 0x0e, 0x28, 0x0d, 0x2b, 0x17, 0x31, 
+    0x1e, 0x38, 0x04, 0x22, 0x07, 0x21, 0x1d, 0x3b, 0x26, 0x00, 0x3c, 0x1a, 0x3f, 0x19, 0x25, 0x03, 
+    0x30, 0x16, 0x2a, 0x0c, 0x29, 0x0f, 0x33, 0x15, 0x08, 0x2e, 0x12, 0x34, 0x11, 0x37, 0x0b, 0x2d, 
+    0x02, 0x24, 0x18, 0x3e, 0x1b, 0x3d, 0x01, 0x27, 0x3a, 0x1c, 0x20, 0x06, 0x23, 0x05, 0x39, 0x1f, 
+    0x21, 0x07, 0x3b, 0x1d, 0x38, 0x1e, 0x22, 0x04, 0x19, 0x3f, 0x03, 0x25, 0x00, 0x26, 0x1a, 0x3c, 
+    0x13, 0x35, 0x09, 0x2f, 0x0a, 0x2c, 0x10, 0x36, 0x2b, 0x0d, 0x31, 0x17, 0x32, 0x14, 0x28, 0x0e, 
+    0x3d, 0x1b, 0x27, 0x01, 0x24, 0x02, 0x3e, 0x18, 0x05, 0x23, 0x1f, 0x39, 0x1c, 0x3a, 0x06, 0x20, 
+    0x0f, 0x29, 0x15, 0x33, 0x16, 0x30, 0x0c, 0x2a, 0x37, 0x11, 0x2d, 0x0b, 0x2e, 0x08, 0x34, 0x12},
+  {
+    0x00, 0x07, 0x13, 0x14, 0x23, 0x24, 0x30, 0x37, 0x31, 0x36, 0x22, 0x25, 0x12, 0x15, 0x01, 0x06, 
+    0x25, 0x22, 0x36, 0x31, 0x06, 0x01, 0x15, 0x12, 0x14, 0x13, 0x07, 0x00, 0x37, 0x30, 0x24, 0x23, 
+    0x29, 0x2e, 0x3a, 0x3d, 0x0a, 0x0d, 0x19, 0x1e, 0x18, 0x1f, 0x0b, 0x0c, 0x3b, 0x3c, 0x28, 0x2f, 
+    0x0c, 0x0b, 0x1f, 0x18, 0x2f, 0x28, 0x3c, 0x3b, 0x3d, 0x3a, 0x2e, 0x29, 0x1e, 0x19, 0x0d, 0x0a, 
+    0x0e, 0x09, 0x1d, 0x1a, 0x2d, 0x2a, 0x3e, 0x39, 0x3f, 0x38, 0x2c, 0x2b, 0x1c, 0x1b, 0x0f, 0x08, 
+    0x2b, 0x2c, 0x38, 0x3f, 0x08, 0x0f, 0x1b, 0x1c, 0x1a, 0x1d, 0x09, 0x0e, 0x39, 0x3e, 0x2a, 0x2d, 
+    0x27, 0x20, 0x34, 0x33, 0x04, 0x03, 0x17, 0x10, 0x16, 0x11, 0x05, 0x02, 0x35, 0x32, 0x26, 0x21, 
+    0x02, 0x05, 0x11, 0x16, 0x21, 0x26, 0x32, 0x35, 0x33, 0x34, 0x20, 0x27, 0x10, 0x17, 0x03, 0x04, 
+    0x16, 0x11, 0x05, 0x02, 0x35, 0x32, 0x26, 0x21, 0x27, 0x20, 0x34, 0x33, 0x04, 0x03, 0x17, 0x10, 
+    0x33, 0x34, 0x20, 0x27, 0x10, 0x17, 0x03, 0x04, 0x02, 0x05, 0x11, 0x16, 0x21, 0x26, 0x32, 0x35, 
+    0x3f, 0x38, 0x2c, 0x2b, 0x1c, 0x1b, 0x0f, 0x08, 0x0e, 0x09, 0x1d, 0x1a, 0x2d, 0x2a, 0x3e, 0x39, 
+    0x1a, 0x1d, 0x09, 0x0e, 0x39, 0x3e, 0x2a, 0x2d, 0x2b, 0x2c, 0x38, 0x3f, 0x08, 0x0f, 0x1b, 0x1c, 
+    0x18, 0x1f, 0x0b, 0x0c, 0x3b, 0x3c, 0x28, 0x2f, 0x29, 0x2e, 0x3a, 0x3d, 0x0a, 0x0d, 0x19, 0x1e, 
+    0x3d, 0x3a, 0x2e, 0x29, 0x1e, 0x19, 0x0d, 0x0a, 0x0c, 0x0b, 0x1f, 0x18, 0x2f, 0x28, 0x3c, 0x3b, 
+    0x31, 0x36, 0x22, 0x25, 0x12, 0x15, 0x01, 0x06, 0x00, 0x07, 0x13, 0x14, 0x23, 0x24, 0x30, 0x37, 
+    0x14, 0x13, 0x07, 0x00, 0x37, 0x30, 0x24, 0x23, 0x25, 0x22, 0x36, 0x31, 0x06, 0x01, 0x15, 0x12}
+};
+
+// SEC-DED (22,16) syndrome-to-error table: 1 + index of the single bit
+// error with this syndrome, or 0 if there is none
+unsigned char secded2216_err_gentab[64] = {
+    0x00, 0x11, 0x12, 0x00, 0x13, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x00, 
+    0x15, 0x00, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0b, 0x0a, 0x00, 0x0e, 0x00, 0x00, 0x00, 
+    0x16, 0x00, 0x00, 0x03, 0x00, 0x05, 0x09, 0x00, 0x00, 0x06, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+    0x00, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// SEC-DED (39,32) parity contribution of each message byte
+unsigned char secded3932_enc_gentab[4][256] = {
+  {
+    0x00, 0x0b, 0x58, 0x53, 0x1c, 0x17, 0x44, 0x4f, 0x4c, 0x47, 0x14, 0x1f, 0x50, 0x5b, 0x08, 0x03, 
+    0x38, 0x33, 0x60, 0x6b, 0x24, 0x2f, 0x7c, 0x77, 0x74, 0x7f, 0x2c, 0x27, 0x68, 0x63, 0x30, 0x3b, 
+    0x0e, 0x05, 0x56, 0x5d, 0x12, 0x19, 0x4a, 0x41, 0x42, 0x49, 0x1a, 0x11, 0x5e, 0x55, 0x06, 0x0d, 
+    0x36, 0x3d, 0x6e, 0x65, 0x2a, 0x21, 0x72, 0x79, 0x7a, 0x71, 0x22, 0x29, 0x66, 0x6d, 0x3e, 0x35, 
+    0x0d, 0x06, 0x55, 0x5e, 0x11, 0x1a, 0x49, 0x42, 0x41, 0x4a, 0x19, 0x12, 0x5d, 0x56, 0x05, 0x0e, 
+    0x35, 0x3e, 0x6d, 0x66, 0x29, 0x22, 0x71, 0x7a, 0x79, 0x72, 0x21, 0x2a, 0x65, 0x6e, 0x3d, 0x36, 
+    0x03, 0x08, 0x5b, 0x50, 0x1f, 0x14, 0x47, 0x4c, 0x4f, 0x44, 0x17, 0x1c, 0x53, 0x58, 0x0b, 0x00, 
+    0x3b, 0x30, 0x63, 0x68, 0x27, 0x2c, 0x7f, 0x74, 0x77, 0x7c, 0x2f, 0x24, 0x6b, 0x60, 0x33, 0x38, 
+    0x49, 0x42, 0x11, 0x1a, 0x55, 0x5e, 0x0d, 0x06, 0x05, 0x0e, 0x5d, 0x56, 0x19, 0x12, 0x41, 0x4a, 
+    0x71, 0x7a, 0x29, 0x22, 0x6d, 0x66, 0x35, 0x3e, 0x3d, 0x36, 0x65, 0x6e, 0x21, 0x2a, 0x79, 0x72, 
+    0x47, 0x4c, 0x1f, 0x14, 0x5b, 0x50, 0x03, 0x08, 0x0b, 0x00, 0x53, 0x58, 0x17, 0x1c, 0x4f, 0x44, 
+    0x7f, 0x74, 0x27, 0x2c, 0x63, 0x68, 0x3b, 0x30, 0x33, 0x38, 0x6b, 0x60, 0x2f, 0x24, 0x77, 0x7c, 
+    0x44, 0x4f, 0x1c, 0x17, 0x58, 0x53, 0x00, 0x0b, 0x08, 0x03, 0x50, 0x5b, 0x14, 0x1f, 0x4c, 0x47, 
+    0x7c, 0x77, 0x24, 0x2f, 0x60, 0x6b, 0x38, 0x33, 0x30, 0x3b, 0x68, 0x63, 0x2c, 0x27, 0x74, 0x7f, 
+    0x4a, 0x41, 0x12, 0x19, 0x56, 0x5d, 0x0e, 0x05, 0x06, 0x0d, 0x5e, 0x55, 0x1a, 0x11, 0x42, 0x49, 
+    0x72, 0x79, 0x2a, 0x21, 0x6e, 0x65, 0x36, 0x3d, 0x3e, 0x35, 0x66, 0x6d, 0x22, 0x29, 0x7a, 0x71},
+  {
+    0x00, 0x2c, 0x64, 0x48, 0x26, 0x0a, 0x42, 0x6e, 0x25, 0x09, 0x41, 0x6d, 0x03, 0x2f, 0x67, 0x4b, 
+    0x34, 0x18, 0x50, 0x7c, 0x12, 0x3e, 0x76, 0x5a, 0x11, 0x3d, 0x75, 0x59, 0x37, 0x1b, 0x53, 0x7f, 
+    0x16, 0x3a, 0x72, 0x5e, 0x30, 0x1c, 0x54, 0x78, 0x33, 0x1f, 0x57, 0x7b, 0x15, 0x39, 0x71, 0x5d, 
+    0x22, 0x0e, 0x46, 0x6a, 0x04, 0x28, 0x60, 0x4c, 0x07, 0x2b, 0x63, 0x4f, 0x21, 0x0d, 0x45, 0x69, 
+    0x15, 0x39, 0x71, 0x5d, 0x33, 0x1f, 0x57, 0x7b, 0x30, 0x1c, 0x54, 0x78, 0x16, 0x3a, 0x72, 0x5e, 
+    0x21, 0x0d, 0x45, 0x69, 0x07, 0x2b, 0x63, 0x4f, 0x04, 0x28, 0x60, 0x4c, 0x22, 0x0e, 0x46, 0x6a, 
+    0x03, 0x2f, 0x67, 0x4b, 0x25, 0x09, 0x41, 0x6d, 0x26, 0x0a, 0x42, 0x6e, 0x00, 0x2c, 0x64, 0x48, 
+    0x37, 0x1b, 0x53, 0x7f, 0x11, 0x3d, 0x75, 0x59, 0x12, 0x3e, 0x76, 0x5a, 0x34, 0x18, 0x50, 0x7c, 
+    0x54, 0x78, 0x30, 0x1c, 0x72, 0x5e, 0x16, 0x3a, 0x71, 0x5d, 0x15, 0x39, 0x57, 0x7b, 0x33, 0x1f, 
+    0x60, 0x4c, 0x04, 0x28, 0x46, 0x6a, 0x22, 0x0e, 0x45, 0x69, 0x21, 0x0d, 0x63, 0x4f, 0x07, 0x2b, 
+    0x42, 0x6e, 0x26, 0x0a, 0x64, 0x48, 0x00, 0x2c, 0x67, 0x4b, 0x03, 0x2f, 0x41, 0x6d, 0x25, 0x09, 
+    0x76, 0x5a, 0x12, 0x3e, 0x50, 0x7c, 0x34, 0x18, 0x53, 0x7f, 0x37, 0x1b, 0x75, 0x59, 0x11, 0x3d, 
+    0x41, 0x6d, 0x25, 0x09, 0x67, 0x4b, 0x03, 0x2f, 0x64, 0x48, 0x00, 0x2c, 0x42, 0x6e, 0x26, 0x0a, 
+    0x75, 0x59, 0x11, 0x3d, 0x53, 0x7f, 0x37, 0x1b, 0x50, 0x7c, 0x34, 0x18, 0x76, 0x5a, 0x12, 0x3e, 
+    0x57, 0x7b, 0x33, 0x1f, 0x71, 0x5d, 0x15, 0x39, 0x72, 0x5e, 0x16, 0x3a, 0x54, 0x78, 0x30, 0x1c, 
+    0x63, 0x4f, 0x07, 0x2b, 0x45, 0x69, 0x21, 0x0d, 0x46, 0x6a, 0x22, 0x0e, 0x60, 0x4c, 0x04, 0x28},
+  {
+    0x00, 0x62, 0x52, 0x30, 0x4a, 0x28, 0x18, 0x7a, 0x46, 0x24, 0x14, 0x76, 0x0c, 0x6e, 0x5e, 0x3c, 
+    0x32, 0x50, 0x60, 0x02, 0x78, 0x1a, 0x2a, 0x48, 0x74, 0x16, 0x26, 0x44, 0x3e, 0x5c, 0x6c, 0x0e, 
+    0x2a, 0x48, 0x78, 0x1a, 0x60, 0x02, 0x32, 0x50, 0x6c, 0x0e, 0x3e, 0x5c, 0x26, 0x44, 0x74, 0x16, 
+    0x18, 0x7a, 0x4a, 0x28, 0x52, 0x30, 0x00, 0x62, 0x5e, 0x3c, 0x0c, 0x6e, 0x14, 0x76, 0x46, 0x24, 
+    0x23, 0x41, 0x71, 0x13, 0x69, 0x0b, 0x3b, 0x59, 0x65, 0x07, 0x37, 0x55, 0x2f, 0x4d, 0x7d, 0x1f, 
+    0x11, 0x73, 0x43, 0x21, 0x5b, 0x39, 0x09, 0x6b, 0x57, 0x35, 0x05, 0x67, 0x1d, 0x7f, 0x4f, 0x2d, 
+    0x09, 0x6b, 0x5b, 0x39, 0x43, 0x21, 0x11, 0x73, 0x4f, 0x2d, 0x1d, 0x7f, 0x05, 0x67, 0x57, 0x35, 
+    0x3b, 0x59, 0x69, 0x0b, 0x71, 0x13, 0x23, 0x41, 0x7d, 0x1f, 0x2f, 0x4d, 0x37, 0x55, 0x65, 0x07, 
+    0x1a, 0x78, 0x48, 0x2a, 0x50, 0x32, 0x02, 0x60, 0x5c, 0x3e, 0x0e, 0x6c, 0x16, 0x74, 0x44, 0x26, 
+    0x28, 0x4a, 0x7a, 0x18, 0x62, 0x00, 0x30, 0x52, 0x6e, 0x0c, 0x3c, 0x5e, 0x24, 0x46, 0x76, 0x14, 
+    0x30, 0x52, 0x62, 0x00, 0x7a, 0x18, 0x28, 0x4a, 0x76, 0x14, 0x24, 0x46, 0x3c, 0x5e, 0x6e, 0x0c, 
+    0x02, 0x60, 0x50, 0x32, 0x48, 0x2a, 0x1a, 0x78, 0x44, 0x26, 0x16, 0x74, 0x0e, 0x6c, 0x5c, 0x3e, 
+    0x39, 0x5b, 0x6b, 0x09, 0x73, 0x11, 0x21, 0x43, 0x7f, 0x1d, 0x2d, 0x4f, 0x35, 0x57, 0x67, 0x05, 
+    0x0b, 0x69, 0x59, 0x3b, 0x41, 0x23, 0x13, 0x71, 0x4d, 0x2f, 0x1f, 0x7d, 0x07, 0x65, 0x55, 0x37, 
+    0x13, 0x71, 0x41, 0x23, 0x59, 0x3b, 0x0b, 0x69, 0x55, 0x37, 0x07, 0x65, 0x1f, 0x7d, 0x4d, 0x2f, 
+    0x21, 0x43, 0x73, 0x11, 0x6b, 0x09, 0x39, 0x5b, 0x67, 0x05, 0x35, 0x57, 0x2d, 0x4f, 0x7f, 0x1d},
+  {
+    0x00, 0x61, 0x51, 0x30, 0x19, 0x78, 0x48, 0x29, 0x45, 0x24, 0x14, 0x75, 0x5c, 0x3d, 0x0d, 0x6c, 
+    0x43, 0x22, 0x12, 0x73, 0x5a, 0x3b, 0x0b, 0x6a, 0x06, 0x67, 0x57, 0x36, 0x1f, 0x7e, 0x4e, 0x2f, 
+    0x31, 0x50, 0x60, 0x01, 0x28, 0x49, 0x79, 0x18, 0x74, 0x15, 0x25, 0x44, 0x6d, 0x0c, 0x3c, 0x5d, 
+    0x72, 0x13, 0x23, 0x42, 0x6b, 0x0a, 0x3a, 0x5b, 0x37, 0x56, 0x66, 0x07, 0x2e, 0x4f, 0x7f, 0x1e, 
+    0x29, 0x48, 0x78, 0x19, 0x30, 0x51, 0x61, 0x00, 0x6c, 0x0d, 0x3d, 0x5c, 0x75, 0x14, 0x24, 0x45, 
+    0x6a, 0x0b, 0x3b, 0x5a, 0x73, 0x12, 0x22, 0x43, 0x2f, 0x4e, 0x7e, 0x1f, 0x36, 0x57, 0x67, 0x06, 
+    0x18, 0x79, 0x49, 0x28, 0x01, 0x60, 0x50, 0x31, 0x5d, 0x3c, 0x0c, 0x6d, 0x44, 0x25, 0x15, 0x74, 
+    0x5b, 0x3a, 0x0a, 0x6b, 0x42, 0x23, 0x13, 0x72, 0x1e, 0x7f, 0x4f, 0x2e, 0x07, 0x66, 0x56, 0x37, 
+    0x13, 0x72, 0x42, 0x23, 0x0a, 0x6b, 0x5b, 0x3a, 0x56, 0x37, 0x07, 0x66, 0x4f, 0x2e, 0x1e, 0x7f, 
+    0x50, 0x31, 0x01, 0x60, 0x49, 0x28, 0x18, 0x79, 0x15, 0x74, 0x44, 0x25, 0x0c, 0x6d, 0x5d, 0x3c, 
+    0x22, 0x43, 0x73, 0x12, 0x3b, 0x5a, 0x6a, 0x0b, 0x67, 0x06, 0x36, 0x57, 0x7e, 0x1f, 0x2f, 0x4e, 
+    0x61, 0x00, 0x30, 0x51, 0x78, 0x19, 0x29, 0x48, 0x24, 0x45, 0x75, 0x14, 0x3d, 0x5c, 0x6c, 0x0d, 
+    0x3a, 0x5b, 0x6b, 0x0a, 0x23, 0x42, 0x72, 0x13, 0x7f, 0x1e, 0x2e, 0x4f, 0x66, 0x07, 0x37, 0x56, 
+    0x79, 0x18, 0x28, 0x49, 0x60, 0x01, 0x31, 0x50, 0x3c, 0x5d, 0x6d, 0x0c, 0x25, 0x44, 0x74, 0x15, 
+    0x0b, 0x6a, 0x5a, 0x3b, 0x12, 0x73, 0x43, 0x22, 0x4e, 0x2f, 0x1f, 0x7e, 0x57, 0x36, 0x06, 0x67, 
+    0x48, 0x29, 0x19, 0x78, 0x51, 0x30, 0x00, 0x61, 0x0d, 0x6c, 0x5c, 0x3d, 0x14, 0x75, 0x45, 0x24}
+};
+
+// SEC-DED (39,32) syndrome-to-error table
+unsigned char secded3932_err_gentab[128] = {
+    0x00, 0x21, 0x22, 0x00, 0x23, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x19, 0x00, 0x1f, 0x1e, 0x00, 
+    0x25, 0x00, 0x00, 0x08, 0x00, 0x17, 0x16, 0x00, 0x00, 0x03, 0x10, 0x00, 0x1b, 0x00, 0x00, 0x00, 
+    0x26, 0x00, 0x00, 0x0f, 0x00, 0x14, 0x13, 0x00, 0x00, 0x07, 0x0e, 0x00, 0x11, 0x00, 0x00, 0x00, 
+    0x00, 0x06, 0x0d, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x27, 0x00, 0x00, 0x05, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x20, 0x0b, 0x00, 0x1c, 0x00, 0x00, 0x00, 
+    0x00, 0x02, 0x0a, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x01, 0x09, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// SEC-DED (72,64) parity contribution of each message byte
+unsigned char secded7264_enc_gentab[8][256] = {
+  {
+    0x00, 0x91, 0x92, 0x03, 0x94, 0x05, 0x06, 0x97, 0x98, 0x09, 0x0a, 0x9b, 0x0c, 0x9d, 0x9e, 0x0f, 
+    0xe0, 0x71, 0x72, 0xe3, 0x74, 0xe5, 0xe6, 0x77, 0x78, 0xe9, 0xea, 0x7b, 0xec, 0x7d, 0x7e, 0xef, 
+    0xec, 0x7d, 0x7e, 0xef, 0x78, 0xe9, 0xea, 0x7b, 0x74, 0xe5, 0xe6, 0x77, 0xe0, 0x71, 0x72, 0xe3, 
+    0x0c, 0x9d, 0x9e, 0x0f, 0x98, 0x09, 0x0a, 0x9b, 0x94, 0x05, 0x06, 0x97, 0x00, 0x91, 0x92, 0x03, 
+    0xdc, 0x4d, 0x4e, 0xdf, 0x48, 0xd9, 0xda, 0x4b, 0x44, 0xd5, 0xd6, 0x47, 0xd0, 0x41, 0x42, 0xd3, 
+    0x3c, 0xad, 0xae, 0x3f, 0xa8, 0x39, 0x3a, 0xab, 0xa4, 0x35, 0x36, 0xa7, 0x30, 0xa1, 0xa2, 0x33, 
+    0x30, 0xa1, 0xa2, 0x33, 0xa4, 0x35, 0x36, 0xa7, 0xa8, 0x39, 0x3a, 0xab, 0x3c, 0xad, 0xae, 0x3f, 
+    0xd0, 0x41, 0x42, 0xd3, 0x44, 0xd5, 0xd6, 0x47, 0x48, 0xd9, 0xda, 0x4b, 0xdc, 0x4d, 0x4e, 0xdf, 
+    0xd0, 0x41, 0x42, 0xd3, 0x44, 0xd5, 0xd6, 0x47, 0x48, 0xd9, 0xda, 0x4b, 0xdc, 0x4d, 0x4e, 0xdf, 
+    0x30, 0xa1, 0xa2, 0x33, 0xa4, 0x35, 0x36, 0xa7, 0xa8, 0x39, 0x3a, 0xab, 0x3c, 0xad, 0xae, 0x3f, 
+    0x3c, 0xad, 0xae, 0x3f, 0xa8, 0x39, 0x3a, 0xab, 0xa4, 0x35, 0x36, 0xa7, 0x30, 0xa1, 0xa2, 0x33, 
+    0xdc, 0x4d, 0x4e, 0xdf, 0x48, 0xd9, 0xda, 0x4b, 0x44, 0xd5, 0xd6, 0x47, 0xd0, 0x41, 0x42, 0xd3, 
+    0x0c, 0x9d, 0x9e, 0x0f, 0x98, 0x09, 0x0a, 0x9b, 0x94, 0x05, 0x06, 0x97, 0x00, 0x91, 0x92, 0x03, 
+    0xec, 0x7d, 0x7e, 0xef, 0x78, 0xe9, 0xea, 0x7b, 0x74, 0xe5, 0xe6, 0x77, 0xe0, 0x71, 0x72, 0xe3, 
+    0xe0, 0x71, 0x72, 0xe3, 0x74, 0xe5, 0xe6, 0x77, 0x78, 0xe9, 0xea, 0x7b, 0xec, 0x7d, 0x7e, 0xef, 
+    0x00, 0x91, 0x92, 0x03, 0x94, 0x05, 0x06, 0x97, 0x98, 0x09, 0x0a, 0x9b, 0x0c, 0x9d, 0x9e, 0x0f},
+  {
+    0x00, 0xc1, 0xc2, 0x03, 0xc4, 0x05, 0x06, 0xc7, 0xc8, 0x09, 0x0a, 0xcb, 0x0c, 0xcd, 0xce, 0x0f, 
+    0x61, 0xa0, 0xa3, 0x62, 0xa5, 0x64, 0x67, 0xa6, 0xa9, 0x68, 0x6b, 0xaa, 0x6d, 0xac, 0xaf, 0x6e, 
+    0x62, 0xa3, 0xa0, 0x61, 0xa6, 0x67, 0x64, 0xa5, 0xaa, 0x6b, 0x68, 0xa9, 0x6e, 0xaf, 0xac, 0x6d, 
+    0x03, 0xc2, 0xc1, 0x00, 0xc7, 0x06, 0x05, 0xc4, 0xcb, 0x0a, 0x09, 0xc8, 0x0f, 0xce, 0xcd, 0x0c, 
+    0x64, 0xa5, 0xa6, 0x67, 0xa0, 0x61, 0x62, 0xa3, 0xac, 0x6d, 0x6e, 0xaf, 0x68, 0xa9, 0xaa, 0x6b, 
+    0x05, 0xc4, 0xc7, 0x06, 0xc1, 0x00, 0x03, 0xc2, 0xcd, 0x0c, 0x0f, 0xce, 0x09, 0xc8, 0xcb, 0x0a, 
+    0x06, 0xc7, 0xc4, 0x05, 0xc2, 0x03, 0x00, 0xc1, 0xce, 0x0f, 0x0c, 0xcd, 0x0a, 0xcb, 0xc8, 0x09, 
+    0x67, 0xa6, 0xa5, 0x64, 0xa3, 0x62, 0x61, 0xa0, 0xaf, 0x6e, 0x6d, 0xac, 0x6b, 0xaa, 0xa9, 0x68, 
+    0x68, 0xa9, 0xaa, 0x6b, 0xac, 0x6d, 0x6e, 0xaf, 0xa0, 0x61, 0x62, 0xa3, 0x64, 0xa5, 0xa6, 0x67, 
+    0x09, 0xc8, 0xcb, 0x0a, 0xcd, 0x0c, 0x0f, 0xce, 0xc1, 0x00, 0x03, 0xc2, 0x05, 0xc4, 0xc7, 0x06, 
+    0x0a, 0xcb, 0xc8, 0x09, 0xce, 0x0f, 0x0c, 0xcd, 0xc2, 0x03, 0x00, 0xc1, 0x06, 0xc7, 0xc4, 0x05, 
+    0x6b, 0xaa, 0xa9, 0x68, 0xaf, 0x6e, 0x6d, 0xac, 0xa3, 0x62, 0x61, 0xa0, 0x67, 0xa6, 0xa5, 0x64, 
+    0x0c, 0xcd, 0xce, 0x0f, 0xc8, 0x09, 0x0a, 0xcb, 0xc4, 0x05, 0x06, 0xc7, 0x00, 0xc1, 0xc2, 0x03, 
+    0x6d, 0xac, 0xaf, 0x6e, 0xa9, 0x68, 0x6b, 0xaa, 0xa5, 0x64, 0x67, 0xa6, 0x61, 0xa0, 0xa3, 0x62, 
+    0x6e, 0xaf, 0xac, 0x6d, 0xaa, 0x6b, 0x68, 0xa9, 0xa6, 0x67, 0x64, 0xa5, 0x62, 0xa3, 0xa0, 0x61, 
+    0x0f, 0xce, 0xcd, 0x0c, 0xcb, 0x0a, 0x09, 0xc8, 0xc7, 0x06, 0x05, 0xc4, 0x03, 0xc2, 0xc1, 0x00},
+  {
+    0x00, 0xa1, 0xa2, 0x03, 0xa4, 0x05, 0x06, 0xa7, 0xa8, 0x09, 0x0a, 0xab, 0x0c, 0xad, 0xae, 0x0f, 
+    0x31, 0x90, 0x93, 0x32, 0x95, 0x34, 0x37, 0x96, 0x99, 0x38, 0x3b, 0x9a, 0x3d, 0x9c, 0x9f, 0x3e, 
+    0x32, 0x93, 0x90, 0x31, 0x96, 0x37, 0x34, 0x95, 0x9a, 0x3b, 0x38, 0x99, 0x3e, 0x9f, 0x9c, 0x3d, 
+    0x03, 0xa2, 0xa1, 0x00, 0xa7, 0x06, 0x05, 0xa4, 0xab, 0x0a, 0x09, 0xa8, 0x0f, 0xae, 0xad, 0x0c, 
+    0x34, 0x95, 0x96, 0x37, 0x90, 0x31, 0x32, 0x93, 0x9c, 0x3d, 0x3e, 0x9f, 0x38, 0x99, 0x9a, 0x3b, 
+    0x05, 0xa4, 0xa7, 0x06, 0xa1, 0x00, 0x03, 0xa2, 0xad, 0x0c, 0x0f, 0xae, 0x09, 0xa8, 0xab, 0x0a, 
+    0x06, 0xa7, 0xa4, 0x05, 0xa2, 0x03, 0x00, 0xa1, 0xae, 0x0f, 0x0c, 0xad, 0x0a, 0xab, 0xa8, 0x09, 
+    0x37, 0x96, 0x95, 0x34, 0x93, 0x32, 0x31, 0x90, 0x9f, 0x3e, 0x3d, 0x9c, 0x3b, 0x9a, 0x99, 0x38, 
+    0x38, 0x99, 0x9a, 0x3b, 0x9c, 0x3d, 0x3e, 0x9f, 0x90, 0x31, 0x32, 0x93, 0x34, 0x95, 0x96, 0x37, 
+    0x09, 0xa8, 0xab, 0x0a, 0xad, 0x0c, 0x0f, 0xae, 0xa1, 0x00, 0x03, 0xa2, 0x05, 0xa4, 0xa7, 0x06, 
+    0x0a, 0xab, 0xa8, 0x09, 0xae, 0x0f, 0x0c, 0xad, 0xa2, 0x03, 0x00, 0xa1, 0x06, 0xa7, 0xa4, 0x05, 
+    0x3b, 0x9a, 0x99, 0x38, 0x9f, 0x3e, 0x3d, 0x9c, 0x93, 0x32, 0x31, 0x90, 0x37, 0x96, 0x95, 0x34, 
+    0x0c, 0xad, 0xae, 0x0f, 0xa8, 0x09, 0x0a, 0xab, 0xa4, 0x05, 0x06, 0xa7, 0x00, 0xa1, 0xa2, 0x03, 
+    0x3d, 0x9c, 0x9f, 0x3e, 0x99, 0x38, 0x3b, 0x9a, 0x95, 0x34, 0x37, 0x96, 0x31, 0x90, 0x93, 0x32, 
+    0x3e, 0x9f, 0x9c, 0x3d, 0x9a, 0x3b, 0x38, 0x99, 0x96, 0x37, 0x34, 0x95, 0x32, 0x93, 0x90, 0x31, 
+    0x0f, 0xae, 0xad, 0x0c, 0xab, 0x0a, 0x09, 0xa8, 0xa7, 0x06, 0x05, 0xa4, 0x03, 0xa2, 0xa1, 0x00},
+  {
+    0x00, 0x70, 0x73, 0x03, 0xb3, 0xc3, 0xc0, 0xb0, 0xb0, 0xc0, 0xc3, 0xb3, 0x03, 0x73, 0x70, 0x00, 
+    0x51, 0x21, 0x22, 0x52, 0xe2, 0x92, 0x91, 0xe1, 0xe1, 0x91, 0x92, 0xe2, 0x52, 0x22, 0x21, 0x51, 
+    0x52, 0x22, 0x21, 0x51, 0xe1, 0x91, 0x92, 0xe2, 0xe2, 0x92, 0x91, 0xe1, 0x51, 0x21, 0x22, 0x52, 
+    0x03, 0x73, 0x70, 0x00, 0xb0, 0xc0, 0xc3, 0xb3, 0xb3, 0xc3, 0xc0, 0xb0, 0x00, 0x70, 0x73, 0x03, 
+    0x54, 0x24, 0x27, 0x57, 0xe7, 0x97, 0x94, 0xe4, 0xe4, 0x94, 0x97, 0xe7, 0x57, 0x27, 0x24, 0x54, 
+    0x05, 0x75, 0x76, 0x06, 0xb6, 0xc6, 0xc5, 0xb5, 0xb5, 0xc5, 0xc6, 0xb6, 0x06, 0x76, 0x75, 0x05, 
+    0x06, 0x76, 0x75, 0x05, 0xb5, 0xc5, 0xc6, 0xb6, 0xb6, 0xc6, 0xc5, 0xb5, 0x05, 0x75, 0x76, 0x06, 
+    0x57, 0x27, 0x24, 0x54, 0xe4, 0x94, 0x97, 0xe7, 0xe7, 0x97, 0x94, 0xe4, 0x54, 0x24, 0x27, 0x57, 
+    0x58, 0x28, 0x2b, 0x5b, 0xeb, 0x9b, 0x98, 0xe8, 0xe8, 0x98, 0x9b, 0xeb, 0x5b, 0x2b, 0x28, 0x58, 
+    0x09, 0x79, 0x7a, 0x0a, 0xba, 0xca, 0xc9, 0xb9, 0xb9, 0xc9, 0xca, 0xba, 0x0a, 0x7a, 0x79, 0x09, 
+    0x0a, 0x7a, 0x79, 0x09, 0xb9, 0xc9, 0xca, 0xba, 0xba, 0xca, 0xc9, 0xb9, 0x09, 0x79, 0x7a, 0x0a, 
+    0x5b, 0x2b, 0x28, 0x58, 0xe8, 0x98, 0x9b, 0xeb, 0xeb, 0x9b, 0x98, 0xe8, 0x58, 0x28, 0x2b, 0x5b, 
+    0x0c, 0x7c, 0x7f, 0x0f, 0xbf, 0xcf, 0xcc, 0xbc, 0xbc, 0xcc, 0xcf, 0xbf, 0x0f, 0x7f, 0x7c, 0x0c, 
+    0x5d, 0x2d, 0x2e, 0x5e, 0xee, 0x9e, 0x9d, 0xed, 0xed, 0x9d, 0x9e, 0xee, 0x5e, 0x2e, 0x2d, 0x5d, 
+    0x5e, 0x2e, 0x2d, 0x5d, 0xed, 0x9d, 0x9e, 0xee, 0xee, 0x9e, 0x9d, 0xed, 0x5d, 0x2d, 0x2e, 0x5e, 
+    0x0f, 0x7f, 0x7c, 0x0c, 0xbc, 0xcc, 0xcf, 0xbf, 0xbf, 0xcf, 0xcc, 0xbc, 0x0c, 0x7c, 0x7f, 0x0f},
+  {
+    0x00, 0x1a, 0x2a, 0x30, 0x4a, 0x50, 0x60, 0x7a, 0x8a, 0x90, 0xa0, 0xba, 0xc0, 0xda, 0xea, 0xf0, 
+    0x0d, 0x17, 0x27, 0x3d, 0x47, 0x5d, 0x6d, 0x77, 0x87, 0x9d, 0xad, 0xb7, 0xcd, 0xd7, 0xe7, 0xfd, 
+    0xcd, 0xd7, 0xe7, 0xfd, 0x87, 0x9d, 0xad, 0xb7, 0x47, 0x5d, 0x6d, 0x77, 0x0d, 0x17, 0x27, 0x3d, 
+    0xc0, 0xda, 0xea, 0xf0, 0x8a, 0x90, 0xa0, 0xba, 0x4a, 0x50, 0x60, 0x7a, 0x00, 0x1a, 0x2a, 0x30, 
+    0xce, 0xd4, 0xe4, 0xfe, 0x84, 0x9e, 0xae, 0xb4, 0x44, 0x5e, 0x6e, 0x74, 0x0e, 0x14, 0x24, 0x3e, 
+    0xc3, 0xd9, 0xe9, 0xf3, 0x89, 0x93, 0xa3, 0xb9, 0x49, 0x53, 0x63, 0x79, 0x03, 0x19, 0x29, 0x33, 
+    0x03, 0x19, 0x29, 0x33, 0x49, 0x53, 0x63, 0x79, 0x89, 0x93, 0xa3, 0xb9, 0xc3, 0xd9, 0xe9, 0xf3, 
+    0x0e, 0x14, 0x24, 0x3e, 0x44, 0x5e, 0x6e, 0x74, 0x84, 0x9e, 0xae, 0xb4, 0xce, 0xd4, 0xe4, 0xfe, 
+    0x0e, 0x14, 0x24, 0x3e, 0x44, 0x5e, 0x6e, 0x74, 0x84, 0x9e, 0xae, 0xb4, 0xce, 0xd4, 0xe4, 0xfe, 
+    0x03, 0x19, 0x29, 0x33, 0x49, 0x53, 0x63, 0x79, 0x89, 0x93, 0xa3, 0xb9, 0xc3, 0xd9, 0xe9, 0xf3, 
+    0xc3, 0xd9, 0xe9, 0xf3, 0x89, 0x93, 0xa3, 0xb9, 0x49, 0x53, 0x63, 0x79, 0x03, 0x19, 0x29, 0x33, 
+    0xce, 0xd4, 0xe4, 0xfe, 0x84, 0x9e, 0xae, 0xb4, 0x44, 0x5e, 0x6e, 0x74, 0x0e, 0x14, 0x24, 0x3e, 
+    0xc0, 0xda, 0xea, 0xf0, 0x8a, 0x90, 0xa0, 0xba, 0x4a, 0x50, 0x60, 0x7a, 0x00, 0x1a, 0x2a, 0x30, 
+    0xcd, 0xd7, 0xe7, 0xfd, 0x87, 0x9d, 0xad, 0xb7, 0x47, 0x5d, 0x6d, 0x77, 0x0d, 0x17, 0x27, 0x3d, 
+    0x0d, 0x17, 0x27, 0x3d, 0x47, 0x5d, 0x6d, 0x77, 0x87, 0x9d, 0xad, 0xb7, 0xcd, 0xd7, 0xe7, 0xfd, 
+    0x00, 0x1a, 0x2a, 0x30, 0x4a, 0x50, 0x60, 0x7a, 0x8a, 0x90, 0xa0, 0xba, 0xc0, 0xda, 0xea, 0xf0},
+  {
+    0x00, 0x1c, 0x2c, 0x30, 0x4c, 0x50, 0x60, 0x7c, 0x8c, 0x90, 0xa0, 0xbc, 0xc0, 0xdc, 0xec, 0xf0, 
+    0x15, 0x09, 0x39, 0x25, 0x59, 0x45, 0x75, 0x69, 0x99, 0x85, 0xb5, 0xa9, 0xd5, 0xc9, 0xf9, 0xe5, 
+    0x25, 0x39, 0x09, 0x15, 0x69, 0x75, 0x45, 0x59, 0xa9, 0xb5, 0x85, 0x99, 0xe5, 0xf9, 0xc9, 0xd5, 
+    0x30, 0x2c, 0x1c, 0x00, 0x7c, 0x60, 0x50, 0x4c, 0xbc, 0xa0, 0x90, 0x8c, 0xf0, 0xec, 0xdc, 0xc0, 
+    0x45, 0x59, 0x69, 0x75, 0x09, 0x15, 0x25, 0x39, 0xc9, 0xd5, 0xe5, 0xf9, 0x85, 0x99, 0xa9, 0xb5, 
+    0x50, 0x4c, 0x7c, 0x60, 0x1c, 0x00, 0x30, 0x2c, 0xdc, 0xc0, 0xf0, 0xec, 0x90, 0x8c, 0xbc, 0xa0, 
+    0x60, 0x7c, 0x4c, 0x50, 0x2c, 0x30, 0x00, 0x1c, 0xec, 0xf0, 0xc0, 0xdc, 0xa0, 0xbc, 0x8c, 0x90, 
+    0x75, 0x69, 0x59, 0x45, 0x39, 0x25, 0x15, 0x09, 0xf9, 0xe5, 0xd5, 0xc9, 0xb5, 0xa9, 0x99, 0x85, 
+    0x85, 0x99, 0xa9, 0xb5, 0xc9, 0xd5, 0xe5, 0xf9, 0x09, 0x15, 0x25, 0x39, 0x45, 0x59, 0x69, 0x75, 
+    0x90, 0x8c, 0xbc, 0xa0, 0xdc, 0xc0, 0xf0, 0xec, 0x1c, 0x00, 0x30, 0x2c, 0x50, 0x4c, 0x7c, 0x60, 
+    0xa0, 0xbc, 0x8c, 0x90, 0xec, 0xf0, 0xc0, 0xdc, 0x2c, 0x30, 0x00, 0x1c, 0x60, 0x7c, 0x4c, 0x50, 
+    0xb5, 0xa9, 0x99, 0x85, 0xf9, 0xe5, 0xd5, 0xc9, 0x39, 0x25, 0x15, 0x09, 0x75, 0x69, 0x59, 0x45, 
+    0xc0, 0xdc, 0xec, 0xf0, 0x8c, 0x90, 0xa0, 0xbc, 0x4c, 0x50, 0x60, 0x7c, 0x00, 0x1c, 0x2c, 0x30, 
+    0xd5, 0xc9, 0xf9, 0xe5, 0x99, 0x85, 0xb5, 0xa9, 0x59, 0x45, 0x75, 0x69, 0x15, 0x09, 0x39, 0x25, 
+    0xe5, 0xf9, 0xc9, 0xd5, 0xa9, 0xb5, 0x85, 0x99, 0x69, 0x75, 0x45, 0x59, 0x25, 0x39, 0x09, 0x15, 
+    0xf0, 0xec, 0xdc, 0xc0, 0xbc, 0xa0, 0x90, 0x8c, 0x7c, 0x60, 0x50, 0x4c, 0x30, 0x2c, 0x1c, 0x00},
+  {
+    0x00, 0x16, 0x26, 0x30, 0x46, 0x50, 0x60, 0x76, 0x86, 0x90, 0xa0, 0xb6, 0xc0, 0xd6, 0xe6, 0xf0, 
+    0x13, 0x05, 0x35, 0x23, 0x55, 0x43, 0x73, 0x65, 0x95, 0x83, 0xb3, 0xa5, 0xd3, 0xc5, 0xf5, 0xe3, 
+    0x23, 0x35, 0x05, 0x13, 0x65, 0x73, 0x43, 0x55, 0xa5, 0xb3, 0x83, 0x95, 0xe3, 0xf5, 0xc5, 0xd3, 
+    0x30, 0x26, 0x16, 0x00, 0x76, 0x60, 0x50, 0x46, 0xb6, 0xa0, 0x90, 0x86, 0xf0, 0xe6, 0xd6, 0xc0, 
+    0x43, 0x55, 0x65, 0x73, 0x05, 0x13, 0x23, 0x35, 0xc5, 0xd3, 0xe3, 0xf5, 0x83, 0x95, 0xa5, 0xb3, 
+    0x50, 0x46, 0x76, 0x60, 0x16, 0x00, 0x30, 0x26, 0xd6, 0xc0, 0xf0, 0xe6, 0x90, 0x86, 0xb6, 0xa0, 
+    0x60, 0x76, 0x46, 0x50, 0x26, 0x30, 0x00, 0x16, 0xe6, 0xf0, 0xc0, 0xd6, 0xa0, 0xb6, 0x86, 0x90, 
+    0x73, 0x65, 0x55, 0x43, 0x35, 0x23, 0x13, 0x05, 0xf5, 0xe3, 0xd3, 0xc5, 0xb3, 0xa5, 0x95, 0x83, 
+    0x83, 0x95, 0xa5, 0xb3, 0xc5, 0xd3, 0xe3, 0xf5, 0x05, 0x13, 0x23, 0x35, 0x43, 0x55, 0x65, 0x73, 
+    0x90, 0x86, 0xb6, 0xa0, 0xd6, 0xc0, 0xf0, 0xe6, 0x16, 0x00, 0x30, 0x26, 0x50, 0x46, 0x76, 0x60, 
+    0xa0, 0xb6, 0x86, 0x90, 0xe6, 0xf0, 0xc0, 0xd6, 0x26, 0x30, 0x00, 0x16, 0x60, 0x76, 0x46, 0x50, 
+    0xb3, 0xa5, 0x95, 0x83, 0xf5, 0xe3, 0xd3, 0xc5, 0x35, 0x23, 0x13, 0x05, 0x73, 0x65, 0x55, 0x43, 
+    0xc0, 0xd6, 0xe6, 0xf0, 0x86, 0x90, 0xa0, 0xb6, 0x46, 0x50, 0x60, 0x76, 0x00, 0x16, 0x26, 0x30, 
+    0xd3, 0xc5, 0xf5, 0xe3, 0x95, 0x83, 0xb3, 0xa5, 0x55, 0x43, 0x73, 0x65, 0x13, 0x05, 0x35, 0x23, 
+    0xe3, 0xf5, 0xc5, 0xd3, 0xa5, 0xb3, 0x83, 0x95, 0x65, 0x73, 0x43, 0x55, 0x23, 0x35, 0x05, 0x13, 
+    0xf0, 0xe6, 0xd6, 0xc0, 0xb6, 0xa0, 0x90, 0x86, 0x76, 0x60, 0x50, 0x46, 0x30, 0x26, 0x16, 0x00},
+  {
+    0x00, 0x0b, 0x3b, 0x30, 0x37, 0x3c, 0x0c, 0x07, 0x07, 0x0c, 0x3c, 0x37, 0x30, 0x3b, 0x0b, 0x00, 
+    0x19, 0x12, 0x22, 0x29, 0x2e, 0x25, 0x15, 0x1e, 0x1e, 0x15, 0x25, 0x2e, 0x29, 0x22, 0x12, 0x19, 
+    0x29, 0x22, 0x12, 0x19, 0x1e, 0x15, 0x25, 0x2e, 0x2e, 0x25, 0x15, 0x1e, 0x19, 0x12, 0x22, 0x29, 
+    0x30, 0x3b, 0x0b, 0x00, 0x07, 0x0c, 0x3c, 0x37, 0x37, 0x3c, 0x0c, 0x07, 0x00, 0x0b, 0x3b, 0x30, 
+    0x49, 0x42, 0x72, 0x79, 0x7e, 0x75, 0x45, 0x4e, 0x4e, 0x45, 0x75, 0x7e, 0x79, 0x72, 0x42, 0x49, 
+    0x50, 0x5b, 0x6b, 0x60, 0x67, 0x6c, 0x5c, 0x57, 0x57, 0x5c, 0x6c, 0x67, 0x60, 0x6b, 0x5b, 0x50, 
+    0x60, 0x6b, 0x5b, 0x50, 0x57, 0x5c, 0x6c, 0x67, 0x67, 0x6c, 0x5c, 0x57, 0x50, 0x5b, 0x6b, 0x60, 
+    0x79, 0x72, 0x42, 0x49, 0x4e, 0x45, 0x75, 0x7e, 0x7e, 0x75, 0x45, 0x4e, 0x49, 0x42, 0x72, 0x79, 
+    0x89, 0x82, 0xb2, 0xb9, 0xbe, 0xb5, 0x85, 0x8e, 0x8e, 0x85, 0xb5, 0xbe, 0xb9, 0xb2, 0x82, 0x89, 
+    0x90, 0x9b, 0xab, 0xa0, 0xa7, 0xac, 0x9c, 0x97, 0x97, 0x9c, 0xac, 0xa7, 0xa0, 0xab, 0x9b, 0x90, 
+    0xa0, 0xab, 0x9b, 0x90, 0x97, 0x9c, 0xac, 0xa7, 0xa7, 0xac, 0x9c, 0x97, 0x90, 0x9b, 0xab, 0xa0, 
+    0xb9, 0xb2, 0x82, 0x89, 0x8e, 0x85, 0xb5, 0xbe, 0xbe, 0xb5, 0x85, 0x8e, 0x89, 0x82, 0xb2, 0xb9, 
+    0xc0, 0xcb, 0xfb, 0xf0, 0xf7, 0xfc, 0xcc, 0xc7, 0xc7, 0xcc, 0xfc, 0xf7, 0xf0, 0xfb, 0xcb, 0xc0, 
+    0xd9, 0xd2, 0xe2, 0xe9, 0xee, 0xe5, 0xd5, 0xde, 0xde, 0xd5, 0xe5, 0xee, 0xe9, 0xe2, 0xd2, 0xd9, 
+    0xe9, 0xe2, 0xd2, 0xd9, 0xde, 0xd5, 0xe5, 0xee, 0xee, 0xe5, 0xd5, 0xde, 0xd9, 0xd2, 0xe2, 0xe9, 
+    0xf0, 0xfb, 0xcb, 0xc0, 0xc7, 0xcc, 0xfc, 0xf7, 0xf7, 0xfc, 0xcc, 0xc7, 0xc0, 0xcb, 0xfb, 0xf0}
+};
+
+// SEC-DED (72,64) syndrome-to-error table
+unsigned char secded7264_err_gentab[256] = {
+    0x00, 0x41, 0x42, 0x00, 0x43, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x20, 0x00, 
+    0x45, 0x00, 0x00, 0x0d, 0x00, 0x15, 0x09, 0x00, 0x00, 0x05, 0x19, 0x00, 0x11, 0x00, 0x00, 0x00, 
+    0x46, 0x00, 0x00, 0x0e, 0x00, 0x16, 0x0a, 0x00, 0x00, 0x06, 0x1a, 0x00, 0x12, 0x00, 0x00, 0x00, 
+    0x00, 0x2d, 0x2e, 0x00, 0x2f, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+    0x47, 0x00, 0x00, 0x0f, 0x00, 0x17, 0x0b, 0x00, 0x00, 0x07, 0x1b, 0x00, 0x13, 0x00, 0x00, 0x00, 
+    0x00, 0x25, 0x26, 0x00, 0x27, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x35, 0x36, 0x00, 0x37, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x21, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x48, 0x00, 0x00, 0x10, 0x00, 0x18, 0x0c, 0x00, 0x00, 0x08, 0x1c, 0x00, 0x14, 0x00, 0x00, 0x00, 
+    0x00, 0x39, 0x3a, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x29, 0x2a, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x24, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x31, 0x32, 0x00, 0x33, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1f, 0x00, 
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 
+    0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+//
+// Viterbi decoder for rate 1/R, constraint length K convolutional codes
+//
+// The shift register is encoded as the state with the most recent input
+// bit in the least-significant position, so the predecessors of states
+// 2i and 2i+1 are i and i+N/2 (N=2^(K-1) states). Every polynomial used
+// here has both its first and last taps set; hence the expected outputs
+// of the four transitions of a butterfly are either equal or complemented
+// and a single branch metric per butterfly suffices. Path metrics are
+// 16-bit integers normalized every step; with SSE2 eight butterflies are
+// processed at once.
+//
+// Survivor decisions are kept in a sliding window: once the window is
+// full, a traceback from the best state releases the oldest bits, so
+// memory does not grow with the message length.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_EMMINTRIN_H && defined(__SSE2__)
+#  include <emmintrin.h>
+#  define FEC_VITERBI_SSE 1
+#else
+#  define FEC_VITERBI_SSE 0
+#endif
+
+// Viterbi decoder object
+struct fec_viterbi_s {
+    unsigned int R;             // inverse rate (outputs per input bit)
+    unsigned int K;             // constraint length
+    unsigned int N;             // number of states, 2^(K-1)
+    unsigned int num_words;     // decision words per step, N/16
+    short * branchtab;          // expected outputs for transition i->2i [size: R x N/2]
+    short * metric0;            // path metrics (ping)
+    short * metric1;            // path metrics (pong)
+
+    // survivor decisions
+    unsigned int depth;         // traceback depth (steps)
+    unsigned int window;        // decision window length (steps)
+    unsigned short * decisions; // decision bits [size: window x num_words]
+    unsigned int num_steps;     // number of steps since initialization
+    unsigned int num_out;       // number of bits released by traceback
+
+    // decoded output
+    unsigned int out_skip;      // number of leading bits to discard
+    unsigned int out_len;       // number of output bits in current frame
+    unsigned int out_max;       // maximum number of output bits
+    unsigned char * out;        // output bits (packed) [size: out_max/8+1]
+};
+
+// create Viterbi decoder object
+//  _R      :   inverse rate
+//  _K      :   constraint length
+//  _poly   :   generator polynomials [size: _R x 1]
+//  _len    :   maximum number of decoded bits per frame
+void * fec_viterbi_create(unsigned int _R,
+                          unsigned int _K,
+                          int *        _poly,
+                          unsigned int _len)
+{
+    // validate input
+    if (_K < 5 || _K > 16) {
+        fprintf(stderr,"error: fec_viterbi_create(), constraint length must be in [5,16]\n");
+        exit(1);
+    } else if (_R < 1 || _R > 16) {
+        fprintf(stderr,"error: fec_viterbi_create(), inverse rate must be in [1,16]\n");
+        exit(1);
+    }
+
+    struct fec_viterbi_s * q = (struct fec_viterbi_s*) malloc(sizeof(struct fec_viterbi_s));
+    q->R         = _R;
+    q->K         = _K;
+    q->N         = 1 << (_K-1);
+    q->num_words = q->N / 16;
+
+    // branch table: outputs for transition from state i with input bit 0
+    // (register 2i); the other transitions of the butterfly are derived
+    // by complementing
+    unsigned int i;
+    unsigned int r;
+    q->branchtab = (short*) malloc(q->R*(q->N/2)*sizeof(short));
+    for (r=0; r<q->R; r++) {
+        for (i=0; i<q->N/2; i++)
+            q->branchtab[r*(q->N/2) + i] = liquid_count_ones_mod2((2*i) & _poly[r]) ? 255 : 0;
+    }
+    q->metric0 = (short*) malloc(q->N*sizeof(short));
+    q->metric1 = (short*) malloc(q->N*sizeof(short));
+
+    // traceback depth: long constraint lengths are only used at low rates
+    // (never punctured) and converge quickly
+    q->depth  = _K <= 9 ? 16*(_K-1) : 8*(_K-1);
+    q->window = 2*q->depth;
+    q->decisions = (unsigned short*) malloc(q->window*q->num_words*sizeof(unsigned short));
+
+    q->out_max = _len;
+    q->out = (unsigned char*) malloc((_len/8 + 1)*sizeof(unsigned char));
+
+    fec_viterbi_init(q, 0);
+    return q;
+}
+
+// create Viterbi decoders for the built-in codes
+void * fec_viterbi27_create(int _len)  { return fec_viterbi_create(2,  7, fec_conv27_poly,  _len); }
+void * fec_viterbi29_create(int _len)  { return fec_viterbi_create(2,  9, fec_conv29_poly,  _len); }
+void * fec_viterbi39_create(int _len)  { return fec_viterbi_create(3,  9, fec_conv39_poly,  _len); }
+void * fec_viterbi615_create(int _len) { return fec_viterbi_create(6, 15, fec_conv615_poly, _len); }
+
+// destroy Viterbi decoder object
+void fec_viterbi_delete(void * _vp)
+{
+    struct fec_viterbi_s * q = (struct fec_viterbi_s*) _vp;
+    free(q->branchtab);
+    free(q->metric0);
+    free(q->metric1);
+    free(q->decisions);
+    free(q->out);
+    free(q);
+}
+
+// initialize decoder for new frame
+//  _vp             :   decoder object
+//  _starting_state :   initial encoder state, or -1 if unknown
+int fec_viterbi_init(void * _vp,
+                     int    _starting_state)
+{
+    struct fec_viterbi_s * q = (struct fec_viterbi_s*) _vp;
+
+    // bias all but the starting state
+    unsigned int i;
+    for (i=0; i<q->N; i++)
+        q->metric0[i] = (_starting_state < 0 || i == (unsigned int)_starting_state % q->N) ? 0 : 1024;
+
+    q->num_steps = 0;
+    q->num_out   = 0;
+    q->out_skip  = 0;
+    q->out_len   = q->out_max;
+    memset(q->out, 0x00, q->out_max/8 + 1);
+    return 0;
+}
+
+// write decoded bit to output, discarding bits outside the frame
+static void fec_viterbi_push_bit(struct fec_viterbi_s * _q,
+                                 unsigned int           _index,
+                                 unsigned int           _bit)
+{
+    if (_index < _q->out_skip || _index - _q->out_skip >= _q->out_len)
+        return;
+    _index -= _q->out_skip;
+    _q->out[_index/8] |= _bit << (7 - (_index%8));
+}
+
+// trace back through decision window from a given state, releasing all
+// bits older than the most recent _keep steps
+static void fec_viterbi_traceback(struct fec_viterbi_s * _q,
+                                  unsigned int           _state,
+                                  unsigned int           _keep)
+{
+    unsigned int t = _q->num_steps;
+    unsigned int s = _state;
+    while (t > _q->num_out) {
+        t--;
+        // decoded bit at step t is the least-significant bit of the state
+        if (t + _keep < _q->num_steps)
+            fec_viterbi_push_bit(_q, t, s & 1);
+
+        // follow survivor to predecessor
+        const unsigned short * d = &_q->decisions[(t % _q->window)*_q->num_words];
+        unsigned int bit = (d[s >> 4] >> (s & 15)) & 1;
+        s = (s >> 1) | (bit << (_q->K-2));
+    }
+    _q->num_out = _q->num_steps > _keep ? _q->num_steps - _keep : 0;
+}
+
+// find state with smallest path metric
+static unsigned int fec_viterbi_best_state(struct fec_viterbi_s * _q)
+{
+    unsigned int i;
+    unsigned int imin = 0;
+    for (i=1; i<_q->N; i++) {
+        if (_q->metric0[i] < _q->metric0[imin])
+            imin = i;
+    }
+    return imin;
+}
+
+// run add-compare-select for a single step
+//  _q      :   decoder object
+//  _syms   :   received soft bits [size: R x 1]
+static void fec_viterbi_step(struct fec_viterbi_s * _q,
+                             const unsigned char *  _syms)
+{
+    unsigned int N2 = _q->N/2;
+    short * m_old = _q->metric0;
+    short * m_new = _q->metric1;
+    unsigned short * d = &_q->decisions[(_q->num_steps % _q->window)*_q->num_words];
+    unsigned int i;
+    unsigned int r;
+
+    // maximum branch metric; complemented transitions have metric S-bm
+    short S = 255*_q->R;
+
+    // normalize metrics relative to state 0 to keep them bounded
+    short offset = m_old[0];
+
+#if FEC_VITERBI_SSE
+    __m128i vS   = _mm_set1_epi16(S);
+    __m128i voff = _mm_set1_epi16(offset);
+    __m128i vsym[16];
+    for (r=0; r<_q->R; r++)
+        vsym[r] = _mm_set1_epi16(_syms[r]);
+
+    for (i=0; i<N2; i+=8) {
+        // branch metric for transitions i -> 2i
+        __m128i bm = _mm_setzero_si128();
+        for (r=0; r<_q->R; r++) {
+            __m128i b = _mm_loadu_si128((__m128i*)&_q->branchtab[r*N2 + i]);
+            bm = _mm_add_epi16(bm, _mm_xor_si128(b, vsym[r]));
+        }
+        __m128i bmc = _mm_sub_epi16(vS, bm);
+
+        __m128i mA = _mm_loadu_si128((__m128i*)&m_old[i]);
+        __m128i mB = _mm_loadu_si128((__m128i*)&m_old[i+N2]);
+
+        // new states 2i (input 0) and 2i+1 (input 1)
+        __m128i a0 = _mm_adds_epi16(mA, bm);
+        __m128i b0 = _mm_adds_epi16(mB, bmc);
+        __m128i a1 = _mm_adds_epi16(mA, bmc);
+        __m128i b1 = _mm_adds_epi16(mB, bm);
+        __m128i d0 = _mm_cmpgt_epi16(a0, b0);
+        __m128i d1 = _mm_cmpgt_epi16(a1, b1);
+        __m128i n0 = _mm_sub_epi16(_mm_min_epi16(a0, b0), voff);
+        __m128i n1 = _mm_sub_epi16(_mm_min_epi16(a1, b1), voff);
+
+        // interleave into natural state order
+        _mm_storeu_si128((__m128i*)&m_new[2*i],   _mm_unpacklo_epi16(n0, n1));
+        _mm_storeu_si128((__m128i*)&m_new[2*i+8], _mm_unpackhi_epi16(n0, n1));
+        __m128i dv = _mm_packs_epi16(_mm_unpacklo_epi16(d0, d1), _mm_unpackhi_epi16(d0, d1));
+        d[i/8] = (unsigned short)_mm_movemask_epi8(dv);
+    }
+#else
+    memset(d, 0x00, _q->num_words*sizeof(unsigned short));
+    for (i=0; i<N2; i++) {
+        int bm = 0;
+        for (r=0; r<_q->R; r++)
+            bm += _q->branchtab[r*N2 + i] ^ _syms[r];
+        int bmc = S - bm;
+
+        int a0 = m_old[i]    + bm;
+        int b0 = m_old[i+N2] + bmc;
+        int a1 = m_old[i]    + bmc;
+        int b1 = m_old[i+N2] + bm;
+        m_new[2*i]   = (a0 > b0 ? b0 : a0) - offset;
+        m_new[2*i+1] = (a1 > b1 ? b1 : a1) - offset;
+        d[(2*i)/16] |= ((a0 > b0 ? 1 : 0) | (a1 > b1 ? 2 : 0)) << ((2*i) % 16);
+    }
+#endif
+
+    // swap metric buffers
+    _q->metric0 = m_new;
+    _q->metric1 = m_old;
+    _q->num_steps++;
+
+    // release oldest bits once the decision window is full
+    if (_q->num_steps - _q->num_out == _q->window)
+        fec_viterbi_traceback(_q, fec_viterbi_best_state(_q), _q->depth);
+}
+
+// run decoder on block of soft bits
+//  _vp     :   decoder object
+//  _syms   :   received soft bits [size: R*_nbits x 1]
+//  _nbits  :   number of decoder steps (input bits, including tail)
+int fec_viterbi_update_blk(void *          _vp,
+                           unsigned char * _syms,
+                           int             _nbits)
+{
+    struct fec_viterbi_s * q = (struct fec_viterbi_s*) _vp;
+    int i;
+    for (i=0; i<_nbits; i++)
+        fec_viterbi_step(q, &_syms[i*q->R]);
+    return 0;
+}
+
+// finish decoding, tracing back from the final encoder state
+//  _vp         :   decoder object
+//  _data       :   decoded bits (packed) [size: ceil(_nbits/8) x 1]
+//  _nbits      :   number of decoded bits
+//  _endstate   :   final encoder state (zero for terminated codes)
+int fec_viterbi_chainback(void *          _vp,
+                          unsigned char * _data,
+                          unsigned int    _nbits,
+                          unsigned int    _endstate)
+{
+    struct fec_viterbi_s * q = (struct fec_viterbi_s*) _vp;
+    fec_viterbi_traceback(q, _endstate % q->N, 0);
+    memmove(_data, q->out, (_nbits+7)/8);
+    return 0;
+}
+
+// decode tail-biting frame: the encoder is initialized with the final
+// K-1 message bits, so the frame has no tail and starts and ends in the
+// same (unknown) state. The symbols are processed circularly with a
+// wrap-around prefix and suffix so that both ends of the frame benefit
+// from a full traceback depth.
+//  _vp     :   decoder object
+//  _syms   :   received soft bits [size: R*_nbits x 1]
+//  _nbits  :   number of message bits
+//  _data   :   decoded bits (packed) [size: ceil(_nbits/8) x 1]
+int fec_viterbi_decode_tailbiting(void *          _vp,
+                                  unsigned char * _syms,
+                                  unsigned int    _nbits,
+                                  unsigned char * _data)
+{
+    struct fec_viterbi_s * q = (struct fec_viterbi_s*) _vp;
+    if (_nbits > q->out_max) {
+        fprintf(stderr,"error: fec_viterbi_decode_tailbiting(), frame exceeds maximum length\n");
+        exit(1);
+    }
+    unsigned int wrap = q->depth < _nbits ? q->depth : _nbits;
+    unsigned int i;
+
+    fec_viterbi_init(q, -1);
+    q->out_skip = wrap;
+    q->out_len  = _nbits;
+    for (i=0; i<wrap; i++)
+        fec_viterbi_step(q, &_syms[(_nbits - wrap + i)*q->R]);
+    for (i=0; i<_nbits; i++)
+        fec_viterbi_step(q, &_syms[i*q->R]);
+    for (i=0; i<wrap; i++)
+        fec_viterbi_step(q, &_syms[i*q->R]);
+
+    fec_viterbi_traceback(q, fec_viterbi_best_state(q), 0);
+    memmove(_data, q->out, (_nbits+7)/8);
+    return 0;
+}
@@ -23,7 +23,7 @@
 #include <string.h>
 
 #include "autotest/autotest.h"
-#include "liquid.h"
+#include "liquid.internal.h"
 
 //
 // AUTOTEST: reverse byte
@@ -120,3 +120,87 @@ void autotest_crc24()    { validate_crc(LIQUID_CRC_24,          64); }
 void autotest_crc32()    { validate_crc(LIQUID_CRC_32,          64); }
 
 
+
+// 
+// autotest helper function: compare incremental key computation, split
+// into chunks of varying size, against key over entire message
+//
+void validate_crc_update(crc_scheme   _check,
+                         unsigned int _n)
+{
+    unsigned int i;
+
+    // generate pseudo-random data
+    unsigned char data[_n];
+    msequence ms = msequence_create_default(11);
+    for (i=0; i<_n; i++)
+        data[i] = msequence_generate_symbol(ms,8);
+    msequence_destroy(ms);
+
+    // generate key over entire message
+    unsigned int key = crc_generate_key(_check, data, _n);
+
+    // generate key incrementally with chunks of increasing size
+    unsigned int chunk;
+    for (chunk=1; chunk<_n; chunk += 7) {
+        unsigned int key_run = crc_init_key(_check);
+        unsigned int n = 0;
+        while (n < _n) {
+            unsigned int k = (_n - n) < chunk ? (_n - n) : chunk;
+            key_run = crc_update_key(_check, key_run, data + n, k);
+            n += k;
+        }
+        CONTEND_EQUALITY(crc_finalize_key(_check, key_run), key);
+    }
+}
+
+void autotest_crc_update_checksum() { validate_crc_update(LIQUID_CRC_CHECKSUM, 200); }
+void autotest_crc_update_crc8()     { validate_crc_update(LIQUID_CRC_8,        200); }
+void autotest_crc_update_crc16()    { validate_crc_update(LIQUID_CRC_16,       200); }
+void autotest_crc_update_crc24()    { validate_crc_update(LIQUID_CRC_24,       200); }
+void autotest_crc_update_crc32()    { validate_crc_update(LIQUID_CRC_32,       200); }
+
+// 
+// autotest helper function: compare all engines against bit-wise method
+//
+void validate_crc_engines(crc_scheme _check)
+{
+    unsigned int i;
+    unsigned int n_max = 300;
+
+    // generate pseudo-random data
+    unsigned char data[n_max];
+    msequence ms = msequence_create_default(10);
+    for (i=0; i<n_max; i++)
+        data[i] = msequence_generate_symbol(ms,8);
+    msequence_destroy(ms);
+
+    // test all message lengths and a few starting offsets (alignment)
+    unsigned int n, offset;
+    for (offset=0; offset<4; offset++) {
+        for (n=0; n<n_max-offset; n++) {
+            unsigned int key0 = crc_init_key(_check);
+            unsigned int key_bitwise = crc_update_key_bitwise(_check, key0, data+offset, n);
+            unsigned int key_table   = crc_update_key_table  (_check, key0, data+offset, n);
+            CONTEND_EQUALITY(key_table, key_bitwise);
+            if (_check == LIQUID_CRC_32) {
+                unsigned int key_pclmul = crc32_update_key_pclmul(key0, data+offset, n);
+                CONTEND_EQUALITY(key_pclmul, key_bitwise);
+            }
+        }
+    }
+}
+
+void autotest_crc_engines_crc8()  { validate_crc_engines(LIQUID_CRC_8 ); }
+void autotest_crc_engines_crc16() { validate_crc_engines(LIQUID_CRC_16); }
+void autotest_crc_engines_crc24() { validate_crc_engines(LIQUID_CRC_24); }
+void autotest_crc_engines_crc32() { validate_crc_engines(LIQUID_CRC_32); }
+
+// 
+// AUTOTEST: CRC-32 check value (ISO-HDLC) for "123456789"
+//
+void autotest_crc32_check_value()
+{
+    unsigned char msg[9] = {'1','2','3','4','5','6','7','8','9'};
+    CONTEND_EQUALITY(crc_generate_key(LIQUID_CRC_32, msg, 9), 0xcbf43926);
+}
@@ -105,3 +105,50 @@ void autotest_golay2412_codec()
     }
 }
 
+
+//
+// AUTOTEST: Golay(24,12) block codec matches symbol codec, with errors
+//
+void autotest_golay2412_block()
+{
+    unsigned int n = 100;   // decoded message length (not a multiple of 3)
+    unsigned int k = fec_get_enc_msg_length(LIQUID_FEC_GOLAY2412, n);
+
+    unsigned char msg_org[n];   // original message
+    unsigned char msg_enc[k];   // encoded message
+    unsigned char msg_rec[k];   // received message
+    unsigned char msg_dec[n];   // decoded message
+
+    unsigned int i;
+    for (i=0; i<n; i++)
+        msg_org[i] = rand() & 0xff;
+
+    fec q = fec_create(LIQUID_FEC_GOLAY2412, NULL);
+    fec_encode(q, n, msg_org, msg_enc);
+
+    // flip random bits; some symbols get more errors than can be corrected
+    for (i=0; i<k; i++)
+        msg_rec[i] = msg_enc[i] ^ ( (rand() % 3) == 0 ? 1 << (rand() % 8) : 0 );
+    fec_decode(q, n, msg_rec, msg_dec);
+    fec_destroy(q);
+
+    // compare against symbol encoder/decoder
+    for (i=0; i<n/3; i++) {
+        unsigned char * m = &msg_org[3*i];
+        unsigned char * v = &msg_enc[6*i];
+        unsigned char * r = &msg_rec[6*i];
+
+        unsigned int m0 = (m[0] << 4) | (m[1] >> 4);
+        unsigned int m1 = ((m[1] & 0x0f) << 8) | m[2];
+        unsigned int v0 = fec_golay2412_encode_symbol(m0);
+        unsigned int v1 = fec_golay2412_encode_symbol(m1);
+        CONTEND_EQUALITY( (v[0] << 16) | (v[1] << 8) | v[2], v0 );
+        CONTEND_EQUALITY( (v[3] << 16) | (v[4] << 8) | v[5], v1 );
+
+        unsigned int m0_hat = fec_golay2412_decode_symbol( (r[0] << 16) | (r[1] << 8) | r[2] );
+        unsigned int m1_hat = fec_golay2412_decode_symbol( (r[3] << 16) | (r[4] << 8) | r[5] );
+        CONTEND_EQUALITY( msg_dec[3*i+0], (m0_hat >> 4) & 0xff );
+        CONTEND_EQUALITY( msg_dec[3*i+1], ((m0_hat << 4) & 0xf0) | (m1_hat >> 8) );
+        CONTEND_EQUALITY( msg_dec[3*i+2], m1_hat & 0xff );
+    }
+}
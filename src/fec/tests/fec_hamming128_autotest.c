@@ -103,3 +103,38 @@ void autotest_hamming128_codec_soft()
     }
 }
 
+
+//
+// AUTOTEST: Hamming (12,8) block decoder matches symbol decoder, with errors
+//
+void autotest_hamming128_block()
+{
+    unsigned int n = 101;   // decoded message length (odd)
+    unsigned int k = fec_get_enc_msg_length(LIQUID_FEC_HAMMING128, n);
+
+    unsigned char msg_org[n];   // original message
+    unsigned char msg_enc[k];   // encoded message
+    unsigned char msg_dec[n];   // decoded message
+
+    unsigned int i;
+    for (i=0; i<n; i++)
+        msg_org[i] = rand() & 0xff;
+
+    fec q = fec_create(LIQUID_FEC_HAMMING128, NULL);
+    fec_encode(q, n, msg_org, msg_enc);
+
+    // flip random bits; some symbols get more errors than can be corrected
+    for (i=0; i<k; i++)
+        msg_enc[i] ^= (rand() % 3) == 0 ? 1 << (rand() % 8) : 0;
+    fec_decode(q, n, msg_enc, msg_dec);
+    fec_destroy(q);
+
+    // compare against symbol decoder
+    for (i=0; i<n/2; i++) {
+        unsigned char * r = &msg_enc[3*i];
+        unsigned int m0 = (r[0] << 4) | (r[1] >> 4);
+        unsigned int m1 = ((r[1] & 0x0f) << 8) | r[2];
+        CONTEND_EQUALITY( msg_dec[2*i+0], fec_hamming128_decode_symbol(m0) );
+        CONTEND_EQUALITY( msg_dec[2*i+1], fec_hamming128_decode_symbol(m1) );
+    }
+}
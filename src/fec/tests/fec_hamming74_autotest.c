@@ -20,6 +20,9 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "autotest/autotest.h"
 #include "liquid.internal.h"
 
@@ -99,3 +102,46 @@ void autotest_hamming74_codec_soft()
     }
 }
 
+
+//
+// AUTOTEST: Hamming (7,4) block codec matches bit-packed symbol codec
+//
+void autotest_hamming74_block()
+{
+    unsigned int n = 103;   // decoded message length (not a multiple of 4)
+    unsigned int k = fec_get_enc_msg_length(LIQUID_FEC_HAMMING74, n);
+
+    unsigned char msg_org[n];   // original message
+    unsigned char msg_enc[k];   // encoded message
+    unsigned char msg_ref[k];   // reference encoded message
+    unsigned char msg_dec[n];   // decoded message
+
+    unsigned int i;
+    for (i=0; i<n; i++)
+        msg_org[i] = rand() & 0xff;
+
+    // reference: pack two 7-bit symbols per input byte
+    memset(msg_ref, 0x00, k);
+    for (i=0; i<n; i++) {
+        liquid_pack_array(msg_ref, k, 14*i+0, 7, hamming74_enc_gentab[msg_org[i] >> 4  ]);
+        liquid_pack_array(msg_ref, k, 14*i+7, 7, hamming74_enc_gentab[msg_org[i] & 0x0f]);
+    }
+
+    fec q = fec_create(LIQUID_FEC_HAMMING74, NULL);
+    memset(msg_enc, 0x00, k);
+    fec_encode(q, n, msg_org, msg_enc);
+    CONTEND_SAME_DATA(msg_enc, msg_ref, k);
+
+    // flip random bits and compare against bit-unpacked symbol decoder
+    for (i=0; i<k; i++)
+        msg_enc[i] ^= (rand() % 3) == 0 ? 1 << (rand() % 8) : 0;
+    fec_decode(q, n, msg_enc, msg_dec);
+    fec_destroy(q);
+
+    for (i=0; i<n; i++) {
+        unsigned char r0, r1;
+        liquid_unpack_array(msg_enc, k, 14*i+0, 7, &r0);
+        liquid_unpack_array(msg_enc, k, 14*i+7, 7, &r1);
+        CONTEND_EQUALITY( msg_dec[i], (hamming74_dec_gentab[r0] << 4) | hamming74_dec_gentab[r1] );
+    }
+}
@@ -20,6 +20,8 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
+
 #include "autotest/autotest.h"
 #include "liquid.internal.h"
 
@@ -99,3 +101,28 @@ void autotest_hamming84_codec_soft()
     }
 }
 
+
+//
+// AUTOTEST: Hamming (8,4) block encoder matches symbol encoder
+//
+void autotest_hamming84_block()
+{
+    unsigned int n = 101;   // decoded message length (not a multiple of 16)
+    unsigned int k = fec_get_enc_msg_length(LIQUID_FEC_HAMMING84, n);
+
+    unsigned char msg_org[n];   // original message
+    unsigned char msg_enc[k];   // encoded message
+
+    unsigned int i;
+    for (i=0; i<n; i++)
+        msg_org[i] = rand() & 0xff;
+
+    fec q = fec_create(LIQUID_FEC_HAMMING84, NULL);
+    fec_encode(q, n, msg_org, msg_enc);
+    fec_destroy(q);
+
+    for (i=0; i<n; i++) {
+        CONTEND_EQUALITY( msg_enc[2*i+0], hamming84_enc_gentab[msg_org[i] >> 4  ] );
+        CONTEND_EQUALITY( msg_enc[2*i+1], hamming84_enc_gentab[msg_org[i] & 0x0f] );
+    }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// check that encoded codewords satisfy all parity checks of the
+// expanded parity-check matrix
+//  _fs     :   LDPC scheme
+//  _n      :   decoded message length (bytes)
+void fec_ldpc_test_codeword(fec_scheme   _fs,
+                            unsigned int _n)
+{
+    fec q = fec_create(_fs, NULL);
+    fec_ldpc_setlength(q, _n);
+
+    unsigned int Z  = q->ldpc_Z;
+    unsigned int mb = q->ldpc_mb;
+    unsigned int nb = q->ldpc_nb;
+
+    // random information bits, compute parity
+    unsigned char c[nb*Z];
+    unsigned int i;
+    for (i=0; i<(nb-mb)*Z; i++)
+        c[i] = rand() & 1;
+    fec_ldpc_encode_block(q, c);
+
+    // compute syndrome
+    smatrixb H = fec_ldpc_gen_smatrixb(_fs, Z);
+    unsigned char syndrome[mb*Z];
+    smatrixb_vmul(H, c, syndrome);
+
+    unsigned int num_errors = 0;
+    for (i=0; i<mb*Z; i++)
+        num_errors += syndrome[i];
+    CONTEND_EQUALITY(num_errors, 0);
+
+    // internal parity check on hard decisions agrees
+    for (i=0; i<nb*Z; i++)
+        q->ldpc_L[i] = c[i] ? -64 : 64;
+    CONTEND_EQUALITY(fec_ldpc_check(q), 1);
+    q->ldpc_L[0] = -q->ldpc_L[0];
+    CONTEND_EQUALITY(fec_ldpc_check(q), 0);
+
+    smatrixb_destroy(H);
+    fec_destroy(q);
+}
+
+void autotest_fec_ldpc12_codeword_n8()   { fec_ldpc_test_codeword(LIQUID_FEC_LDPC_R12,   8); }
+void autotest_fec_ldpc12_codeword_n64()  { fec_ldpc_test_codeword(LIQUID_FEC_LDPC_R12,  64); }
+void autotest_fec_ldpc12_codeword_n144() { fec_ldpc_test_codeword(LIQUID_FEC_LDPC_R12, 144); }
+void autotest_fec_ldpc23_codeword_n64()  { fec_ldpc_test_codeword(LIQUID_FEC_LDPC_R23,  64); }
+void autotest_fec_ldpc34_codeword_n64()  { fec_ldpc_test_codeword(LIQUID_FEC_LDPC_R34,  64); }
+void autotest_fec_ldpc56_codeword_n64()  { fec_ldpc_test_codeword(LIQUID_FEC_LDPC_R56,  64); }
+
+// decode message transmitted over noisy BPSK channel
+//  _fs     :   LDPC scheme
+//  _n      :   decoded message length (bytes)
+//  _sigma  :   noise standard deviation
+void fec_ldpc_test_awgn(fec_scheme   _fs,
+                        unsigned int _n,
+                        float        _sigma)
+{
+    fec q = fec_create(_fs, NULL);
+
+    unsigned int n_enc = fec_get_enc_msg_length(_fs, _n);
+    unsigned char msg[_n];              // original message
+    unsigned char msg_enc[n_enc];       // encoded message
+    unsigned char msg_soft[8*n_enc];    // received soft bits
+    unsigned char msg_dec[_n];          // decoded message
+
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg[i] = rand() & 0xff;
+
+    fec_encode(q, _n, msg, msg_enc);
+
+    // modulate, add noise, and compute soft bits
+    unsigned int num_bit_errors = 0;
+    for (i=0; i<8*n_enc; i++) {
+        unsigned int bit = (msg_enc[i/8] >> (7-(i%8))) & 1;
+        float y = (bit ? -1.0f : 1.0f) + _sigma*randnf();
+        int soft = (int)(127.5f - 64.0f*y);
+        msg_soft[i] = soft < 0 ? 0 : (soft > 255 ? 255 : soft);
+        num_bit_errors += (msg_soft[i] > 127) != bit;
+    }
+    if (liquid_autotest_verbose)
+        printf("  %s, n=%u, channel bit errors: %u / %u\n", fec_scheme_str[_fs][0], _n, num_bit_errors, 8*n_enc);
+
+    fec_decode_soft(q, _n, msg_soft, msg_dec);
+    CONTEND_SAME_DATA(msg, msg_dec, _n);
+
+    fec_destroy(q);
+}
+
+void autotest_fec_ldpc12_awgn_n32()  { fec_ldpc_test_awgn(LIQUID_FEC_LDPC_R12,  32, 0.60f); }
+void autotest_fec_ldpc12_awgn_n400() { fec_ldpc_test_awgn(LIQUID_FEC_LDPC_R12, 400, 0.60f); }
+void autotest_fec_ldpc23_awgn_n400() { fec_ldpc_test_awgn(LIQUID_FEC_LDPC_R23, 400, 0.50f); }
+void autotest_fec_ldpc34_awgn_n400() { fec_ldpc_test_awgn(LIQUID_FEC_LDPC_R34, 400, 0.45f); }
+void autotest_fec_ldpc56_awgn_n400() { fec_ldpc_test_awgn(LIQUID_FEC_LDPC_R56, 400, 0.40f); }
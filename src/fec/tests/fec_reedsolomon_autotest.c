@@ -31,11 +31,6 @@
 //
 void autotest_reedsolomon_223_255()
 {
-#if !LIBFEC_ENABLED
-    printf("warning: Reed-Solomon codes unavailable\n");
-    return;
-#endif
-
     unsigned int dec_msg_len = 223;
 
     // compute and test encoded message length
@@ -83,3 +78,141 @@ void autotest_reedsolomon_223_255()
     fec_destroy(q);
 }
 
+
+// Test native codec directly: encode random block, corrupt symbols at
+// _num_errors unknown and _num_erasures known locations, and decode
+void reedsolomon_test_codec(unsigned int _gfpoly,
+                            unsigned int _fcs,
+                            unsigned int _prim,
+                            unsigned int _nroots,
+                            unsigned int _pad,
+                            unsigned int _num_errors,
+                            unsigned int _num_erasures)
+{
+    unsigned int n = 255 - _pad;    // stored codeword length
+    unsigned int k = n - _nroots;   // data symbols
+
+    void * q = fec_reedsolomon_create(8, _gfpoly, _fcs, _prim, _nroots, _pad);
+
+    // encode random block
+    unsigned char msg_org[n];
+    unsigned char msg_rec[n];
+    unsigned int i;
+    for (i=0; i<k; i++)
+        msg_org[i] = rand() & 0xff;
+    fec_reedsolomon_encode(q, msg_org, &msg_org[k]);
+
+    // choose distinct locations: first the erasures, then the errors
+    unsigned int perm[n];
+    for (i=0; i<n; i++)
+        perm[i] = i;
+    for (i=0; i<_num_errors + _num_erasures; i++) {
+        unsigned int j = i + rand() % (n - i);
+        unsigned int t = perm[i];
+        perm[i] = perm[j];
+        perm[j] = t;
+    }
+
+    // corrupt message; erased symbols are overwritten with arbitrary values
+    int eras_pos[_nroots];
+    memmove(msg_rec, msg_org, n*sizeof(unsigned char));
+    for (i=0; i<_num_erasures; i++) {
+        eras_pos[i] = perm[i];
+        msg_rec[perm[i]] = rand() & 0xff;
+    }
+    for (i=_num_erasures; i<_num_errors + _num_erasures; i++)
+        msg_rec[perm[i]] ^= 1 + rand() % 255;
+
+    // decode and validate
+    int rc = fec_reedsolomon_decode(q, msg_rec, eras_pos, _num_erasures);
+    if (_num_errors + _num_erasures == 0) {
+        CONTEND_EQUALITY( rc, 0 );
+    } else {
+        CONTEND_EQUALITY( rc, (int)(_num_errors + _num_erasures) );
+    }
+    CONTEND_SAME_DATA( msg_rec, msg_org, n );
+
+    fec_reedsolomon_destroy(q);
+}
+
+// RS(255,223) as used by LIQUID_FEC_RS_M8
+void autotest_reedsolomon_codec_e0()      { reedsolomon_test_codec(0x11d, 1, 1, 32,  0,  0,  0); }
+void autotest_reedsolomon_codec_e1()      { reedsolomon_test_codec(0x11d, 1, 1, 32,  0,  1,  0); }
+void autotest_reedsolomon_codec_e16()     { reedsolomon_test_codec(0x11d, 1, 1, 32,  0, 16,  0); }
+void autotest_reedsolomon_codec_x32()     { reedsolomon_test_codec(0x11d, 1, 1, 32,  0,  0, 32); }
+void autotest_reedsolomon_codec_e8_x16()  { reedsolomon_test_codec(0x11d, 1, 1, 32,  0,  8, 16); }
+void autotest_reedsolomon_codec_e15_x2()  { reedsolomon_test_codec(0x11d, 1, 1, 32,  0, 15,  2); }
+
+// shortened codes
+void autotest_reedsolomon_codec_n64_e16() { reedsolomon_test_codec(0x11d, 1, 1, 32,191, 16,  0); }
+void autotest_reedsolomon_codec_n40_e5_x6(){ reedsolomon_test_codec(0x11d, 1, 1, 16,215,  5,  6); }
+
+// CCSDS parameters: field 0x187, first root 112, primitive element 11
+void autotest_reedsolomon_codec_ccsds()   { reedsolomon_test_codec(0x187,112,11, 32,  0, 10, 12); }
+
+// small number of roots, other field polynomial
+void autotest_reedsolomon_codec_r6()      { reedsolomon_test_codec(0x12b, 0, 1,  6, 17,  2,  2); }
+
+// uncorrectable block must be reported and left untouched
+void autotest_reedsolomon_codec_failure()
+{
+    void * q = fec_reedsolomon_create(8, 0x11d, 1, 1, 32, 0);
+
+    unsigned char msg_org[255];
+    unsigned char msg_rec[255];
+    unsigned int i;
+    for (i=0; i<223; i++)
+        msg_org[i] = i;
+    fec_reedsolomon_encode(q, msg_org, &msg_org[223]);
+
+    // 32 consecutive errors are well beyond the correction capability
+    memmove(msg_rec, msg_org, sizeof(msg_rec));
+    for (i=0; i<32; i++)
+        msg_rec[3*i] ^= 0x5a;
+    unsigned char msg_cpy[255];
+    memmove(msg_cpy, msg_rec, sizeof(msg_rec));
+
+    int rc = fec_reedsolomon_decode(q, msg_rec, NULL, 0);
+    CONTEND_EQUALITY( rc, -1 );
+    CONTEND_SAME_DATA( msg_rec, msg_cpy, 255 );
+
+    fec_reedsolomon_destroy(q);
+}
+
+// soft-decision decoding: 24 corrupted symbols are beyond the reach of
+// hard decisions, but become correctable when 16 of them are flagged as
+// unreliable (erasures) by the soft values
+void autotest_reedsolomon_soft_erasures()
+{
+    unsigned int dec_msg_len = 223;
+    unsigned int enc_msg_len = fec_get_enc_msg_length(LIQUID_FEC_RS_M8,dec_msg_len);
+
+    unsigned char msg_org[dec_msg_len];
+    unsigned char msg_enc[enc_msg_len];
+    unsigned char msg_soft[8*enc_msg_len];
+    unsigned char msg_dec[dec_msg_len];
+
+    unsigned int i;
+    for (i=0; i<dec_msg_len; i++)
+        msg_org[i] = (7*i) & 0xff;
+
+    fec q = fec_create(LIQUID_FEC_RS_M8,NULL);
+    fec_encode(q, dec_msg_len, msg_org, msg_enc);
+
+    // confident soft bits
+    for (i=0; i<8*enc_msg_len; i++)
+        msg_soft[i] = ((msg_enc[i/8] >> (7-(i%8))) & 1) ? 255 : 0;
+
+    // 16 symbols with a flipped, unreliable bit
+    for (i=0; i<16; i++)
+        msg_soft[8*(10*i+3)+2] = msg_soft[8*(10*i+3)+2] ? 100 : 155;
+
+    // 8 symbols with a flipped, confident bit
+    for (i=0; i<8; i++)
+        msg_soft[8*(10*i+5)+6] = msg_soft[8*(10*i+5)+6] ? 0 : 255;
+
+    fec_decode_soft(q, dec_msg_len, msg_soft, msg_dec);
+    CONTEND_SAME_DATA(msg_org, msg_dec, dec_msg_len);
+
+    fec_destroy(q);
+}
@@ -146,3 +146,47 @@ void autotest_secded2216_codec_e2()
     }
 }
 
+
+//
+// AUTOTEST: SEC-DEC block codec matches symbol codec, with errors
+//
+void autotest_secded2216_block()
+{
+    unsigned int n = 203;   // decoded message length (not a multiple of 2)
+    unsigned int k = fec_get_enc_msg_length(LIQUID_FEC_SECDED2216, n);
+
+    unsigned char msg_org[n];   // original message
+    unsigned char msg_enc[k];   // encoded message
+    unsigned char sym_enc[3];  // encoded symbol
+    unsigned char sym_dec[2];  // decoded symbol
+    unsigned char msg_dec[n];   // decoded message
+
+    unsigned int i;
+    unsigned int j;
+    for (i=0; i<n; i++)
+        msg_org[i] = rand() & 0xff;
+
+    fec q = fec_create(LIQUID_FEC_SECDED2216, NULL);
+    fec_encode(q, n, msg_org, msg_enc);
+
+    // compare against symbol encoder
+    for (i=0; i<n/2; i++) {
+        fec_secded2216_encode_symbol(&msg_org[2*i], sym_enc);
+        for (j=0; j<3; j++)
+            CONTEND_EQUALITY(msg_enc[3*i+j], sym_enc[j]);
+    }
+
+    // flip random bits (including unused parity bits); some symbols
+    // get more errors than can be corrected
+    for (i=0; i<k; i++)
+        msg_enc[i] ^= (rand() % 4) == 0 ? 1 << (rand() % 8) : 0;
+    fec_decode(q, n, msg_enc, msg_dec);
+    fec_destroy(q);
+
+    // compare against symbol decoder
+    for (i=0; i<n/2; i++) {
+        fec_secded2216_decode_symbol(&msg_enc[3*i], sym_dec);
+        for (j=0; j<2; j++)
+            CONTEND_EQUALITY(msg_dec[2*i+j], sym_dec[j]);
+    }
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// convert bit to noisy soft bit (BPSK)
+static unsigned char fec_viterbi_test_softbit(unsigned int _bit,
+                                              float        _sigma)
+{
+    float y = (_bit ? -1.0f : 1.0f) + _sigma*randnf();
+    int soft = (int)(127.5f - 64.0f*y);
+    return soft < 0 ? 0 : (soft > 255 ? 255 : soft);
+}
+
+// decode long message over noisy channel; the message spans many
+// traceback windows
+//  _fs     :   convolutional scheme
+//  _n      :   decoded message length (bytes)
+//  _sigma  :   noise standard deviation
+void fec_viterbi_test_awgn(fec_scheme   _fs,
+                           unsigned int _n,
+                           float        _sigma)
+{
+    fec q = fec_create(_fs, NULL);
+
+    unsigned int n_enc = fec_get_enc_msg_length(_fs, _n);
+    unsigned char * msg      = (unsigned char*) malloc(_n*sizeof(unsigned char));
+    unsigned char * msg_enc  = (unsigned char*) malloc(n_enc*sizeof(unsigned char));
+    unsigned char * msg_soft = (unsigned char*) malloc(8*n_enc*sizeof(unsigned char));
+    unsigned char * msg_dec  = (unsigned char*) malloc(_n*sizeof(unsigned char));
+
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg[i] = rand() & 0xff;
+
+    fec_encode(q, _n, msg, msg_enc);
+    for (i=0; i<8*n_enc; i++)
+        msg_soft[i] = fec_viterbi_test_softbit((msg_enc[i/8] >> (7-(i%8))) & 1, _sigma);
+
+    fec_decode_soft(q, _n, msg_soft, msg_dec);
+    CONTEND_SAME_DATA(msg, msg_dec, _n);
+
+    free(msg);
+    free(msg_enc);
+    free(msg_soft);
+    free(msg_dec);
+    fec_destroy(q);
+}
+
+void autotest_fec_viterbi_v27_awgn()    { fec_viterbi_test_awgn(LIQUID_FEC_CONV_V27,    2000, 0.60f); }
+void autotest_fec_viterbi_v29_awgn()    { fec_viterbi_test_awgn(LIQUID_FEC_CONV_V29,    2000, 0.60f); }
+void autotest_fec_viterbi_v39_awgn()    { fec_viterbi_test_awgn(LIQUID_FEC_CONV_V39,    1000, 0.70f); }
+void autotest_fec_viterbi_v615_awgn()   { fec_viterbi_test_awgn(LIQUID_FEC_CONV_V615,    200, 1.00f); }
+void autotest_fec_viterbi_v27p34_awgn() { fec_viterbi_test_awgn(LIQUID_FEC_CONV_V27P34, 2000, 0.40f); }
+void autotest_fec_viterbi_v29p78_awgn() { fec_viterbi_test_awgn(LIQUID_FEC_CONV_V29P78, 2000, 0.30f); }
+
+// tail-biting encoding and decoding
+//  _R      :   inverse rate
+//  _K      :   constraint length
+//  _poly   :   generator polynomials
+//  _n      :   number of message bits
+//  _sigma  :   noise standard deviation
+void fec_viterbi_test_tailbiting(unsigned int _R,
+                                 unsigned int _K,
+                                 int *        _poly,
+                                 unsigned int _n,
+                                 float        _sigma)
+{
+    unsigned char msg[_n/8];
+    unsigned char msg_soft[_R*_n];
+    unsigned char msg_dec[_n/8];
+    unsigned int i;
+    unsigned int r;
+    for (i=0; i<_n/8; i++)
+        msg[i] = rand() & 0xff;
+
+    // encoder starts in the state given by the final K-1 message bits
+    unsigned int sr = 0;
+    for (i=_n-(_K-1); i<_n; i++)
+        sr = (sr << 1) | ((msg[i/8] >> (7-(i%8))) & 1);
+    for (i=0; i<_n; i++) {
+        sr = (sr << 1) | ((msg[i/8] >> (7-(i%8))) & 1);
+        for (r=0; r<_R; r++)
+            msg_soft[i*_R+r] = fec_viterbi_test_softbit(liquid_count_ones_mod2(sr & _poly[r]), _sigma);
+    }
+
+    void * vp = fec_viterbi_create(_R, _K, _poly, _n);
+    fec_viterbi_decode_tailbiting(vp, msg_soft, _n, msg_dec);
+    CONTEND_SAME_DATA(msg, msg_dec, _n/8);
+    fec_viterbi_delete(vp);
+}
+
+void autotest_fec_viterbi_v27_tailbiting_n64()   { fec_viterbi_test_tailbiting(2, 7, fec_conv27_poly,   64, 0.5f); }
+void autotest_fec_viterbi_v27_tailbiting_n1024() { fec_viterbi_test_tailbiting(2, 7, fec_conv27_poly, 1024, 0.5f); }
+void autotest_fec_viterbi_v29_tailbiting_n256()  { fec_viterbi_test_tailbiting(2, 9, fec_conv29_poly,  256, 0.5f); }
+
+// tail-biting frames through the fec interface
+//  _fs     :   convolutional scheme
+//  _n      :   decoded message length (bytes)
+//  _sigma  :   noise standard deviation
+void fec_viterbi_test_tailbiting_fec(fec_scheme   _fs,
+                                     unsigned int _n,
+                                     float        _sigma)
+{
+    fec_conv_opts_s opts = {1};
+    fec q = fec_create(_fs, &opts);
+
+    // no tail bits
+    unsigned int n_enc = fec_get_enc_msg_length_opts(_fs, &opts, _n);
+    CONTEND_EQUALITY(n_enc, (unsigned int)ceilf(_n / fec_get_rate(_fs) - 1e-3f));
+
+    unsigned char msg[_n];
+    unsigned char msg_enc[n_enc];
+    unsigned char msg_soft[8*n_enc];
+    unsigned char msg_dec[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg[i] = rand() & 0xff;
+
+    fec_encode(q, _n, msg, msg_enc);
+
+    // hard decision, no errors
+    fec_decode(q, _n, msg_enc, msg_dec);
+    CONTEND_SAME_DATA(msg, msg_dec, _n);
+
+    // soft decision over noisy channel
+    for (i=0; i<8*n_enc; i++)
+        msg_soft[i] = fec_viterbi_test_softbit((msg_enc[i/8] >> (7-(i%8))) & 1, _sigma);
+    fec_decode_soft(q, _n, msg_soft, msg_dec);
+    CONTEND_SAME_DATA(msg, msg_dec, _n);
+
+    fec_destroy(q);
+}
+
+void autotest_fec_viterbi_v27_tailbiting_fec()    { fec_viterbi_test_tailbiting_fec(LIQUID_FEC_CONV_V27,     64, 0.50f); }
+void autotest_fec_viterbi_v29_tailbiting_fec()    { fec_viterbi_test_tailbiting_fec(LIQUID_FEC_CONV_V29,     32, 0.50f); }
+void autotest_fec_viterbi_v615_tailbiting_fec()   { fec_viterbi_test_tailbiting_fec(LIQUID_FEC_CONV_V615,     1, 0.50f); }
+void autotest_fec_viterbi_v27p34_tailbiting_fec() { fec_viterbi_test_tailbiting_fec(LIQUID_FEC_CONV_V27P34, 100, 0.30f); }
+void autotest_fec_viterbi_v29p67_tailbiting_fec() { fec_viterbi_test_tailbiting_fec(LIQUID_FEC_CONV_V29P67,  42, 0.20f); }
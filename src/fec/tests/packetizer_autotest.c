@@ -64,4 +64,7 @@ void packetizer_test_codec(unsigned int _n,
 void autotest_packetizer_n16_0_0()  { packetizer_test_codec(16, LIQUID_CRC_32, LIQUID_FEC_NONE, LIQUID_FEC_NONE);       }
 void autotest_packetizer_n16_0_1()  { packetizer_test_codec(16, LIQUID_CRC_32, LIQUID_FEC_NONE, LIQUID_FEC_REP3);       }
 void autotest_packetizer_n16_0_2()  { packetizer_test_codec(16, LIQUID_CRC_32, LIQUID_FEC_NONE, LIQUID_FEC_HAMMING74);  }
+void autotest_packetizer_n16_0_3()  { packetizer_test_codec(16, LIQUID_CRC_32, LIQUID_FEC_NONE, LIQUID_FEC_LDPC_R12);  }
+void autotest_packetizer_n16_0_4()  { packetizer_test_codec(16, LIQUID_CRC_32, LIQUID_FEC_NONE, LIQUID_FEC_RS_M8);     }
+void autotest_packetizer_n16_4_5()  { packetizer_test_codec(16, LIQUID_CRC_32, LIQUID_FEC_RS_M8, LIQUID_FEC_CONV_V27); }
 
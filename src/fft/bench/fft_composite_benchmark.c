@@ -227,3 +227,10 @@ void benchmark_fft_252    LIQUID_FFT_BENCHMARK_API(   252, LIQUID_FFT_FORWARD)
 void benchmark_fft_253    LIQUID_FFT_BENCHMARK_API(   253, LIQUID_FFT_FORWARD)
 void benchmark_fft_254    LIQUID_FFT_BENCHMARK_API(   254, LIQUID_FFT_FORWARD)
 void benchmark_fft_255    LIQUID_FFT_BENCHMARK_API(   255, LIQUID_FFT_FORWARD)
+
+// plan creation
+void benchmark_fft_create_30   LIQUID_FFT_CREATE_BENCHMARK_API(    30, LIQUID_FFT_FORWARD)
+void benchmark_fft_create_72   LIQUID_FFT_CREATE_BENCHMARK_API(    72, LIQUID_FFT_FORWARD)
+void benchmark_fft_create_120  LIQUID_FFT_CREATE_BENCHMARK_API(   120, LIQUID_FFT_FORWARD)
+void benchmark_fft_create_240  LIQUID_FFT_CREATE_BENCHMARK_API(   240, LIQUID_FFT_FORWARD)
+void benchmark_fft_create_250  LIQUID_FFT_CREATE_BENCHMARK_API(   250, LIQUID_FFT_FORWARD)
@@ -129,3 +129,10 @@ void benchmark_fft_499    LIQUID_FFT_BENCHMARK_API(   499, LIQUID_FFT_FORWARD)
 void benchmark_fft_503    LIQUID_FFT_BENCHMARK_API(   503, LIQUID_FFT_FORWARD)
 void benchmark_fft_509    LIQUID_FFT_BENCHMARK_API(   509, LIQUID_FFT_FORWARD)
 
+// plan creation
+void benchmark_fft_create_17   LIQUID_FFT_CREATE_BENCHMARK_API(    17, LIQUID_FFT_FORWARD)
+void benchmark_fft_create_31   LIQUID_FFT_CREATE_BENCHMARK_API(    31, LIQUID_FFT_FORWARD)
+void benchmark_fft_create_67   LIQUID_FFT_CREATE_BENCHMARK_API(    67, LIQUID_FFT_FORWARD)
+void benchmark_fft_create_101  LIQUID_FFT_CREATE_BENCHMARK_API(   101, LIQUID_FFT_FORWARD)
+void benchmark_fft_create_251  LIQUID_FFT_CREATE_BENCHMARK_API(   251, LIQUID_FFT_FORWARD)
+void benchmark_fft_create_509  LIQUID_FFT_CREATE_BENCHMARK_API(   509, LIQUID_FFT_FORWARD)
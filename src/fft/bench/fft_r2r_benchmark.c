@@ -23,7 +23,8 @@
 //
 // fft_r2r_benchmark.h
 //
-// Real even/odd FFT benchmarks (discrete cosine/sine transforms)
+// Real even/odd FFT benchmarks (discrete cosine/sine transforms) and
+// real-input (half spectrum) FFT benchmarks
 //
 
 #include <sys/resource.h>
@@ -98,3 +99,59 @@ void benchmark_fft_RODFT01_127  LIQUID_FFT_R2R_BENCH_API(127,  LIQUID_FFT_RODFT0
 void benchmark_fft_RODFT10_127  LIQUID_FFT_R2R_BENCH_API(127,  LIQUID_FFT_RODFT10)
 void benchmark_fft_RODFT11_127  LIQUID_FFT_R2R_BENCH_API(127,  LIQUID_FFT_RODFT11)
 
+
+
+// real-to-complex/complex-to-real (half spectrum)
+
+#define LIQUID_FFT_R2C_BENCH_API(N,K)   \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ fft_r2c_bench(_start, _finish, _num_iterations, N, K); }
+
+// Helper function to keep code base small
+void fft_r2c_bench(struct rusage *_start,
+                   struct rusage *_finish,
+                   unsigned long int *_num_iterations,
+                   unsigned int _n,
+                   int _kind)
+{
+    // initialize arrays, plan
+    float x[_n];
+    float complex y[_n/2+1];
+    int _flags = 0;
+    fftplan p = (_kind == LIQUID_FFT_R2C) ? fft_create_plan_r2c(_n, x, y, _flags) :
+                                            fft_create_plan_c2r(_n, y, x, _flags);
+
+    unsigned long int i;
+
+    // initialize input with random values
+    for (i=0; i<_n; i++)
+        x[i] = randnf();
+    for (i=0; i<_n/2+1; i++)
+        y[i] = randnf() + _Complex_I*randnf();
+
+    // scale number of iterations to keep execution time
+    // relatively linear
+    *_num_iterations /= _n;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        fft_execute(p);
+        fft_execute(p);
+        fft_execute(p);
+        fft_execute(p);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    fft_destroy_plan(p);
+}
+
+void benchmark_fft_r2c_256      LIQUID_FFT_R2C_BENCH_API(256,   LIQUID_FFT_R2C)
+void benchmark_fft_r2c_1024     LIQUID_FFT_R2C_BENCH_API(1024,  LIQUID_FFT_R2C)
+void benchmark_fft_r2c_4096     LIQUID_FFT_R2C_BENCH_API(4096,  LIQUID_FFT_R2C)
+void benchmark_fft_c2r_256      LIQUID_FFT_R2C_BENCH_API(256,   LIQUID_FFT_C2R)
+void benchmark_fft_c2r_1024     LIQUID_FFT_R2C_BENCH_API(1024,  LIQUID_FFT_C2R)
+void benchmark_fft_c2r_4096     LIQUID_FFT_R2C_BENCH_API(4096,  LIQUID_FFT_C2R)
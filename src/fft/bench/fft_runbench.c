@@ -68,3 +68,36 @@ void fft_runbench(struct rusage *     _start,
     free(y);
 }
 
+// Helper function to benchmark plan creation; one plan of the same size
+// remains in use throughout, as with many objects sharing a transform size
+void fft_runbench_create(struct rusage *     _start,
+                         struct rusage *     _finish,
+                         unsigned long int * _num_iterations,
+                         unsigned int        _nfft,
+                         int                 _direction)
+{
+    // initialize arrays, resident plan
+    float complex * x = (float complex *) malloc(_nfft*sizeof(float complex));
+    float complex * y = (float complex *) malloc(_nfft*sizeof(float complex));
+    int _method = 0;
+    fftplan q = fft_create_plan(_nfft, x, y, _direction, _method);
+
+    unsigned long int i;
+
+    // scale number of iterations to keep execution time
+    // relatively linear
+    *_num_iterations /= 10*_nfft;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        fftplan p = fft_create_plan(_nfft, x, y, _direction, _method);
+        fft_destroy_plan(p);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    fft_destroy_plan(q);
+    free(x);
+    free(y);
+}
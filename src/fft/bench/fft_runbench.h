@@ -35,6 +35,12 @@
     unsigned long int *_num_iterations)     \
 { fft_runbench(_start, _finish, _num_iterations, NFFT, D); }
 
+#define LIQUID_FFT_CREATE_BENCHMARK_API(NFFT,D)    \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ fft_runbench_create(_start, _finish, _num_iterations, NFFT, D); }
+
 // Helper function to keep code base small
 void fft_runbench(struct rusage *     _start,
                   struct rusage *     _finish,
@@ -42,5 +48,12 @@ void fft_runbench(struct rusage *     _start,
                   unsigned int        _nfft,
                   int                 _direction);
 
+// Helper function to benchmark plan creation
+void fft_runbench_create(struct rusage *     _start,
+                         struct rusage *     _finish,
+                         unsigned long int * _num_iterations,
+                         unsigned int        _nfft,
+                         int                 _direction);
+
 #endif // __FFT_RUNBENCH_H__
 
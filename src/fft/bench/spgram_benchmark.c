@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// spgram_benchmark.c : benchmark spectral periodogram
+//
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+//  _nfft   :   transform size
+//  _real   :   use real-valued input (spgramf) rather than complex (spgramcf)
+//  _block  :   number of samples per write (0: push one sample at a time)
+void spgram_bench(struct rusage *     _start,
+                  struct rusage *     _finish,
+                  unsigned long int * _num_iterations,
+                  unsigned int        _nfft,
+                  int                 _real,
+                  unsigned int        _block)
+{
+    // number of input samples per trial
+    unsigned int n = _block > 0 ? _block : 256;
+
+    // adjust number of iterations
+    *_num_iterations /= 20;
+    *_num_iterations = *_num_iterations * 256 / n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // create objects: full window, transform every _nfft/4 samples
+    spgramf  qf = spgramf_create (_nfft, LIQUID_WINDOW_HANN, _nfft, _nfft/4);
+    spgramcf qc = spgramcf_create(_nfft, LIQUID_WINDOW_HANN, _nfft, _nfft/4);
+
+    // generate input vectors
+    unsigned long int i;
+    float *         xf = (float*)         malloc(n*sizeof(float));
+    float complex * xc = (float complex*) malloc(n*sizeof(float complex));
+    for (i=0; i<n; i++) {
+        xf[i] = randnf();
+        xc[i] = randnf() + _Complex_I*randnf();
+    }
+
+    // start trials
+    unsigned int k;
+    getrusage(RUSAGE_SELF, _start);
+    if (_block == 0 && _real) {
+        for (i=0; i<(*_num_iterations); i++) {
+            for (k=0; k<n; k++)
+                spgramf_push(qf, xf[k]);
+        }
+    } else if (_block == 0) {
+        for (i=0; i<(*_num_iterations); i++) {
+            for (k=0; k<n; k++)
+                spgramcf_push(qc, xc[k]);
+        }
+    } else if (_real) {
+        for (i=0; i<(*_num_iterations); i++)
+            spgramf_write(qf, xf, n);
+    } else {
+        for (i=0; i<(*_num_iterations); i++)
+            spgramcf_write(qc, xc, n);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    spgramf_destroy(qf);
+    spgramcf_destroy(qc);
+    free(xf);
+    free(xc);
+}
+
+#define SPGRAM_BENCHMARK_API(NFFT,REAL,BLOCK)   \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ spgram_bench(_start, _finish, _num_iterations, NFFT, REAL, BLOCK); }
+
+void benchmark_spgramcf_256     SPGRAM_BENCHMARK_API(256,   0,  256)
+void benchmark_spgramcf_1024    SPGRAM_BENCHMARK_API(1024,  0,  256)
+void benchmark_spgramf_256      SPGRAM_BENCHMARK_API(256,   1,  256)
+void benchmark_spgramf_1024     SPGRAM_BENCHMARK_API(1024,  1,  256)
+
+// throughput: large blocks vs. pushing one sample at a time
+void benchmark_spgramcf_1024_block4096  SPGRAM_BENCHMARK_API(1024, 0, 4096)
+void benchmark_spgramcf_1024_push       SPGRAM_BENCHMARK_API(1024, 0,    0)
+void benchmark_spgramf_1024_block4096   SPGRAM_BENCHMARK_API(1024, 1, 4096)
+void benchmark_spgramf_1024_push        SPGRAM_BENCHMARK_API(1024, 1,    0)
+
+// Welch estimate over a large buffer split across threads
+void spgram_welch_bench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        unsigned int        _num_threads)
+{
+    // adjust number of iterations
+    unsigned int n = 1 << 20;
+    *_num_iterations /= 20 * (n / 256);
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // generate input
+    unsigned long int i;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    for (i=0; i<n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+    float psd[1024];
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        spgramcf_estimate_psd_welch(1024, LIQUID_WINDOW_HANN, 1024, 256, x, n, _num_threads, psd);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    free(x);
+}
+
+#define SPGRAM_WELCH_BENCHMARK_API(NUM_THREADS) \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ spgram_welch_bench(_start, _finish, _num_iterations, NUM_THREADS); }
+
+void benchmark_spgramcf_welch_1024_t1   SPGRAM_WELCH_BENCHMARK_API(1)
+void benchmark_spgramcf_welch_1024_t4   SPGRAM_WELCH_BENCHMARK_API(4)
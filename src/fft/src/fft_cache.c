@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_cache.c : process-wide cache of read-only tables (twiddle factors,
+//               index sequences, pre-computed transforms) shared between
+//               plans of the same size, direction, and method
+//
+// Plans keep their own input/output pointers and scratch buffers, but
+// acquire their tables here; an entry is freed when the last plan which
+// references it is destroyed. Tables are computed outside the lock (which
+// may recursively create sub-plans) and inserted afterwards; if another
+// thread inserted an equivalent entry in the meantime, the new tables are
+// discarded in favor of the existing ones.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "liquid.internal.h"
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#  include <pthread.h>
+static pthread_mutex_t FFT(_cache_mutex) = PTHREAD_MUTEX_INITIALIZER;
+#  define FFT_CACHE_LOCK()      pthread_mutex_lock(&FFT(_cache_mutex))
+#  define FFT_CACHE_UNLOCK()    pthread_mutex_unlock(&FFT(_cache_mutex))
+#else
+#  define FFT_CACHE_LOCK()
+#  define FFT_CACHE_UNLOCK()
+#endif
+
+struct FFT(_cache_s) {
+    liquid_fft_method method;   // transform method
+    unsigned int nfft;          // transform size
+    int direction;              // transform direction
+    unsigned int num_refs;      // number of plans referencing tables
+
+    // shared read-only tables (NULL if not used by method)
+    TC * twiddle;               // twiddle factors
+    unsigned int * index;       // index sequence (bit reversal, permutation)
+    TC * R;                     // pre-computed transform (Rader)
+    DOTPROD() * dotprod;        // dot product objects (DFT) [size: nfft x 1]
+
+    struct FFT(_cache_s) * next;
+};
+
+// linked list of all cache entries
+static FFT(_cache) FFT(_cache_head) = NULL;
+
+// destroy cache entry, freeing all tables
+static void FFT(_cache_destroy)(FFT(_cache) _c)
+{
+    free(_c->twiddle);
+    free(_c->index);
+    free(_c->R);
+    if (_c->dotprod != NULL) {
+        unsigned int i;
+        for (i=0; i<_c->nfft; i++)
+            DOTPROD(_destroy)(_c->dotprod[i]);
+        free(_c->dotprod);
+    }
+    free(_c);
+}
+
+// acquire existing tables for transform, returning NULL if none exist
+FFT(_cache) FFT(_cache_acquire)(liquid_fft_method _method,
+                                unsigned int      _nfft,
+                                int               _dir)
+{
+    FFT_CACHE_LOCK();
+    FFT(_cache) c;
+    for (c=FFT(_cache_head); c!=NULL; c=c->next) {
+        if (c->method == _method && c->nfft == _nfft && c->direction == _dir) {
+            c->num_refs++;
+            break;
+        }
+    }
+    FFT_CACHE_UNLOCK();
+    return c;
+}
+
+// create new (unshared) entry with empty tables, to be populated by the
+// caller before inserting
+FFT(_cache) FFT(_cache_create)(liquid_fft_method _method,
+                               unsigned int      _nfft,
+                               int               _dir)
+{
+    FFT(_cache) c = (FFT(_cache)) malloc(sizeof(struct FFT(_cache_s)));
+    c->method    = _method;
+    c->nfft      = _nfft;
+    c->direction = _dir;
+    c->num_refs  = 1;
+    c->twiddle   = NULL;
+    c->index     = NULL;
+    c->R         = NULL;
+    c->dotprod   = NULL;
+    c->next      = NULL;
+    return c;
+}
+
+// insert populated entry into cache and acquire it; if an equivalent
+// entry already exists, the new entry is destroyed and the existing one
+// is returned instead
+FFT(_cache) FFT(_cache_insert)(FFT(_cache) _c)
+{
+    FFT_CACHE_LOCK();
+    FFT(_cache) c;
+    for (c=FFT(_cache_head); c!=NULL; c=c->next) {
+        if (c->method == _c->method && c->nfft == _c->nfft && c->direction == _c->direction) {
+            c->num_refs++;
+            break;
+        }
+    }
+    if (c == NULL) {
+        // add new entry to head of list
+        _c->next = FFT(_cache_head);
+        FFT(_cache_head) = _c;
+    }
+    FFT_CACHE_UNLOCK();
+
+    if (c == NULL)
+        return _c;
+
+    FFT(_cache_destroy)(_c);
+    return c;
+}
+
+// release tables, destroying entry when no plans reference it
+void FFT(_cache_release)(FFT(_cache) _c)
+{
+    FFT_CACHE_LOCK();
+    _c->num_refs--;
+    int remove = (_c->num_refs == 0);
+    if (remove) {
+        // unlink entry from list
+        FFT(_cache) * p = &FFT(_cache_head);
+        while (*p != _c)
+            p = &(*p)->next;
+        *p = _c->next;
+    }
+    FFT_CACHE_UNLOCK();
+
+    if (remove)
+        FFT(_cache_destroy)(_c);
+}
+
+// get number of entries in cache
+unsigned int FFT(_cache_get_num_entries)(void)
+{
+    FFT_CACHE_LOCK();
+    unsigned int n = 0;
+    FFT(_cache) c;
+    for (c=FFT(_cache_head); c!=NULL; c=c->next)
+        n++;
+    FFT_CACHE_UNLOCK();
+    return n;
+}
+
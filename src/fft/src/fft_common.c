@@ -42,6 +42,9 @@ struct FFT(plan_s)
     // 'execute' function pointer
     FFT(_execute_t) * execute;
 
+    // shared read-only tables (see fft_cache.c)
+    FFT(_cache) cache;
+
     // real even/odd DFT parameters (DCT/DST)
     T * xr; // input array (real)
     T * yr; // output array (real)
@@ -61,6 +64,15 @@ struct FFT(plan_s)
             TC * twiddle;               // twiddle factors
         } radix2;
 
+        // radix-4 transform data
+        struct {
+            unsigned int m;             // log2(nfft)
+            unsigned int num_stages;    // number of stages: ceil(m/2)
+            TC * t;                     // scratch buffer
+            TC * twiddle;               // twiddle factors (all stages)
+            liquid_simd_type simd;      // butterfly kernels
+        } radix4;
+
         // recursive mixed-radix transform data:
         //  - compute 'Q' FFTs of size 'P'
         //  - apply twiddle factors
@@ -97,6 +109,16 @@ struct FFT(plan_s)
             FFT(plan) fft;      // sub-FFT of size nfft_prime
             FFT(plan) ifft;     // sub-IFFT of size nfft_prime
         } rader2;
+
+        // real-input transforms: the even/odd samples of a real sequence
+        // of even length are packed into a half-length complex sequence;
+        // odd lengths are promoted to a full-length complex transform
+        struct {
+            TC * x;             // sub-transform input buffer
+            TC * X;             // sub-transform output buffer
+            TC * twiddle;       // exp(-/+j*2*pi*k/nfft), k in [0,nfft/2)
+            FFT(plan) fft;      // complex sub-transform
+        } r2c;
     } data;
 };
 
@@ -112,9 +134,15 @@ FFT(plan) FFT(_create_plan)(unsigned int _nfft,
                             int          _dir,
                             int          _flags)
 {
-    // determine best method for execution
-    // TODO : check flags and allow user override
-    liquid_fft_method method = liquid_fft_estimate_method(_nfft);
+    // determine best method for execution: use wisdom if available,
+    // measuring methods first if requested, otherwise estimate
+    liquid_fft_method method = liquid_fft_wisdom_lookup(_nfft);
+    if (method == LIQUID_FFT_METHOD_UNKNOWN && (_flags & LIQUID_FFT_MEASURE)) {
+        liquid_fft_wisdom_measure(_nfft);
+        method = liquid_fft_wisdom_lookup(_nfft);
+    }
+    if (method == LIQUID_FFT_METHOD_UNKNOWN)
+        method = liquid_fft_estimate_method(_nfft);
 
     // initialize fft based on method
     switch (method) {
@@ -122,6 +150,10 @@ FFT(plan) FFT(_create_plan)(unsigned int _nfft,
         // use radix-2 decimation-in-time method
         return FFT(_create_plan_radix2)(_nfft, _x, _y, _dir, _flags);
 
+    case LIQUID_FFT_METHOD_RADIX4:
+        // use radix-4 Stockham method
+        return FFT(_create_plan_radix4)(_nfft, _x, _y, _dir, _flags);
+
     case LIQUID_FFT_METHOD_MIXED_RADIX:
         // use Cooley-Tukey mixed-radix algorithm
         return FFT(_create_plan_mixed_radix)(_nfft, _x, _y, _dir, _flags);
@@ -157,6 +189,7 @@ void FFT(_destroy_plan)(FFT(plan) _q)
         switch (_q->method) {
         case LIQUID_FFT_METHOD_DFT:         FFT(_destroy_plan_dft)(_q);         return;
         case LIQUID_FFT_METHOD_RADIX2:      FFT(_destroy_plan_radix2)(_q);      return;
+        case LIQUID_FFT_METHOD_RADIX4:      FFT(_destroy_plan_radix4)(_q);      return;
         case LIQUID_FFT_METHOD_MIXED_RADIX: FFT(_destroy_plan_mixed_radix)(_q); return;
         case LIQUID_FFT_METHOD_RADER:       FFT(_destroy_plan_rader)(_q);       return;
         case LIQUID_FFT_METHOD_RADER2:      FFT(_destroy_plan_rader2)(_q);      return;
@@ -183,6 +216,12 @@ void FFT(_destroy_plan)(FFT(plan) _q)
     case LIQUID_FFT_MDCT:   break;
     case LIQUID_FFT_IMDCT:  break;
 
+    // real-input transforms
+    case LIQUID_FFT_R2C:
+    case LIQUID_FFT_C2R:
+        FFT(_destroy_plan_r2c_1d)(_q);
+        break;
+
     case LIQUID_FFT_UNKNOWN:
     default:
         fprintf(stderr,"error: fft_destroy_plan(), unknown/invalid fft type\n");
@@ -203,6 +242,7 @@ void FFT(_print_plan)(FFT(plan) _q)
         switch (_q->method) {
         case LIQUID_FFT_METHOD_DFT:         printf("DFT\n");                break;
         case LIQUID_FFT_METHOD_RADIX2:      printf("Radix-2\n");            break;
+        case LIQUID_FFT_METHOD_RADIX4:      printf("Radix-4\n");            break;
         case LIQUID_FFT_METHOD_MIXED_RADIX: printf("Cooley-Tukey\n");       break;
         case LIQUID_FFT_METHOD_RADER:       printf("Rader (Type I)\n");     break;
         case LIQUID_FFT_METHOD_RADER2:      printf("Rader (Type II)\n");    break;
@@ -231,6 +271,12 @@ void FFT(_print_plan)(FFT(plan) _q)
     case LIQUID_FFT_MDCT:   break;
     case LIQUID_FFT_IMDCT:  break;
 
+    // real-input transforms
+    case LIQUID_FFT_R2C:
+    case LIQUID_FFT_C2R:
+        FFT(_print_plan_r2c_1d)(_q);
+        break;
+
     case LIQUID_FFT_UNKNOWN:
     default:
         fprintf(stderr,"error: fft_print_plan(), unknown/invalid fft type\n");
@@ -257,6 +303,10 @@ void FFT(_print_plan_recursive)(FFT(plan)    _q,
         printf("Radix-2\n");
         break;
 
+    case LIQUID_FFT_METHOD_RADIX4:
+        printf("Radix-4, %s\n", liquid_simd_type_str[_q->data.radix4.simd][1]);
+        break;
+
     case LIQUID_FFT_METHOD_MIXED_RADIX:
         // two internal transforms
         printf("Cooley-Tukey mixed radix, Q=%u, P=%u\n",
@@ -52,6 +52,7 @@ FFT(plan) FFT(_create_plan_dft)(unsigned int _nfft,
     q->direction = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
     q->method    = LIQUID_FFT_METHOD_DFT;
         
+    q->cache            = NULL;
     q->data.dft.twiddle = NULL;
     q->data.dft.dotprod = NULL;
 
@@ -67,33 +68,43 @@ FFT(plan) FFT(_create_plan_dft)(unsigned int _nfft,
     else {
         q->execute = FFT(_execute_dft);
 
-        // initialize twiddle factors
-        q->data.dft.twiddle = (TC *) malloc(q->nfft * sizeof(TC));
+        // acquire shared dotprod objects, creating them if necessary
+        q->cache = FFT(_cache_acquire)(q->method, q->nfft, q->direction);
+        if (q->cache == NULL) {
+            FFT(_cache) c = FFT(_cache_create)(q->method, q->nfft, q->direction);
 
-        // create dotprod objects
-        q->data.dft.dotprod = (DOTPROD()*) malloc(q->nfft * sizeof(DOTPROD()));
-        
-        // create dotprod objects
-        // twiddles: exp(-j*2*pi*W/n), W=
-        //  0   0   0   0   0...
-        //  0   1   2   3   4...
-        //  0   2   4   6   8...
-        //  0   3   6   9   12...
-        //  ...
-        // Note that first row/column is zero, no multiplication necessary.
-        // Create dotprod for first row anyway because it's still faster...
-        unsigned int i;
-        unsigned int k;
-        T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
-        for (i=0; i<q->nfft; i++) {
             // initialize twiddle factors
-            // NOTE: no need to compute first twiddle because exp(-j*2*pi*0) = 1
-            for (k=1; k<q->nfft; k++)
-                q->data.dft.twiddle[k-1] = cexpf(_Complex_I*d*2*M_PI*(T)(k*i) / (T)(q->nfft));
+            c->twiddle = (TC *) malloc(q->nfft * sizeof(TC));
 
-            // create dotprod object
-            q->data.dft.dotprod[i] = DOTPROD(_create)(q->data.dft.twiddle, q->nfft-1);
+            // create dotprod objects
+            c->dotprod = (DOTPROD()*) malloc(q->nfft * sizeof(DOTPROD()));
+        
+            // create dotprod objects
+            // twiddles: exp(-j*2*pi*W/n), W=
+            //  0   0   0   0   0...
+            //  0   1   2   3   4...
+            //  0   2   4   6   8...
+            //  0   3   6   9   12...
+            //  ...
+            // Note that first row/column is zero, no multiplication necessary.
+            // Create dotprod for first row anyway because it's still faster...
+            unsigned int i;
+            unsigned int k;
+            T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+            for (i=0; i<q->nfft; i++) {
+                // initialize twiddle factors
+                // NOTE: no need to compute first twiddle because exp(-j*2*pi*0) = 1
+                for (k=1; k<q->nfft; k++)
+                    c->twiddle[k-1] = cexpf(_Complex_I*d*2*M_PI*(T)(k*i) / (T)(q->nfft));
+
+                // create dotprod object
+                c->dotprod[i] = DOTPROD(_create)(c->twiddle, q->nfft-1);
+            }
+
+            q->cache = FFT(_cache_insert)(c);
         }
+        q->data.dft.twiddle = q->cache->twiddle;
+        q->data.dft.dotprod = q->cache->dotprod;
     }
 
     return q;
@@ -102,19 +113,9 @@ FFT(plan) FFT(_create_plan_dft)(unsigned int _nfft,
 // destroy FFT plan
 void FFT(_destroy_plan_dft)(FFT(plan) _q)
 {
-    // free twiddle factors
-    if (_q->data.dft.twiddle != NULL)
-        free(_q->data.dft.twiddle);
-
-    // free dotprod objects
-    if (_q->data.dft.dotprod != NULL) {
-        unsigned int i;
-        for (i=0; i<_q->nfft; i++)
-            DOTPROD(_destroy)(_q->data.dft.dotprod[i]);
-
-        // free dotprod array
-        free(_q->data.dft.dotprod);
-    }
+    // release shared twiddle factors and dotprod objects
+    if (_q->cache != NULL)
+        FFT(_cache_release)(_q->cache);
 
     // free main object memory
     free(_q);
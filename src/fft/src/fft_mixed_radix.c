@@ -96,13 +96,21 @@ FFT(plan) FFT(_create_plan_mixed_radix)(unsigned int _nfft,
                                                  q->direction,
                                                  q->flags);
 
-    // initialize twiddle factors, indices for mixed-radix transforms
+    // initialize twiddle factors, indices for mixed-radix transforms,
+    // acquiring shared tables if they exist
     // TODO : only allocate necessary twiddle factors
-    q->data.mixedradix.twiddle = (TC *) malloc(q->nfft * sizeof(TC));
+    q->cache = FFT(_cache_acquire)(q->method, q->nfft, q->direction);
+    if (q->cache == NULL) {
+        FFT(_cache) c = FFT(_cache_create)(q->method, q->nfft, q->direction);
+        c->twiddle = (TC *) malloc(q->nfft * sizeof(TC));
     
-    T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
-    for (i=0; i<q->nfft; i++)
-        q->data.mixedradix.twiddle[i] = cexpf(_Complex_I*d*2*M_PI*(T)i / (T)(q->nfft));
+        T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+        for (i=0; i<q->nfft; i++)
+            c->twiddle[i] = cexpf(_Complex_I*d*2*M_PI*(T)i / (T)(q->nfft));
+
+        q->cache = FFT(_cache_insert)(c);
+    }
+    q->data.mixedradix.twiddle = q->cache->twiddle;
 
     return q;
 }
@@ -118,7 +126,9 @@ void FFT(_destroy_plan_mixed_radix)(FFT(plan) _q)
     free(_q->data.mixedradix.t0);
     free(_q->data.mixedradix.t1);
     free(_q->data.mixedradix.x);
-    free(_q->data.mixedradix.twiddle);
+
+    // release shared twiddle factors
+    FFT(_cache_release)(_q->cache);
 
     // free main object memory
     free(_q);
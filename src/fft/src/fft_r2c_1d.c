@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_r2c_1d.c : real-input transforms (half spectrum)
+//
+// For even nfft = 2M, the real sequence x is viewed as the complex
+// sequence z[k] = x[2k] + j*x[2k+1] of length M, whose transform Z gives
+// the transforms of the even and odd samples
+//
+//   E[k] = ( Z[k] + conj(Z[M-k]) ) / 2
+//   O[k] = ( Z[k] - conj(Z[M-k]) ) / 2j
+//
+// which combine as X[k] = E[k] + exp(-j*2*pi*k/nfft) O[k], k in [0,M].
+// The inverse runs the same steps backwards. Odd lengths are computed
+// with a full-length complex transform.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "liquid.internal.h"
+
+// SSE3 post-processing is available only if the baseline architecture
+// flags (e.g. -msse3, -msse4.1) enable it
+#if HAVE_PMMINTRIN_H && defined(__SSE3__)
+#  include <pmmintrin.h>
+#  define FFT_R2C_SSE 1
+#else
+#  define FFT_R2C_SSE 0
+#endif
+
+// create real-input plan (common to both directions)
+//  _nfft   :   FFT size
+//  _type   :   LIQUID_FFT_R2C or LIQUID_FFT_C2R
+//  _flags  :   fft flags
+FFT(plan) FFT(_create_plan_r2c_1d)(unsigned int _nfft,
+                                   int          _type,
+                                   int          _flags)
+{
+    // validate input
+    if (_nfft == 0) {
+        fprintf(stderr,"error: fft_create_plan_%s(), fft size must be > 0\n",
+                _type == LIQUID_FFT_R2C ? "r2c" : "c2r");
+        exit(1);
+    }
+
+    // allocate plan and initialize all internal arrays to NULL
+    FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
+
+    q->nfft      = _nfft;
+    q->x         = NULL;
+    q->y         = NULL;
+    q->xr        = NULL;
+    q->yr        = NULL;
+    q->type      = _type;
+    q->flags     = _flags;
+    q->direction = (_type == LIQUID_FFT_R2C) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->method    = LIQUID_FFT_METHOD_UNKNOWN;
+    q->cache     = NULL;
+    q->execute   = (_type == LIQUID_FFT_R2C) ? FFT(_execute_r2c) : FFT(_execute_c2r);
+
+    q->data.r2c.x       = NULL;
+    q->data.r2c.X       = NULL;
+    q->data.r2c.twiddle = NULL;
+    q->data.r2c.fft     = NULL;
+
+    return q;
+}
+
+// create real-to-complex transform
+//  _nfft   :   FFT size
+//  _x      :   input array [size: _nfft x 1]
+//  _y      :   output array [size: _nfft/2+1 x 1]
+//  _flags  :   fft flags
+FFT(plan) FFT(_create_plan_r2c)(unsigned int _nfft,
+                                T *          _x,
+                                TC *         _y,
+                                int          _flags)
+{
+    FFT(plan) q = FFT(_create_plan_r2c_1d)(_nfft, LIQUID_FFT_R2C, _flags);
+    q->xr = _x;
+    q->y  = _y;
+
+    unsigned int i;
+    if (q->nfft % 2) {
+        // odd length: promote to complex
+        q->data.r2c.x   = (TC*) malloc(q->nfft*sizeof(TC));
+        q->data.r2c.X   = (TC*) malloc(q->nfft*sizeof(TC));
+        q->data.r2c.fft = FFT(_create_plan)(q->nfft, q->data.r2c.x, q->data.r2c.X,
+                                            LIQUID_FFT_FORWARD, q->flags);
+    } else {
+        // even length: transform input in place as complex sequence of
+        // half the length (sub-transforms never write to their input)
+        unsigned int M = q->nfft / 2;
+        q->data.r2c.X   = (TC*) malloc(M*sizeof(TC));
+        q->data.r2c.fft = FFT(_create_plan)(M, (TC*)_x, q->data.r2c.X,
+                                            LIQUID_FFT_FORWARD, q->flags);
+        q->data.r2c.twiddle = (TC*) malloc(M*sizeof(TC));
+        for (i=0; i<M; i++)
+            q->data.r2c.twiddle[i] = cexpf(-_Complex_I*2*M_PI*(T)i / (T)(q->nfft));
+    }
+    return q;
+}
+
+// create complex-to-real transform
+//  _nfft   :   FFT size
+//  _x      :   input array [size: _nfft/2+1 x 1]
+//  _y      :   output array [size: _nfft x 1]
+//  _flags  :   fft flags
+FFT(plan) FFT(_create_plan_c2r)(unsigned int _nfft,
+                                TC *         _x,
+                                T *          _y,
+                                int          _flags)
+{
+    FFT(plan) q = FFT(_create_plan_r2c_1d)(_nfft, LIQUID_FFT_C2R, _flags);
+    q->x  = _x;
+    q->yr = _y;
+
+    unsigned int i;
+    if (q->nfft % 2) {
+        // odd length: extend to full conjugate-symmetric spectrum
+        q->data.r2c.x   = (TC*) malloc(q->nfft*sizeof(TC));
+        q->data.r2c.X   = (TC*) malloc(q->nfft*sizeof(TC));
+        q->data.r2c.fft = FFT(_create_plan)(q->nfft, q->data.r2c.x, q->data.r2c.X,
+                                            LIQUID_FFT_BACKWARD, q->flags);
+    } else {
+        // even length: output written directly as complex sequence of
+        // half the length
+        unsigned int M = q->nfft / 2;
+        q->data.r2c.x   = (TC*) malloc(M*sizeof(TC));
+        q->data.r2c.fft = FFT(_create_plan)(M, q->data.r2c.x, (TC*)_y,
+                                            LIQUID_FFT_BACKWARD, q->flags);
+        q->data.r2c.twiddle = (TC*) malloc(M*sizeof(TC));
+        for (i=0; i<M; i++)
+            q->data.r2c.twiddle[i] = cexpf(_Complex_I*2*M_PI*(T)i / (T)(q->nfft));
+    }
+    return q;
+}
+
+// destroy real-input transform plan
+void FFT(_destroy_plan_r2c_1d)(FFT(plan) _q)
+{
+    FFT(_destroy_plan)(_q->data.r2c.fft);
+    free(_q->data.r2c.x);
+    free(_q->data.r2c.X);
+    free(_q->data.r2c.twiddle);
+
+    // free main object memory
+    free(_q);
+}
+
+// print real-input transform plan
+void FFT(_print_plan_r2c_1d)(FFT(plan) _q)
+{
+    printf("fft plan [%s], n=%u\n",
+            _q->type == LIQUID_FFT_R2C ? "real-to-complex" : "complex-to-real",
+            _q->nfft);
+    FFT(_print_plan_recursive)(_q->data.r2c.fft, 1);
+}
+
+// execute real-to-complex transform
+void FFT(_execute_r2c)(FFT(plan) _q)
+{
+    unsigned int i;
+    if (_q->nfft % 2) {
+        for (i=0; i<_q->nfft; i++)
+            _q->data.r2c.x[i] = _q->xr[i];
+        FFT(_execute)(_q->data.r2c.fft);
+        for (i=0; i<=_q->nfft/2; i++)
+            _q->y[i] = _q->data.r2c.X[i];
+        return;
+    }
+
+    // transform packed sequence
+    FFT(_execute)(_q->data.r2c.fft);
+
+    // separate even/odd transforms and combine; bins k and M-k share
+    // inputs and (conjugate) twiddle factors so are computed together:
+    //   e = (Z[k] + conj(Z[M-k]))/2, o = (Z[k] - conj(Z[M-k]))/2, p = w^k o
+    //   X[k]   = e - j*p
+    //   X[M-k] = conj(e + j*p)
+    unsigned int M = _q->nfft / 2;
+    T * Z = (T*) _q->data.r2c.X;
+    T * w = (T*) _q->data.r2c.twiddle;
+    T * y = (T*) _q->y;
+    y[0]     = Z[0] + Z[1];
+    y[1]     = 0;
+    y[2*M  ] = Z[0] - Z[1];
+    y[2*M+1] = 0;
+
+    unsigned int k = 1;
+#if FFT_R2C_SSE
+    __m128 conj_mask = _mm_setr_ps(0.0f,-0.0f, 0.0f,-0.0f);
+    __m128 real_mask = _mm_setr_ps(-0.0f,0.0f,-0.0f, 0.0f);
+    __m128 half      = _mm_set1_ps(0.5f);
+    for ( ; 2*k+2 <= M; k+=2) {
+        __m128 a  = _mm_loadu_ps(&Z[2*k]);
+        __m128 b  = _mm_loadu_ps(&Z[2*(M-k-1)]);
+        __m128 cb = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1,0,3,2)), conj_mask);
+        __m128 e  = _mm_mul_ps(half, _mm_add_ps(a, cb));
+        __m128 o  = _mm_mul_ps(half, _mm_sub_ps(a, cb));
+        __m128 wk = _mm_loadu_ps(&w[2*k]);
+        __m128 pk = _mm_addsub_ps(_mm_mul_ps(o, _mm_moveldup_ps(wk)),
+                                  _mm_mul_ps(_mm_shuffle_ps(o, o, _MM_SHUFFLE(2,3,0,1)), _mm_movehdup_ps(wk)));
+        __m128 ps = _mm_shuffle_ps(pk, pk, _MM_SHUFFLE(2,3,0,1));
+        __m128 y0 = _mm_add_ps(e, _mm_xor_ps(ps, conj_mask));
+        __m128 y1 = _mm_xor_ps(_mm_add_ps(e, _mm_xor_ps(ps, real_mask)), conj_mask);
+        _mm_storeu_ps(&y[2*k],         y0);
+        _mm_storeu_ps(&y[2*(M-k-1)],   _mm_shuffle_ps(y1, y1, _MM_SHUFFLE(1,0,3,2)));
+    }
+#endif
+    for ( ; 2*k <= M; k++) {
+        T er = 0.5f*(Z[2*k  ] + Z[2*(M-k)  ]);
+        T ei = 0.5f*(Z[2*k+1] - Z[2*(M-k)+1]);
+        T or = 0.5f*(Z[2*k  ] - Z[2*(M-k)  ]);
+        T oi = 0.5f*(Z[2*k+1] + Z[2*(M-k)+1]);
+        T pr = w[2*k]*or - w[2*k+1]*oi;
+        T pi = w[2*k]*oi + w[2*k+1]*or;
+        y[2*k      ] =  er + pi;
+        y[2*k+1    ] =  ei - pr;
+        y[2*(M-k)  ] =  er - pi;
+        y[2*(M-k)+1] = -ei - pr;
+    }
+}
+
+// execute complex-to-real transform
+void FFT(_execute_c2r)(FFT(plan) _q)
+{
+    unsigned int i;
+    if (_q->nfft % 2) {
+        unsigned int n = _q->nfft;
+        for (i=0; i<=n/2; i++)
+            _q->data.r2c.x[i] = _q->x[i];
+        for (i=n/2+1; i<n; i++)
+            _q->data.r2c.x[i] = conjf(_q->x[n-i]);
+        FFT(_execute)(_q->data.r2c.fft);
+        for (i=0; i<n; i++)
+            _q->yr[i] = crealf(_q->data.r2c.X[i]);
+        return;
+    }
+
+    // recover packed transform, again computing bins k and M-k together:
+    //   e = X[k] + conj(X[M-k]), o = w^-k (X[k] - conj(X[M-k]))
+    //   Z[k]   = e + j*o
+    //   Z[M-k] = conj(e - j*o)
+    unsigned int M = _q->nfft / 2;
+    T * X = (T*) _q->x;
+    T * w = (T*) _q->data.r2c.twiddle;
+    T * Z = (T*) _q->data.r2c.x;
+    Z[0] = (X[0] + X[2*M]) - (X[1] + X[2*M+1]);
+    Z[1] = (X[0] - X[2*M]) + (X[1] - X[2*M+1]);
+
+    unsigned int k = 1;
+#if FFT_R2C_SSE
+    __m128 conj_mask = _mm_setr_ps(0.0f,-0.0f, 0.0f,-0.0f);
+    __m128 real_mask = _mm_setr_ps(-0.0f,0.0f,-0.0f, 0.0f);
+    for ( ; 2*k+2 <= M; k+=2) {
+        __m128 a  = _mm_loadu_ps(&X[2*k]);
+        __m128 b  = _mm_loadu_ps(&X[2*(M-k-1)]);
+        __m128 cb = _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1,0,3,2)), conj_mask);
+        __m128 e  = _mm_add_ps(a, cb);
+        __m128 d  = _mm_sub_ps(a, cb);
+        __m128 wk = _mm_loadu_ps(&w[2*k]);
+        __m128 o  = _mm_addsub_ps(_mm_mul_ps(d, _mm_moveldup_ps(wk)),
+                                  _mm_mul_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2,3,0,1)), _mm_movehdup_ps(wk)));
+        __m128 jo = _mm_xor_ps(_mm_shuffle_ps(o, o, _MM_SHUFFLE(2,3,0,1)), real_mask);
+        __m128 z0 = _mm_add_ps(e, jo);
+        __m128 z1 = _mm_xor_ps(_mm_sub_ps(e, jo), conj_mask);
+        _mm_storeu_ps(&Z[2*k],         z0);
+        _mm_storeu_ps(&Z[2*(M-k-1)],   _mm_shuffle_ps(z1, z1, _MM_SHUFFLE(1,0,3,2)));
+    }
+#endif
+    for ( ; 2*k <= M; k++) {
+        T er = X[2*k  ] + X[2*(M-k)  ];
+        T ei = X[2*k+1] - X[2*(M-k)+1];
+        T dr = X[2*k  ] - X[2*(M-k)  ];
+        T di = X[2*k+1] + X[2*(M-k)+1];
+        T or = w[2*k]*dr - w[2*k+1]*di;
+        T oi = w[2*k]*di + w[2*k+1]*dr;
+        Z[2*k      ] =  er - oi;
+        Z[2*k+1    ] =  ei + or;
+        Z[2*(M-k)  ] =  er + oi;
+        Z[2*(M-k)+1] = -ei + or;
+    }
+
+    // inverse transform directly into output as packed sequence
+    FFT(_execute)(_q->data.r2c.fft);
+}
@@ -81,26 +81,36 @@ FFT(plan) FFT(_create_plan_rader)(unsigned int _nfft,
                                            LIQUID_FFT_BACKWARD,
                                            q->flags);
 
-    // compute primitive root of nfft
-    unsigned int g = liquid_primitive_root_prime(q->nfft);
-
-    // create and initialize sequence
-    q->data.rader.seq = (unsigned int *)malloc((q->nfft-1)*sizeof(unsigned int));
-    unsigned int i;
-    for (i=0; i<q->nfft-1; i++)
-        q->data.rader.seq[i] = liquid_modpow(g, i+1, q->nfft);
+    // acquire shared sequence and transform, computing them if necessary
+    q->cache = FFT(_cache_acquire)(q->method, q->nfft, q->direction);
+    if (q->cache == NULL) {
+        FFT(_cache) c = FFT(_cache_create)(q->method, q->nfft, q->direction);
+
+        // compute primitive root of nfft
+        unsigned int g = liquid_primitive_root_prime(q->nfft);
+
+        // create and initialize sequence
+        c->index = (unsigned int *)malloc((q->nfft-1)*sizeof(unsigned int));
+        unsigned int i;
+        for (i=0; i<q->nfft-1; i++)
+            c->index[i] = liquid_modpow(g, i+1, q->nfft);
     
-    // compute DFT of sequence { exp(-j*2*pi*g^i/nfft }, size: nfft-1
-    // NOTE: R[0] = -1, |R[k]| = sqrt(nfft) for k != 0
-    // (use newly-created FFT plan of length nfft-1)
-    T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
-    for (i=0; i<q->nfft-1; i++)
-        q->data.rader.x_prime[i] = cexpf(_Complex_I*d*2*M_PI*q->data.rader.seq[i]/(T)(q->nfft));
-    FFT(_execute)(q->data.rader.fft);
-
-    // copy result to R
-    q->data.rader.R = (TC*)malloc((q->nfft-1)*sizeof(TC));
-    memmove(q->data.rader.R, q->data.rader.X_prime, (q->nfft-1)*sizeof(TC));
+        // compute DFT of sequence { exp(-j*2*pi*g^i/nfft }, size: nfft-1
+        // NOTE: R[0] = -1, |R[k]| = sqrt(nfft) for k != 0
+        // (use newly-created FFT plan of length nfft-1)
+        T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+        for (i=0; i<q->nfft-1; i++)
+            q->data.rader.x_prime[i] = cexpf(_Complex_I*d*2*M_PI*c->index[i]/(T)(q->nfft));
+        FFT(_execute)(q->data.rader.fft);
+
+        // copy result to R
+        c->R = (TC*)malloc((q->nfft-1)*sizeof(TC));
+        memmove(c->R, q->data.rader.X_prime, (q->nfft-1)*sizeof(TC));
+
+        q->cache = FFT(_cache_insert)(c);
+    }
+    q->data.rader.seq = q->cache->index;
+    q->data.rader.R   = q->cache->R;
     
     // return main object
     return q;
@@ -109,9 +119,10 @@ FFT(plan) FFT(_create_plan_rader)(unsigned int _nfft,
 // destroy FFT plan
 void FFT(_destroy_plan_rader)(FFT(plan) _q)
 {
+    // release shared sequence and pre-computed transform of exp(j*2*pi*seq)
+    FFT(_cache_release)(_q->cache);
+
     // free data specific to Rader's algorithm
-    free(_q->data.rader.seq);       // sequence
-    free(_q->data.rader.R);         // pre-computed transform of exp(j*2*pi*seq)
     free(_q->data.rader.x_prime);   // sub-transform input array
     free(_q->data.rader.X_prime);   // sub-transform output array
 
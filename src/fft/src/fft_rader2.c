@@ -64,14 +64,6 @@ FFT(plan) FFT(_create_plan_rader2)(unsigned int _nfft,
 
     unsigned int i;
 
-    // compute primitive root of nfft
-    unsigned int g = liquid_primitive_root_prime(q->nfft);
-
-    // create and initialize sequence
-    q->data.rader2.seq = (unsigned int *)malloc((q->nfft-1)*sizeof(unsigned int));
-    for (i=0; i<q->nfft-1; i++)
-        q->data.rader2.seq[i] = liquid_modpow(g, i+1, q->nfft);
-
 #if 0
     // compute larger FFT length greater than 2*nfft-4
     // NOTE: while any length greater than 2*nfft-4 will work, use
@@ -146,17 +138,35 @@ FFT(plan) FFT(_create_plan_rader2)(unsigned int _nfft,
                                             LIQUID_FFT_BACKWARD,
                                             q->flags);
 
-    // compute DFT of sequence { exp(-j*2*pi*g^i/nfft }, size: nfft_prime
-    // NOTE: R[0] = -1, |R[k]| = sqrt(nfft) for k != 0
-    // (use newly-created FFT plan of length nfft_prime)
-    T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
-    for (i=0; i<q->data.rader2.nfft_prime; i++)
-        q->data.rader2.x_prime[i] = cexpf(_Complex_I*d*2*M_PI*q->data.rader2.seq[i%(q->nfft-1)]/(T)(q->nfft));
-    FFT(_execute)(q->data.rader2.fft);
+    // acquire shared sequence and transform, computing them if necessary
+    q->cache = FFT(_cache_acquire)(q->method, q->nfft, q->direction);
+    if (q->cache == NULL) {
+        FFT(_cache) c = FFT(_cache_create)(q->method, q->nfft, q->direction);
+
+        // compute primitive root of nfft
+        unsigned int g = liquid_primitive_root_prime(q->nfft);
+
+        // create and initialize sequence
+        c->index = (unsigned int *)malloc((q->nfft-1)*sizeof(unsigned int));
+        for (i=0; i<q->nfft-1; i++)
+            c->index[i] = liquid_modpow(g, i+1, q->nfft);
+
+        // compute DFT of sequence { exp(-j*2*pi*g^i/nfft }, size: nfft_prime
+        // NOTE: R[0] = -1, |R[k]| = sqrt(nfft) for k != 0
+        // (use newly-created FFT plan of length nfft_prime)
+        T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+        for (i=0; i<q->data.rader2.nfft_prime; i++)
+            q->data.rader2.x_prime[i] = cexpf(_Complex_I*d*2*M_PI*c->index[i%(q->nfft-1)]/(T)(q->nfft));
+        FFT(_execute)(q->data.rader2.fft);
     
-    // copy result to R
-    q->data.rader2.R = (TC*)malloc(q->data.rader2.nfft_prime*sizeof(TC));
-    memmove(q->data.rader2.R, q->data.rader2.X_prime, q->data.rader2.nfft_prime*sizeof(TC));
+        // copy result to R
+        c->R = (TC*)malloc(q->data.rader2.nfft_prime*sizeof(TC));
+        memmove(c->R, q->data.rader2.X_prime, q->data.rader2.nfft_prime*sizeof(TC));
+
+        q->cache = FFT(_cache_insert)(c);
+    }
+    q->data.rader2.seq = q->cache->index;
+    q->data.rader2.R   = q->cache->R;
 
     // return main object
     return q;
@@ -165,9 +175,8 @@ FFT(plan) FFT(_create_plan_rader2)(unsigned int _nfft,
 // destroy FFT plan
 void FFT(_destroy_plan_rader2)(FFT(plan) _q)
 {
-    // free data specific to Rader's algorithm
-    free(_q->data.rader2.seq);      // sequence
-    free(_q->data.rader2.R);        // pre-computed transform of exp(j*2*pi*seq)
+    // release shared sequence and pre-computed transform of exp(j*2*pi*seq)
+    FFT(_cache_release)(_q->cache);
 
     free(_q->data.rader2.x_prime);   // sub-transform input array
     free(_q->data.rader2.X_prime);   // sub-transform output array
@@ -56,18 +56,28 @@ FFT(plan) FFT(_create_plan_radix2)(unsigned int _nfft,
 
     // initialize twiddle factors, indices for radix-2 transforms
     q->data.radix2.m = liquid_msb_index(q->nfft) - 1;  // m = log2(nfft)
-    
-    q->data.radix2.index_rev = (unsigned int *) malloc((q->nfft)*sizeof(unsigned int));
-    unsigned int i;
-    for (i=0; i<q->nfft; i++)
-        q->data.radix2.index_rev[i] = fft_reverse_index(i,q->data.radix2.m);
 
-    // initialize twiddle factors
-    q->data.radix2.twiddle = (TC *) malloc(q->nfft * sizeof(TC));
+    // acquire shared tables, computing them if necessary
+    q->cache = FFT(_cache_acquire)(q->method, q->nfft, q->direction);
+    if (q->cache == NULL) {
+        FFT(_cache) c = FFT(_cache_create)(q->method, q->nfft, q->direction);
+
+        c->index = (unsigned int *) malloc((q->nfft)*sizeof(unsigned int));
+        unsigned int i;
+        for (i=0; i<q->nfft; i++)
+            c->index[i] = fft_reverse_index(i,q->data.radix2.m);
+
+        // initialize twiddle factors
+        c->twiddle = (TC *) malloc(q->nfft * sizeof(TC));
     
-    T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
-    for (i=0; i<q->nfft; i++)
-        q->data.radix2.twiddle[i] = cexpf(_Complex_I*d*2*M_PI*(T)i / (T)(q->nfft));
+        T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+        for (i=0; i<q->nfft; i++)
+            c->twiddle[i] = cexpf(_Complex_I*d*2*M_PI*(T)i / (T)(q->nfft));
+
+        q->cache = FFT(_cache_insert)(c);
+    }
+    q->data.radix2.index_rev = q->cache->index;
+    q->data.radix2.twiddle   = q->cache->twiddle;
 
     return q;
 }
@@ -75,9 +85,8 @@ FFT(plan) FFT(_create_plan_radix2)(unsigned int _nfft,
 // destroy FFT plan
 void FFT(_destroy_plan_radix2)(FFT(plan) _q)
 {
-    // free data specific to radix-2 transforms
-    free(_q->data.radix2.index_rev);
-    free(_q->data.radix2.twiddle);
+    // release shared tables
+    FFT(_cache_release)(_q->cache);
 
     // free main object memory
     free(_q);
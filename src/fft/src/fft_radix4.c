@@ -0,0 +1,519 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_radix4.c : definitions for transforms of the form 2^m using
+//                radix-4 butterflies (Stockham auto-sort, decimation in
+//                frequency) with a final radix-2 stage for odd m
+//
+// Each stage reads sub-sequences of length L with stride s (L*s = nfft)
+// and writes them to the other of two buffers, so no bit-reversal
+// permutation is needed. For s >= 4 the inner loop runs over contiguous
+// blocks of s samples which are vectorized directly; the first stage
+// (s = 1) is vectorized over the butterfly index instead, followed by a
+// 4x4 transpose on output. Butterfly kernels are selected at plan
+// creation (see liquid_simd_select()); SIMD kernels assume single
+// precision.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "liquid.internal.h"
+
+// SSE3 kernels are available only if the baseline architecture flags
+// (e.g. -msse3, -msse4.1) enable them
+#if HAVE_PMMINTRIN_H && defined(__SSE3__)
+#  include <pmmintrin.h>
+#  define FFT_RADIX4_SSE 1
+#else
+#  define FFT_RADIX4_SSE 0
+#endif
+
+#if LIQUID_SIMD_X86_TARGETS
+#  include <immintrin.h>
+#endif
+
+// forward declaration of internal methods
+void FFT(_radix4_stage)(unsigned int _L, unsigned int _s, int _dir, TC * _x, TC * _y, TC * _w);
+void FFT(_radix2_stage)(unsigned int _s, TC * _x, TC * _y);
+#if FFT_RADIX4_SSE
+void FFT(_radix4_stage_sse)(unsigned int _L, unsigned int _s, int _dir, TC * _x, TC * _y, TC * _w);
+void FFT(_radix2_stage_sse)(unsigned int _s, TC * _x, TC * _y);
+#endif
+#if LIQUID_SIMD_X86_TARGETS
+void FFT(_radix4_stage_avx2)(unsigned int _L, unsigned int _s, int _dir, TC * _x, TC * _y, TC * _w);
+void FFT(_radix2_stage_avx2)(unsigned int _s, TC * _x, TC * _y);
+#endif
+
+// create FFT plan for radix-4 transform
+//  _nfft   :   FFT size
+//  _x      :   input array [size: _nfft x 1]
+//  _y      :   output array [size: _nfft x 1]
+//  _dir    :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _method :   fft method
+FFT(plan) FFT(_create_plan_radix4)(unsigned int _nfft,
+                                   TC *         _x,
+                                   TC *         _y,
+                                   int          _dir,
+                                   int          _flags)
+{
+    // allocate plan and initialize all internal arrays to NULL
+    FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
+
+    q->nfft      = _nfft;
+    q->x         = _x;
+    q->y         = _y;
+    q->flags     = _flags;
+    q->type      = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->direction = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->method    = LIQUID_FFT_METHOD_RADIX4;
+
+    q->execute   = FFT(_execute_radix4);
+
+    // number of stages: ceil(log2(nfft)/2)
+    q->data.radix4.m          = liquid_msb_index(q->nfft) - 1;  // m = log2(nfft)
+    q->data.radix4.num_stages = (q->data.radix4.m + 1) / 2;
+
+    // scratch buffer for alternating stages
+    q->data.radix4.t = (TC *) malloc(q->nfft * sizeof(TC));
+
+    // select butterfly kernels
+    q->data.radix4.simd = liquid_simd_select(LIQUID_SIMD_AVX2);
+#if !FFT_RADIX4_SSE
+    if (q->data.radix4.simd == LIQUID_SIMD_SSE)
+        q->data.radix4.simd = LIQUID_SIMD_PORTABLE;
+#endif
+
+    // acquire shared tables, computing them if necessary
+    q->cache = FFT(_cache_acquire)(q->method, q->nfft, q->direction);
+    if (q->cache == NULL) {
+        FFT(_cache) c = FFT(_cache_create)(q->method, q->nfft, q->direction);
+
+        // twiddle factors for each radix-4 stage of length L, stored as
+        // { w^p, w^2p, w^3p } for p in [0,L/4) with w = exp(-/+j*2*pi/L)
+        c->twiddle = (TC *) malloc(q->nfft * sizeof(TC));
+        T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+        unsigned int L;
+        unsigned int n = 0;
+        unsigned int p;
+        for (L=q->nfft; L>=4; L>>=2) {
+            unsigned int n1 = L/4;
+            for (p=0; p<n1; p++) {
+                c->twiddle[n +      p] = cexpf(_Complex_I*d*2*M_PI*(T)(  p) / (T)L);
+                c->twiddle[n +   n1+p] = cexpf(_Complex_I*d*2*M_PI*(T)(2*p) / (T)L);
+                c->twiddle[n + 2*n1+p] = cexpf(_Complex_I*d*2*M_PI*(T)(3*p) / (T)L);
+            }
+            n += 3*n1;
+        }
+
+        q->cache = FFT(_cache_insert)(c);
+    }
+    q->data.radix4.twiddle = q->cache->twiddle;
+
+    return q;
+}
+
+// destroy FFT plan
+void FFT(_destroy_plan_radix4)(FFT(plan) _q)
+{
+    // release shared tables
+    FFT(_cache_release)(_q->cache);
+
+    // free scratch buffer
+    free(_q->data.radix4.t);
+
+    // free main object memory
+    free(_q);
+}
+
+// execute radix-4 FFT
+void FFT(_execute_radix4)(FFT(plan) _q)
+{
+    unsigned int num_stages = _q->data.radix4.num_stages;
+    TC * t = _q->data.radix4.t;
+    TC * w = _q->data.radix4.twiddle;
+    TC * x = _q->x;
+
+    // stages alternate between the output and scratch buffers, ending
+    // with the output; for in-place transforms with an odd number of
+    // stages the first would overwrite its own input, so move it aside
+    if (_q->x == _q->y && (num_stages & 1)) {
+        memmove(t, x, _q->nfft*sizeof(TC));
+        x = t;
+    }
+
+    unsigned int i;
+    unsigned int L = _q->nfft;  // sub-sequence length
+    unsigned int s = 1;         // sub-sequence stride
+    for (i=0; i<num_stages; i++) {
+        TC * y = ((num_stages - i) & 1) ? _q->y : t;
+
+        if (L == 2) {
+            // final radix-2 stage (odd log2(nfft))
+            switch (_q->data.radix4.simd) {
+#if LIQUID_SIMD_X86_TARGETS
+            case LIQUID_SIMD_AVX2:  FFT(_radix2_stage_avx2)(s, x, y);   break;
+#endif
+#if FFT_RADIX4_SSE
+            case LIQUID_SIMD_SSE:   FFT(_radix2_stage_sse)(s, x, y);    break;
+#endif
+            default:                FFT(_radix2_stage)(s, x, y);
+            }
+        } else {
+            switch (_q->data.radix4.simd) {
+#if LIQUID_SIMD_X86_TARGETS
+            case LIQUID_SIMD_AVX2:  FFT(_radix4_stage_avx2)(L, s, _q->direction, x, y, w);  break;
+#endif
+#if FFT_RADIX4_SSE
+            case LIQUID_SIMD_SSE:   FFT(_radix4_stage_sse)(L, s, _q->direction, x, y, w);   break;
+#endif
+            default:                FFT(_radix4_stage)(L, s, _q->direction, x, y, w);
+            }
+            w += 3*(L/4);
+        }
+
+        x = y;
+        L >>= 2;
+        s <<= 2;
+    }
+}
+
+// compute single radix-4 stage (portable C)
+//  _L      :   sub-sequence length
+//  _s      :   sub-sequence stride
+//  _dir    :   fft direction
+//  _x      :   input array [size: _L*_s x 1]
+//  _y      :   output array [size: _L*_s x 1]
+//  _w      :   twiddle factors for stage [size: 3*_L/4 x 1]
+void FFT(_radix4_stage)(unsigned int _L,
+                        unsigned int _s,
+                        int          _dir,
+                        TC *         _x,
+                        TC *         _y,
+                        TC *         _w)
+{
+    unsigned int n1 = _L/4;
+    unsigned int p, q;
+
+    // sign of imaginary unit applied to (b - d)
+    T g = (_dir == LIQUID_FFT_FORWARD) ? 1 : -1;
+
+    // NOTE: complex arithmetic is expanded to avoid checks for
+    //       infinite/NaN values on multiplication
+    T * x = (T*) _x;
+    T * y = (T*) _y;
+    T * w = (T*) _w;
+    for (p=0; p<n1; p++) {
+        T w1r = w[2*(     p)], w1i = w[2*(     p)+1];
+        T w2r = w[2*(  n1+p)], w2i = w[2*(  n1+p)+1];
+        T w3r = w[2*(2*n1+p)], w3i = w[2*(2*n1+p)+1];
+        for (q=0; q<_s; q++) {
+            T * a = &x[2*(q + _s*(p     ))];
+            T * b = &x[2*(q + _s*(p+  n1))];
+            T * c = &x[2*(q + _s*(p+2*n1))];
+            T * d = &x[2*(q + _s*(p+3*n1))];
+
+            T apc_r = a[0] + c[0], apc_i = a[1] + c[1];
+            T amc_r = a[0] - c[0], amc_i = a[1] - c[1];
+            T bpd_r = b[0] + d[0], bpd_i = b[1] + d[1];
+            T jbmd_r = -g*(b[1] - d[1]);
+            T jbmd_i =  g*(b[0] - d[0]);
+
+            T v1r = amc_r - jbmd_r, v1i = amc_i - jbmd_i;
+            T v2r = apc_r - bpd_r,  v2i = apc_i - bpd_i;
+            T v3r = amc_r + jbmd_r, v3i = amc_i + jbmd_i;
+
+            T * v = &y[2*(q + _s*4*p)];
+            v[0]      = apc_r + bpd_r;
+            v[1]      = apc_i + bpd_i;
+            v[2*_s  ] = v1r*w1r - v1i*w1i;
+            v[2*_s+1] = v1r*w1i + v1i*w1r;
+            v[4*_s  ] = v2r*w2r - v2i*w2i;
+            v[4*_s+1] = v2r*w2i + v2i*w2r;
+            v[6*_s  ] = v3r*w3r - v3i*w3i;
+            v[6*_s+1] = v3r*w3i + v3i*w3r;
+        }
+    }
+}
+
+// compute final radix-2 stage (portable C)
+//  _s      :   sub-sequence stride (nfft/2)
+//  _x      :   input array [size: 2*_s x 1]
+//  _y      :   output array [size: 2*_s x 1]
+void FFT(_radix2_stage)(unsigned int _s,
+                        TC *         _x,
+                        TC *         _y)
+{
+    unsigned int q;
+    for (q=0; q<_s; q++) {
+        TC a = _x[q];
+        TC b = _x[q+_s];
+        _y[q   ] = a + b;
+        _y[q+_s] = a - b;
+    }
+}
+
+#if FFT_RADIX4_SSE
+// compute single radix-4 stage (SSE3, two complex samples per register)
+void FFT(_radix4_stage_sse)(unsigned int _L,
+                            unsigned int _s,
+                            int          _dir,
+                            TC *         _x,
+                            TC *         _y,
+                            TC *         _w)
+{
+    unsigned int n1 = _L/4;
+    unsigned int p, q;
+
+    // multiplying by +/-j swaps real and imaginary parts, negating one
+    __m128 jsign = (_dir == LIQUID_FFT_FORWARD) ? _mm_setr_ps(-0.0f, 0.0f,-0.0f, 0.0f) :
+                                                  _mm_setr_ps( 0.0f,-0.0f, 0.0f,-0.0f);
+
+    float * x = (float*) _x;
+    float * y = (float*) _y;
+    float * w = (float*) _w;
+
+    if (_s == 1 && (n1 % 2) == 0) {
+        // first stage: vectorize over butterfly index, transposing output
+        for (p=0; p<n1; p+=2) {
+            __m128 a  = _mm_loadu_ps(&x[2*(p     )]);
+            __m128 b  = _mm_loadu_ps(&x[2*(p+  n1)]);
+            __m128 c  = _mm_loadu_ps(&x[2*(p+2*n1)]);
+            __m128 d  = _mm_loadu_ps(&x[2*(p+3*n1)]);
+            __m128 w1 = _mm_loadu_ps(&w[2*(     p)]);
+            __m128 w2 = _mm_loadu_ps(&w[2*(  n1+p)]);
+            __m128 w3 = _mm_loadu_ps(&w[2*(2*n1+p)]);
+
+            __m128 apc  = _mm_add_ps(a, c);
+            __m128 amc  = _mm_sub_ps(a, c);
+            __m128 bpd  = _mm_add_ps(b, d);
+            __m128 bmd  = _mm_sub_ps(b, d);
+            __m128 jbmd = _mm_xor_ps(_mm_shuffle_ps(bmd, bmd, _MM_SHUFFLE(2,3,0,1)), jsign);
+
+            __m128 v0 = _mm_add_ps(apc, bpd);
+            __m128 v1 = _mm_sub_ps(amc, jbmd);
+            __m128 v2 = _mm_sub_ps(apc, bpd);
+            __m128 v3 = _mm_add_ps(amc, jbmd);
+
+            // complex multiply by twiddle factors
+            v1 = _mm_addsub_ps(_mm_mul_ps(v1, _mm_moveldup_ps(w1)),
+                               _mm_mul_ps(_mm_shuffle_ps(v1, v1, _MM_SHUFFLE(2,3,0,1)), _mm_movehdup_ps(w1)));
+            v2 = _mm_addsub_ps(_mm_mul_ps(v2, _mm_moveldup_ps(w2)),
+                               _mm_mul_ps(_mm_shuffle_ps(v2, v2, _MM_SHUFFLE(2,3,0,1)), _mm_movehdup_ps(w2)));
+            v3 = _mm_addsub_ps(_mm_mul_ps(v3, _mm_moveldup_ps(w3)),
+                               _mm_mul_ps(_mm_shuffle_ps(v3, v3, _MM_SHUFFLE(2,3,0,1)), _mm_movehdup_ps(w3)));
+
+            // transpose: { v0[p], v1[p], v2[p], v3[p] } are contiguous
+            _mm_storeu_ps(&y[2*(4*p    )], _mm_movelh_ps(v0, v1));
+            _mm_storeu_ps(&y[2*(4*p + 2)], _mm_movelh_ps(v2, v3));
+            _mm_storeu_ps(&y[2*(4*p + 4)], _mm_movehl_ps(v1, v0));
+            _mm_storeu_ps(&y[2*(4*p + 6)], _mm_movehl_ps(v3, v2));
+        }
+        return;
+    } else if (_s == 1) {
+        // too short to vectorize
+        FFT(_radix4_stage)(_L, _s, _dir, _x, _y, _w);
+        return;
+    }
+
+    // remaining stages: vectorize over contiguous block of _s samples
+    for (p=0; p<n1; p++) {
+        __m128 w1r = _mm_set1_ps(w[2*(     p)]), w1i = _mm_set1_ps(w[2*(     p)+1]);
+        __m128 w2r = _mm_set1_ps(w[2*(  n1+p)]), w2i = _mm_set1_ps(w[2*(  n1+p)+1]);
+        __m128 w3r = _mm_set1_ps(w[2*(2*n1+p)]), w3i = _mm_set1_ps(w[2*(2*n1+p)+1]);
+        float * xa = &x[2*_s*(p     )];
+        float * xb = &x[2*_s*(p+  n1)];
+        float * xc = &x[2*_s*(p+2*n1)];
+        float * xd = &x[2*_s*(p+3*n1)];
+        float * yp = &y[2*_s*(4*p)];
+        for (q=0; q<2*_s; q+=4) {
+            __m128 a = _mm_loadu_ps(&xa[q]);
+            __m128 b = _mm_loadu_ps(&xb[q]);
+            __m128 c = _mm_loadu_ps(&xc[q]);
+            __m128 d = _mm_loadu_ps(&xd[q]);
+
+            __m128 apc  = _mm_add_ps(a, c);
+            __m128 amc  = _mm_sub_ps(a, c);
+            __m128 bpd  = _mm_add_ps(b, d);
+            __m128 bmd  = _mm_sub_ps(b, d);
+            __m128 jbmd = _mm_xor_ps(_mm_shuffle_ps(bmd, bmd, _MM_SHUFFLE(2,3,0,1)), jsign);
+
+            __m128 v1 = _mm_sub_ps(amc, jbmd);
+            __m128 v2 = _mm_sub_ps(apc, bpd);
+            __m128 v3 = _mm_add_ps(amc, jbmd);
+
+            v1 = _mm_addsub_ps(_mm_mul_ps(v1, w1r), _mm_mul_ps(_mm_shuffle_ps(v1, v1, _MM_SHUFFLE(2,3,0,1)), w1i));
+            v2 = _mm_addsub_ps(_mm_mul_ps(v2, w2r), _mm_mul_ps(_mm_shuffle_ps(v2, v2, _MM_SHUFFLE(2,3,0,1)), w2i));
+            v3 = _mm_addsub_ps(_mm_mul_ps(v3, w3r), _mm_mul_ps(_mm_shuffle_ps(v3, v3, _MM_SHUFFLE(2,3,0,1)), w3i));
+
+            _mm_storeu_ps(&yp[q       ], _mm_add_ps(apc, bpd));
+            _mm_storeu_ps(&yp[q+2*_s  ], v1);
+            _mm_storeu_ps(&yp[q+4*_s  ], v2);
+            _mm_storeu_ps(&yp[q+6*_s  ], v3);
+        }
+    }
+}
+
+// compute final radix-2 stage (SSE3)
+void FFT(_radix2_stage_sse)(unsigned int _s,
+                            TC *         _x,
+                            TC *         _y)
+{
+    float * x = (float*) _x;
+    float * y = (float*) _y;
+    unsigned int q;
+    for (q=0; q<2*_s; q+=4) {
+        __m128 a = _mm_loadu_ps(&x[q     ]);
+        __m128 b = _mm_loadu_ps(&x[q+2*_s]);
+        _mm_storeu_ps(&y[q     ], _mm_add_ps(a, b));
+        _mm_storeu_ps(&y[q+2*_s], _mm_sub_ps(a, b));
+    }
+}
+#endif
+
+#if LIQUID_SIMD_X86_TARGETS
+// compute single radix-4 stage (AVX2/FMA, four complex samples per register)
+__attribute__((target("avx2,fma")))
+void FFT(_radix4_stage_avx2)(unsigned int _L,
+                             unsigned int _s,
+                             int          _dir,
+                             TC *         _x,
+                             TC *         _y,
+                             TC *         _w)
+{
+    unsigned int n1 = _L/4;
+    unsigned int p, q;
+
+    // multiplying by +/-j swaps real and imaginary parts, negating one
+    __m256 jsign = (_dir == LIQUID_FFT_FORWARD) ?
+        _mm256_setr_ps(-0.0f, 0.0f,-0.0f, 0.0f,-0.0f, 0.0f,-0.0f, 0.0f) :
+        _mm256_setr_ps( 0.0f,-0.0f, 0.0f,-0.0f, 0.0f,-0.0f, 0.0f,-0.0f);
+
+    float * x = (float*) _x;
+    float * y = (float*) _y;
+    float * w = (float*) _w;
+
+    if (_s == 1 && (n1 % 4) == 0) {
+        // first stage: vectorize over butterfly index, transposing output
+        for (p=0; p<n1; p+=4) {
+            __m256 a  = _mm256_loadu_ps(&x[2*(p     )]);
+            __m256 b  = _mm256_loadu_ps(&x[2*(p+  n1)]);
+            __m256 c  = _mm256_loadu_ps(&x[2*(p+2*n1)]);
+            __m256 d  = _mm256_loadu_ps(&x[2*(p+3*n1)]);
+            __m256 w1 = _mm256_loadu_ps(&w[2*(     p)]);
+            __m256 w2 = _mm256_loadu_ps(&w[2*(  n1+p)]);
+            __m256 w3 = _mm256_loadu_ps(&w[2*(2*n1+p)]);
+
+            __m256 apc  = _mm256_add_ps(a, c);
+            __m256 amc  = _mm256_sub_ps(a, c);
+            __m256 bpd  = _mm256_add_ps(b, d);
+            __m256 bmd  = _mm256_sub_ps(b, d);
+            __m256 jbmd = _mm256_xor_ps(_mm256_permute_ps(bmd, _MM_SHUFFLE(2,3,0,1)), jsign);
+
+            __m256 v0 = _mm256_add_ps(apc, bpd);
+            __m256 v1 = _mm256_sub_ps(amc, jbmd);
+            __m256 v2 = _mm256_sub_ps(apc, bpd);
+            __m256 v3 = _mm256_add_ps(amc, jbmd);
+
+            // complex multiply by twiddle factors
+            v1 = _mm256_fmaddsub_ps(v1, _mm256_moveldup_ps(w1),
+                    _mm256_mul_ps(_mm256_permute_ps(v1, _MM_SHUFFLE(2,3,0,1)), _mm256_movehdup_ps(w1)));
+            v2 = _mm256_fmaddsub_ps(v2, _mm256_moveldup_ps(w2),
+                    _mm256_mul_ps(_mm256_permute_ps(v2, _MM_SHUFFLE(2,3,0,1)), _mm256_movehdup_ps(w2)));
+            v3 = _mm256_fmaddsub_ps(v3, _mm256_moveldup_ps(w3),
+                    _mm256_mul_ps(_mm256_permute_ps(v3, _MM_SHUFFLE(2,3,0,1)), _mm256_movehdup_ps(w3)));
+
+            // transpose 4x4 complex: { v0[p], v1[p], v2[p], v3[p] } are
+            // contiguous (each complex sample treated as one double)
+            __m256d t0 = _mm256_unpacklo_pd(_mm256_castps_pd(v0), _mm256_castps_pd(v1));
+            __m256d t1 = _mm256_unpackhi_pd(_mm256_castps_pd(v0), _mm256_castps_pd(v1));
+            __m256d t2 = _mm256_unpacklo_pd(_mm256_castps_pd(v2), _mm256_castps_pd(v3));
+            __m256d t3 = _mm256_unpackhi_pd(_mm256_castps_pd(v2), _mm256_castps_pd(v3));
+            _mm256_storeu_ps(&y[2*(4*p     )], _mm256_castpd_ps(_mm256_permute2f128_pd(t0, t2, 0x20)));
+            _mm256_storeu_ps(&y[2*(4*p +  4)], _mm256_castpd_ps(_mm256_permute2f128_pd(t1, t3, 0x20)));
+            _mm256_storeu_ps(&y[2*(4*p +  8)], _mm256_castpd_ps(_mm256_permute2f128_pd(t0, t2, 0x31)));
+            _mm256_storeu_ps(&y[2*(4*p + 12)], _mm256_castpd_ps(_mm256_permute2f128_pd(t1, t3, 0x31)));
+        }
+        return;
+    } else if (_s == 1) {
+        // too short to vectorize
+        FFT(_radix4_stage)(_L, _s, _dir, _x, _y, _w);
+        return;
+    }
+
+    // remaining stages: vectorize over contiguous block of _s samples
+    for (p=0; p<n1; p++) {
+        __m256 w1r = _mm256_set1_ps(w[2*(     p)]), w1i = _mm256_set1_ps(w[2*(     p)+1]);
+        __m256 w2r = _mm256_set1_ps(w[2*(  n1+p)]), w2i = _mm256_set1_ps(w[2*(  n1+p)+1]);
+        __m256 w3r = _mm256_set1_ps(w[2*(2*n1+p)]), w3i = _mm256_set1_ps(w[2*(2*n1+p)+1]);
+        float * xa = &x[2*_s*(p     )];
+        float * xb = &x[2*_s*(p+  n1)];
+        float * xc = &x[2*_s*(p+2*n1)];
+        float * xd = &x[2*_s*(p+3*n1)];
+        float * yp = &y[2*_s*(4*p)];
+        for (q=0; q<2*_s; q+=8) {
+            __m256 a = _mm256_loadu_ps(&xa[q]);
+            __m256 b = _mm256_loadu_ps(&xb[q]);
+            __m256 c = _mm256_loadu_ps(&xc[q]);
+            __m256 d = _mm256_loadu_ps(&xd[q]);
+
+            __m256 apc  = _mm256_add_ps(a, c);
+            __m256 amc  = _mm256_sub_ps(a, c);
+            __m256 bpd  = _mm256_add_ps(b, d);
+            __m256 bmd  = _mm256_sub_ps(b, d);
+            __m256 jbmd = _mm256_xor_ps(_mm256_permute_ps(bmd, _MM_SHUFFLE(2,3,0,1)), jsign);
+
+            __m256 v1 = _mm256_sub_ps(amc, jbmd);
+            __m256 v2 = _mm256_sub_ps(apc, bpd);
+            __m256 v3 = _mm256_add_ps(amc, jbmd);
+
+            v1 = _mm256_fmaddsub_ps(v1, w1r, _mm256_mul_ps(_mm256_permute_ps(v1, _MM_SHUFFLE(2,3,0,1)), w1i));
+            v2 = _mm256_fmaddsub_ps(v2, w2r, _mm256_mul_ps(_mm256_permute_ps(v2, _MM_SHUFFLE(2,3,0,1)), w2i));
+            v3 = _mm256_fmaddsub_ps(v3, w3r, _mm256_mul_ps(_mm256_permute_ps(v3, _MM_SHUFFLE(2,3,0,1)), w3i));
+
+            _mm256_storeu_ps(&yp[q     ], _mm256_add_ps(apc, bpd));
+            _mm256_storeu_ps(&yp[q+2*_s], v1);
+            _mm256_storeu_ps(&yp[q+4*_s], v2);
+            _mm256_storeu_ps(&yp[q+6*_s], v3);
+        }
+    }
+}
+
+// compute final radix-2 stage (AVX2)
+__attribute__((target("avx2,fma")))
+void FFT(_radix2_stage_avx2)(unsigned int _s,
+                             TC *         _x,
+                             TC *         _y)
+{
+    float * x = (float*) _x;
+    float * y = (float*) _y;
+    unsigned int q;
+    for (q=0; q<2*_s; q+=8) {
+        __m256 a = _mm256_loadu_ps(&x[q     ]);
+        __m256 b = _mm256_loadu_ps(&x[q+2*_s]);
+        _mm256_storeu_ps(&y[q     ], _mm256_add_ps(a, b));
+        _mm256_storeu_ps(&y[q+2*_s], _mm256_sub_ps(a, b));
+    }
+}
+#endif
@@ -43,14 +43,9 @@ liquid_fft_method liquid_fft_estimate_method(unsigned int _nfft)
         return LIQUID_FFT_METHOD_DFT;
 
     } else if (fft_is_radix2(_nfft)) {
-        // transform is of the form 2^m
-#if 0
-        // use radix-2 algorithm
-        return LIQUID_FFT_METHOD_RADIX2;
-#else
-        // acutally, prefer Cooley-Tukey algorithm
-        return LIQUID_FFT_METHOD_MIXED_RADIX;
-#endif
+        // transform is of the form 2^m: use radix-4 algorithm (vectorized
+        // butterflies) which outperforms both radix-2 and Cooley-Tukey
+        return LIQUID_FFT_METHOD_RADIX4;
 
     } else if (liquid_is_prime(_nfft)) {
         // prefer Rader's alternate method (using radix-2 transform)
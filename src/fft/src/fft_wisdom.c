@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_wisdom.c : fastest measured FFT method for each transform size
+//
+// Wisdom files are plain text with one transform size and method name per
+// line; lines beginning with '#' are ignored, e.g.
+//
+//  # liquid-dsp fft wisdom
+//  64 mixed-radix
+//  257 rader
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#  include <pthread.h>
+static pthread_mutex_t liquid_fft_wisdom_mutex = PTHREAD_MUTEX_INITIALIZER;
+#  define FFT_WISDOM_LOCK()     pthread_mutex_lock(&liquid_fft_wisdom_mutex)
+#  define FFT_WISDOM_UNLOCK()   pthread_mutex_unlock(&liquid_fft_wisdom_mutex)
+#else
+#  define FFT_WISDOM_LOCK()
+#  define FFT_WISDOM_UNLOCK()
+#endif
+
+// method names used in wisdom files, indexed by liquid_fft_method
+static const char * liquid_fft_method_str[] = {
+    "unknown",
+    "radix2",
+    "radix4",
+    "mixed-radix",
+    "rader",
+    "rader2",
+    "dft"};
+#define LIQUID_FFT_WISDOM_NUM_METHODS (sizeof(liquid_fft_method_str)/sizeof(char*))
+
+// largest transform for which the regular DFT is measured
+#define LIQUID_FFT_WISDOM_DFT_MAX   (64)
+
+// wisdom table
+struct liquid_fft_wisdom_s {
+    unsigned int      nfft;     // transform size
+    liquid_fft_method method;   // fastest measured method
+};
+static struct liquid_fft_wisdom_s * liquid_fft_wisdom = NULL;
+static unsigned int liquid_fft_wisdom_len = 0;
+
+// has wisdom file from environment been loaded?
+static int liquid_fft_wisdom_env_loaded = 0;
+
+// determine if method can compute transform of size _nfft
+int liquid_fft_method_is_valid(liquid_fft_method _method,
+                               unsigned int      _nfft)
+{
+    switch (_method) {
+    case LIQUID_FFT_METHOD_DFT:         return _nfft > 0;
+    case LIQUID_FFT_METHOD_RADIX2:      return _nfft >= 4 && fft_is_radix2(_nfft);
+    case LIQUID_FFT_METHOD_RADIX4:      return _nfft >= 4 && fft_is_radix2(_nfft);
+    case LIQUID_FFT_METHOD_MIXED_RADIX:
+        // first factor must be smaller than transform size
+        return _nfft >= 4 && !liquid_is_prime(_nfft) && fft_estimate_mixed_radix(_nfft) < _nfft;
+    case LIQUID_FFT_METHOD_RADER:       return _nfft >= 3 && liquid_is_prime(_nfft);
+    case LIQUID_FFT_METHOD_RADER2:      return _nfft >= 5 && liquid_is_prime(_nfft);
+    default:;
+    }
+    return 0;
+}
+
+// look up fastest measured method for transform size from wisdom
+liquid_fft_method liquid_fft_wisdom_lookup(unsigned int _nfft)
+{
+    // load wisdom file from environment on first use
+    FFT_WISDOM_LOCK();
+    int load = !liquid_fft_wisdom_env_loaded;
+    liquid_fft_wisdom_env_loaded = 1;
+    FFT_WISDOM_UNLOCK();
+    if (load) {
+        const char * filename = getenv("LIQUID_FFT_WISDOM");
+        if (filename != NULL)
+            liquid_fft_wisdom_import(filename);
+    }
+
+    liquid_fft_method method = LIQUID_FFT_METHOD_UNKNOWN;
+    FFT_WISDOM_LOCK();
+    unsigned int i;
+    for (i=0; i<liquid_fft_wisdom_len; i++) {
+        if (liquid_fft_wisdom[i].nfft == _nfft) {
+            method = liquid_fft_wisdom[i].method;
+            break;
+        }
+    }
+    FFT_WISDOM_UNLOCK();
+    return method;
+}
+
+// record method for transform size in wisdom
+void liquid_fft_wisdom_set(unsigned int      _nfft,
+                           liquid_fft_method _method)
+{
+    if (!liquid_fft_method_is_valid(_method, _nfft)) {
+        fprintf(stderr,"warning: liquid_fft_wisdom_set(), invalid method for nfft=%u\n", _nfft);
+        return;
+    }
+
+    FFT_WISDOM_LOCK();
+    unsigned int i;
+    for (i=0; i<liquid_fft_wisdom_len; i++) {
+        if (liquid_fft_wisdom[i].nfft == _nfft)
+            break;
+    }
+    if (i == liquid_fft_wisdom_len) {
+        // append new entry
+        liquid_fft_wisdom_len++;
+        liquid_fft_wisdom = (struct liquid_fft_wisdom_s*) realloc(liquid_fft_wisdom,
+                                liquid_fft_wisdom_len*sizeof(struct liquid_fft_wisdom_s));
+    }
+    liquid_fft_wisdom[i].nfft   = _nfft;
+    liquid_fft_wisdom[i].method = _method;
+    FFT_WISDOM_UNLOCK();
+}
+
+// measure all methods for transform size and record fastest in wisdom
+void liquid_fft_wisdom_measure(unsigned int _nfft)
+{
+    // create methods, indexed by liquid_fft_method
+    fft_create_t * create[LIQUID_FFT_WISDOM_NUM_METHODS] = {
+        NULL,
+        fft_create_plan_radix2,
+        fft_create_plan_radix4,
+        fft_create_plan_mixed_radix,
+        fft_create_plan_rader,
+        fft_create_plan_rader2,
+        fft_create_plan_dft};
+
+    float complex * x = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y = (float complex*) malloc(_nfft*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<_nfft; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    liquid_fft_method method_opt = LIQUID_FFT_METHOD_UNKNOWN;
+    double cost_opt = 0.0;
+    for (i=1; i<LIQUID_FFT_WISDOM_NUM_METHODS; i++) {
+        liquid_fft_method method = (liquid_fft_method) i;
+        if (!liquid_fft_method_is_valid(method, _nfft))
+            continue;
+        if (method == LIQUID_FFT_METHOD_DFT && _nfft > LIQUID_FFT_WISDOM_DFT_MAX)
+            continue;
+
+        // create plan, measuring sub-transforms as well
+        fftplan q = create[i](_nfft, x, y, LIQUID_FFT_FORWARD, LIQUID_FFT_MEASURE);
+
+        // run transform, doubling number of trials until at least 2 ms
+        // have elapsed
+        unsigned long int num_trials = 1;
+        unsigned long int n;
+        clock_t t;
+        fft_execute(q);
+        do {
+            num_trials *= 2;
+            t = clock();
+            for (n=0; n<num_trials; n++)
+                fft_execute(q);
+            t = clock() - t;
+        } while (t < CLOCKS_PER_SEC/500);
+        fft_destroy_plan(q);
+
+        double cost = (double)t / (double)num_trials;
+        if (method_opt == LIQUID_FFT_METHOD_UNKNOWN || cost < cost_opt) {
+            method_opt = method;
+            cost_opt   = cost;
+        }
+    }
+
+    free(x);
+    free(y);
+
+    if (method_opt != LIQUID_FFT_METHOD_UNKNOWN)
+        liquid_fft_wisdom_set(_nfft, method_opt);
+}
+
+// import wisdom from file, returning 0 on success
+int liquid_fft_wisdom_import(const char * _filename)
+{
+    FILE * fid = fopen(_filename, "r");
+    if (fid == NULL) {
+        fprintf(stderr,"warning: liquid_fft_wisdom_import(), could not open '%s' for reading\n", _filename);
+        return -1;
+    }
+
+    char line[256];
+    char name[64];
+    unsigned int nfft;
+    unsigned int i;
+    int rc = 0;
+    while (fgets(line, sizeof(line), fid) != NULL) {
+        // skip comments and blank lines
+        char * p = line;
+        while (*p == ' ' || *p == '\t')
+            p++;
+        p[strcspn(p, "\r\n")] = '\0';
+        if (*p == '#' || *p == '\0')
+            continue;
+
+        // parse size and method
+        liquid_fft_method method = LIQUID_FFT_METHOD_UNKNOWN;
+        if (sscanf(p, "%u %63s", &nfft, name) == 2) {
+            for (i=1; i<LIQUID_FFT_WISDOM_NUM_METHODS; i++) {
+                if (strcmp(name, liquid_fft_method_str[i]) == 0)
+                    method = (liquid_fft_method) i;
+            }
+        }
+
+        if (!liquid_fft_method_is_valid(method, nfft)) {
+            fprintf(stderr,"warning: liquid_fft_wisdom_import(), ignoring invalid line '%s'\n", p);
+            rc = -1;
+            continue;
+        }
+        liquid_fft_wisdom_set(nfft, method);
+    }
+    fclose(fid);
+    return rc;
+}
+
+// export wisdom to file, returning 0 on success
+int liquid_fft_wisdom_export(const char * _filename)
+{
+    FILE * fid = fopen(_filename, "w");
+    if (fid == NULL) {
+        fprintf(stderr,"warning: liquid_fft_wisdom_export(), could not open '%s' for writing\n", _filename);
+        return -1;
+    }
+
+    fprintf(fid,"# liquid-dsp fft wisdom\n");
+    fprintf(fid,"# nfft method\n");
+    FFT_WISDOM_LOCK();
+    unsigned int i;
+    for (i=0; i<liquid_fft_wisdom_len; i++)
+        fprintf(fid,"%u %s\n", liquid_fft_wisdom[i].nfft, liquid_fft_method_str[liquid_fft_wisdom[i].method]);
+    FFT_WISDOM_UNLOCK();
+    fclose(fid);
+    return 0;
+}
+
+// clear all wisdom
+void liquid_fft_wisdom_forget(void)
+{
+    FFT_WISDOM_LOCK();
+    free(liquid_fft_wisdom);
+    liquid_fft_wisdom     = NULL;
+    liquid_fft_wisdom_len = 0;
+    FFT_WISDOM_UNLOCK();
+}
+
@@ -28,11 +28,22 @@
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <limits.h>
 #include <assert.h>
 
 #include <complex.h>
 #include "liquid.internal.h"
 
+#if HAVE_SYS_MMAN_H && HAVE_SYS_STAT_H
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#endif
+
+// number of batches of transforms in Welch estimate; partial spectra are
+// computed for each batch (in parallel) and summed in order, so the
+// result does not depend on the number of threads
+#define SPGRAM_WELCH_NUM_BATCHES    (256)
+
 struct SPGRAM(_s) {
     // options
     unsigned int    nfft;           // FFT length
@@ -44,13 +55,24 @@ struct SPGRAM(_s) {
     int             accumulate;     // accumulate? or use time-average
 
     WINDOW()        buffer;         // input buffer
+#if TI_COMPLEX
     TC *            buf_time;       // pointer to input array (allocated)
     TC *            buf_freq;       // output fft (allocated)
+#else
+    T *             buf_time;       // pointer to input array (allocated)
+    TC *            buf_freq;       // output fft, half spectrum (allocated)
+#endif
+#if TI_COMPLEX
+    T  *            w;              // tapering window, each value repeated for
+                                    // real/imag components [size: 2*window_len x 1]
+#else
     T  *            w;              // tapering window [size: window_len x 1]
+#endif
     FFT_PLAN        fft;            // FFT plan
 
     // psd accumulation
     T *             psd;                    // accumulated power spectral density estimate (linear)
+    T *             buf_psd;                // squared magnitude of current transform
     unsigned int    sample_timer;           // countdown to transform
     uint64_t        num_samples;            // total number of samples since reset
     uint64_t        num_samples_total;      // total number of samples since start
@@ -66,6 +88,32 @@ struct SPGRAM(_s) {
 // from current buffer contents
 void SPGRAM(_step)(SPGRAM() _q);
 
+// shared state for parallel Welch estimate
+struct SPGRAM(_welch_s) {
+    SPGRAM() *      q;              // spgram object for each worker
+    TI *            x;              // input signal
+    unsigned int    num_transforms; // total number of transforms
+    unsigned int    num_batches;    // number of batches of transforms
+    T *             psd;            // partial sums [size: num_batches x nfft]
+};
+
+// Welch estimate task: compute partial spectra for batches [_start,_end)
+void SPGRAM(_welch_task)(void *       _context,
+                         unsigned int _worker,
+                         unsigned int _start,
+                         unsigned int _end);
+
+// compute spectral periodogram output from a window of samples split
+// across two arrays
+//  _q      :   spgram object
+//  _x0     :   first part of window [size: _n0 x 1]
+//  _n0     :   number of samples in first part, _n0 <= window_len
+//  _x1     :   remainder of window [size: window_len-_n0 x 1]
+void SPGRAM(_transform)(SPGRAM()     _q,
+                        TI *         _x0,
+                        unsigned int _n0,
+                        TI *         _x1);
+
 // create spgram object
 //  _nfft       : FFT size
 //  _wtype      : window type, e.g. LIQUID_WINDOW_HAMMING
@@ -107,16 +155,24 @@ SPGRAM() SPGRAM(_create)(unsigned int _nfft,
     SPGRAM(_set_alpha)(q, -1.0f);
 
     // create FFT arrays, object
+#if TI_COMPLEX
     q->buf_time = (TC*) malloc((q->nfft)*sizeof(TC));
     q->buf_freq = (TC*) malloc((q->nfft)*sizeof(TC));
-    q->psd      = (T *) malloc((q->nfft)*sizeof(T ));
     q->fft      = FFT_CREATE_PLAN(q->nfft, q->buf_time, q->buf_freq, FFT_DIR_FORWARD, FFT_METHOD);
+#else
+    // real input: compute only non-redundant half of spectrum
+    q->buf_time = (T *) malloc((q->nfft    )*sizeof(T ));
+    q->buf_freq = (TC*) malloc((q->nfft/2+1)*sizeof(TC));
+    q->fft      = FFT_CREATE_PLAN_R2C(q->nfft, q->buf_time, q->buf_freq, FFT_METHOD);
+#endif
+    q->psd      = (T *) malloc((q->nfft)*sizeof(T ));
+    q->buf_psd  = (T *) malloc((q->nfft)*sizeof(T ));
 
     // create buffer
     q->buffer = WINDOW(_create)(q->window_len);
 
     // create window
-    q->w = (T*) malloc((q->window_len)*sizeof(T));
+    q->w = (T*) malloc(2*(q->window_len)*sizeof(T));
     unsigned int i;
     unsigned int n = q->window_len;
     float beta = 10.0f;
@@ -147,6 +203,14 @@ SPGRAM() SPGRAM(_create)(unsigned int _nfft,
     // scale window and copy
     for (i=0; i<q->window_len; i++)
         q->w[i] = g * q->w[i];
+#if TI_COMPLEX
+    // repeat each value so window can be applied to interleaved
+    // real/imaginary components with real-valued vector operations
+    for (i=q->window_len; i>0; i--) {
+        q->w[2*i-1] = q->w[i-1];
+        q->w[2*i-2] = q->w[i-1];
+    }
+#endif
 
     // reset the spgram object
     q->num_samples_total    = 0;
@@ -177,6 +241,7 @@ void SPGRAM(_destroy)(SPGRAM() _q)
     free(_q->buf_freq);
     free(_q->w);
     free(_q->psd);
+    free(_q->buf_psd);
     WINDOW(_destroy)(_q->buffer);
     FFT_DESTROY_PLAN(_q->fft);
 
@@ -317,42 +382,85 @@ void SPGRAM(_write)(SPGRAM()     _q,
                     TI *         _x,
                     unsigned int _n)
 {
-#if 0
-    // write a block of samples to the internal window
-    WINDOW(_write)(_q->buffer, _x, _n);
-#else
-    // TODO: be smarter about how to write and execute samples
+    // samples carried over from previous calls (oldest first); the
+    // window buffer is not updated until all transforms are computed
+    TI * rc;
+    WINDOW(_read)(_q->buffer, &rc);
+
+    // compute transforms at each boundary within the block, reading
+    // each window directly from the carried-over samples and the input
+    unsigned int len = _q->window_len;
     unsigned int i;
-    for (i=0; i<_n; i++)
-        SPGRAM(_push)(_q, _x[i]);
-#endif
-}
+    for (i=_q->sample_timer; i<=_n; i+=_q->delay) {
+        if (i < len)
+            SPGRAM(_transform)(_q, rc + i, len - i, _x);
+        else
+            SPGRAM(_transform)(_q, _x + i - len, len, NULL);
+    }
 
+    // update timer, counters, and internal buffer
+    _q->sample_timer       = i - _n;
+    _q->num_samples       += _n;
+    _q->num_samples_total += _n;
+    WINDOW(_write)(_q->buffer, _x, _n);
+}
 
 // compute spectral periodogram output from current buffer contents
 //  _q      :   spgram object
 void SPGRAM(_step)(SPGRAM() _q)
 {
-    unsigned int i;
-
-    // read buffer, copy to FFT input (applying window)
-    // TODO: use SIMD extensions to speed this up
     TI * rc;
     WINDOW(_read)(_q->buffer, &rc);
-    for (i=0; i<_q->window_len; i++)
-        _q->buf_time[i] = rc[i] * _q->w[i];
+    SPGRAM(_transform)(_q, rc, _q->window_len, NULL);
+}
+
+// compute spectral periodogram output from a window of samples split
+// across two arrays
+//  _q      :   spgram object
+//  _x0     :   first part of window [size: _n0 x 1]
+//  _n0     :   number of samples in first part, _n0 <= window_len
+//  _x1     :   remainder of window [size: window_len-_n0 x 1]
+void SPGRAM(_transform)(SPGRAM()     _q,
+                        TI *         _x0,
+                        unsigned int _n0,
+                        TI *         _x1)
+{
+    // copy to FFT input, applying window
+#if TI_COMPLEX
+    // interleaved real/imaginary components
+    float * buf = (float*)_q->buf_time;
+    liquid_vectorf_mul((float*)_x0, _q->w, 2*_n0, buf);
+    liquid_vectorf_mul((float*)_x1, _q->w + 2*_n0, 2*(_q->window_len - _n0), buf + 2*_n0);
+#else
+    liquid_vectorf_mul(_x0, _q->w, _n0, _q->buf_time);
+    liquid_vectorf_mul(_x1, _q->w + _n0, _q->window_len - _n0, _q->buf_time + _n0);
+#endif
 
     // execute fft on _q->buf_time and store result in _q->buf_freq
     FFT_EXECUTE(_q->fft);
 
     // accumulate output
-    for (i=0; i<_q->nfft; i++) {
-        T v = crealf( _q->buf_freq[i] * conjf(_q->buf_freq[i]) );
-        if (_q->num_transforms == 0)
-            _q->psd[i] = v;
-        else
-            _q->psd[i] = _q->gamma*_q->psd[i] + _q->alpha*v;
+#if TI_COMPLEX
+    unsigned int n = _q->nfft;
+#else
+    unsigned int n = _q->nfft/2 + 1;
+#endif
+    if (_q->num_transforms == 0) {
+        liquid_vectorcf_abs2(_q->buf_freq, n, _q->psd);
+    } else {
+        liquid_vectorcf_abs2(_q->buf_freq, n, _q->buf_psd);
+        if (!_q->accumulate) {
+            liquid_vectorf_mulscalar(_q->psd,     n, _q->gamma, _q->psd);
+            liquid_vectorf_mulscalar(_q->buf_psd, n, _q->alpha, _q->buf_psd);
+        }
+        liquid_vectorf_add(_q->psd, _q->buf_psd, n, _q->psd);
     }
+#if !TI_COMPLEX
+    // spectrum of real input is conjugate symmetric
+    unsigned int i;
+    for (i=n; i<_q->nfft; i++)
+        _q->psd[i] = _q->psd[_q->nfft - i];
+#endif
 
     _q->num_transforms++;
     _q->num_transforms_total++;
@@ -444,3 +552,169 @@ void SPGRAM(_estimate_psd)(unsigned int _nfft,
     // destroy object
     SPGRAM(_destroy)(q);
 }
+
+// estimate spectrum on input signal with Welch's method, splitting the
+// overlapping transforms across a pool of threads
+//  _nfft        :   FFT size
+//  _wtype       :   window type, e.g. LIQUID_WINDOW_HAMMING
+//  _window_len  :   window length, _window_len in [1,_nfft]
+//  _delay       :   delay between transforms, _delay > 0
+//  _x           :   input signal [size: _n x 1]
+//  _n           :   input signal length
+//  _num_threads :   number of threads, > 0
+//  _psd         :   output spectrum (dB) [size: _nfft x 1]
+void SPGRAM(_estimate_psd_welch)(unsigned int _nfft,
+                                 int          _wtype,
+                                 unsigned int _window_len,
+                                 unsigned int _delay,
+                                 TI *         _x,
+                                 unsigned int _n,
+                                 unsigned int _num_threads,
+                                 T *          _psd)
+{
+    // validate input
+    if (_num_threads == 0) {
+        fprintf(stderr,"error: spgram%s_estimate_psd_welch(), number of threads must be greater than 0\n", EXTENSION);
+        exit(1);
+    }
+
+    // create worker pool and one spgram object (and thus FFT plan,
+    // sharing tables through the transform cache) for each worker
+    liquid_workers workers = _num_threads > 1 ? liquid_workers_create(_num_threads) : NULL;
+    unsigned int num_workers = liquid_workers_get_num_workers(workers);
+
+    struct SPGRAM(_welch_s) welch;
+    welch.q = (SPGRAM()*) malloc(num_workers*sizeof(SPGRAM()));
+    unsigned int i;
+    for (i=0; i<num_workers; i++)
+        welch.q[i] = SPGRAM(_create)(_nfft, _wtype, _window_len, _delay);
+
+    // transforms occur after every _delay samples, as with _write()
+    welch.x              = _x;
+    welch.num_transforms = _n / _delay;
+    welch.num_batches    = welch.num_transforms < SPGRAM_WELCH_NUM_BATCHES ?
+                           welch.num_transforms : SPGRAM_WELCH_NUM_BATCHES;
+    welch.psd            = (T*) malloc(welch.num_batches*_nfft*sizeof(T));
+    liquid_workers_run(workers, SPGRAM(_welch_task), &welch, welch.num_batches);
+
+    // sum partial spectra in order
+    SPGRAM() q = welch.q[0];
+    SPGRAM(_clear)(q);
+    for (i=0; i<welch.num_batches; i++)
+        liquid_vectorf_add(q->psd, welch.psd + i*_nfft, _nfft, q->psd);
+    q->num_transforms = welch.num_transforms;
+    SPGRAM(_get_psd)(q, _psd);
+
+    // clean up allocated objects and memory
+    for (i=0; i<num_workers; i++)
+        SPGRAM(_destroy)(welch.q[i]);
+    free(welch.q);
+    free(welch.psd);
+    liquid_workers_destroy(workers);
+}
+
+// estimate spectrum of a capture file (raw samples in native format)
+// with Welch's method; the file is memory-mapped where supported
+//  _nfft        :   FFT size
+//  _wtype       :   window type, e.g. LIQUID_WINDOW_HAMMING
+//  _window_len  :   window length, _window_len in [1,_nfft]
+//  _delay       :   delay between transforms, _delay > 0
+//  _filename    :   input file name
+//  _num_threads :   number of threads, > 0
+//  _psd         :   output spectrum (dB) [size: _nfft x 1]
+int SPGRAM(_estimate_psd_file)(unsigned int _nfft,
+                               int          _wtype,
+                               unsigned int _window_len,
+                               unsigned int _delay,
+                               const char * _filename,
+                               unsigned int _num_threads,
+                               T *          _psd)
+{
+    FILE * fid = fopen(_filename,"rb");
+    if (fid == NULL) {
+        fprintf(stderr,"error: spgram%s_estimate_psd_file(), could not open '%s' for reading\n",
+                EXTENSION, _filename);
+        return -1;
+    }
+
+    // determine number of samples
+    fseek(fid, 0, SEEK_END);
+    long int num_bytes = ftell(fid);
+    fseek(fid, 0, SEEK_SET);
+    if (num_bytes > 0 && (unsigned long int)num_bytes / sizeof(TI) > UINT_MAX) {
+        fprintf(stderr,"error: spgram%s_estimate_psd_file(), '%s' has more than %u samples\n",
+                EXTENSION, _filename, UINT_MAX);
+        fclose(fid);
+        return -1;
+    }
+    unsigned int n = num_bytes > 0 ? (unsigned int)(num_bytes / sizeof(TI)) : 0;
+
+    TI * x = NULL;
+#if HAVE_SYS_MMAN_H && HAVE_SYS_STAT_H
+    void * map = n > 0 ? mmap(NULL, (size_t)num_bytes, PROT_READ, MAP_PRIVATE, fileno(fid), 0) : MAP_FAILED;
+    if (map != MAP_FAILED) {
+        x = (TI*) map;
+        madvise(map, (size_t)num_bytes, MADV_SEQUENTIAL);
+    }
+#endif
+
+    // read file into memory if it could not be mapped
+    int mapped = x != NULL;
+    if (!mapped) {
+        x = (TI*) malloc((n > 0 ? n : 1)*sizeof(TI));
+        if (fread(x, sizeof(TI), n, fid) != n) {
+            fprintf(stderr,"error: spgram%s_estimate_psd_file(), could not read '%s'\n",
+                    EXTENSION, _filename);
+            free(x);
+            fclose(fid);
+            return -1;
+        }
+    }
+
+    SPGRAM(_estimate_psd_welch)(_nfft, _wtype, _window_len, _delay, x, n, _num_threads, _psd);
+
+    // clean up
+#if HAVE_SYS_MMAN_H && HAVE_SYS_STAT_H
+    if (mapped)
+        munmap(x, (size_t)num_bytes);
+#endif
+    if (!mapped)
+        free(x);
+    fclose(fid);
+    return 0;
+}
+
+// Welch estimate task: compute partial spectra for batches [_start,_end)
+void SPGRAM(_welch_task)(void *       _context,
+                         unsigned int _worker,
+                         unsigned int _start,
+                         unsigned int _end)
+{
+    struct SPGRAM(_welch_s) * welch = (struct SPGRAM(_welch_s) *) _context;
+    SPGRAM() q = welch->q[_worker];
+
+    // window buffer is never written and holds zeros, standing in for
+    // samples before the start of the signal
+    TI * rc;
+    WINDOW(_read)(q->buffer, &rc);
+
+    unsigned int len = q->window_len;
+    unsigned int b;
+    for (b=_start; b<_end; b++) {
+        // transforms in batch
+        unsigned int t0 = (uint64_t) b    * welch->num_transforms / welch->num_batches;
+        unsigned int t1 = (uint64_t)(b+1) * welch->num_transforms / welch->num_batches;
+
+        SPGRAM(_clear)(q);
+        unsigned int t;
+        for (t=t0; t<t1; t++) {
+            // number of samples consumed at transform
+            unsigned int i = (t+1)*q->delay;
+            if (i < len)
+                SPGRAM(_transform)(q, rc + i, len - i, welch->x);
+            else
+                SPGRAM(_transform)(q, welch->x + i - len, len, NULL);
+        }
+        memmove(welch->psd + b*q->nfft, q->psd, q->nfft*sizeof(T));
+    }
+}
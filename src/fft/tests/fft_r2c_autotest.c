@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_r2c_autotest.c : test real-input transforms (half spectrum)
+//
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// autotest helper function: compare real-to-complex transform to full
+// complex transform, and complex-to-real transform to original input
+//  _n      :   transform size
+void fft_r2c_test(unsigned int _n)
+{
+    float tol = 1e-5f * _n;
+    unsigned int i;
+
+    float         x[_n];        // real input
+    float complex xc[_n];       // real input (promoted)
+    float complex y_test[_n];   // full spectrum
+    float complex y[_n/2+1];    // half spectrum
+    float         z[_n];        // inverse
+    for (i=0; i<_n; i++) {
+        x[i]  = randnf();
+        xc[i] = x[i];
+    }
+
+    // compute full complex transform
+    fft_run(_n, xc, y_test, LIQUID_FFT_FORWARD, 0);
+
+    // compute real-to-complex transform
+    fftplan q0 = fft_create_plan_r2c(_n, x, y, 0);
+    fft_execute(q0);
+
+    // compute complex-to-real transform
+    fftplan q1 = fft_create_plan_c2r(_n, y, z, 0);
+    fft_execute(q1);
+
+    if (liquid_autotest_verbose)
+        fft_print_plan(q0);
+
+    // validate results
+    for (i=0; i<=_n/2; i++) {
+        CONTEND_DELTA( crealf(y[i]), crealf(y_test[i]), tol );
+        CONTEND_DELTA( cimagf(y[i]), cimagf(y_test[i]), tol );
+    }
+    for (i=0; i<_n; i++)
+        CONTEND_DELTA( z[i] / (float)_n, x[i], 1e-5f );
+
+    // destroy plans
+    fft_destroy_plan(q0);
+    fft_destroy_plan(q1);
+}
+
+// even lengths (packed half-length transform)
+void autotest_fft_r2c_n2()      { fft_r2c_test(   2); }
+void autotest_fft_r2c_n8()      { fft_r2c_test(   8); }
+void autotest_fft_r2c_n30()     { fft_r2c_test(  30); }
+void autotest_fft_r2c_n64()     { fft_r2c_test(  64); }
+void autotest_fft_r2c_n100()    { fft_r2c_test( 100); }
+void autotest_fft_r2c_n202()    { fft_r2c_test( 202); }
+void autotest_fft_r2c_n1024()   { fft_r2c_test(1024); }
+
+// odd lengths (full-length transform)
+void autotest_fft_r2c_n1()      { fft_r2c_test(   1); }
+void autotest_fft_r2c_n17()     { fft_r2c_test(  17); }
+void autotest_fft_r2c_n27()     { fft_r2c_test(  27); }
+
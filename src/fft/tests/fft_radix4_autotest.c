@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_radix4_autotest.c : test radix-4 transforms against radix-2
+//
+
+#include <string.h>
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// test radix-4 transform for each supported set of butterfly kernels
+//  _nfft   :   transform size (power of two)
+//  _dir    :   transform direction
+void fft_radix4_test(unsigned int _nfft,
+                     int          _dir)
+{
+    float tol = 1e-5f * _nfft;
+    unsigned int i;
+    float complex x[_nfft];
+    float complex y_test[_nfft];
+    float complex y[_nfft];
+    float complex z[_nfft];
+    for (i=0; i<_nfft; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // compute reference using radix-2 transform
+    fftplan q0 = fft_create_plan_radix2(_nfft, x, y_test, _dir, 0);
+    fft_execute(q0);
+    fft_destroy_plan(q0);
+
+    liquid_simd_type types[3] = {LIQUID_SIMD_PORTABLE, LIQUID_SIMD_SSE, LIQUID_SIMD_AVX2};
+    unsigned int t;
+    for (t=0; t<3; t++) {
+        if (!liquid_simd_is_supported(types[t]))
+            continue;
+        liquid_simd_set_type(types[t]);
+
+        // out-of-place transform
+        fftplan q1 = fft_create_plan_radix4(_nfft, x, y, _dir, 0);
+        fft_execute(q1);
+        fft_destroy_plan(q1);
+
+        // in-place transform
+        memmove(z, x, _nfft*sizeof(float complex));
+        fftplan q2 = fft_create_plan_radix4(_nfft, z, z, _dir, 0);
+        fft_execute(q2);
+        fft_destroy_plan(q2);
+
+        if (liquid_autotest_verbose)
+            printf("  radix4, n=%u, %s\n", _nfft, liquid_simd_type_str[types[t]][0]);
+
+        for (i=0; i<_nfft; i++) {
+            CONTEND_DELTA( crealf(y[i]), crealf(y_test[i]), tol );
+            CONTEND_DELTA( cimagf(y[i]), cimagf(y_test[i]), tol );
+            CONTEND_DELTA( crealf(z[i]), crealf(y_test[i]), tol );
+            CONTEND_DELTA( cimagf(z[i]), cimagf(y_test[i]), tol );
+        }
+    }
+
+    // restore default
+    liquid_simd_set_type(LIQUID_SIMD_AUTO);
+}
+
+// even and odd log2(nfft), spanning all stage configurations
+void autotest_fft_radix4_4()        { fft_radix4_test(   4, LIQUID_FFT_FORWARD);  }
+void autotest_fft_radix4_8()        { fft_radix4_test(   8, LIQUID_FFT_FORWARD);  }
+void autotest_fft_radix4_16()       { fft_radix4_test(  16, LIQUID_FFT_FORWARD);  }
+void autotest_fft_radix4_32()       { fft_radix4_test(  32, LIQUID_FFT_FORWARD);  }
+void autotest_fft_radix4_64()       { fft_radix4_test(  64, LIQUID_FFT_FORWARD);  }
+void autotest_fft_radix4_128()      { fft_radix4_test( 128, LIQUID_FFT_FORWARD);  }
+void autotest_fft_radix4_1024()     { fft_radix4_test(1024, LIQUID_FFT_FORWARD);  }
+void autotest_fft_radix4_2048()     { fft_radix4_test(2048, LIQUID_FFT_FORWARD);  }
+void autotest_ifft_radix4_32()      { fft_radix4_test(  32, LIQUID_FFT_BACKWARD); }
+void autotest_ifft_radix4_256()     { fft_radix4_test( 256, LIQUID_FFT_BACKWARD); }
+void autotest_ifft_radix4_2048()    { fft_radix4_test(2048, LIQUID_FFT_BACKWARD); }
+
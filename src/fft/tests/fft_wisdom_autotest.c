@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// compute regular DFT for reference
+void fft_wisdom_test_dft(float complex * _x,
+                         float complex * _y,
+                         unsigned int    _nfft,
+                         int             _dir)
+{
+    unsigned int i;
+    unsigned int k;
+    float d = (_dir == LIQUID_FFT_FORWARD) ? -1.0f : 1.0f;
+    for (i=0; i<_nfft; i++) {
+        _y[i] = 0.0f;
+        for (k=0; k<_nfft; k++)
+            _y[i] += _x[k] * cexpf(_Complex_I*d*2*M_PI*(float)((i*k)%_nfft)/(float)_nfft);
+    }
+}
+
+// test plans sharing cached tables
+void fft_cache_test(unsigned int _nfft)
+{
+    float tol = 2e-4f * _nfft;
+    unsigned int i;
+    float complex x[_nfft];
+    float complex y0[_nfft];
+    float complex y1[_nfft];
+    float complex y2[_nfft];
+    float complex y_test[_nfft];
+    for (i=0; i<_nfft; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // first plan adds entries to the cache, second plan of the same size
+    // and direction shares them
+    unsigned int n0 = fft_cache_get_num_entries();
+    fftplan q0 = fft_create_plan(_nfft, x, y0, LIQUID_FFT_FORWARD, 0);
+    unsigned int n1 = fft_cache_get_num_entries();
+    fftplan q1 = fft_create_plan(_nfft, x, y1, LIQUID_FFT_FORWARD, 0);
+    CONTEND_EXPRESSION( (n1 > n0) );
+    CONTEND_EQUALITY( fft_cache_get_num_entries(), n1 );
+
+    // reverse transform requires its own tables
+    fftplan q2 = fft_create_plan(_nfft, x, y2, LIQUID_FFT_BACKWARD, 0);
+    CONTEND_EXPRESSION( (fft_cache_get_num_entries() > n1) );
+
+    // run transforms and compare to regular DFT
+    fft_execute(q0);
+    fft_execute(q1);
+    fft_execute(q2);
+    fft_wisdom_test_dft(x, y_test, _nfft, LIQUID_FFT_FORWARD);
+    for (i=0; i<_nfft; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y_test[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y_test[i]), tol );
+        CONTEND_EQUALITY( y1[i], y0[i] );
+    }
+    fft_wisdom_test_dft(x, y_test, _nfft, LIQUID_FFT_BACKWARD);
+    for (i=0; i<_nfft; i++) {
+        CONTEND_DELTA( crealf(y2[i]), crealf(y_test[i]), tol );
+        CONTEND_DELTA( cimagf(y2[i]), cimagf(y_test[i]), tol );
+    }
+
+    // destroying one plan retains tables for the other
+    fft_destroy_plan(q0);
+    fft_destroy_plan(q2);
+    CONTEND_EQUALITY( fft_cache_get_num_entries(), n1 );
+    fft_execute(q1);
+    for (i=0; i<_nfft; i++)
+        CONTEND_EQUALITY( y1[i], y0[i] );
+
+    // destroying last plan frees all tables
+    fft_destroy_plan(q1);
+    CONTEND_EQUALITY( fft_cache_get_num_entries(), n0 );
+}
+
+void autotest_fft_cache_dft_11()        { fft_cache_test( 11); }
+void autotest_fft_cache_radix2_64()     { fft_cache_test( 64); }
+void autotest_fft_cache_composite_240() { fft_cache_test(240); }
+void autotest_fft_cache_rader_101()     { fft_cache_test(101); }
+void autotest_fft_cache_rader2_257()    { fft_cache_test(257); }
+
+// test wisdom export and import
+void autotest_fft_wisdom_file()
+{
+    const char filename[] = "/tmp/liquid_fft_wisdom_autotest.txt";
+    liquid_fft_wisdom_forget();
+
+    // record wisdom and export to file
+    liquid_fft_wisdom_set( 64, LIQUID_FFT_METHOD_RADIX2);
+    liquid_fft_wisdom_set(101, LIQUID_FFT_METHOD_RADER2);
+    CONTEND_EQUALITY( liquid_fft_wisdom_export(filename), 0 );
+
+    // invalid methods are not recorded
+    liquid_fft_wisdom_set( 17, LIQUID_FFT_METHOD_RADIX2);
+    CONTEND_EQUALITY( liquid_fft_wisdom_lookup(17), LIQUID_FFT_METHOD_UNKNOWN );
+
+    // forget and re-import
+    liquid_fft_wisdom_forget();
+    CONTEND_EQUALITY( liquid_fft_wisdom_lookup( 64), LIQUID_FFT_METHOD_UNKNOWN );
+    CONTEND_EQUALITY( liquid_fft_wisdom_import(filename), 0 );
+    CONTEND_EQUALITY( liquid_fft_wisdom_lookup( 64), LIQUID_FFT_METHOD_RADIX2 );
+    CONTEND_EQUALITY( liquid_fft_wisdom_lookup(101), LIQUID_FFT_METHOD_RADER2 );
+    CONTEND_EQUALITY( liquid_fft_wisdom_lookup(100), LIQUID_FFT_METHOD_UNKNOWN );
+
+    // plans created with wisdom compute the correct transform
+    unsigned int i;
+    float complex x[101];
+    float complex y[101];
+    float complex y_test[101];
+    for (i=0; i<101; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+    fftplan q = fft_create_plan(101, x, y, LIQUID_FFT_FORWARD, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+    fft_wisdom_test_dft(x, y_test, 101, LIQUID_FFT_FORWARD);
+    for (i=0; i<101; i++) {
+        CONTEND_DELTA( crealf(y[i]), crealf(y_test[i]), 0.02f );
+        CONTEND_DELTA( cimagf(y[i]), cimagf(y_test[i]), 0.02f );
+    }
+
+    // invalid lines are ignored
+    FILE * fid = fopen(filename, "w");
+    fprintf(fid,"# invalid wisdom\n");
+    fprintf(fid,"17 radix2\n");
+    fprintf(fid,"32 unknown-method\n");
+    fprintf(fid,"48 mixed-radix\n");
+    fclose(fid);
+    liquid_fft_wisdom_forget();
+    CONTEND_EQUALITY( liquid_fft_wisdom_import(filename), -1 );
+    CONTEND_EQUALITY( liquid_fft_wisdom_lookup(17), LIQUID_FFT_METHOD_UNKNOWN );
+    CONTEND_EQUALITY( liquid_fft_wisdom_lookup(32), LIQUID_FFT_METHOD_UNKNOWN );
+    CONTEND_EQUALITY( liquid_fft_wisdom_lookup(48), LIQUID_FFT_METHOD_MIXED_RADIX );
+
+    remove(filename);
+    liquid_fft_wisdom_forget();
+}
+
+// test measuring methods
+void autotest_fft_wisdom_measure()
+{
+    liquid_fft_wisdom_forget();
+
+    // measure composite and prime sizes
+    liquid_fft_wisdom_measure(30);
+    liquid_fft_wisdom_measure(37);
+    CONTEND_EXPRESSION( liquid_fft_method_is_valid(liquid_fft_wisdom_lookup(30), 30) );
+    CONTEND_EXPRESSION( liquid_fft_method_is_valid(liquid_fft_wisdom_lookup(37), 37) );
+
+    // plan flag measures sizes without wisdom, including sub-transforms
+    float complex x[74];
+    float complex y[74];
+    fftplan q = fft_create_plan(74, x, y, LIQUID_FFT_FORWARD, LIQUID_FFT_MEASURE);
+    fft_destroy_plan(q);
+    CONTEND_EXPRESSION( liquid_fft_method_is_valid(liquid_fft_wisdom_lookup(74), 74) );
+
+    liquid_fft_wisdom_forget();
+}
+
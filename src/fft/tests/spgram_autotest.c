@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// spgram_autotest.c : test spectral periodogram
+//
+
+#include "autotest/autotest.h"
+#include <stdlib.h>
+#include "liquid.h"
+
+// real-valued input (half-spectrum transform) should yield the same
+// spectrum as the equivalent complex-valued input
+void spgram_real_test(unsigned int _nfft,
+                      unsigned int _window_len,
+                      unsigned int _delay)
+{
+    float tol = 1e-3f;  // error tolerance [dB]
+    unsigned int i;
+
+    spgramf  qf = spgramf_create (_nfft, LIQUID_WINDOW_HAMMING, _window_len, _delay);
+    spgramcf qc = spgramcf_create(_nfft, LIQUID_WINDOW_HAMMING, _window_len, _delay);
+
+    // push the same (real) signal through both objects
+    unsigned int num_samples = 8*_nfft + 3;
+    for (i=0; i<num_samples; i++) {
+        float x = 0.3f*cosf(0.2f*i) + 0.1f*randnf();
+        spgramf_push (qf, x);
+        spgramcf_push(qc, x);
+    }
+    CONTEND_EQUALITY( spgramf_get_num_transforms(qf), spgramcf_get_num_transforms(qc) );
+
+    float psdf[_nfft];
+    float psdc[_nfft];
+    spgramf_get_psd (qf, psdf);
+    spgramcf_get_psd(qc, psdc);
+    for (i=0; i<_nfft; i++)
+        CONTEND_DELTA( psdf[i], psdc[i], tol );
+
+    spgramf_destroy(qf);
+    spgramcf_destroy(qc);
+}
+
+void autotest_spgram_real_n64()     { spgram_real_test(  64,  64,  16); }
+void autotest_spgram_real_n100()    { spgram_real_test( 100,  60,  25); }
+void autotest_spgram_real_n127()    { spgram_real_test( 127, 100,  20); }
+void autotest_spgram_real_n1024()   { spgram_real_test(1024, 800, 200); }
+
+
+// writing blocks of samples should yield the same spectrum as pushing
+// samples one at a time, regardless of block size
+void spgram_write_test(unsigned int _nfft,
+                       unsigned int _window_len,
+                       unsigned int _delay,
+                       float        _alpha)
+{
+    float tol = 1e-4f;  // error tolerance [dB]
+    unsigned int i;
+
+    spgramf  qf0 = spgramf_create (_nfft, LIQUID_WINDOW_HAMMING, _window_len, _delay);
+    spgramf  qf1 = spgramf_create (_nfft, LIQUID_WINDOW_HAMMING, _window_len, _delay);
+    spgramcf qc0 = spgramcf_create(_nfft, LIQUID_WINDOW_HAMMING, _window_len, _delay);
+    spgramcf qc1 = spgramcf_create(_nfft, LIQUID_WINDOW_HAMMING, _window_len, _delay);
+    spgramf_set_alpha (qf0, _alpha);
+    spgramf_set_alpha (qf1, _alpha);
+    spgramcf_set_alpha(qc0, _alpha);
+    spgramcf_set_alpha(qc1, _alpha);
+
+    // generate signal
+    unsigned int num_samples = 12*_nfft + 7;
+    float         xf[num_samples];
+    float complex xc[num_samples];
+    for (i=0; i<num_samples; i++) {
+        xf[i] = 0.3f*cosf(0.2f*i) + 0.1f*randnf();
+        xc[i] = 0.3f*cexpf(_Complex_I*0.2f*i) + 0.1f*(randnf() + _Complex_I*randnf());
+        spgramf_push (qf0, xf[i]);
+        spgramcf_push(qc0, xc[i]);
+    }
+
+    // write in blocks of varying size, shorter and longer than window
+    unsigned int n = 0;
+    unsigned int block = 1;
+    while (n < num_samples) {
+        block = block > 3*_nfft ? 0 : block;
+        unsigned int k = block < num_samples - n ? block : num_samples - n;
+        spgramf_write (qf1, xf + n, k);
+        spgramcf_write(qc1, xc + n, k);
+        n += k;
+        block = 2*block + 1;
+    }
+    CONTEND_EQUALITY( spgramf_get_num_transforms(qf0),  spgramf_get_num_transforms(qf1)  );
+    CONTEND_EQUALITY( spgramcf_get_num_transforms(qc0), spgramcf_get_num_transforms(qc1) );
+    CONTEND_EQUALITY( spgramf_get_num_samples(qf0),     spgramf_get_num_samples(qf1)     );
+    CONTEND_EQUALITY( spgramcf_get_num_samples(qc0),    spgramcf_get_num_samples(qc1)    );
+
+    float psd0[_nfft];
+    float psd1[_nfft];
+    spgramf_get_psd(qf0, psd0);
+    spgramf_get_psd(qf1, psd1);
+    for (i=0; i<_nfft; i++)
+        CONTEND_DELTA( psd0[i], psd1[i], tol );
+
+    spgramcf_get_psd(qc0, psd0);
+    spgramcf_get_psd(qc1, psd1);
+    for (i=0; i<_nfft; i++)
+        CONTEND_DELTA( psd0[i], psd1[i], tol );
+
+    spgramf_destroy(qf0);
+    spgramf_destroy(qf1);
+    spgramcf_destroy(qc0);
+    spgramcf_destroy(qc1);
+}
+
+void autotest_spgram_write_n64()    { spgram_write_test(  64,  64,  16, -1.0f); }
+void autotest_spgram_write_n100()   { spgram_write_test( 100,  60,  75, -1.0f); }
+void autotest_spgram_write_n127()   { spgram_write_test( 127, 100,  20,  0.1f); }
+void autotest_spgram_write_n1024()  { spgram_write_test(1024, 800, 200,  0.02f); }
+
+// parallel Welch estimate should match serial estimate and should not
+// depend on the number of threads
+void spgram_welch_test(unsigned int _nfft,
+                       unsigned int _window_len,
+                       unsigned int _delay,
+                       unsigned int _num_samples)
+{
+    float tol = 1e-3f;  // error tolerance [dB]
+    unsigned int i;
+
+    // generate signal
+    float complex * x = (float complex*) malloc(_num_samples*sizeof(float complex));
+    for (i=0; i<_num_samples; i++)
+        x[i] = 0.3f*cexpf(_Complex_I*0.2f*i) + 0.1f*(randnf() + _Complex_I*randnf());
+
+    // serial estimate
+    float psd[_nfft];
+    spgramcf q = spgramcf_create(_nfft, LIQUID_WINDOW_HANN, _window_len, _delay);
+    spgramcf_write(q, x, _num_samples);
+    spgramcf_get_psd(q, psd);
+    spgramcf_destroy(q);
+
+    // parallel estimates
+    float psd_1[_nfft];
+    float psd_4[_nfft];
+    spgramcf_estimate_psd_welch(_nfft, LIQUID_WINDOW_HANN, _window_len, _delay,
+                                x, _num_samples, 1, psd_1);
+    spgramcf_estimate_psd_welch(_nfft, LIQUID_WINDOW_HANN, _window_len, _delay,
+                                x, _num_samples, 4, psd_4);
+    for (i=0; i<_nfft; i++) {
+        CONTEND_DELTA   (psd_1[i], psd[i], tol);
+        CONTEND_EQUALITY(psd_4[i], psd_1[i]);
+    }
+
+    // estimate from capture file
+    const char filename[] = "/tmp/liquid_spgram_welch_autotest.dat";
+    FILE * fid = fopen(filename, "wb");
+    fwrite(x, sizeof(float complex), _num_samples, fid);
+    fclose(fid);
+    float psd_file[_nfft];
+    CONTEND_EQUALITY(spgramcf_estimate_psd_file(_nfft, LIQUID_WINDOW_HANN, _window_len,
+                                                _delay, filename, 2, psd_file), 0);
+    for (i=0; i<_nfft; i++)
+        CONTEND_EQUALITY(psd_file[i], psd_1[i]);
+    remove(filename);
+
+    free(x);
+}
+
+void autotest_spgram_welch_n64()    { spgram_welch_test(  64,  64,  16,   1000); }
+void autotest_spgram_welch_n100()   { spgram_welch_test( 100,  60,  75,   5003); }
+void autotest_spgram_welch_n1024()  { spgram_welch_test(1024, 800, 200, 400000); }
@@ -28,7 +28,8 @@ void firdecim_crcf_bench(struct rusage *     _start,
                          struct rusage *     _finish,
                          unsigned long int * _num_iterations,
                          unsigned int        _M,
-                         unsigned int        _h_len)
+                         unsigned int        _h_len,
+                         int                 _block)
 {
     // normalize number of iterations
     *_num_iterations /= _h_len;
@@ -42,22 +43,32 @@ void firdecim_crcf_bench(struct rusage *     _start,
     firdecim_crcf q = firdecim_crcf_create(_M,h,_h_len);
 
     // initialize input
-    float complex x[_M];
-    for (i=0; i<_M; i++)
+    unsigned int num_outputs = 64;
+    float complex x[num_outputs*_M];
+    for (i=0; i<num_outputs*_M; i++)
         x[i] = (i%2) ? 1.0f : -1.0f;
 
-    float complex y;
+    float complex y[num_outputs];
 
     // start trials
     getrusage(RUSAGE_SELF, _start);
-    for (i=0; i<(*_num_iterations); i++) {
-        firdecim_crcf_execute(q, x, &y);
-        firdecim_crcf_execute(q, x, &y);
-        firdecim_crcf_execute(q, x, &y);
-        firdecim_crcf_execute(q, x, &y);
+    if (_block) {
+        // compute block of outputs at a time
+        *_num_iterations /= 16;
+        if (*_num_iterations < 1) *_num_iterations = 1;
+        for (i=0; i<(*_num_iterations); i++)
+            firdecim_crcf_execute_block(q, x, num_outputs, y);
+        *_num_iterations *= num_outputs;
+    } else {
+        for (i=0; i<(*_num_iterations); i++) {
+            firdecim_crcf_execute(q, x, &y[0]);
+            firdecim_crcf_execute(q, x, &y[0]);
+            firdecim_crcf_execute(q, x, &y[0]);
+            firdecim_crcf_execute(q, x, &y[0]);
+        }
+        *_num_iterations *= 4;
     }
     getrusage(RUSAGE_SELF, _finish);
-    *_num_iterations *= 4;
 
     firdecim_crcf_destroy(q);
 }
@@ -66,7 +77,13 @@ void firdecim_crcf_bench(struct rusage *     _start,
 (   struct rusage *_start,                      \
     struct rusage *_finish,                     \
     unsigned long int *_num_iterations)         \
-{ firdecim_crcf_bench(_start, _finish, _num_iterations, M, H_LEN); }
+{ firdecim_crcf_bench(_start, _finish, _num_iterations, M, H_LEN, 0); }
+
+#define FIRDECIM_CRCF_BLOCK_BENCHMARK_API(M,H_LEN)  \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ firdecim_crcf_bench(_start, _finish, _num_iterations, M, H_LEN, 1); }
 
 void benchmark_firdecim_crcf_m2_h8     FIRDECIM_CRCF_BENCHMARK_API(2, 8)
 void benchmark_firdecim_crcf_m4_h16    FIRDECIM_CRCF_BENCHMARK_API(4, 16)
@@ -74,3 +91,10 @@ void benchmark_firdecim_crcf_m8_h32    FIRDECIM_CRCF_BENCHMARK_API(8, 32)
 void benchmark_firdecim_crcf_m16_h64   FIRDECIM_CRCF_BENCHMARK_API(16,64)
 void benchmark_firdecim_cccf_m32_h128  FIRDECIM_CRCF_BENCHMARK_API(32,128)
 
+// block execution (output samples/s comparable to above)
+void benchmark_firdecim_crcf_block_m2_h8     FIRDECIM_CRCF_BLOCK_BENCHMARK_API(2, 8)
+void benchmark_firdecim_crcf_block_m4_h16    FIRDECIM_CRCF_BLOCK_BENCHMARK_API(4, 16)
+void benchmark_firdecim_crcf_block_m8_h32    FIRDECIM_CRCF_BLOCK_BENCHMARK_API(8, 32)
+void benchmark_firdecim_crcf_block_m16_h64   FIRDECIM_CRCF_BLOCK_BENCHMARK_API(16,64)
+void benchmark_firdecim_crcf_block_m32_h128  FIRDECIM_CRCF_BLOCK_BENCHMARK_API(32,128)
+
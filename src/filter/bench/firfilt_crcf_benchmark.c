@@ -27,7 +27,9 @@
 void firfilt_crcf_bench(struct rusage *_start,
                         struct rusage *_finish,
                         unsigned long int *_num_iterations,
-                        unsigned int _n)
+                        unsigned int _n,
+                        int _block,
+                        liquid_firfilt_method _method)
 {
     // adjust number of iterations:
     // cycles/trial ~ 107 + 4.3*_n
@@ -41,26 +43,35 @@ void firfilt_crcf_bench(struct rusage *_start,
         h[i] = randnf();
 
     // create filter object
-    firfilt_crcf f = firfilt_crcf_create(h,_n);
+    firfilt_crcf f = firfilt_crcf_create_method(h,_n,_method,0);
 
     // generate input vector
-    float complex x[4];
-    for (i=0; i<4; i++)
+    float complex x[256];
+    for (i=0; i<256; i++)
         x[i] = randnf() + _Complex_I*randnf();
 
     // output vector
-    float complex y[4];
+    float complex y[256];
 
     // start trials
     getrusage(RUSAGE_SELF, _start);
-    for (i=0; i<(*_num_iterations); i++) {
-        firfilt_crcf_push(f, x[0]); firfilt_crcf_execute(f, &y[0]);
-        firfilt_crcf_push(f, x[1]); firfilt_crcf_execute(f, &y[1]);
-        firfilt_crcf_push(f, x[2]); firfilt_crcf_execute(f, &y[2]);
-        firfilt_crcf_push(f, x[3]); firfilt_crcf_execute(f, &y[3]);
+    if (_block) {
+        // process block of 256 samples at a time
+        *_num_iterations /= 64;
+        if (*_num_iterations < 1) *_num_iterations = 1;
+        for (i=0; i<(*_num_iterations); i++)
+            firfilt_crcf_execute_block(f, x, 256, y);
+        *_num_iterations *= 256;
+    } else {
+        for (i=0; i<(*_num_iterations); i++) {
+            firfilt_crcf_push(f, x[0]); firfilt_crcf_execute(f, &y[0]);
+            firfilt_crcf_push(f, x[1]); firfilt_crcf_execute(f, &y[1]);
+            firfilt_crcf_push(f, x[2]); firfilt_crcf_execute(f, &y[2]);
+            firfilt_crcf_push(f, x[3]); firfilt_crcf_execute(f, &y[3]);
+        }
+        *_num_iterations *= 4;
     }
     getrusage(RUSAGE_SELF, _finish);
-    *_num_iterations *= 4;
 
     firfilt_crcf_destroy(f);
 }
@@ -69,7 +80,19 @@ void firfilt_crcf_bench(struct rusage *_start,
 (   struct rusage *_start,              \
     struct rusage *_finish,             \
     unsigned long int *_num_iterations) \
-{ firfilt_crcf_bench(_start, _finish, _num_iterations, N); }
+{ firfilt_crcf_bench(_start, _finish, _num_iterations, N, 0, LIQUID_FIRFILT_METHOD_DIRECT); }
+
+#define FIRFILT_CRCF_BLOCK_BENCHMARK_API(N) \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ firfilt_crcf_bench(_start, _finish, _num_iterations, N, 1, LIQUID_FIRFILT_METHOD_DIRECT); }
+
+#define FIRFILT_CRCF_METHOD_BENCHMARK_API(N,M) \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ firfilt_crcf_bench(_start, _finish, _num_iterations, N, 1, M); }
 
 void benchmark_firfilt_crcf_4    FIRFILT_CRCF_BENCHMARK_API(4)
 void benchmark_firfilt_crcf_8    FIRFILT_CRCF_BENCHMARK_API(8)
@@ -77,3 +100,18 @@ void benchmark_firfilt_crcf_16   FIRFILT_CRCF_BENCHMARK_API(16)
 void benchmark_firfilt_crcf_32   FIRFILT_CRCF_BENCHMARK_API(32)
 void benchmark_firfilt_crcf_64   FIRFILT_CRCF_BENCHMARK_API(64)
 
+// block execution (samples/s comparable to above)
+void benchmark_firfilt_crcf_block_4    FIRFILT_CRCF_BLOCK_BENCHMARK_API(4)
+void benchmark_firfilt_crcf_block_8    FIRFILT_CRCF_BLOCK_BENCHMARK_API(8)
+void benchmark_firfilt_crcf_block_16   FIRFILT_CRCF_BLOCK_BENCHMARK_API(16)
+void benchmark_firfilt_crcf_block_32   FIRFILT_CRCF_BLOCK_BENCHMARK_API(32)
+void benchmark_firfilt_crcf_block_64   FIRFILT_CRCF_BLOCK_BENCHMARK_API(64)
+
+// long filters: direct form vs. automatic selection (FFT)
+void benchmark_firfilt_crcf_direct_1024 FIRFILT_CRCF_METHOD_BENCHMARK_API(1024, LIQUID_FIRFILT_METHOD_DIRECT)
+void benchmark_firfilt_crcf_direct_2048 FIRFILT_CRCF_METHOD_BENCHMARK_API(2048, LIQUID_FIRFILT_METHOD_DIRECT)
+void benchmark_firfilt_crcf_direct_8192 FIRFILT_CRCF_METHOD_BENCHMARK_API(8192, LIQUID_FIRFILT_METHOD_DIRECT)
+void benchmark_firfilt_crcf_auto_64     FIRFILT_CRCF_METHOD_BENCHMARK_API(  64, LIQUID_FIRFILT_METHOD_AUTO)
+void benchmark_firfilt_crcf_auto_1024   FIRFILT_CRCF_METHOD_BENCHMARK_API(1024, LIQUID_FIRFILT_METHOD_AUTO)
+void benchmark_firfilt_crcf_auto_2048   FIRFILT_CRCF_METHOD_BENCHMARK_API(2048, LIQUID_FIRFILT_METHOD_AUTO)
+void benchmark_firfilt_crcf_auto_8192   FIRFILT_CRCF_METHOD_BENCHMARK_API(8192, LIQUID_FIRFILT_METHOD_AUTO)
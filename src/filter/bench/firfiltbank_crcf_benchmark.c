@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+//  _h_len          : filter length
+//  _num_channels   : number of channels
+//  _bank           : use firfiltbank (1) or independent firfilt objects (0)
+void firfiltbank_crcf_bench(struct rusage *     _start,
+                            struct rusage *     _finish,
+                            unsigned long int * _num_iterations,
+                            unsigned int        _h_len,
+                            unsigned int        _num_channels,
+                            int                 _bank)
+{
+    // adjust number of iterations (iterations count output samples)
+    *_num_iterations *= 1000;
+    *_num_iterations /= (unsigned int)(107+4.3*_h_len*_num_channels);
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // generate coefficients
+    float h[_h_len];
+    unsigned long int i;
+    unsigned int c;
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+
+    // create filter objects
+    firfiltbank_crcf q = firfiltbank_crcf_create(h, _h_len, _num_channels);
+    firfilt_crcf f[_num_channels];
+    for (c=0; c<_num_channels; c++)
+        f[c] = firfilt_crcf_create(h, _h_len);
+
+    // generate input block (interleaved by channel)
+    unsigned int num_frames = 16;
+    float complex x[num_frames*_num_channels];
+    float complex y[num_frames*_num_channels];
+    for (i=0; i<num_frames*_num_channels; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    unsigned int k;
+    getrusage(RUSAGE_SELF, _start);
+    if (_bank) {
+        for (i=0; i<(*_num_iterations); i++)
+            firfiltbank_crcf_execute_block(q, x, num_frames, y);
+    } else {
+        for (i=0; i<(*_num_iterations); i++) {
+            for (k=0; k<num_frames; k++) {
+                for (c=0; c<_num_channels; c++) {
+                    firfilt_crcf_push(f[c], x[k*_num_channels+c]);
+                    firfilt_crcf_execute(f[c], &y[k*_num_channels+c]);
+                }
+            }
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= num_frames * _num_channels;
+
+    firfiltbank_crcf_destroy(q);
+    for (c=0; c<_num_channels; c++)
+        firfilt_crcf_destroy(f[c]);
+}
+
+#define FIRFILTBANK_CRCF_BENCHMARK_API(H,M,B)   (   struct rusage *_start,                          struct rusage *_finish,                         unsigned long int *_num_iterations)         { firfiltbank_crcf_bench(_start, _finish, _num_iterations, H, M, B); }
+
+// filter bank
+void benchmark_firfiltbank_crcf_h16m4       FIRFILTBANK_CRCF_BENCHMARK_API(16,  4, 1)
+void benchmark_firfiltbank_crcf_h16m16      FIRFILTBANK_CRCF_BENCHMARK_API(16, 16, 1)
+void benchmark_firfiltbank_crcf_h16m64      FIRFILTBANK_CRCF_BENCHMARK_API(16, 64, 1)
+void benchmark_firfiltbank_crcf_h64m4       FIRFILTBANK_CRCF_BENCHMARK_API(64,  4, 1)
+void benchmark_firfiltbank_crcf_h64m16      FIRFILTBANK_CRCF_BENCHMARK_API(64, 16, 1)
+void benchmark_firfiltbank_crcf_h64m64      FIRFILTBANK_CRCF_BENCHMARK_API(64, 64, 1)
+
+// independent firfilt objects, for comparison
+void benchmark_firfiltbank_crcf_ref_h16m4   FIRFILTBANK_CRCF_BENCHMARK_API(16,  4, 0)
+void benchmark_firfiltbank_crcf_ref_h16m16  FIRFILTBANK_CRCF_BENCHMARK_API(16, 16, 0)
+void benchmark_firfiltbank_crcf_ref_h16m64  FIRFILTBANK_CRCF_BENCHMARK_API(16, 64, 0)
+void benchmark_firfiltbank_crcf_ref_h64m4   FIRFILTBANK_CRCF_BENCHMARK_API(64,  4, 0)
+void benchmark_firfiltbank_crcf_ref_h64m16  FIRFILTBANK_CRCF_BENCHMARK_API(64, 16, 0)
+void benchmark_firfiltbank_crcf_ref_h64m64  FIRFILTBANK_CRCF_BENCHMARK_API(64, 64, 0)
+
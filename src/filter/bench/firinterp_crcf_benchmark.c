@@ -28,7 +28,8 @@ void firinterp_crcf_bench(struct rusage *_start,
                           struct rusage *_finish,
                           unsigned long int *_num_iterations,
                           unsigned int _M,
-                          unsigned int _h_len)
+                          unsigned int _h_len,
+                          int _block)
 {
     // normalize number of iterations
     *_num_iterations *= 80;
@@ -42,17 +43,33 @@ void firinterp_crcf_bench(struct rusage *_start,
 
     firinterp_crcf q = firinterp_crcf_create(_M,h,_h_len);
 
-    float complex y[_M];
+    // initialize input
+    unsigned int num_inputs = 64;
+    float complex x[num_inputs];
+    for (i=0; i<num_inputs; i++)
+        x[i] = (i%2) ? 1.0f : -1.0f;
+
+    float complex y[num_inputs*_M];
+
     // start trials
     getrusage(RUSAGE_SELF, _start);
-    for (i=0; i<(*_num_iterations); i++) {
-        firinterp_crcf_execute(q,1.0f,y);
-        firinterp_crcf_execute(q,1.0f,y);
-        firinterp_crcf_execute(q,1.0f,y);
-        firinterp_crcf_execute(q,1.0f,y);
+    if (_block) {
+        // process block of inputs at a time
+        *_num_iterations /= 16;
+        if (*_num_iterations < 1) *_num_iterations = 1;
+        for (i=0; i<(*_num_iterations); i++)
+            firinterp_crcf_execute_block(q, x, num_inputs, y);
+        *_num_iterations *= num_inputs;
+    } else {
+        for (i=0; i<(*_num_iterations); i++) {
+            firinterp_crcf_execute(q,1.0f,y);
+            firinterp_crcf_execute(q,1.0f,y);
+            firinterp_crcf_execute(q,1.0f,y);
+            firinterp_crcf_execute(q,1.0f,y);
+        }
+        *_num_iterations *= 4;
     }
     getrusage(RUSAGE_SELF, _finish);
-    *_num_iterations *= 4;
 
     firinterp_crcf_destroy(q);
 }
@@ -61,7 +78,13 @@ void firinterp_crcf_bench(struct rusage *_start,
 (   struct rusage *_start,                  \
     struct rusage *_finish,                 \
     unsigned long int *_num_iterations)     \
-{ firinterp_crcf_bench(_start, _finish, _num_iterations, M, H_LEN); }
+{ firinterp_crcf_bench(_start, _finish, _num_iterations, M, H_LEN, 0); }
+
+#define FIRINTERP_CRCF_BLOCK_BENCHMARK_API(M,H_LEN)  \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ firinterp_crcf_bench(_start, _finish, _num_iterations, M, H_LEN, 1); }
 
 void benchmark_firinterp_crcf_m2_h8    FIRINTERP_CRCF_BENCHMARK_API(2, 8)
 void benchmark_firinterp_crcf_m4_h16   FIRINTERP_CRCF_BENCHMARK_API(4, 16)
@@ -69,3 +92,10 @@ void benchmark_firinterp_crcf_m8_h32   FIRINTERP_CRCF_BENCHMARK_API(8, 32)
 void benchmark_firinterp_crcf_m16_h64  FIRINTERP_CRCF_BENCHMARK_API(16,64)
 void benchmark_firinterp_crcf_m32_h128 FIRINTERP_CRCF_BENCHMARK_API(32,128)
 
+// block execution (input samples/s comparable to above)
+void benchmark_firinterp_crcf_block_m2_h8    FIRINTERP_CRCF_BLOCK_BENCHMARK_API(2, 8)
+void benchmark_firinterp_crcf_block_m4_h16   FIRINTERP_CRCF_BLOCK_BENCHMARK_API(4, 16)
+void benchmark_firinterp_crcf_block_m8_h32   FIRINTERP_CRCF_BLOCK_BENCHMARK_API(8, 32)
+void benchmark_firinterp_crcf_block_m16_h64  FIRINTERP_CRCF_BLOCK_BENCHMARK_API(16,64)
+void benchmark_firinterp_crcf_block_m32_h128 FIRINTERP_CRCF_BLOCK_BENCHMARK_API(32,128)
+
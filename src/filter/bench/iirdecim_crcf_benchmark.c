@@ -28,7 +28,9 @@ void iirdecim_crcf_bench(struct rusage *     _start,
                          struct rusage *     _finish,
                          unsigned long int * _num_iterations,
                          unsigned int        _M,
-                         unsigned int        _order)
+                         unsigned int        _order,
+                         int                 _block,
+                         int                 _parallel)
 {
     // normalize number of iterations
     *_num_iterations /= _order;
@@ -43,25 +45,36 @@ void iirdecim_crcf_bench(struct rusage *     _start,
     float Ap =  0.1f;
     float As = 60.0f;
     iirdecim_crcf q = iirdecim_crcf_create_prototype(_M,ftype,btype,format,_order,fc,f0,Ap,As);
+    iirdecim_crcf_set_parallel(q, _parallel);
 
     // initialize input
-    float complex x[_M];
+    unsigned int num_outputs = 64;
+    float complex x[num_outputs*_M];
     unsigned int i;
-    for (i=0; i<_M; i++)
+    for (i=0; i<num_outputs*_M; i++)
         x[i] = (i%2) ? 1.0f : -1.0f;
 
-    float complex y;
+    float complex y[num_outputs];
 
     // start trials
     getrusage(RUSAGE_SELF, _start);
-    for (i=0; i<(*_num_iterations); i++) {
-        iirdecim_crcf_execute(q, x, &y);
-        iirdecim_crcf_execute(q, x, &y);
-        iirdecim_crcf_execute(q, x, &y);
-        iirdecim_crcf_execute(q, x, &y);
+    if (_block) {
+        // compute block of outputs at a time
+        *_num_iterations /= num_outputs / 4;
+        if (*_num_iterations < 1) *_num_iterations = 1;
+        for (i=0; i<(*_num_iterations); i++)
+            iirdecim_crcf_execute_block(q, x, num_outputs, y);
+        *_num_iterations *= num_outputs;
+    } else {
+        for (i=0; i<(*_num_iterations); i++) {
+            iirdecim_crcf_execute(q, x, &y[0]);
+            iirdecim_crcf_execute(q, x, &y[0]);
+            iirdecim_crcf_execute(q, x, &y[0]);
+            iirdecim_crcf_execute(q, x, &y[0]);
+        }
+        *_num_iterations *= 4;
     }
     getrusage(RUSAGE_SELF, _finish);
-    *_num_iterations *= 4;
 
     iirdecim_crcf_destroy(q);
 }
@@ -70,7 +83,13 @@ void iirdecim_crcf_bench(struct rusage *     _start,
 (   struct rusage *_start,                      \
     struct rusage *_finish,                     \
     unsigned long int *_num_iterations)         \
-{ iirdecim_crcf_bench(_start, _finish, _num_iterations, M, ORDER); }
+{ iirdecim_crcf_bench(_start, _finish, _num_iterations, M, ORDER, 0, 0); }
+
+#define IIRDECIM_CRCF_BLOCK_BENCHMARK_API(M,ORDER,P)    \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ iirdecim_crcf_bench(_start, _finish, _num_iterations, M, ORDER, 1, P); }
 
 void benchmark_iirdecim_crcf_M2     IIRDECIM_CRCF_BENCHMARK_API(2, 5)
 void benchmark_iirdecim_crcf_M4     IIRDECIM_CRCF_BENCHMARK_API(4, 5)
@@ -78,3 +97,12 @@ void benchmark_iirdecim_crcf_M8     IIRDECIM_CRCF_BENCHMARK_API(8, 5)
 void benchmark_iirdecim_crcf_M16    IIRDECIM_CRCF_BENCHMARK_API(16,5)
 void benchmark_iirdecim_cccf_M32    IIRDECIM_CRCF_BENCHMARK_API(32,5)
 
+// block execution (output samples/s comparable to above)
+void benchmark_iirdecim_crcf_block_M2       IIRDECIM_CRCF_BLOCK_BENCHMARK_API(2, 5, 0)
+void benchmark_iirdecim_crcf_block_M4       IIRDECIM_CRCF_BLOCK_BENCHMARK_API(4, 5, 0)
+void benchmark_iirdecim_crcf_block_M8       IIRDECIM_CRCF_BLOCK_BENCHMARK_API(8, 5, 0)
+
+// block execution with parallel-form bank
+void benchmark_iirdecim_crcf_parallel_M2    IIRDECIM_CRCF_BLOCK_BENCHMARK_API(2, 5, 1)
+void benchmark_iirdecim_crcf_parallel_M4    IIRDECIM_CRCF_BLOCK_BENCHMARK_API(4, 5, 1)
+void benchmark_iirdecim_crcf_parallel_M8    IIRDECIM_CRCF_BLOCK_BENCHMARK_API(8, 5, 1)
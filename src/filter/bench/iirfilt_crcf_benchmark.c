@@ -28,7 +28,9 @@ void iirfilt_crcf_bench(struct rusage *     _start,
                         struct rusage *     _finish,
                         unsigned long int * _num_iterations,
                         unsigned int        _order,
-                        unsigned int        _format)
+                        unsigned int        _format,
+                        int                 _block,
+                        int                 _parallel)
 {
     unsigned int i;
 
@@ -53,23 +55,34 @@ void iirfilt_crcf_bench(struct rusage *     _start,
                                                    _format,
                                                    _order,
                                                    fc, f0, Ap, As);
+    iirfilt_crcf_set_parallel(q, _parallel);
 
     // initialize input/output
-    float complex x[4];
-    float complex y[4];
-    for (i=0; i<4; i++)
+    unsigned int num_samples = 256;
+    float complex x[num_samples];
+    float complex y[num_samples];
+    for (i=0; i<num_samples; i++)
         x[i] = randnf() + _Complex_I*randnf();
 
     // start trials
     getrusage(RUSAGE_SELF, _start);
-    for (i=0; i<(*_num_iterations); i++) {
-        iirfilt_crcf_execute(q, x[0], &y[0]);
-        iirfilt_crcf_execute(q, x[1], &y[1]);
-        iirfilt_crcf_execute(q, x[2], &y[2]);
-        iirfilt_crcf_execute(q, x[3], &y[3]);
+    if (_block) {
+        // filter block of samples at a time
+        *_num_iterations /= num_samples / 4;
+        if (*_num_iterations < 1) *_num_iterations = 1;
+        for (i=0; i<(*_num_iterations); i++)
+            iirfilt_crcf_execute_block(q, x, num_samples, y);
+        *_num_iterations *= num_samples;
+    } else {
+        for (i=0; i<(*_num_iterations); i++) {
+            iirfilt_crcf_execute(q, x[0], &y[0]);
+            iirfilt_crcf_execute(q, x[1], &y[1]);
+            iirfilt_crcf_execute(q, x[2], &y[2]);
+            iirfilt_crcf_execute(q, x[3], &y[3]);
+        }
+        *_num_iterations *= 4;
     }
     getrusage(RUSAGE_SELF, _finish);
-    *_num_iterations *= 4;
 
     // destroy filter object
     iirfilt_crcf_destroy(q);
@@ -79,7 +92,13 @@ void iirfilt_crcf_bench(struct rusage *     _start,
 (   struct rusage *_start,                  \
     struct rusage *_finish,                 \
     unsigned long int *_num_iterations)     \
-{ iirfilt_crcf_bench(_start, _finish, _num_iterations, N, T); }
+{ iirfilt_crcf_bench(_start, _finish, _num_iterations, N, T, 0, 0); }
+
+#define IIRFILT_CRCF_BLOCK_BENCHMARK_API(N,T,P) \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ iirfilt_crcf_bench(_start, _finish, _num_iterations, N, T, 1, P); }
 
 // benchmark regular transfer function form
 void benchmark_iirfilt_crcf_4        IIRFILT_CRCF_BENCHMARK_API(4,    LIQUID_IIRDES_TF)
@@ -95,6 +114,17 @@ void benchmark_iirfilt_crcf_sos_16   IIRFILT_CRCF_BENCHMARK_API(16,   LIQUID_IIR
 void benchmark_iirfilt_crcf_sos_32   IIRFILT_CRCF_BENCHMARK_API(32,   LIQUID_IIRDES_SOS)
 void benchmark_iirfilt_crcf_sos_64   IIRFILT_CRCF_BENCHMARK_API(64,   LIQUID_IIRDES_SOS)
 
+// benchmark block execution of cascaded second-order sections
+void benchmark_iirfilt_crcf_block_4  IIRFILT_CRCF_BLOCK_BENCHMARK_API(4,  LIQUID_IIRDES_SOS, 0)
+void benchmark_iirfilt_crcf_block_8  IIRFILT_CRCF_BLOCK_BENCHMARK_API(8,  LIQUID_IIRDES_SOS, 0)
+void benchmark_iirfilt_crcf_block_12 IIRFILT_CRCF_BLOCK_BENCHMARK_API(12, LIQUID_IIRDES_SOS, 0)
+void benchmark_iirfilt_crcf_block_16 IIRFILT_CRCF_BLOCK_BENCHMARK_API(16, LIQUID_IIRDES_SOS, 0)
+
+// benchmark block execution of parallel-form bank
+void benchmark_iirfilt_crcf_parallel_4  IIRFILT_CRCF_BLOCK_BENCHMARK_API(4,  LIQUID_IIRDES_SOS, 1)
+void benchmark_iirfilt_crcf_parallel_8  IIRFILT_CRCF_BLOCK_BENCHMARK_API(8,  LIQUID_IIRDES_SOS, 1)
+void benchmark_iirfilt_crcf_parallel_12 IIRFILT_CRCF_BLOCK_BENCHMARK_API(12, LIQUID_IIRDES_SOS, 1)
+
 // benchmark DC-blocking filter
 void benchmark_irfilt_crcf_dcblock(struct rusage *     _start,
                                    struct rusage *     _finish,
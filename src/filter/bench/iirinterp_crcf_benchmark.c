@@ -28,7 +28,9 @@ void iirinterp_crcf_bench(struct rusage *_start,
                           struct rusage *_finish,
                           unsigned long int *_num_iterations,
                           unsigned int _M,
-                          unsigned int _order)
+                          unsigned int _order,
+                          int _block,
+                          int _parallel)
 {
     // normalize number of iterations
     *_num_iterations *= 80;
@@ -44,19 +46,34 @@ void iirinterp_crcf_bench(struct rusage *_start,
     float Ap =  0.1f;
     float As = 60.0f;
     iirinterp_crcf q = iirinterp_crcf_create_prototype(_M,ftype,btype,format,_order,fc,f0,Ap,As);
+    iirinterp_crcf_set_parallel(q, _parallel);
+
+    unsigned int num_inputs = 64;
+    float complex x[num_inputs];
+    float complex y[num_inputs*_M];
+    unsigned int i;
+    for (i=0; i<num_inputs; i++)
+        x[i] = 1.0f;
 
-    float complex y[_M];
     // start trials
     getrusage(RUSAGE_SELF, _start);
-    unsigned int i;
-    for (i=0; i<(*_num_iterations); i++) {
-        iirinterp_crcf_execute(q, 1.0f, y);
-        iirinterp_crcf_execute(q, 1.0f, y);
-        iirinterp_crcf_execute(q, 1.0f, y);
-        iirinterp_crcf_execute(q, 1.0f, y);
+    if (_block) {
+        // interpolate block of inputs at a time
+        *_num_iterations /= num_inputs / 4;
+        if (*_num_iterations < 1) *_num_iterations = 1;
+        for (i=0; i<(*_num_iterations); i++)
+            iirinterp_crcf_execute_block(q, x, num_inputs, y);
+        *_num_iterations *= num_inputs;
+    } else {
+        for (i=0; i<(*_num_iterations); i++) {
+            iirinterp_crcf_execute(q, 1.0f, y);
+            iirinterp_crcf_execute(q, 1.0f, y);
+            iirinterp_crcf_execute(q, 1.0f, y);
+            iirinterp_crcf_execute(q, 1.0f, y);
+        }
+        *_num_iterations *= 4;
     }
     getrusage(RUSAGE_SELF, _finish);
-    *_num_iterations *= 4;
 
     iirinterp_crcf_destroy(q);
 }
@@ -65,7 +82,13 @@ void iirinterp_crcf_bench(struct rusage *_start,
 (   struct rusage *_start,                      \
     struct rusage *_finish,                     \
     unsigned long int *_num_iterations)         \
-{ iirinterp_crcf_bench(_start, _finish, _num_iterations, M, ORDER); }
+{ iirinterp_crcf_bench(_start, _finish, _num_iterations, M, ORDER, 0, 0); }
+
+#define IIRINTERP_CRCF_BLOCK_BENCHMARK_API(M,ORDER,P)   \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ iirinterp_crcf_bench(_start, _finish, _num_iterations, M, ORDER, 1, P); }
 
 void benchmark_iirinterp_crcf_M2    IIRINTERP_CRCF_BENCHMARK_API(2, 5)
 void benchmark_iirinterp_crcf_M4    IIRINTERP_CRCF_BENCHMARK_API(4, 5)
@@ -73,3 +96,12 @@ void benchmark_iirinterp_crcf_M8    IIRINTERP_CRCF_BENCHMARK_API(8, 5)
 void benchmark_iirinterp_crcf_M16   IIRINTERP_CRCF_BENCHMARK_API(16,5)
 void benchmark_iirinterp_crcf_M32   IIRINTERP_CRCF_BENCHMARK_API(32,5)
 
+// block execution (input samples/s comparable to above)
+void benchmark_iirinterp_crcf_block_M2      IIRINTERP_CRCF_BLOCK_BENCHMARK_API(2, 5, 0)
+void benchmark_iirinterp_crcf_block_M4      IIRINTERP_CRCF_BLOCK_BENCHMARK_API(4, 5, 0)
+void benchmark_iirinterp_crcf_block_M8      IIRINTERP_CRCF_BLOCK_BENCHMARK_API(8, 5, 0)
+
+// block execution with parallel-form bank
+void benchmark_iirinterp_crcf_parallel_M2   IIRINTERP_CRCF_BLOCK_BENCHMARK_API(2, 5, 1)
+void benchmark_iirinterp_crcf_parallel_M4   IIRINTERP_CRCF_BLOCK_BENCHMARK_API(4, 5, 1)
+void benchmark_iirinterp_crcf_parallel_M8   IIRINTERP_CRCF_BLOCK_BENCHMARK_API(8, 5, 1)
@@ -36,6 +36,10 @@
 //  DOTPROD()       dotprod macro
 //  PRINTVAL()      print macro
 
+// real filters (rrrf) use real-input transforms which compute only the
+// non-redundant half of the spectrum
+#define FFTFILT_REAL (!TI_COMPLEX && !TC_COMPLEX)
+
 // fftfilt object structure
 struct FFTFILT(_s) {
     TC * h;             // filter coefficients array [size; h_len x 1]
@@ -44,11 +48,17 @@ struct FFTFILT(_s) {
 
     // internal memory arrays
     // TODO: make TI/TO type, but ensuring complex
-    // TODO: use special format for fftfilt_rrrf type
+#if FFTFILT_REAL
+    float *         time_buf;   // time buffer [size: 2*n x 1]
+    float complex * freq_buf;   // freq buffer [size: n+1 x 1]
+    float complex * H;          // FFT of filter coefficients [size: n+1 x 1]
+    float *         w;          // overlap array [size: n x 1]
+#else
     float complex * time_buf;   // time buffer [size: 2*n x 1]
     float complex * freq_buf;   // freq buffer [size: 2*n x 1]
     float complex * H;          // FFT of filter coefficients [size: 2*n x 1]
     float complex * w;          // overlap array [size: n x 1]
+#endif
 
     // FFT objects
 #ifdef LIQUID_FFTOVERRIDE
@@ -91,6 +101,23 @@ FFTFILT() FFTFILT(_create)(TC *         _h,
     q->h = (TC *) malloc((q->h_len)*sizeof(TC));
     memmove(q->h, _h, _h_len*sizeof(TC));
 
+#if FFTFILT_REAL
+    // allocate internal memory arrays
+    q->time_buf = (float *)         malloc((2*q->n  )* sizeof(float));         // time buffer
+    q->freq_buf = (float complex *) malloc((  q->n+1)* sizeof(float complex)); // frequency buffer
+    q->H        = (float complex *) malloc((  q->n+1)* sizeof(float complex)); // FFT{ h }
+    q->w        = (float *)         malloc((  q->n  )* sizeof(float));         // delay buffer
+
+    // create internal FFT objects (real input, half spectrum)
+#  ifdef LIQUID_FFTOVERRIDE
+    q->fft  = fft_create_plan_r2c(2*q->n, q->time_buf, q->freq_buf, 0);
+    q->ifft = fft_create_plan_c2r(2*q->n, q->freq_buf, q->time_buf, 0);
+#  else
+    q->fft  = FFT_CREATE_PLAN_R2C(2*q->n, q->time_buf, q->freq_buf, FFT_METHOD);
+    q->ifft = FFT_CREATE_PLAN_C2R(2*q->n, q->freq_buf, q->time_buf, FFT_METHOD);
+#  endif
+    unsigned int H_len = q->n+1;
+#else
     // allocate internal memory arrays
     q->time_buf = (float complex *) malloc((2*q->n)* sizeof(float complex)); // time buffer
     q->freq_buf = (float complex *) malloc((2*q->n)* sizeof(float complex)); // frequency buffer
@@ -105,6 +132,8 @@ FFTFILT() FFTFILT(_create)(TC *         _h,
     q->fft  = FFT_CREATE_PLAN(2*q->n, q->time_buf, q->freq_buf, FFT_DIR_FORWARD,  FFT_METHOD);
     q->ifft = FFT_CREATE_PLAN(2*q->n, q->freq_buf, q->time_buf, FFT_DIR_BACKWARD, FFT_METHOD);
 #endif
+    unsigned int H_len = 2*q->n;
+#endif
 
     // compute FFT of filter coefficients and copy to internal H array
     unsigned int i;
@@ -116,7 +145,7 @@ FFTFILT() FFTFILT(_create)(TC *         _h,
 #else
     FFT_EXECUTE(q->fft);
 #endif
-    memmove(q->H, q->freq_buf, 2*q->n*sizeof(float complex));
+    memmove(q->H, q->freq_buf, H_len*sizeof(float complex));
 
     // set default scaling
     FFTFILT(_set_scale)(q, 1);
@@ -224,8 +253,13 @@ void FFTFILT(_execute)(FFTFILT() _q,
 
     // compute inner product between FFT{ _x } and FFT{ H }
 #if 1
+#  if FFTFILT_REAL
+    for (i=0; i<_q->n+1; i++)
+        _q->freq_buf[i] *= _q->H[i];
+#  else
     for (i=0; i<2*_q->n; i++)
         _q->freq_buf[i] *= _q->H[i];
+#  endif
 #else
     // use SIMD vector extensions
 # if TI_COMPLEX
@@ -245,7 +279,7 @@ void FFTFILT(_execute)(FFTFILT() _q,
 #endif
 
     // copy output summed with buffer and scaled
-#if TI_COMPLEX
+#if TI_COMPLEX || FFTFILT_REAL
     for (i=0; i<_q->n; i++)
         _y[i] = (_q->time_buf[i] + _q->w[i]) * _q->scale;
 #else
@@ -256,7 +290,7 @@ void FFTFILT(_execute)(FFTFILT() _q,
 #endif
 
     // copy buffer
-    memmove(_q->w, &_q->time_buf[_q->n], _q->n*sizeof(float complex));
+    memmove(_q->w, &_q->time_buf[_q->n], _q->n*sizeof(_q->w[0]));
 }
 
 // return length of filter object's internal coefficients
@@ -35,6 +35,7 @@
 #define FFTFILT(name)       LIQUID_CONCAT(fftfilt_cccf,name)
 #define FIRDECIM(name)      LIQUID_CONCAT(firdecim_cccf,name)
 #define FIRFILT(name)       LIQUID_CONCAT(firfilt_cccf,name)
+#define FIRFILTBANK(name)   LIQUID_CONCAT(firfiltbank_cccf,name)
 #define FIRINTERP(name)     LIQUID_CONCAT(firinterp_cccf,name)
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_cccf,name)
 #define IIRDECIM(name)      LIQUID_CONCAT(iirdecim_cccf,name)
@@ -69,6 +70,7 @@
 #include "fftfilt.c"
 #include "firdecim.c"
 #include "firfilt.c"
+#include "firfiltbank.c"
 #include "firinterp.c"
 #include "firpfb.c"
 #include "iirdecim.c"
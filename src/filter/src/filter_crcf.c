@@ -36,6 +36,7 @@
 #define FIRDECIM(name)      LIQUID_CONCAT(firdecim_crcf,name)
 #define FIRFARROW(name)     LIQUID_CONCAT(firfarrow_crcf,name)
 #define FIRFILT(name)       LIQUID_CONCAT(firfilt_crcf,name)
+#define FIRFILTBANK(name)   LIQUID_CONCAT(firfiltbank_crcf,name)
 #define FIRINTERP(name)     LIQUID_CONCAT(firinterp_crcf,name)
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_crcf,name)
 #define IIRDECIM(name)      LIQUID_CONCAT(iirdecim_crcf,name)
@@ -70,6 +71,7 @@
 #include "firdecim.c"
 #include "firfarrow.c"
 #include "firfilt.c"
+#include "firfiltbank.c"
 #include "firinterp.c"
 #include "firpfb.c"
 #include "iirdecim.c"
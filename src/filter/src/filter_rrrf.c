@@ -36,6 +36,7 @@
 #define FIRDECIM(name)      LIQUID_CONCAT(firdecim_rrrf,name)
 #define FIRFARROW(name)     LIQUID_CONCAT(firfarrow_rrrf,name)
 #define FIRFILT(name)       LIQUID_CONCAT(firfilt_rrrf,name)
+#define FIRFILTBANK(name)   LIQUID_CONCAT(firfiltbank_rrrf,name)
 #define FIRINTERP(name)     LIQUID_CONCAT(firinterp_rrrf,name)
 #define FIRHILB(name)       LIQUID_CONCAT(firhilbf,name)
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_rrrf,name)
@@ -71,6 +72,7 @@
 #include "firdecim.c"
 #include "firfarrow.c"
 #include "firfilt.c"
+#include "firfiltbank.c"
 #include "firinterp.c"
 #include "firhilb.c"
 #include "firpfb.c"
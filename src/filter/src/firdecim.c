@@ -30,6 +30,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+// maximum number of output samples computed together in block method
+#define LIQUID_FIRDECIM_BLOCK_SIZE  (64)
+
+// maximum number of input samples buffered by block method (limits the
+// number of outputs in each block for large decimation factors)
+#define LIQUID_FIRDECIM_BLOCK_INPUT (4096)
+
 // decimator structure
 struct FIRDECIM(_s) {
     TC * h;             // coefficients array
@@ -38,6 +45,10 @@ struct FIRDECIM(_s) {
 
     WINDOW() w;         // buffer
     DOTPROD() dp;       // vector dot product
+
+    // block execution buffer: history followed by input block
+    TI * buf;               // [size: h_len-1 + num_block*M x 1]
+    unsigned int num_block; // maximum number of outputs in block
 };
 
 // create decimator object
@@ -75,6 +86,12 @@ FIRDECIM() FIRDECIM(_create)(unsigned int _M,
     // create dot product object
     q->dp = DOTPROD(_create)(q->h, q->h_len);
 
+    // allocate block execution buffer
+    q->num_block = LIQUID_FIRDECIM_BLOCK_INPUT / q->M;
+    if (q->num_block > LIQUID_FIRDECIM_BLOCK_SIZE) q->num_block = LIQUID_FIRDECIM_BLOCK_SIZE;
+    if (q->num_block < 1)                          q->num_block = 1;
+    q->buf = (TI*) malloc((q->h_len - 1 + q->num_block*q->M)*sizeof(TI));
+
     // reset filter state (clear buffer)
     FIRDECIM(_reset)(q);
 
@@ -165,6 +182,7 @@ void FIRDECIM(_destroy)(FIRDECIM() _q)
     WINDOW(_destroy)(_q->w);
     DOTPROD(_destroy)(_q->dp);
     free(_q->h);
+    free(_q->buf);
     free(_q);
 }
 
@@ -215,10 +233,39 @@ void FIRDECIM(_execute_block)(FIRDECIM()   _q,
                               unsigned int _n,
                               TO *         _y)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        // execute _M input samples computing just one output each time
-        FIRDECIM(_execute)(_q, &_x[i*_q->M], &_y[i]);
+    if (_n == 0)
+        return;
+
+    // history plus input block: outputs are computed directly from this
+    // array at the first of every _M input samples
+    unsigned int len = _q->h_len;
+    unsigned int M   = _q->M;
+    TI * buf = _q->buf;
+
+    // load history from window
+    TI * r;
+    WINDOW(_read)(_q->w, &r);
+    memmove(buf, r + 1, (len-1)*sizeof(TI));
+
+    unsigned int i = 0; // output sample index
+    unsigned int k = 0; // number of outputs in block
+    unsigned int j;
+    while (i < _n) {
+        // append block of input samples after history
+        k = (_n - i) < _q->num_block ? (_n - i) : _q->num_block;
+        memmove(buf + len - 1, &_x[i*M], k*M*sizeof(TI));
+
+        // compute only retained outputs
+        for (j=0; j<k; j++)
+            DOTPROD(_execute)(_q->dp, buf + j*M, &_y[i+j]);
+
+        // retain most recent samples as history for next block
+        i += k;
+        if (i < _n)
+            memmove(buf, buf + k*M, (len-1)*sizeof(TI));
     }
+
+    // update window with most recent samples
+    WINDOW(_write)(_q->w, buf + k*M - 1, len);
 }
 
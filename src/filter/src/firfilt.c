@@ -54,8 +54,43 @@ struct FIRFILT(_s) {
 #endif
     DOTPROD() dp;           // dot product object
     TC scale;               // output scaling factor
+
+    // FFT-based block filtering (long filters)
+    liquid_firfilt_method method;   // requested implementation method
+    unsigned int block_len;         // requested block length (0: automatic)
+    FFTFILT()    ff;                // FFT-based filter (NULL: direct form)
+    unsigned int ff_n;              // FFT filter block length (latency)
+    TI *         ff_in;             // input staging buffer [size: ff_n x 1]
+    TO *         ff_out;            // output staging buffer [size: ff_n x 1]
+    unsigned int ff_index;          // staging buffer index
+    TO           ff_y;              // most recent output sample
 };
 
+// approximate cost model used to select between direct-form and FFT-based
+// filtering, in cycles per output sample:
+//  direct form : FIRFILT_COST_DOTPROD * h_len
+//  FFT         : (2 * FIRFILT_COST_FFT * nfft * log2(nfft)
+//                  + FIRFILT_COST_BLOCK * nfft) / n,   nfft = 2*n
+// Constants were measured with the internal FFT and vectorized dot
+// products; the cross-over for firfilt_crcf is between 1024 and 2048 taps.
+#define FIRFILT_COST_DOTPROD    (TI_COMPLEX ? (TC_COMPLEX ? 0.60f : 0.35f) : 0.18f)
+#define FIRFILT_COST_FFT        (8.5f)
+#define FIRFILT_COST_BLOCK      (12.0f)
+
+// estimate cost of direct-form and FFT-based filtering [cycles/sample]
+float FIRFILT(_cost_direct)(unsigned int _h_len);
+float FIRFILT(_cost_fft)(unsigned int _n);
+
+// configure implementation (direct form or FFT) from requested method,
+// block length, and filter length
+void FIRFILT(_configure)(FIRFILT() _q);
+
+// execute FFT-based filter on a block of input samples
+void FIRFILT(_execute_block_fft)(FIRFILT()    _q,
+                                 TI *         _x,
+                                 unsigned int _n,
+                                 TO *         _y);
+
 // create firfilt object
 //  _h      :   coefficients (filter taps) [size: _n x 1]
 //  _n      :   filter length
@@ -95,12 +130,50 @@ FIRFILT() FIRFILT(_create)(TC * _h,
     // set default scaling
     q->scale = 1;
 
+    // direct-form implementation
+    q->method    = LIQUID_FIRFILT_METHOD_DIRECT;
+    q->block_len = 0;
+    q->ff        = NULL;
+
     // reset filter state (clear buffer)
     FIRFILT(_reset)(q);
 
     return q;
 }
 
+// create firfilt object, selecting implementation method
+//  _h          :   coefficients (filter taps) [size: _n x 1]
+//  _n          :   filter length
+//  _method     :   implementation method (e.g. LIQUID_FIRFILT_METHOD_AUTO)
+//  _block_len  :   FFT block length (0: select automatically)
+FIRFILT() FIRFILT(_create_method)(TC *                  _h,
+                                  unsigned int          _n,
+                                  liquid_firfilt_method _method,
+                                  unsigned int          _block_len)
+{
+    // validate input
+    if (_method != LIQUID_FIRFILT_METHOD_AUTO   &&
+        _method != LIQUID_FIRFILT_METHOD_DIRECT &&
+        _method != LIQUID_FIRFILT_METHOD_FFT)
+    {
+        fprintf(stderr,"error: firfilt_%s_create_method(), invalid method\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_method == LIQUID_FIRFILT_METHOD_FFT && _block_len > 0 && _block_len+1 < _n) {
+        fprintf(stderr,"error: firfilt_%s_create_method(), block length must be at least _n-1 (%u)\n", EXTENSION_FULL, _n-1);
+        exit(1);
+    }
+
+    // create direct-form filter object
+    FIRFILT() q = FIRFILT(_create)(_h, _n);
+
+    // set method and configure implementation
+    q->method    = _method;
+    q->block_len = _block_len;
+    FIRFILT(_configure)(q);
+
+    return q;
+}
+
 // create filter using Kaiser-Bessel windowed sinc method
 //  _n      : filter length, _n > 0
 //  _fc     : cutoff frequency, 0 < _fc < 0.5
@@ -233,6 +306,10 @@ FIRFILT() FIRFILT(_recreate)(FIRFILT() _q,
     DOTPROD(_destroy)(_q->dp);
     _q->dp = DOTPROD(_create)(_q->h, _q->h_len);
 
+    // re-configure FFT-based filter (state is not preserved)
+    if (_q->method != LIQUID_FIRFILT_METHOD_DIRECT)
+        FIRFILT(_configure)(_q);
+
     return _q;
 }
 
@@ -245,6 +322,11 @@ void FIRFILT(_destroy)(FIRFILT() _q)
     free(_q->w);
 #endif
     DOTPROD(_destroy)(_q->dp);
+    if (_q->ff != NULL) {
+        FFTFILT(_destroy)(_q->ff);
+        free(_q->ff_in);
+        free(_q->ff_out);
+    }
     free(_q->h);
     free(_q);
 }
@@ -260,12 +342,24 @@ void FIRFILT(_reset)(FIRFILT() _q)
         _q->w[i] = 0.0;
     _q->w_index = 0;
 #endif
+
+    // reset FFT-based filter and staging buffers
+    if (_q->ff != NULL) {
+        FFTFILT(_reset)(_q->ff);
+        memset(_q->ff_in,  0x00, _q->ff_n*sizeof(TI));
+        memset(_q->ff_out, 0x00, _q->ff_n*sizeof(TO));
+        _q->ff_index = 0;
+        _q->ff_y     = 0;
+    }
 }
 
 // print filter object internals (taps, buffer)
 void FIRFILT(_print)(FIRFILT() _q)
 {
-    printf("firfilt_%s:\n", EXTENSION_FULL);
+    if (_q->ff != NULL)
+        printf("firfilt_%s: [fft, block length=%u]\n", EXTENSION_FULL, _q->ff_n);
+    else
+        printf("firfilt_%s:\n", EXTENSION_FULL);
     unsigned int i;
     unsigned int n = _q->h_len;
     for (i=0; i<n; i++) {
@@ -289,6 +383,10 @@ void FIRFILT(_set_scale)(FIRFILT() _q,
                          TC        _scale)
 {
     _q->scale = _scale;
+
+    // FFT-based filter applies scaling internally
+    if (_q->ff != NULL)
+        FFTFILT(_set_scale)(_q->ff, _scale);
 }
 
 // push sample into filter object's internal buffer
@@ -297,6 +395,17 @@ void FIRFILT(_set_scale)(FIRFILT() _q,
 void FIRFILT(_push)(FIRFILT() _q,
                     TI        _x)
 {
+    // FFT-based filter: stage input, retrieving output delayed by one block
+    if (_q->ff != NULL) {
+        _q->ff_y = _q->ff_out[_q->ff_index];
+        _q->ff_in[_q->ff_index++] = _x;
+        if (_q->ff_index == _q->ff_n) {
+            FFTFILT(_execute)(_q->ff, _q->ff_in, _q->ff_out);
+            _q->ff_index = 0;
+        }
+        return;
+    }
+
 #if LIQUID_FIRFILT_USE_WINDOW
     WINDOW(_push)(_q->w, _x);
 #else
@@ -322,6 +431,12 @@ void FIRFILT(_push)(FIRFILT() _q,
 void FIRFILT(_execute)(FIRFILT() _q,
                        TO *      _y)
 {
+    // FFT-based filter: output computed when block was filled
+    if (_q->ff != NULL) {
+        *_y = _q->ff_y;
+        return;
+    }
+
     // read buffer (retrieve pointer to aligned memory array)
 #if LIQUID_FIRFILT_USE_WINDOW
     TI *r;
@@ -348,6 +463,12 @@ void FIRFILT(_execute_block)(FIRFILT()    _q,
                              unsigned int _n,
                              TO *         _y)
 {
+    if (_q->ff != NULL) {
+        FIRFILT(_execute_block_fft)(_q, _x, _n, _y);
+        return;
+    }
+
+#if LIQUID_FIRFILT_USE_WINDOW
     unsigned int i;
     for (i=0; i<_n; i++) {
         // push sample into filter
@@ -356,6 +477,38 @@ void FIRFILT(_execute_block)(FIRFILT()    _q,
         // compute output sample
         FIRFILT(_execute)(_q, &_y[i]);
     }
+#else
+    unsigned int i = 0;
+    unsigned int j;
+    while (i < _n) {
+        // number of samples which can be appended to the buffer before the
+        // read index wraps around
+        unsigned int k = _q->w_mask - _q->w_index;
+        if (k == 0) {
+            // read index wraps: push sample, moving memory as necessary
+            FIRFILT(_push)(_q, _x[i]);
+            FIRFILT(_execute)(_q, &_y[i]);
+            i++;
+            continue;
+        }
+        if (k > _n - i)
+            k = _n - i;
+
+        // append input to end of buffer (before any output is written in
+        // case input and output buffers are the same)
+        memmove(_q->w + _q->w_index + _q->h_len, &_x[i], k*sizeof(TI));
+
+        // compute output samples directly from buffer
+        TI * r = _q->w + _q->w_index + 1;
+        for (j=0; j<k; j++) {
+            DOTPROD(_execute)(_q->dp, r + j, &_y[i+j]);
+            _y[i+j] *= _q->scale;
+        }
+
+        _q->w_index += k;
+        i += k;
+    }
+#endif
 }
 
 // get filter length
@@ -364,6 +517,18 @@ unsigned int FIRFILT(_get_length)(FIRFILT() _q)
     return _q->h_len;
 }
 
+// get implementation method in use (direct form or FFT)
+liquid_firfilt_method FIRFILT(_get_method)(FIRFILT() _q)
+{
+    return _q->ff != NULL ? LIQUID_FIRFILT_METHOD_FFT : LIQUID_FIRFILT_METHOD_DIRECT;
+}
+
+// get latency of output relative to direct-form convolution [samples]
+unsigned int FIRFILT(_get_latency)(FIRFILT() _q)
+{
+    return _q->ff != NULL ? _q->ff_n : 0;
+}
+
 // compute complex frequency response
 //  _q      :   filter object
 //  _fc     :   frequency
@@ -403,3 +568,98 @@ float FIRFILT(_groupdelay)(FIRFILT() _q,
     return fir_group_delay(h, n, _fc);
 }
 
+// execute FFT-based filter on a block of input samples; input is
+// staged until a full block is available, and output is delayed by
+// one block
+void FIRFILT(_execute_block_fft)(FIRFILT()    _q,
+                                 TI *         _x,
+                                 unsigned int _n,
+                                 TO *         _y)
+{
+    unsigned int i = 0;
+    unsigned int j;
+    while (i < _n) {
+        // number of samples until staging buffer is full
+        unsigned int k = _q->ff_n - _q->ff_index;
+        if (k > _n - i)
+            k = _n - i;
+
+        // exchange input and output (reading input before writing output
+        // in case buffers are the same)
+        TI * r = _q->ff_in  + _q->ff_index;
+        TO * s = _q->ff_out + _q->ff_index;
+        for (j=0; j<k; j++) {
+            r[j] = _x[i+j];
+            _y[i+j] = s[j];
+        }
+        _q->ff_y = _y[i+k-1];
+        _q->ff_index += k;
+        i += k;
+
+        // run filter on full block
+        if (_q->ff_index == _q->ff_n) {
+            FFTFILT(_execute)(_q->ff, _q->ff_in, _q->ff_out);
+            _q->ff_index = 0;
+        }
+    }
+}
+
+// estimate cost of direct-form filtering [cycles/sample]
+float FIRFILT(_cost_direct)(unsigned int _h_len)
+{
+    return FIRFILT_COST_DOTPROD * _h_len;
+}
+
+// estimate cost of FFT-based filtering with block length _n [cycles/sample]
+float FIRFILT(_cost_fft)(unsigned int _n)
+{
+    float nfft = 2.0f*_n;
+    return (2.0f*FIRFILT_COST_FFT*nfft*log2f(nfft) + FIRFILT_COST_BLOCK*nfft) / (float)_n;
+}
+
+// configure implementation (direct form or FFT) from requested method,
+// block length, and filter length
+void FIRFILT(_configure)(FIRFILT() _q)
+{
+    // remove existing FFT-based filter
+    if (_q->ff != NULL) {
+        FFTFILT(_destroy)(_q->ff);
+        free(_q->ff_in);
+        free(_q->ff_out);
+        _q->ff = NULL;
+    }
+
+    if (_q->method == LIQUID_FIRFILT_METHOD_DIRECT)
+        return;
+
+    // minimum block length for FFT-based filtering
+    unsigned int n_min = _q->h_len > 1 ? _q->h_len - 1 : 1;
+
+    // select block length: use requested length if valid, otherwise the
+    // smallest power of two which fits the filter (the cost per sample
+    // grows with the transform size)
+    unsigned int n = _q->block_len >= n_min ? _q->block_len : 1 << liquid_nextpow2(n_min);
+
+    // automatic selection: use FFT only if it is cheaper than direct form
+    if (_q->method == LIQUID_FIRFILT_METHOD_AUTO &&
+        FIRFILT(_cost_fft)(n) >= FIRFILT(_cost_direct)(_q->h_len))
+    {
+        // direct-form buffer is not updated while using FFT
+        FIRFILT(_reset)(_q);
+        return;
+    }
+
+    // copy coefficients in original order
+    TC h[_q->h_len];
+    unsigned int i;
+    for (i=0; i<_q->h_len; i++)
+        h[i] = _q->h[_q->h_len-i-1];
+
+    // create FFT-based filter and staging buffers
+    _q->ff_n   = n;
+    _q->ff     = FFTFILT(_create)(h, _q->h_len, _q->ff_n);
+    _q->ff_in  = (TI*) malloc(_q->ff_n*sizeof(TI));
+    _q->ff_out = (TO*) malloc(_q->ff_n*sizeof(TO));
+    FFTFILT(_set_scale)(_q->ff, _q->scale);
+    FIRFILT(_reset)(_q);
+}
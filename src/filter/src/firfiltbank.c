@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// firfiltbank : bank of finite impulse response (FIR) filters sharing a
+//               single set of coefficients
+//
+// The history of all channels is stored interleaved (one frame of
+// num_channels samples per time step) so that each filter tap scales a
+// contiguous frame; the inner loop runs across channels and advances
+// several channels per vector instruction.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// defined:
+//  FIRFILTBANK()   name-mangling macro
+//  TO              output type
+//  TC              coefficients type
+//  TI              input type
+//  PRINTVAL()      print macro
+
+// number of floating-point values accumulated together in registers
+#ifndef FIRFILTBANK_BLOCK
+#  define FIRFILTBANK_BLOCK 16
+#endif
+
+// firfiltbank object structure
+struct FIRFILTBANK(_s) {
+    TC *         h;             // filter coefficients (reversed) [size: h_len x 1]
+    unsigned int h_len;         // filter length
+    unsigned int num_channels;  // number of channels
+
+    // interleaved buffer: sample k of channel c in current window is
+    // stored at w[(w_index + k)*num_channels + c]
+    TI *         w;             // internal buffer
+    unsigned int w_len;         // window length (frames)
+    unsigned int w_mask;        // window index mask
+    unsigned int w_index;       // window read index
+
+    TC scale;                   // output scaling factor
+};
+
+// compute one output frame from internal buffer
+void FIRFILTBANK(_execute_frame)(FIRFILTBANK() _q,
+                                 TO *          _y);
+
+// create filter bank object
+//  _h              :   coefficients (filter taps) [size: _n x 1]
+//  _n              :   filter length, _n > 0
+//  _num_channels   :   number of channels, _num_channels > 0
+FIRFILTBANK() FIRFILTBANK(_create)(TC *         _h,
+                                   unsigned int _n,
+                                   unsigned int _num_channels)
+{
+    // validate input
+    if (_n == 0) {
+        fprintf(stderr,"error: firfiltbank_%s_create(), filter length must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_num_channels == 0) {
+        fprintf(stderr,"error: firfiltbank_%s_create(), number of channels must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // create filter object and initialize
+    FIRFILTBANK() q = (FIRFILTBANK()) malloc(sizeof(struct FIRFILTBANK(_s)));
+    q->h_len        = _n;
+    q->num_channels = _num_channels;
+    q->h            = (TC *) malloc((q->h_len)*sizeof(TC));
+
+    // initialize array for buffering
+    q->w_len   = 1<<liquid_msb_index(q->h_len); // effectively 2^{floor(log2(len))+1}
+    q->w_mask  = q->w_len - 1;
+    q->w       = (TI *) malloc((q->w_len + q->h_len + 1)*q->num_channels*sizeof(TI));
+    q->w_index = 0;
+
+    // load filter in reverse order
+    unsigned int i;
+    for (i=_n; i>0; i--)
+        q->h[i-1] = _h[_n-i];
+
+    // set default scaling
+    q->scale = 1;
+
+    // reset filter state (clear buffer)
+    FIRFILTBANK(_reset)(q);
+
+    return q;
+}
+
+// create filter bank using Kaiser-Bessel windowed sinc method
+//  _n              : filter length, _n > 0
+//  _fc             : cutoff frequency, 0 < _fc < 0.5
+//  _As             : stop-band attenuation [dB], _As > 0
+//  _mu             : fractional sample offset, -0.5 < _mu < 0.5
+//  _num_channels   : number of channels, _num_channels > 0
+FIRFILTBANK() FIRFILTBANK(_create_kaiser)(unsigned int _n,
+                                          float        _fc,
+                                          float        _As,
+                                          float        _mu,
+                                          unsigned int _num_channels)
+{
+    // validate input
+    if (_n == 0) {
+        fprintf(stderr,"error: firfiltbank_%s_create_kaiser(), filter length must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // compute temporary array for holding coefficients
+    float hf[_n];
+    liquid_firdes_kaiser(_n, _fc, _As, _mu, hf);
+
+    // copy coefficients to type-specific array
+    TC h[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        h[i] = (TC) hf[i];
+
+    return FIRFILTBANK(_create)(h, _n, _num_channels);
+}
+
+// destroy filter bank object
+void FIRFILTBANK(_destroy)(FIRFILTBANK() _q)
+{
+    free(_q->w);
+    free(_q->h);
+    free(_q);
+}
+
+// reset internal state of all channels
+void FIRFILTBANK(_reset)(FIRFILTBANK() _q)
+{
+    memset(_q->w, 0x00, (_q->w_len + _q->h_len + 1)*_q->num_channels*sizeof(TI));
+    _q->w_index = 0;
+}
+
+// print filter bank object internals
+void FIRFILTBANK(_print)(FIRFILTBANK() _q)
+{
+    printf("firfiltbank_%s: [%u channels]\n", EXTENSION_FULL, _q->num_channels);
+    unsigned int i;
+    unsigned int n = _q->h_len;
+    for (i=0; i<n; i++) {
+        printf("  h(%3u) = ", i+1);
+        PRINTVAL_TC(_q->h[n-i-1],%12.8f);
+        printf("\n");
+    }
+
+    // print scaling
+    printf("  scale = ");
+    PRINTVAL_TC(_q->scale,%12.8f);
+    printf("\n");
+}
+
+// set output scaling for all channels
+void FIRFILTBANK(_set_scale)(FIRFILTBANK() _q,
+                             TC            _scale)
+{
+    _q->scale = _scale;
+}
+
+// push one sample for each channel into internal buffer
+//  _q      :   filter bank object
+//  _x      :   input frame [size: num_channels x 1]
+void FIRFILTBANK(_push)(FIRFILTBANK() _q,
+                        TI *          _x)
+{
+    unsigned int m = _q->num_channels;
+
+    // increment index
+    _q->w_index++;
+
+    // wrap around pointer
+    _q->w_index &= _q->w_mask;
+
+    // if pointer wraps around, copy excess memory
+    if (_q->w_index == 0)
+        memmove(_q->w, _q->w + _q->w_len*m, (_q->h_len)*m*sizeof(TI));
+
+    // append frame to end of buffer
+    memmove(_q->w + (_q->w_index + _q->h_len - 1)*m, _x, m*sizeof(TI));
+}
+
+// compute output sample for each channel
+//  _q      :   filter bank object
+//  _y      :   output frame [size: num_channels x 1]
+void FIRFILTBANK(_execute)(FIRFILTBANK() _q,
+                           TO *          _y)
+{
+    FIRFILTBANK(_execute_frame)(_q, _y);
+}
+
+// execute the filter bank on a block of input frames; the input and
+// output buffers may be the same
+//  _q      : filter bank object
+//  _x      : input array, interleaved by channel [size: _n*num_channels x 1]
+//  _n      : number of input, output frames
+//  _y      : output array, interleaved by channel [size: _n*num_channels x 1]
+void FIRFILTBANK(_execute_block)(FIRFILTBANK() _q,
+                                 TI *          _x,
+                                 unsigned int  _n,
+                                 TO *          _y)
+{
+    unsigned int m = _q->num_channels;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        // push frame into filter bank
+        FIRFILTBANK(_push)(_q, &_x[i*m]);
+
+        // compute output frame
+        FIRFILTBANK(_execute_frame)(_q, &_y[i*m]);
+    }
+}
+
+// get filter length
+unsigned int FIRFILTBANK(_get_length)(FIRFILTBANK() _q)
+{
+    return _q->h_len;
+}
+
+// get number of channels
+unsigned int FIRFILTBANK(_get_num_channels)(FIRFILTBANK() _q)
+{
+    return _q->num_channels;
+}
+
+// accumulate one tap across a block of channels
+//  _acc    :   accumulator [size: FIRFILTBANK_BLOCK x 1]
+//  _h      :   filter coefficient
+//  _v      :   buffer at current tap [size: FIRFILTBANK_BLOCK x 1]
+static inline void FIRFILTBANK(_accumulate)(float *       _acc,
+                                            TC            _h,
+                                            const float * _v)
+{
+    unsigned int j;
+#if TC_COMPLEX == 0
+    for (j=0; j<FIRFILTBANK_BLOCK; j++)
+        _acc[j] += _h * _v[j];
+#else
+    // interleaved {real, imag} pairs
+    float hi = crealf(_h);
+    float hq = cimagf(_h);
+    for (j=0; j<FIRFILTBANK_BLOCK; j+=2) {
+        _acc[j  ] += hi * _v[j  ] - hq * _v[j+1];
+        _acc[j+1] += hi * _v[j+1] + hq * _v[j  ];
+    }
+#endif
+}
+
+// compute one output frame from internal buffer; each coefficient scales
+// a contiguous frame of all channels which is accumulated into the output
+void FIRFILTBANK(_execute_frame)(FIRFILTBANK() _q,
+                                 TO *          _y)
+{
+    unsigned int m = _q->num_channels;
+    unsigned int i;
+    unsigned int k;
+
+    // pointer to oldest frame in current window
+    TI * r = _q->w + _q->w_index*m;
+
+    // operate on underlying floating-point arrays
+    unsigned int n = TI_COMPLEX ? 2*m : m;  // floats per frame
+    float * y = (float*) _y;
+    float * v = (float*) r;
+
+    // process channels in fixed-size blocks, keeping the accumulators in
+    // registers across all taps
+    float acc[FIRFILTBANK_BLOCK];
+    unsigned int t = n - (n % FIRFILTBANK_BLOCK);
+    unsigned int j;
+    for (i=0; i<t; i+=FIRFILTBANK_BLOCK) {
+        for (j=0; j<FIRFILTBANK_BLOCK; j++)
+            acc[j] = 0.0f;
+        for (k=0; k<_q->h_len; k++)
+            FIRFILTBANK(_accumulate)(acc, _q->h[k], v + k*n + i);
+        for (j=0; j<FIRFILTBANK_BLOCK; j++)
+            y[i+j] = acc[j];
+    }
+
+    // remaining channels, one at a time
+    for ( ; i<n; i+=(TI_COMPLEX ? 2 : 1)) {
+#if TI_COMPLEX == 0
+        float v0 = 0.0f;
+        for (k=0; k<_q->h_len; k++)
+            v0 += _q->h[k] * v[k*n + i];
+        y[i] = v0;
+#else
+        TO v0 = 0.0f;
+        for (k=0; k<_q->h_len; k++)
+            v0 += _q->h[k] * r[(k*n + i)/2];
+        _y[i/2] = v0;
+#endif
+    }
+
+    // apply scaling factor
+    if (_q->scale != 1) {
+        for (i=0; i<m; i++)
+            _y[i] *= _q->scale;
+    }
+}
+
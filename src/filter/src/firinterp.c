@@ -207,10 +207,7 @@ void FIRINTERP(_execute_block)(FIRINTERP()  _q,
                                unsigned int _n,
                                TO *         _y)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        // execute one input at a time with an output stride _M
-        FIRINTERP(_execute)(_q, _x[i], &_y[i*_q->M]);
-    }
+    // each input sample drives all _M polyphase branches in turn
+    FIRPFB(_execute_block_bank)(_q->filterbank, _x, _n, _y);
 }
 
@@ -28,6 +28,9 @@
 #include <string.h>
 #include <stdlib.h>
 
+// maximum number of input samples processed together in block methods
+#define LIQUID_FIRPFB_BLOCK_SIZE    (256)
+
 struct FIRPFB(_s) {
     TC * h;                     // filter coefficients array
     unsigned int h_len;         // total number of filter coefficients
@@ -37,8 +40,19 @@ struct FIRPFB(_s) {
     WINDOW() w;                 // window buffer
     DOTPROD() * dp;             // array of vector dot product objects
     TC scale;                   // output scaling factor
+
+    // block execution buffer: history followed by input block
+    TI * buf;                   // [size: h_sub_len-1 + LIQUID_FIRPFB_BLOCK_SIZE x 1]
 };
 
+// run block of input samples through subset of filters in bank
+void FIRPFB(_run_block)(FIRPFB()     _q,
+                        unsigned int _i0,
+                        unsigned int _num,
+                        TI *         _x,
+                        unsigned int _n,
+                        TO *         _y);
+
 // create firpfb from external coefficients
 //  _M      : number of filters in the bank
 //  _h      : coefficients [size: _M*_h_len x 1]
@@ -89,6 +103,9 @@ FIRPFB() FIRPFB(_create)(unsigned int _M,
     // create window buffer
     q->w = WINDOW(_create)(q->h_sub_len);
 
+    // allocate block execution buffer
+    q->buf = (TI*) malloc((q->h_sub_len - 1 + LIQUID_FIRPFB_BLOCK_SIZE)*sizeof(TI));
+
     // set default scaling
     q->scale = 1;
 
@@ -280,6 +297,7 @@ void FIRPFB(_destroy)(FIRPFB() _q)
         DOTPROD(_destroy)(_q->dp[i]);
     free(_q->dp);
     WINDOW(_destroy)(_q->w);
+    free(_q->buf);
     free(_q);
 }
 
@@ -357,13 +375,82 @@ void FIRPFB(_execute_block)(FIRPFB()     _q,
                             unsigned int _n,
                             TO *         _y)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        // push sample into filter
-        FIRPFB(_push)(_q, _x[i]);
+    // validate input
+    if (_i >= _q->num_filters) {
+        fprintf(stderr,"error: firpfb_execute_block(), filterbank index (%u) exceeds maximum (%u)\n",
+                _i, _q->num_filters);
+        exit(1);
+    }
+
+    FIRPFB(_run_block)(_q, _i, 1, _x, _n, _y);
+}
+
+// execute every filter in the bank on a block of input samples
+//  _q      : firpfb object
+//  _x      : pointer to input array [size: _n x 1]
+//  _n      : number of input samples
+//  _y      : output array [size: _n*num_filters x 1]
+void FIRPFB(_execute_block_bank)(FIRPFB()     _q,
+                                 TI *         _x,
+                                 unsigned int _n,
+                                 TO *         _y)
+{
+    FIRPFB(_run_block)(_q, 0, _q->num_filters, _x, _n, _y);
+}
 
-        // compute output at appropriate index
-        FIRPFB(_execute)(_q, _i, &_y[i]);
+// run block of input samples through filters [_i0, _i0+_num) of the bank,
+// reading directly from a contiguous array holding the most recent
+// h_sub_len-1 samples of the window followed by the input
+//  _q      : firpfb object
+//  _i0     : index of first filter to use
+//  _num    : number of filters to use
+//  _x      : pointer to input array [size: _n x 1]
+//  _n      : number of input samples
+//  _y      : output array [size: _n*_num x 1]
+void FIRPFB(_run_block)(FIRPFB()     _q,
+                        unsigned int _i0,
+                        unsigned int _num,
+                        TI *         _x,
+                        unsigned int _n,
+                        TO *         _y)
+{
+    if (_n == 0)
+        return;
+
+    // history plus input block
+    unsigned int len = _q->h_sub_len;
+    TI * buf = _q->buf;
+
+    // load history from window
+    TI * r;
+    WINDOW(_read)(_q->w, &r);
+    memmove(buf, r + 1, (len-1)*sizeof(TI));
+
+    unsigned int i = 0; // input sample index
+    unsigned int k = 0; // number of samples in block
+    unsigned int j, b;
+    while (i < _n) {
+        // append block of input samples after history (before any output
+        // is written in case input and output buffers are the same)
+        k = (_n - i) < LIQUID_FIRPFB_BLOCK_SIZE ? (_n - i) : LIQUID_FIRPFB_BLOCK_SIZE;
+        memmove(buf + len - 1, &_x[i], k*sizeof(TI));
+
+        // the same span of the buffer drives each filter in turn
+        for (j=0; j<k; j++) {
+            TO * y = &_y[(i+j)*_num];
+            for (b=0; b<_num; b++) {
+                DOTPROD(_execute)(_q->dp[_i0+b], buf + j, &y[b]);
+                y[b] *= _q->scale;
+            }
+        }
+
+        // retain most recent samples as history for next block
+        i += k;
+        if (i < _n)
+            memmove(buf, buf + k, (len-1)*sizeof(TI));
     }
+
+    // update window with most recent samples
+    WINDOW(_write)(_q->w, buf + k - 1, len);
 }
 
@@ -30,14 +30,30 @@
 #include <stdlib.h>
 #include <string.h>
 
+// number of input samples filtered at a time by block execution
+#define LIQUID_IIRDECIM_BLOCK_LEN   (256)
+
 // decimator structure
 struct IIRDECIM(_s) {
     unsigned int M;     // decimation factor
 
     // TODO: use IIR polyphase filterbank
     IIRFILT() iirfilt;  // filter object
+
+    // block execution buffer
+    TO *         buf;       // filter output [size: num_block*M x 1]
+    unsigned int num_block; // number of output samples per block
 };
 
+// allocate block execution buffer
+void IIRDECIM(_init_buffer)(IIRDECIM() _q)
+{
+    _q->num_block = LIQUID_IIRDECIM_BLOCK_LEN / _q->M;
+    if (_q->num_block == 0)
+        _q->num_block = 1;
+    _q->buf = (TO *) malloc(_q->num_block*_q->M*sizeof(TO));
+}
+
 // create interpolator from external coefficients
 //  _M      : interpolation factor
 //  _b      : feed-back coefficients [size: _nb x 1]
@@ -62,6 +78,7 @@ IIRDECIM() IIRDECIM(_create)(unsigned int _M,
 
     // create filter
     q->iirfilt = IIRFILT(_create)(_b, _nb, _a, _na);
+    IIRDECIM(_init_buffer)(q);
 
     // return interpolator object
     return q;
@@ -108,6 +125,7 @@ IIRDECIM() IIRDECIM(_create_prototype)(unsigned int             _M,
 
     // create filter
     q->iirfilt = IIRFILT(_create_prototype)(_ftype, _btype, _format, _order, _fc, _f0, _Ap, _As);
+    IIRDECIM(_init_buffer)(q);
 
     // return interpolator object
     return q;
@@ -117,6 +135,7 @@ IIRDECIM() IIRDECIM(_create_prototype)(unsigned int             _M,
 void IIRDECIM(_destroy)(IIRDECIM() _q)
 {
     IIRFILT(_destroy)(_q->iirfilt);
+    free(_q->buf);
     free(_q);
 }
 
@@ -134,25 +153,24 @@ void IIRDECIM(_reset)(IIRDECIM() _q)
     IIRFILT(_reset)(_q->iirfilt);
 }
 
+// set execution topology of internal filter
+//  _q          : decimator object
+//  _parallel   : use parallel-form bank? 0:no, 1:yes
+void IIRDECIM(_set_parallel)(IIRDECIM() _q,
+                             int        _parallel)
+{
+    IIRFILT(_set_parallel)(_q->iirfilt, _parallel);
+}
+
 // execute decimator
 //  _q      :   decimator object
 //  _x      :   input sample array [size: _M x 1]
 //  _y      :   output sample pointer
-//  _index  :   decimator output index [0,_M-1]
 void IIRDECIM(_execute)(IIRDECIM()   _q,
                         TI *         _x,
                         TO *         _y)
 {
-    TO v; // output value
-    unsigned int i;
-    for (i=0; i<_q->M; i++) {
-        // run filter
-        IIRFILT(_execute)(_q->iirfilt, _x[i], &v);
-
-        // save output at appropriate index
-        if (i==0)
-            *_y = v;
-    }
+    IIRDECIM(_execute_block)(_q, _x, 1, _y);
 }
 
 // execute decimator on block of _n*_M input samples
@@ -165,10 +183,16 @@ void IIRDECIM(_execute_block)(IIRDECIM()   _q,
                               unsigned int _n,
                               TO *         _y)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        // execute _M input samples computing just one output each time
-        IIRDECIM(_execute)(_q, &_x[i*_q->M], &_y[i]);
+    unsigned int i, n;
+    for (n=0; n<_n; n+=_q->num_block) {
+        unsigned int num_out = _n - n < _q->num_block ? _n - n : _q->num_block;
+
+        // run filter over every input sample in the block...
+        IIRFILT(_execute_block)(_q->iirfilt, &_x[n*_q->M], num_out*_q->M, _q->buf);
+
+        // ...and keep the first of each group of _M outputs
+        for (i=0; i<num_out; i++)
+            _y[n+i] = _q->buf[i*_q->M];
     }
 }
 
@@ -46,6 +46,24 @@
 // use structured dot product? 0:no, 1:yes
 #define LIQUID_IIRFILT_USE_DOTPROD   (1)
 
+// number of parallel-form sections run together by the SIMD bank
+// kernel (one lane for each section and real-valued channel); the
+// section arrays are padded to a multiple of this value
+#define LIQUID_IIRFILT_PARALLEL_SECTIONS    (LIQUID_VECTOR_SOSBANK_LANES / (TO_COMPLEX ? 2 : 1))
+
+// maximum number of samples buffered by the parallel-form block
+// execution when the input and output arrays are the same
+#define LIQUID_IIRFILT_BLOCK_LEN            (256)
+
+// parallel-form conditioning check: the sum of the section response
+// magnitudes may not exceed the filter's peak response by more than
+// this factor, and the response may not deviate from that of the
+// cascade by more than this fraction of its peak, evaluated at this
+// many frequencies
+#define LIQUID_IIRFILT_PARALLEL_MAX_GAIN    (1000.0)
+#define LIQUID_IIRFILT_PARALLEL_MAX_ERROR   (1e-3)
+#define LIQUID_IIRFILT_PARALLEL_NFREQ       (256)
+
 struct IIRFILT(_s) {
     TC * b;             // numerator (feed-forward coefficients)
     TC * a;             // denominator (feed-back coefficients)
@@ -66,9 +84,24 @@ struct IIRFILT(_s) {
     DOTPROD() dpa;      // denominator dot product
 #endif
 
-    // second-order sections 
-    IIRFILTSOS() * qsos;    // second-order sections filters
+    // second-order sections (transposed direct form II)
+    TC * bsos;              // normalized feed-forward coefficients [size: 3*nsos]
+    TC * asos;              // normalized feed-back coefficients [size: 3*nsos]
+    TO * wsos;              // section state [size: 2*nsos]
     unsigned int nsos;      // number of second-order sections
+
+    // parallel-form (partial-fraction) bank of second-order sections
+    int          parallel;  // execute parallel-form bank? 0:no, 1:yes
+    unsigned int npar;      // number of parallel sections (padded)
+    TC   c;                 // direct feed-through term
+    TC * pb0;               // section feed-forward coefficients [size: npar]
+    TC * pb1;               //
+    TC * pa1;               // section feed-back coefficients [size: npar]
+    TC * pa2;               //
+    TO * pw1;               // section state [size: npar]
+    TO * pw2;               //
+    float * pbank;          // coefficients by kernel lane [size: 4*LANES*npar/SECTIONS]
+    TO * buf;               // block input buffer [size: LIQUID_IIRFILT_BLOCK_LEN]
 };
 
 // initialize internal objects/arrays
@@ -77,14 +110,254 @@ void IIRFILT(_init)(IIRFILT() _q)
     _q->b    = NULL;
     _q->a    = NULL;
     _q->v    = NULL;
-    _q->qsos = NULL;
+    _q->bsos = NULL;
+    _q->asos = NULL;
+    _q->wsos = NULL;
     _q->nsos = 0;
+    _q->parallel = 0;
+    _q->npar = 0;
+    _q->c    = 0;
+    _q->pb0  = NULL;
+    _q->pb1  = NULL;
+    _q->pa1  = NULL;
+    _q->pa2  = NULL;
+    _q->pw1  = NULL;
+    _q->pw2  = NULL;
+    _q->pbank = NULL;
+    _q->buf  = NULL;
 #if LIQUID_IIRFILT_USE_DOTPROD
     _q->dpb  = NULL;
     _q->dpa  = NULL;
 #endif
 }
 
+// free parallel-form bank arrays
+void IIRFILT(_parallel_free)(IIRFILT() _q)
+{
+    if (_q->pb0 != NULL) free(_q->pb0);
+    if (_q->pb1 != NULL) free(_q->pb1);
+    if (_q->pa1 != NULL) free(_q->pa1);
+    if (_q->pa2 != NULL) free(_q->pa2);
+    if (_q->pw1 != NULL) free(_q->pw1);
+    if (_q->pw2 != NULL) free(_q->pw2);
+    if (_q->pbank != NULL) free(_q->pbank);
+    if (_q->buf != NULL) free(_q->buf);
+    _q->pb0  = NULL;
+    _q->pb1  = NULL;
+    _q->pa1  = NULL;
+    _q->pa2  = NULL;
+    _q->pw1  = NULL;
+    _q->pw2  = NULL;
+    _q->pbank = NULL;
+    _q->buf  = NULL;
+    _q->npar = 0;
+}
+
+// convert cascaded second-order sections to parallel form
+//
+//                 P-1  b0[k] + b1[k] z^-1
+//  H(z) = c   +   sum  ------------------------------
+//                 k=0  1 + a1[k] z^-1 + a2[k] z^-2
+//
+// by expanding H(z) in partial fractions over the poles of each
+// section; poles belonging to the same section are recombined so
+// that every parallel section has real coefficients. A numerator one
+// order higher than the denominator (e.g. odd-order half-band designs
+// with a pole at the origin) adds a single tap c1 z^-1, run as one
+// more section with b0 = a1 = a2 = 0. Returns 0 on success, or -1 if
+// the filter cannot be decomposed (complex coefficients, repeated
+// poles, numerator order exceeding the denominator order by more than
+// one) or if the expansion is inaccurate or its sections cancel each
+// other so strongly that single-precision execution would be
+// noticeably less accurate than the cascade.
+int IIRFILT(_parallel_design)(IIRFILT() _q)
+{
+#if TC_COMPLEX
+    // poles of complex-coefficient sections are not conjugate
+    // pairs and cannot be recombined into real sections
+    return -1;
+#else
+    unsigned int nsos = _q->nsos;
+    unsigned int i, j, k;
+
+    // find poles of each section: roots of z^2 + a1 z + a2
+    double complex p[2*nsos];   // poles
+    unsigned int   sec[2*nsos]; // section index of each pole
+    unsigned int   num_poles = 0;
+    unsigned int   order_b   = 0;
+    double         lead_b    = 1.0; // leading numerator coefficient
+    double         lead_a    = 1.0; // leading denominator coefficient
+    for (i=0; i<nsos; i++) {
+        double b1 = _q->bsos[3*i+1];
+        double b2 = _q->bsos[3*i+2];
+        double a1 = _q->asos[3*i+1];
+        double a2 = _q->asos[3*i+2];
+
+        // numerator order and leading coefficient
+        if (b2 != 0.0) {
+            order_b += 2;
+            lead_b  *= b2;
+        } else if (b1 != 0.0) {
+            order_b += 1;
+            lead_b  *= b1;
+        } else {
+            lead_b  *= _q->bsos[3*i+0];
+        }
+
+        if (a2 != 0.0) {
+            // two poles (complex-conjugate pair or two real poles)
+            double complex d = csqrt(a1*a1 - 4.0*a2);
+            p[num_poles]   = 0.5*(-a1 + d);
+            sec[num_poles] = i;
+            num_poles++;
+            p[num_poles]   = 0.5*(-a1 - d);
+            sec[num_poles] = i;
+            num_poles++;
+            lead_a *= a2;
+        } else if (a1 != 0.0) {
+            // single real pole
+            p[num_poles]   = -a1;
+            sec[num_poles] = i;
+            num_poles++;
+            lead_a *= a1;
+        }
+    }
+
+    // a filter without poles, or with a numerator of much higher
+    // order than its denominator, would need more feed-forward taps
+    if (num_poles == 0 || order_b > num_poles + 1)
+        return -1;
+
+    // partial fractions require distinct poles
+    for (j=0; j<num_poles; j++) {
+        for (k=j+1; k<num_poles; k++) {
+            if (cabs(p[j] - p[k]) < 1e-6 * cabs(p[j]))
+                return -1;
+        }
+    }
+
+    // residues: r[k] = B(1/p[k]) / prod_{j!=k} (1 - p[j]/p[k])
+    double complex r[num_poles];
+    for (k=0; k<num_poles; k++) {
+        double complex u = 1.0 / p[k];
+        double complex num = 1.0;
+        for (i=0; i<nsos; i++) {
+            num *= _q->bsos[3*i+0] +
+                   _q->bsos[3*i+1]*u +
+                   _q->bsos[3*i+2]*u*u;
+        }
+        double complex den = 1.0;
+        for (j=0; j<num_poles; j++) {
+            if (j != k)
+                den *= 1.0 - p[j]*u;
+        }
+        r[k] = num / den;
+    }
+
+    // polynomial part c + c1 z^-1: the highest-order term is the ratio
+    // of leading coefficients in z^-1; with an additional tap c1 the
+    // direct term follows from H at z^-1 = 0
+    double c  = 0.0;
+    double c1 = 0.0;
+    if (order_b == num_poles) {
+        c = lead_b / lead_a;
+    } else if (order_b > num_poles) {
+        c1 = lead_b / lead_a;
+        c  = 1.0;
+        for (i=0; i<nsos; i++)
+            c *= _q->bsos[3*i+0];
+        for (k=0; k<num_poles; k++)
+            c -= creal(r[k]);
+    }
+
+    // allocate bank, padding to a multiple of the number of lanes
+    unsigned int num_sections = 0;
+    for (k=0; k<num_poles; k++)
+        num_sections += (k==0 || sec[k] != sec[k-1]) ? 1 : 0;
+    num_sections += (c1 != 0.0) ? 1 : 0;
+    unsigned int L = LIQUID_IIRFILT_PARALLEL_SECTIONS;
+    IIRFILT(_parallel_free)(_q);
+    _q->npar = L * ((num_sections + L - 1) / L);
+    _q->c    = c;
+    _q->pb0  = (TC *) calloc(_q->npar, sizeof(TC));
+    _q->pb1  = (TC *) calloc(_q->npar, sizeof(TC));
+    _q->pa1  = (TC *) calloc(_q->npar, sizeof(TC));
+    _q->pa2  = (TC *) calloc(_q->npar, sizeof(TC));
+    _q->pw1  = (TO *) calloc(_q->npar, sizeof(TO));
+    _q->pw2  = (TO *) calloc(_q->npar, sizeof(TO));
+    _q->pbank = (float *) malloc(4*LIQUID_VECTOR_SOSBANK_LANES*(_q->npar/L)*sizeof(float));
+    _q->buf  = (TO *) malloc(LIQUID_IIRFILT_BLOCK_LEN*sizeof(TO));
+
+    // recombine the poles of each cascade section
+    //   r0/(1-p0 z^-1) + r1/(1-p1 z^-1)
+    //   = [(r0+r1) - (r0 p1 + r1 p0) z^-1] / [1 - (p0+p1) z^-1 + p0 p1 z^-2]
+    for (i=0, k=0; k<num_poles; i++) {
+        if (k+1 < num_poles && sec[k+1] == sec[k]) {
+            _q->pb0[i] =  creal(r[k] + r[k+1]);
+            _q->pb1[i] = -creal(r[k]*p[k+1] + r[k+1]*p[k]);
+            _q->pa1[i] = -creal(p[k] + p[k+1]);
+            _q->pa2[i] =  creal(p[k]*p[k+1]);
+            k += 2;
+        } else {
+            _q->pb0[i] =  creal(r[k]);
+            _q->pa1[i] = -creal(p[k]);
+            k += 1;
+        }
+    }
+    if (c1 != 0.0)
+        _q->pb1[i] = c1;
+
+    // measure the cancellation between sections: if the sum of the
+    // magnitudes of the section responses greatly exceeds that of
+    // the filter, rounding errors in each section are amplified; the
+    // expansion itself is compared against the cascade response as
+    // closely spaced poles make the residues inaccurate
+    double Hmax = 0.0;  // peak magnitude of the filter response
+    double Smax = 0.0;  // peak sum of section response magnitudes
+    double Emax = 0.0;  // peak deviation from the cascade response
+    for (j=0; j<LIQUID_IIRFILT_PARALLEL_NFREQ; j++) {
+        double complex u = cexp(-_Complex_I*M_PI*j/(double)LIQUID_IIRFILT_PARALLEL_NFREQ);
+        double complex H = c;
+        double         S = fabs(c);
+        for (i=0; i<_q->npar; i++) {
+            double complex Hk = (_q->pb0[i] + _q->pb1[i]*u) /
+                                (1.0 + _q->pa1[i]*u + _q->pa2[i]*u*u);
+            H += Hk;
+            S += cabs(Hk);
+        }
+        double complex Hc = 1.0;
+        for (i=0; i<nsos; i++) {
+            Hc *= (_q->bsos[3*i+0] + _q->bsos[3*i+1]*u + _q->bsos[3*i+2]*u*u) /
+                  (1.0             + _q->asos[3*i+1]*u + _q->asos[3*i+2]*u*u);
+        }
+        Hmax = cabs(H)    > Hmax ? cabs(H)    : Hmax;
+        Smax = S          > Smax ? S          : Smax;
+        Emax = cabs(H-Hc) > Emax ? cabs(H-Hc) : Emax;
+    }
+    if (Smax > LIQUID_IIRFILT_PARALLEL_MAX_GAIN  * Hmax ||
+        Emax > LIQUID_IIRFILT_PARALLEL_MAX_ERROR * Hmax)
+    {
+        IIRFILT(_parallel_free)(_q);
+        return -1;
+    }
+
+    // arrange coefficients by lane for the bank kernel, with the
+    // real and imaginary channels of each section in adjacent lanes
+    unsigned int nc = TO_COMPLEX ? 2 : 1;
+    unsigned int W  = LIQUID_VECTOR_SOSBANK_LANES;
+    for (i=0; i<_q->npar/L; i++) {
+        float * h = _q->pbank + 4*W*i;
+        for (k=0; k<W; k++) {
+            h[0*W+k] = _q->pb0[i*L + k/nc];
+            h[1*W+k] = _q->pb1[i*L + k/nc];
+            h[2*W+k] = _q->pa1[i*L + k/nc];
+            h[3*W+k] = _q->pa2[i*L + k/nc];
+        }
+    }
+    return 0;
+#endif
+}
+
 // create iirfilt (infinite impulse response filter) object
 //  _b      :   numerator, feed-forward coefficients [size: _nb x 1]
 //  _nb     :   length of numerator
@@ -176,7 +449,6 @@ IIRFILT() IIRFILT(_create_sos)(TC *         _B,
     IIRFILT(_init)(q);
     q->type = IIRFILT_TYPE_SOS;
     q->nsos = _nsos;
-    q->qsos = (IIRFILTSOS()*) malloc( (q->nsos)*sizeof(IIRFILTSOS()) );
     q->n = _nsos * 2;
 
     // create coefficients array and copy over
@@ -185,17 +457,23 @@ IIRFILT() IIRFILT(_create_sos)(TC *         _B,
     memmove(q->b, _B, 3*(q->nsos)*sizeof(TC));
     memmove(q->a, _A, 3*(q->nsos)*sizeof(TC));
 
-    TC at[3];
-    TC bt[3];
+    // normalize each section to its own a[0] and store contiguously
+    // so the cascade runs without per-section object calls
+    q->bsos = (TC *) malloc(3*(q->nsos)*sizeof(TC));
+    q->asos = (TC *) malloc(3*(q->nsos)*sizeof(TC));
+    q->wsos = (TO *) malloc(2*(q->nsos)*sizeof(TO));
     unsigned int i,k;
     for (i=0; i<q->nsos; i++) {
+        TC a0 = q->a[3*i];
         for (k=0; k<3; k++) {
-            at[k] = q->a[3*i+k];
-            bt[k] = q->b[3*i+k];
+            q->bsos[3*i+k] = q->b[3*i+k] / a0;
+            q->asos[3*i+k] = q->a[3*i+k] / a0;
         }
-        q->qsos[i] = IIRFILTSOS(_create)(bt,at);
-        //q->qsos[i] = IIRFILT(_create)(q->b+3*i,3,q->a+3*i,3);
     }
+
+    // reset internal state
+    IIRFILT(_reset)(q);
+
     return q;
 }
 
@@ -437,14 +715,13 @@ void IIRFILT(_destroy)(IIRFILT() _q)
     if (_q->a   != NULL) free(_q->a);
     if (_q->v   != NULL) free(_q->v);
 
-    // if filter is comprised of cascaded second-order sections,
-    // delete sub-filters separately
-    if (_q->qsos != NULL) {
-        unsigned int i;
-        for (i=0; i<_q->nsos; i++)
-            IIRFILTSOS(_destroy)(_q->qsos[i]);
-        free(_q->qsos);
-    }
+    // free second-order sections arrays
+    if (_q->bsos != NULL) free(_q->bsos);
+    if (_q->asos != NULL) free(_q->asos);
+    if (_q->wsos != NULL) free(_q->wsos);
+
+    // free parallel-form bank
+    IIRFILT(_parallel_free)(_q);
 
     // free main object memory
     free(_q);
@@ -453,12 +730,21 @@ void IIRFILT(_destroy)(IIRFILT() _q)
 // print iirfilt object internals
 void IIRFILT(_print)(IIRFILT() _q)
 {
-    printf("iir filter [%s]:\n", _q->type == IIRFILT_TYPE_NORM ? "normal" : "sos");
+    printf("iir filter [%s]:\n", _q->type == IIRFILT_TYPE_NORM ? "normal" :
+                                 (_q->parallel ? "sos, parallel" : "sos"));
     unsigned int i;
 
     if (_q->type == IIRFILT_TYPE_SOS) {
-        for (i=0; i<_q->nsos; i++)
-            IIRFILTSOS(_print)(_q->qsos[i]);
+        for (i=0; i<_q->nsos; i++) {
+            printf("  b[%2u] :", i);
+            PRINTVAL_TC(_q->bsos[3*i+0],%12.8f); printf(",");
+            PRINTVAL_TC(_q->bsos[3*i+1],%12.8f); printf(",");
+            PRINTVAL_TC(_q->bsos[3*i+2],%12.8f); printf("\n");
+            printf("  a[%2u] :", i);
+            PRINTVAL_TC(_q->asos[3*i+0],%12.8f); printf(",");
+            PRINTVAL_TC(_q->asos[3*i+1],%12.8f); printf(",");
+            PRINTVAL_TC(_q->asos[3*i+2],%12.8f); printf("\n");
+        }
     } else {
 
         printf("  b :");
@@ -487,8 +773,13 @@ void IIRFILT(_reset)(IIRFILT() _q)
 
     if (_q->type == IIRFILT_TYPE_SOS) {
         // clear second-order sections
-        for (i=0; i<_q->nsos; i++) {
-            IIRFILTSOS(_reset)(_q->qsos[i]);
+        for (i=0; i<2*_q->nsos; i++)
+            _q->wsos[i] = 0;
+
+        // clear parallel-form bank
+        for (i=0; i<_q->npar; i++) {
+            _q->pw1[i] = 0;
+            _q->pw2[i] = 0;
         }
     } else {
         // set internal buffer to zero
@@ -538,7 +829,8 @@ void IIRFILT(_execute_norm)(IIRFILT() _q,
 #endif
 }
 
-// execute iir filter using second-order sections form
+// execute iir filter using second-order sections form; each
+// section is a transposed direct form II biquad
 //  _q      :   iirfilt object
 //  _x      :   input sample
 //  _y      :   output sample
@@ -546,17 +838,40 @@ void IIRFILT(_execute_sos)(IIRFILT() _q,
                            TI        _x,
                            TO *      _y)
 {
-    TI t0 = _x;     // intermediate input
-    TO t1 = 0.;     // intermediate output
+    TO v = _x;      // intermediate input/output
     unsigned int i;
     for (i=0; i<_q->nsos; i++) {
-        // run each filter separately
-        IIRFILTSOS(_execute)(_q->qsos[i], t0, &t1);
+        TC * b = _q->bsos + 3*i;
+        TC * a = _q->asos + 3*i;
+        TO * w = _q->wsos + 2*i;
+
+        // output for section n becomes input to section n+1
+        TO t = b[0]*v + w[0];
+        w[0] = b[1]*v + w[1] - a[1]*t;
+        w[1] = b[2]*v - a[2]*t;
+        v = t;
+    }
+    *_y = v;
+}
 
-        // output for filter n becomes input to filter n+1
-        t0 = t1;
+// execute iir filter using parallel-form bank of second-order
+// sections (see IIRFILT(_parallel_design))
+//  _q      :   iirfilt object
+//  _x      :   input sample
+//  _y      :   output sample
+void IIRFILT(_execute_parallel)(IIRFILT() _q,
+                                TI        _x,
+                                TO *      _y)
+{
+    TO y = _q->c * _x;
+    unsigned int i;
+    for (i=0; i<_q->npar; i++) {
+        TO t = _q->pb0[i]*_x + _q->pw1[i];
+        _q->pw1[i] = _q->pb1[i]*_x + _q->pw2[i] - _q->pa1[i]*t;
+        _q->pw2[i] = -_q->pa2[i]*t;
+        y += t;
     }
-    *_y = t1;
+    *_y = y;
 }
 
 // execute iir filter, switching to type-specific function
@@ -569,10 +884,93 @@ void IIRFILT(_execute)(IIRFILT() _q,
 {
     if (_q->type == IIRFILT_TYPE_NORM)
         IIRFILT(_execute_norm)(_q,_x,_y);
+    else if (_q->parallel)
+        IIRFILT(_execute_parallel)(_q,_x,_y);
     else
         IIRFILT(_execute_sos)(_q,_x,_y);
 }
 
+// execute cascaded second-order sections on a block of samples,
+// running each section over the entire block before moving on to
+// the next so that its coefficients and state stay in registers
+//  _q      : filter object
+//  _x      : pointer to input array [size: _n x 1]
+//  _n      : number of input, output samples
+//  _y      : pointer to output array [size: _n x 1]
+void IIRFILT(_execute_block_sos)(IIRFILT()    _q,
+                                 TI *         _x,
+                                 unsigned int _n,
+                                 TO *         _y)
+{
+    unsigned int i, k;
+
+    // copy input to output; each section then runs in place
+    for (i=0; i<_n; i++)
+        _y[i] = _x[i];
+
+    for (k=0; k<_q->nsos; k++) {
+        TC b0 = _q->bsos[3*k+0];
+        TC b1 = _q->bsos[3*k+1];
+        TC b2 = _q->bsos[3*k+2];
+        TC a1 = _q->asos[3*k+1];
+        TC a2 = _q->asos[3*k+2];
+        TO w0 = _q->wsos[2*k+0];
+        TO w1 = _q->wsos[2*k+1];
+        for (i=0; i<_n; i++) {
+            TO v = _y[i];
+            TO t = b0*v + w0;
+            w0 = b1*v + w1 - a1*t;
+            w1 = b2*v - a2*t;
+            _y[i] = t;
+        }
+        _q->wsos[2*k+0] = w0;
+        _q->wsos[2*k+1] = w1;
+    }
+}
+
+// execute parallel-form bank on a block of samples, running each
+// group of LIQUID_IIRFILT_PARALLEL_SECTIONS sections over the block
+// with the SIMD bank kernel; the real and imaginary parts of complex
+// samples are filtered as separate channels in adjacent lanes
+//  _q      : filter object
+//  _x      : pointer to input array [size: _n x 1]
+//  _n      : number of input, output samples
+//  _y      : pointer to output array [size: _n x 1]
+void IIRFILT(_execute_block_parallel)(IIRFILT()    _q,
+                                      TI *         _x,
+                                      unsigned int _n,
+                                      TO *         _y)
+{
+#if TC_COMPLEX
+    // parallel form is only designed for real coefficients
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        IIRFILT(_execute_parallel)(_q, _x[i], &_y[i]);
+#else
+    unsigned int nc = TO_COMPLEX ? 2 : 1;
+    unsigned int L  = LIQUID_IIRFILT_PARALLEL_SECTIONS;
+    unsigned int i, k, n;
+    for (n=0; n<_n; n+=LIQUID_IIRFILT_BLOCK_LEN) {
+        unsigned int len = _n - n < LIQUID_IIRFILT_BLOCK_LEN ?
+                           _n - n : LIQUID_IIRFILT_BLOCK_LEN;
+
+        // buffer input (arrays may be the same) and apply direct term
+        for (i=0; i<len; i++) {
+            _q->buf[i] = _x[n+i];
+            _y[n+i] = _q->c * _q->buf[i];
+        }
+
+        // accumulate output of each group of sections
+        for (k=0; k<_q->npar/L; k++) {
+            liquid_vectorf_sosbank(_q->pbank + 4*LIQUID_VECTOR_SOSBANK_LANES*k,
+                                   (float*) (_q->pw1 + k*L),
+                                   (float*) (_q->pw2 + k*L),
+                                   nc, (float*) _q->buf, len, (float*) (_y + n));
+        }
+    }
+#endif
+}
+
 // execute the filter on a block of input samples; the
 // input and output buffers may be the same
 //  _q      : filter object
@@ -584,12 +982,45 @@ void IIRFILT(_execute_block)(IIRFILT()    _q,
                              unsigned int _n,
                              TO *         _y)
 {
+    if (_q->type == IIRFILT_TYPE_SOS && _q->parallel) {
+        IIRFILT(_execute_block_parallel)(_q, _x, _n, _y);
+        return;
+    } else if (_q->type == IIRFILT_TYPE_SOS) {
+        IIRFILT(_execute_block_sos)(_q, _x, _n, _y);
+        return;
+    }
+
     unsigned int i;
     for (i=0; i<_n; i++)
         // compute output sample
-        IIRFILT(_execute)(_q, _x[i], &_y[i]);
+        IIRFILT(_execute_norm)(_q, _x[i], &_y[i]);
 }
 
+// set execution topology of a second-order sections filter: the
+// cascade of sections (default) or an equivalent parallel-form
+// bank; the internal state is reset in either case
+//  _q          : filter object
+//  _parallel   : use parallel-form bank? 0:no, 1:yes
+void IIRFILT(_set_parallel)(IIRFILT() _q,
+                            int       _parallel)
+{
+    if (_parallel && _q->type != IIRFILT_TYPE_SOS) {
+        fprintf(stderr,"warning: iirfilt_%s_set_parallel(), filter is not in second-order sections form\n", EXTENSION_FULL);
+        return;
+    } else if (_parallel && _q->npar == 0 && IIRFILT(_parallel_design)(_q) != 0) {
+        fprintf(stderr,"warning: iirfilt_%s_set_parallel(), filter cannot be expanded in parallel form\n", EXTENSION_FULL);
+        return;
+    }
+
+    _q->parallel = _parallel ? 1 : 0;
+    IIRFILT(_reset)(_q);
+}
+
+// get execution topology (1 if parallel-form bank, 0 otherwise)
+int IIRFILT(_get_parallel)(IIRFILT() _q)
+{
+    return _q->parallel;
+}
 
 // get filter length (order + 1)
 unsigned int IIRFILT(_get_length)(IIRFILT() _q)
@@ -664,8 +1095,16 @@ float IIRFILT(_groupdelay)(IIRFILT() _q,
         groupdelay = iir_group_delay(b, _q->nb, a, _q->na, _fc);
     } else {
         // accumulate group delay from second-order sections
-        for (i=0; i<_q->nsos; i++)
-            groupdelay += IIRFILTSOS(_groupdelay)(_q->qsos[i], _fc) - 2;
+        float b[3];
+        float a[3];
+        unsigned int k;
+        for (i=0; i<_q->nsos; i++) {
+            for (k=0; k<3; k++) {
+                b[k] = crealf(_q->bsos[3*i+k]);
+                a[k] = crealf(_q->asos[3*i+k]);
+            }
+            groupdelay += iir_group_delay(b, 3, a, 3, _fc);
+        }
     }
 
     return groupdelay;
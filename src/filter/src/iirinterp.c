@@ -132,6 +132,15 @@ void IIRINTERP(_reset)(IIRINTERP() _q)
     IIRFILT(_reset)(_q->iirfilt);
 }
 
+// set execution topology of internal filter
+//  _q          : interpolator object
+//  _parallel   : use parallel-form bank? 0:no, 1:yes
+void IIRINTERP(_set_parallel)(IIRINTERP() _q,
+                              int         _parallel)
+{
+    IIRFILT(_set_parallel)(_q->iirfilt, _parallel);
+}
+
 // execute interpolator
 //  _q      :   interpolator object
 //  _x      :   input sample
@@ -140,10 +149,7 @@ void IIRINTERP(_execute)(IIRINTERP() _q,
                          TI          _x,
                          TO *        _y)
 {
-    // TODO: use iirpfb
-    unsigned int i;
-    for (i=0; i<_q->M; i++)
-        IIRFILT(_execute)(_q->iirfilt, i==0 ? _x : 0.0f, &_y[i]);
+    IIRINTERP(_execute_block)(_q, &_x, 1, _y);
 }
 
 // execute interpolation on block of input samples
@@ -156,11 +162,16 @@ void IIRINTERP(_execute_block)(IIRINTERP()  _q,
                                unsigned int _n,
                                TO *         _y)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        // execute one input at a time with an output stride _M
-        IIRINTERP(_execute)(_q, _x[i], &_y[i*_q->M]);
+    // TODO: use iirpfb
+    // zero-stuff input into output array (in reverse so that _x
+    // may alias the beginning of _y), then filter it in place
+    unsigned int i, j;
+    for (i=_n; i>0; i--) {
+        for (j=_q->M-1; j>0; j--)
+            _y[(i-1)*_q->M + j] = 0;
+        _y[(i-1)*_q->M] = _x[i-1];
     }
+    IIRFILT(_execute_block)(_q->iirfilt, _y, _n*_q->M, _y);
 }
 
 // get system group delay at frequency _fc
@@ -35,6 +35,61 @@
 
 #define LIQUID_LEVINSON_MAXORDER (256)
 
+// compute auto-correlation of real signal for lags [0,_p]; computed
+// directly for low orders, otherwise as the inverse transform of the
+// power spectrum using real-input transforms of the zero-padded signal
+//  _x      :   input signal [size: _n x 1]
+//  _n      :   input signal length
+//  _p      :   maximum lag, _p <= _n
+//  _r      :   auto-correlation array [size: _p+1 x 1]
+void liquid_lpc_autocorr(float *      _x,
+                         unsigned int _n,
+                         unsigned int _p,
+                         float *      _r)
+{
+    // transform size: padding prevents circular wrap-around for all lags
+    unsigned int nfft = 1 << liquid_nextpow2(_n + _p);
+    unsigned int log2_nfft = liquid_nextpow2(nfft);
+
+    // approximate number of operations for direct and transform methods
+    float cost_direct = (float)_n * (float)(_p + 1);
+    float cost_fft    = 6.0f * (float)nfft * (float)(log2_nfft + 1);
+
+    unsigned int i;
+    if (cost_direct <= cost_fft) {
+        for (i=0; i<_p+1; i++) {
+            unsigned int lag = i;
+            unsigned int j;
+            _r[i] = 0.0f;
+            for (j=lag; j<_n; j++)
+                _r[i] += _x[j] * _x[j-lag];
+        }
+        return;
+    }
+
+    float *         x = (float *)         malloc(nfft       *sizeof(float));
+    float complex * X = (float complex *) malloc((nfft/2+1) *sizeof(float complex));
+    fftplan fft  = fft_create_plan_r2c(nfft, x, X, 0);
+    fftplan ifft = fft_create_plan_c2r(nfft, X, x, 0);
+
+    // compute power spectrum of zero-padded signal
+    for (i=0; i<nfft; i++)
+        x[i] = i < _n ? _x[i] : 0.0f;
+    fft_execute(fft);
+    for (i=0; i<nfft/2+1; i++)
+        X[i] = crealf(X[i])*crealf(X[i]) + cimagf(X[i])*cimagf(X[i]);
+
+    // inverse transform, normalizing
+    fft_execute(ifft);
+    for (i=0; i<_p+1; i++)
+        _r[i] = x[i] / (float)nfft;
+
+    fft_destroy_plan(fft);
+    fft_destroy_plan(ifft);
+    free(x);
+    free(X);
+}
+
 // compute the linear prediction coefficients for an input signal _x
 //  _x      :   input signal [size: _n x 1]
 //  _p      :   prediction filter order
@@ -54,16 +109,7 @@ void liquid_lpc(float * _x,
 
     // compute auto-correlation with lags
     float r[_p+1];    // auto-correlation array
-
-    unsigned int i;
-    for (i=0; i<_p+1; i++) {
-        unsigned int lag = i;
-        unsigned int j;
-        r[i] = 0.0f;
-        for (j=lag; j<_n; j++)
-            r[i] += _x[j] * _x[j-lag];
-        printf("r[%3u] = %12.8f\n", i, r[i]);
-    }
+    liquid_lpc_autocorr(_x, _n, _p, r);
 
     // solve the Toeplitz inversion using Levinson-Durbin recursion
     liquid_levinson(r,_p,_a,_g);
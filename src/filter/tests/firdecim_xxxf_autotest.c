@@ -129,3 +129,52 @@ void autotest_firdecim_cccf_data_M5h23x50()
 }
 
 
+
+// 
+// AUTOTEST: firdecim_crcf block execution against execute
+//
+void firdecim_crcf_block_test(unsigned int _M,
+                              unsigned int _h_len)
+{
+    float tol = 1e-4f;
+    unsigned int num_outputs = 150;
+    unsigned int i;
+
+    // create decimator objects
+    float h[_h_len];
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+    firdecim_crcf q0 = firdecim_crcf_create(_M, h, _h_len);
+    firdecim_crcf q1 = firdecim_crcf_create(_M, h, _h_len);
+
+    // generate input
+    float complex x[num_outputs*_M];
+    for (i=0; i<num_outputs*_M; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run in blocks of varying size
+    float complex y[num_outputs];
+    unsigned int n = 0;
+    unsigned int k = 1;
+    while (n < num_outputs) {
+        k = (k*5 + 1) % 71;
+        if (k > num_outputs - n) k = num_outputs - n;
+        firdecim_crcf_execute_block(q1, &x[n*_M], k, &y[n]);
+        n += k;
+    }
+
+    // compare with execute
+    for (i=0; i<num_outputs; i++) {
+        float complex v;
+        firdecim_crcf_execute(q0, &x[i*_M], &v);
+        CONTEND_DELTA(crealf(y[i]), crealf(v), tol);
+        CONTEND_DELTA(cimagf(y[i]), cimagf(v), tol);
+    }
+
+    firdecim_crcf_destroy(q0);
+    firdecim_crcf_destroy(q1);
+}
+void autotest_firdecim_crcf_block_M2h1()      { firdecim_crcf_block_test(  2,    1); }
+void autotest_firdecim_crcf_block_M3h13()     { firdecim_crcf_block_test(  3,   13); }
+void autotest_firdecim_crcf_block_M8h100()    { firdecim_crcf_block_test(  8,  100); }
+void autotest_firdecim_crcf_block_M100h3000() { firdecim_crcf_block_test(100, 3000); }
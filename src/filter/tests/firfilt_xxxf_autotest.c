@@ -117,3 +117,178 @@ void autotest_firfilt_cccf_data_h23x64()
 }
 
 
+
+// 
+// AUTOTEST: firfilt_crcf block execution against push/execute
+//
+void firfilt_crcf_block_test(unsigned int _h_len)
+{
+    float tol = 1e-4f;
+    unsigned int num_samples = 600;
+    unsigned int i;
+
+    // create filter objects
+    float h[_h_len];
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+    firfilt_crcf q0 = firfilt_crcf_create(h, _h_len);
+    firfilt_crcf q1 = firfilt_crcf_create(h, _h_len);
+    firfilt_crcf_set_scale(q0, 0.7f);
+    firfilt_crcf_set_scale(q1, 0.7f);
+
+    // generate input; run block in place with blocks of varying size
+    float complex x[num_samples];
+    float complex y[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = y[i] = randnf() + _Complex_I*randnf();
+    unsigned int n = 0;
+    unsigned int k = 1;
+    while (n < num_samples) {
+        k = (k*7 + 3) % 97;
+        if (k > num_samples - n) k = num_samples - n;
+        firfilt_crcf_execute_block(q1, &y[n], k, &y[n]);
+        n += k;
+    }
+
+    // compare with push/execute
+    for (i=0; i<num_samples; i++) {
+        float complex v;
+        firfilt_crcf_push(q0, x[i]);
+        firfilt_crcf_execute(q0, &v);
+        CONTEND_DELTA(crealf(y[i]), crealf(v), tol);
+        CONTEND_DELTA(cimagf(y[i]), cimagf(v), tol);
+    }
+
+    // internal state must also match
+    firfilt_crcf_push(q0, 1.0f); firfilt_crcf_execute(q0, &x[0]);
+    firfilt_crcf_push(q1, 1.0f); firfilt_crcf_execute(q1, &x[1]);
+    CONTEND_DELTA(crealf(x[0]), crealf(x[1]), tol);
+    CONTEND_DELTA(cimagf(x[0]), cimagf(x[1]), tol);
+
+    firfilt_crcf_destroy(q0);
+    firfilt_crcf_destroy(q1);
+}
+void autotest_firfilt_crcf_block_h1()   { firfilt_crcf_block_test(  1); }
+void autotest_firfilt_crcf_block_h7()   { firfilt_crcf_block_test(  7); }
+void autotest_firfilt_crcf_block_h64()  { firfilt_crcf_block_test( 64); }
+void autotest_firfilt_crcf_block_h129() { firfilt_crcf_block_test(129); }
+
+// 
+// AUTOTEST: firfilt_crcf FFT-based filtering against direct form
+//
+void firfilt_crcf_fft_test(unsigned int _h_len,
+                           unsigned int _block_len)
+{
+    float tol = 1e-4f;
+    unsigned int num_samples = 1200;
+    unsigned int i;
+
+    // create filter objects
+    float h[_h_len];
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf() / sqrtf(_h_len);
+    firfilt_crcf q0 = firfilt_crcf_create(h, _h_len);
+    firfilt_crcf q1 = firfilt_crcf_create_method(h, _h_len, LIQUID_FIRFILT_METHOD_FFT, _block_len);
+    firfilt_crcf q2 = firfilt_crcf_create_method(h, _h_len, LIQUID_FIRFILT_METHOD_FFT, _block_len);
+    firfilt_crcf_set_scale(q0, 0.7f);
+    firfilt_crcf_set_scale(q1, 0.7f);
+    firfilt_crcf_set_scale(q2, 0.7f);
+    CONTEND_EQUALITY(firfilt_crcf_get_method(q1), LIQUID_FIRFILT_METHOD_FFT);
+
+    // latency is the block length
+    unsigned int d = firfilt_crcf_get_latency(q1);
+    CONTEND_EXPRESSION( (d >= _h_len-1) );
+    if (_block_len > 0) {
+        CONTEND_EQUALITY(d, _block_len);
+    }
+
+    // generate input
+    float complex x[num_samples];
+    float complex y0[num_samples];
+    float complex y1[num_samples];
+    float complex y2[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = y2[i] = randnf() + _Complex_I*randnf();
+
+    // run direct form and FFT filter with push/execute
+    for (i=0; i<num_samples; i++) {
+        firfilt_crcf_push(q0, x[i]);
+        firfilt_crcf_execute(q0, &y0[i]);
+        firfilt_crcf_push(q1, x[i]);
+        firfilt_crcf_execute(q1, &y1[i]);
+    }
+
+    // run FFT filter in place with blocks of varying size
+    unsigned int n = 0;
+    unsigned int k = 1;
+    while (n < num_samples) {
+        k = (k*7 + 3) % 97;
+        if (k > num_samples - n) k = num_samples - n;
+        firfilt_crcf_execute_block(q2, &y2[n], k, &y2[n]);
+        n += k;
+    }
+
+    // compare with direct form delayed by latency
+    for (i=0; i<num_samples; i++) {
+        float complex v = i < d ? 0.0f : y0[i-d];
+        CONTEND_DELTA(crealf(y1[i]), crealf(v), tol);
+        CONTEND_DELTA(cimagf(y1[i]), cimagf(v), tol);
+        CONTEND_DELTA(crealf(y2[i]), crealf(v), tol);
+        CONTEND_DELTA(cimagf(y2[i]), cimagf(v), tol);
+    }
+
+    // reset clears buffered input
+    firfilt_crcf_reset(q1);
+    firfilt_crcf_push(q1, 1.0f);
+    firfilt_crcf_execute(q1, &y1[0]);
+    CONTEND_DELTA(crealf(y1[0]), 0.0f, tol);
+    CONTEND_DELTA(cimagf(y1[0]), 0.0f, tol);
+
+    firfilt_crcf_destroy(q0);
+    firfilt_crcf_destroy(q1);
+    firfilt_crcf_destroy(q2);
+}
+void autotest_firfilt_crcf_fft_h1()         { firfilt_crcf_fft_test(  1,   0); }
+void autotest_firfilt_crcf_fft_h64()        { firfilt_crcf_fft_test( 64,   0); }
+void autotest_firfilt_crcf_fft_h200()       { firfilt_crcf_fft_test(200,   0); }
+void autotest_firfilt_crcf_fft_h200_n300()  { firfilt_crcf_fft_test(200, 300); }
+
+// 
+// AUTOTEST: firfilt automatic method selection
+//
+void autotest_firfilt_method_auto()
+{
+    unsigned int i;
+    float h[4096];
+    for (i=0; i<4096; i++)
+        h[i] = randnf();
+
+    // short filter: direct form without latency
+    firfilt_crcf q = firfilt_crcf_create_method(h, 16, LIQUID_FIRFILT_METHOD_AUTO, 0);
+    CONTEND_EQUALITY(firfilt_crcf_get_method(q), LIQUID_FIRFILT_METHOD_DIRECT);
+    CONTEND_EQUALITY(firfilt_crcf_get_latency(q), 0);
+
+    // long filter: FFT-based with latency of one block
+    q = firfilt_crcf_recreate(q, h, 4096);
+    CONTEND_EQUALITY(firfilt_crcf_get_method(q), LIQUID_FIRFILT_METHOD_FFT);
+    CONTEND_EQUALITY(firfilt_crcf_get_latency(q), 4096);
+    firfilt_crcf_destroy(q);
+
+    // default constructor always uses direct form
+    q = firfilt_crcf_create(h, 4096);
+    CONTEND_EQUALITY(firfilt_crcf_get_method(q), LIQUID_FIRFILT_METHOD_DIRECT);
+    CONTEND_EQUALITY(firfilt_crcf_get_latency(q), 0);
+    firfilt_crcf_destroy(q);
+
+    // real and complex types
+    firfilt_rrrf qr = firfilt_rrrf_create_method(h, 4096, LIQUID_FIRFILT_METHOD_AUTO, 0);
+    CONTEND_EQUALITY(firfilt_rrrf_get_method(qr), LIQUID_FIRFILT_METHOD_FFT);
+    firfilt_rrrf_destroy(qr);
+
+    float complex hc[4096];
+    for (i=0; i<4096; i++)
+        hc[i] = h[i];
+    firfilt_cccf qc = firfilt_cccf_create_method(hc, 4096, LIQUID_FIRFILT_METHOD_AUTO, 0);
+    CONTEND_EQUALITY(firfilt_cccf_get_method(qc), LIQUID_FIRFILT_METHOD_FFT);
+    firfilt_cccf_destroy(qc);
+}
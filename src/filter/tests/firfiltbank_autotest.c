@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// 
+// AUTOTEST: firfiltbank_rrrf compared to independent firfilt_rrrf objects
+//
+void firfiltbank_rrrf_test(unsigned int _h_len,
+                           unsigned int _num_channels,
+                           unsigned int _num_frames)
+{
+    float tol = 1e-4f;
+    unsigned int i;
+    unsigned int c;
+
+    // generate coefficients
+    float h[_h_len];
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+
+    // create filter bank and reference filters
+    firfiltbank_rrrf q = firfiltbank_rrrf_create(h, _h_len, _num_channels);
+    firfiltbank_rrrf_set_scale(q, 0.5f);
+    firfilt_rrrf f[_num_channels];
+    for (c=0; c<_num_channels; c++) {
+        f[c] = firfilt_rrrf_create(h, _h_len);
+        firfilt_rrrf_set_scale(f[c], 0.5f);
+    }
+
+    // generate interleaved input; run block in place
+    unsigned int n = _num_frames * _num_channels;
+    float x[n];
+    float y[n];
+    for (i=0; i<n; i++)
+        x[i] = y[i] = randnf();
+    firfiltbank_rrrf_execute_block(q, y, _num_frames, y);
+
+    // compare with reference
+    for (i=0; i<_num_frames; i++) {
+        for (c=0; c<_num_channels; c++) {
+            float v;
+            firfilt_rrrf_push(f[c], x[i*_num_channels+c]);
+            firfilt_rrrf_execute(f[c], &v);
+            CONTEND_DELTA(y[i*_num_channels+c], v, tol);
+        }
+    }
+
+    // destroy objects
+    firfiltbank_rrrf_destroy(q);
+    for (c=0; c<_num_channels; c++)
+        firfilt_rrrf_destroy(f[c]);
+}
+
+// 
+// AUTOTEST: firfiltbank_crcf compared to independent firfilt_crcf objects
+//
+void firfiltbank_crcf_test(unsigned int _h_len,
+                           unsigned int _num_channels,
+                           unsigned int _num_frames)
+{
+    float tol = 1e-4f;
+    unsigned int i;
+    unsigned int c;
+
+    // generate coefficients
+    float h[_h_len];
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+
+    // create filter bank and reference filters
+    firfiltbank_crcf q = firfiltbank_crcf_create(h, _h_len, _num_channels);
+    firfilt_crcf f[_num_channels];
+    for (c=0; c<_num_channels; c++)
+        f[c] = firfilt_crcf_create(h, _h_len);
+
+    // run frame by frame and compare with reference
+    float complex x[_num_channels];
+    float complex y[_num_channels];
+    for (i=0; i<_num_frames; i++) {
+        for (c=0; c<_num_channels; c++)
+            x[c] = randnf() + _Complex_I*randnf();
+        firfiltbank_crcf_push(q, x);
+        firfiltbank_crcf_execute(q, y);
+
+        for (c=0; c<_num_channels; c++) {
+            float complex v;
+            firfilt_crcf_push(f[c], x[c]);
+            firfilt_crcf_execute(f[c], &v);
+            CONTEND_DELTA(crealf(y[c]), crealf(v), tol);
+            CONTEND_DELTA(cimagf(y[c]), cimagf(v), tol);
+        }
+    }
+
+    // destroy objects
+    firfiltbank_crcf_destroy(q);
+    for (c=0; c<_num_channels; c++)
+        firfilt_crcf_destroy(f[c]);
+}
+
+// 
+// AUTOTEST: firfiltbank_cccf compared to independent firfilt_cccf objects
+//
+void firfiltbank_cccf_test(unsigned int _h_len,
+                           unsigned int _num_channels,
+                           unsigned int _num_frames)
+{
+    float tol = 1e-4f;
+    unsigned int i;
+    unsigned int c;
+
+    // generate coefficients
+    float complex h[_h_len];
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf() + _Complex_I*randnf();
+
+    // create filter bank and reference filters
+    float complex scale = 0.3f - 0.4f*_Complex_I;
+    firfiltbank_cccf q = firfiltbank_cccf_create(h, _h_len, _num_channels);
+    firfiltbank_cccf_set_scale(q, scale);
+    firfilt_cccf f[_num_channels];
+    for (c=0; c<_num_channels; c++) {
+        f[c] = firfilt_cccf_create(h, _h_len);
+        firfilt_cccf_set_scale(f[c], scale);
+    }
+
+    // generate interleaved input
+    unsigned int n = _num_frames * _num_channels;
+    float complex x[n];
+    float complex y[n];
+    for (i=0; i<n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+    firfiltbank_cccf_execute_block(q, x, _num_frames, y);
+
+    // compare with reference
+    for (i=0; i<_num_frames; i++) {
+        for (c=0; c<_num_channels; c++) {
+            float complex v;
+            firfilt_cccf_push(f[c], x[i*_num_channels+c]);
+            firfilt_cccf_execute(f[c], &v);
+            CONTEND_DELTA(crealf(y[i*_num_channels+c]), crealf(v), tol);
+            CONTEND_DELTA(cimagf(y[i*_num_channels+c]), cimagf(v), tol);
+        }
+    }
+
+    // destroy objects
+    firfiltbank_cccf_destroy(q);
+    for (c=0; c<_num_channels; c++)
+        firfilt_cccf_destroy(f[c]);
+}
+
+void autotest_firfiltbank_rrrf_h7m1()   { firfiltbank_rrrf_test( 7,  1, 40); }
+void autotest_firfiltbank_rrrf_h13m5()  { firfiltbank_rrrf_test(13,  5, 80); }
+void autotest_firfiltbank_rrrf_h32m16() { firfiltbank_rrrf_test(32, 16, 80); }
+void autotest_firfiltbank_crcf_h7m1()   { firfiltbank_crcf_test( 7,  1, 40); }
+void autotest_firfiltbank_crcf_h13m5()  { firfiltbank_crcf_test(13,  5, 80); }
+void autotest_firfiltbank_crcf_h32m16() { firfiltbank_crcf_test(32, 16, 80); }
+void autotest_firfiltbank_cccf_h7m1()   { firfiltbank_cccf_test( 7,  1, 40); }
+void autotest_firfiltbank_cccf_h13m5()  { firfiltbank_cccf_test(13,  5, 80); }
+void autotest_firfiltbank_cccf_h32m16() { firfiltbank_cccf_test(32, 16, 80); }
+
@@ -150,3 +150,54 @@ void autotest_firinterp_crcf_generic()
     firinterp_crcf_destroy(q);
 }
 
+
+//
+// AUTOTEST: firinterp_crcf block execution against execute
+//
+void firinterp_crcf_block_test(unsigned int _M,
+                               unsigned int _h_len)
+{
+    float tol = 1e-4f;
+    unsigned int num_inputs = 300;
+    unsigned int i, j;
+
+    // create interpolator objects
+    float h[_h_len];
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+    firinterp_crcf q0 = firinterp_crcf_create(_M, h, _h_len);
+    firinterp_crcf q1 = firinterp_crcf_create(_M, h, _h_len);
+
+    // generate input
+    float complex x[num_inputs];
+    for (i=0; i<num_inputs; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run in blocks of varying size
+    float complex y[num_inputs*_M];
+    unsigned int n = 0;
+    unsigned int k = 1;
+    while (n < num_inputs) {
+        k = (k*11 + 5) % 83;
+        if (k > num_inputs - n) k = num_inputs - n;
+        firinterp_crcf_execute_block(q1, &x[n], k, &y[n*_M]);
+        n += k;
+    }
+
+    // compare with execute
+    float complex v[_M];
+    for (i=0; i<num_inputs; i++) {
+        firinterp_crcf_execute(q0, x[i], v);
+        for (j=0; j<_M; j++) {
+            CONTEND_DELTA(crealf(y[i*_M+j]), crealf(v[j]), tol);
+            CONTEND_DELTA(cimagf(y[i*_M+j]), cimagf(v[j]), tol);
+        }
+    }
+
+    firinterp_crcf_destroy(q0);
+    firinterp_crcf_destroy(q1);
+}
+void autotest_firinterp_crcf_block_M2h8()    { firinterp_crcf_block_test(2,    8); }
+void autotest_firinterp_crcf_block_M4h13()   { firinterp_crcf_block_test(4,   13); }
+void autotest_firinterp_crcf_block_M8h200()  { firinterp_crcf_block_test(8,  200); }
+void autotest_firinterp_crcf_block_M4h8000() { firinterp_crcf_block_test(4, 8000); }
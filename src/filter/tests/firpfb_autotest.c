@@ -76,3 +76,52 @@ void autotest_firpfb_impulse_response()
     firpfb_rrrf_destroy(f);
 }
 
+
+// 
+// AUTOTEST: firpfb_crcf block execution against push/execute
+//
+void firpfb_crcf_block_test(unsigned int _M,
+                            unsigned int _m)
+{
+    float tol = 1e-4f;
+    unsigned int num_samples = 400;
+    unsigned int i;
+
+    // create filterbank objects
+    firpfb_crcf q0 = firpfb_crcf_create_kaiser(_M, _m, 0.4f, 60.0f);
+    firpfb_crcf q1 = firpfb_crcf_create_kaiser(_M, _m, 0.4f, 60.0f);
+
+    // generate input; run block in place with blocks of varying size,
+    // cycling filter index
+    float complex x[num_samples];
+    float complex y[num_samples];
+    unsigned int index[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = y[i] = randnf() + _Complex_I*randnf();
+    unsigned int n = 0;
+    unsigned int k = 1;
+    unsigned int b = 0;
+    while (n < num_samples) {
+        k = (k*13 + 7) % 301;
+        if (k > num_samples - n) k = num_samples - n;
+        firpfb_crcf_execute_block(q1, b, &y[n], k, &y[n]);
+        for (i=n; i<n+k; i++)
+            index[i] = b;
+        b = (b + 1) % _M;
+        n += k;
+    }
+
+    // compare with push/execute
+    for (i=0; i<num_samples; i++) {
+        float complex v;
+        firpfb_crcf_push(q0, x[i]);
+        firpfb_crcf_execute(q0, index[i], &v);
+        CONTEND_DELTA(crealf(y[i]), crealf(v), tol);
+        CONTEND_DELTA(cimagf(y[i]), cimagf(v), tol);
+    }
+
+    firpfb_crcf_destroy(q0);
+    firpfb_crcf_destroy(q1);
+}
+void autotest_firpfb_crcf_block_M4m3()   { firpfb_crcf_block_test( 4,  3); }
+void autotest_firpfb_crcf_block_M32m12() { firpfb_crcf_block_test(32, 12); }
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// 
+// AUTOTEST: iirdecim_crcf block execution against filter and
+// down-sample
+//
+void iirdecim_crcf_block_test(unsigned int _M,
+                              unsigned int _order,
+                              int          _parallel)
+{
+    float tol = _parallel ? 2e-3f : 1e-4f;
+    unsigned int num_outputs = 400;
+    unsigned int i;
+
+    // create decimator and reference filter
+    iirdecim_crcf q = iirdecim_crcf_create_prototype(_M, LIQUID_IIRDES_BUTTER,
+            LIQUID_IIRDES_LOWPASS, LIQUID_IIRDES_SOS, _order, 0.5f/_M, 0.0f, 1.0f, 60.0f);
+    iirfilt_crcf f = iirfilt_crcf_create_prototype(LIQUID_IIRDES_BUTTER,
+            LIQUID_IIRDES_LOWPASS, LIQUID_IIRDES_SOS, _order, 0.5f/_M, 0.0f, 1.0f, 60.0f);
+    iirdecim_crcf_set_parallel(q, _parallel);
+
+    // generate input
+    float complex x[num_outputs*_M];
+    for (i=0; i<num_outputs*_M; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run in blocks of varying size
+    float complex y[num_outputs];
+    unsigned int n = 0;
+    unsigned int k = 1;
+    while (n < num_outputs) {
+        k = (k*5 + 1) % 151;
+        if (k > num_outputs - n) k = num_outputs - n;
+        iirdecim_crcf_execute_block(q, &x[n*_M], k, &y[n]);
+        n += k;
+    }
+
+    // compare with filtering every sample and keeping every _M-th
+    for (i=0; i<num_outputs*_M; i++) {
+        float complex v;
+        iirfilt_crcf_execute(f, x[i], &v);
+        if ((i % _M) == 0) {
+            CONTEND_DELTA(crealf(y[i/_M]), crealf(v), tol);
+            CONTEND_DELTA(cimagf(y[i/_M]), cimagf(v), tol);
+        }
+    }
+
+    iirdecim_crcf_destroy(q);
+    iirfilt_crcf_destroy(f);
+}
+void autotest_iirdecim_crcf_block_M2n5()           { iirdecim_crcf_block_test(  2, 5, 0); }
+void autotest_iirdecim_crcf_block_M3n8()           { iirdecim_crcf_block_test(  3, 8, 0); }
+void autotest_iirdecim_crcf_block_M300n4()         { iirdecim_crcf_block_test(300, 4, 0); }
+void autotest_iirdecim_crcf_block_parallel_M2n5()  { iirdecim_crcf_block_test(  2, 5, 1); }
+void autotest_iirdecim_crcf_block_parallel_M4n8()  { iirdecim_crcf_block_test(  4, 8, 1); }
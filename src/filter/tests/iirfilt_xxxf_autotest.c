@@ -108,3 +108,120 @@ void autotest_iirfilt_cccf_h7x64()
 }
 
 
+
+
+// 
+// AUTOTEST: iirfilt_crcf block execution against execute
+//
+void iirfilt_crcf_block_test(liquid_iirdes_filtertype _ftype,
+                             liquid_iirdes_bandtype   _btype,
+                             unsigned int             _order,
+                             float                    _fc,
+                             int                      _parallel)
+{
+    float tol = _parallel ? 2e-3f : 1e-4f;
+    unsigned int num_samples = 1200;
+    unsigned int i;
+
+    // create filter objects from second-order sections
+    iirfilt_crcf q0 = iirfilt_crcf_create_prototype(_ftype, _btype,
+            LIQUID_IIRDES_SOS, _order, _fc, 0.25f, 1.0f, 60.0f);
+    iirfilt_crcf q1 = iirfilt_crcf_create_prototype(_ftype, _btype,
+            LIQUID_IIRDES_SOS, _order, _fc, 0.25f, 1.0f, 60.0f);
+    iirfilt_crcf_set_parallel(q1, _parallel);
+    CONTEND_EQUALITY(iirfilt_crcf_get_parallel(q1), _parallel);
+
+    // generate input
+    float complex x[num_samples];
+    float complex y[num_samples];
+    for (i=0; i<num_samples; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        y[i] = x[i];
+    }
+
+    // run in place in blocks of varying size
+    unsigned int n = 0;
+    unsigned int k = 1;
+    while (n < num_samples) {
+        k = (k*37 + 11) % 301;
+        if (k > num_samples - n) k = num_samples - n;
+        iirfilt_crcf_execute_block(q1, &y[n], k, &y[n]);
+        n += k;
+    }
+
+    // compare with cascade execute
+    for (i=0; i<num_samples; i++) {
+        float complex v;
+        iirfilt_crcf_execute(q0, x[i], &v);
+        CONTEND_DELTA(crealf(y[i]), crealf(v), tol);
+        CONTEND_DELTA(cimagf(y[i]), cimagf(v), tol);
+    }
+
+    iirfilt_crcf_destroy(q0);
+    iirfilt_crcf_destroy(q1);
+}
+void autotest_iirfilt_crcf_block_butter_n8()     { iirfilt_crcf_block_test(LIQUID_IIRDES_BUTTER, LIQUID_IIRDES_LOWPASS,  8, 0.15f, 0); }
+void autotest_iirfilt_crcf_block_cheby1_n7()     { iirfilt_crcf_block_test(LIQUID_IIRDES_CHEBY1, LIQUID_IIRDES_LOWPASS,  7, 0.15f, 0); }
+void autotest_iirfilt_crcf_parallel_butter_n8()  { iirfilt_crcf_block_test(LIQUID_IIRDES_BUTTER, LIQUID_IIRDES_LOWPASS,  8, 0.15f, 1); }
+void autotest_iirfilt_crcf_parallel_butter_n12() { iirfilt_crcf_block_test(LIQUID_IIRDES_BUTTER, LIQUID_IIRDES_LOWPASS, 12, 0.15f, 1); }
+void autotest_iirfilt_crcf_parallel_butter_hb5() { iirfilt_crcf_block_test(LIQUID_IIRDES_BUTTER, LIQUID_IIRDES_LOWPASS,  5, 0.25f, 1); }
+void autotest_iirfilt_crcf_parallel_cheby1_n7()  { iirfilt_crcf_block_test(LIQUID_IIRDES_CHEBY1, LIQUID_IIRDES_LOWPASS,  7, 0.15f, 1); }
+void autotest_iirfilt_crcf_parallel_ellip_n6()   { iirfilt_crcf_block_test(LIQUID_IIRDES_ELLIP,  LIQUID_IIRDES_LOWPASS,  6, 0.15f, 1); }
+void autotest_iirfilt_crcf_parallel_cheby2_bp4() { iirfilt_crcf_block_test(LIQUID_IIRDES_CHEBY2, LIQUID_IIRDES_BANDPASS, 4, 0.15f, 1); }
+
+// 
+// AUTOTEST: iirfilt_rrrf parallel-form bank against cascade
+//
+void autotest_iirfilt_rrrf_parallel()
+{
+    float tol = 2e-3f;
+    unsigned int num_samples = 600;
+    unsigned int i;
+
+    iirfilt_rrrf q0 = iirfilt_rrrf_create_prototype(LIQUID_IIRDES_CHEBY1,
+            LIQUID_IIRDES_LOWPASS, LIQUID_IIRDES_SOS, 9, 0.2f, 0.0f, 1.0f, 60.0f);
+    iirfilt_rrrf q1 = iirfilt_rrrf_create_prototype(LIQUID_IIRDES_CHEBY1,
+            LIQUID_IIRDES_LOWPASS, LIQUID_IIRDES_SOS, 9, 0.2f, 0.0f, 1.0f, 60.0f);
+    iirfilt_rrrf_set_parallel(q1, 1);
+    CONTEND_EQUALITY(iirfilt_rrrf_get_parallel(q1), 1);
+
+    float x[num_samples];
+    float y[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf();
+    iirfilt_rrrf_execute_block(q1, x, num_samples, y);
+
+    // compare with cascade; also run sample-by-sample parallel form
+    // after reset
+    iirfilt_rrrf_reset(q1);
+    for (i=0; i<num_samples; i++) {
+        float v0, v1;
+        iirfilt_rrrf_execute(q0, x[i], &v0);
+        iirfilt_rrrf_execute(q1, x[i], &v1);
+        CONTEND_DELTA(y[i], v0, tol);
+        CONTEND_DELTA(v1,   v0, tol);
+    }
+
+    iirfilt_rrrf_destroy(q0);
+    iirfilt_rrrf_destroy(q1);
+}
+
+// 
+// AUTOTEST: parallel form is not used where it cannot be designed
+//
+void autotest_iirfilt_parallel_fallback()
+{
+    // transfer function form
+    iirfilt_crcf q0 = iirfilt_crcf_create_prototype(LIQUID_IIRDES_BUTTER,
+            LIQUID_IIRDES_LOWPASS, LIQUID_IIRDES_TF, 4, 0.2f, 0.0f, 1.0f, 60.0f);
+    iirfilt_crcf_set_parallel(q0, 1);
+    CONTEND_EQUALITY(iirfilt_crcf_get_parallel(q0), 0);
+    iirfilt_crcf_destroy(q0);
+
+    // complex coefficients
+    iirfilt_cccf q1 = iirfilt_cccf_create_prototype(LIQUID_IIRDES_BUTTER,
+            LIQUID_IIRDES_LOWPASS, LIQUID_IIRDES_SOS, 4, 0.2f, 0.0f, 1.0f, 60.0f);
+    iirfilt_cccf_set_parallel(q1, 1);
+    CONTEND_EQUALITY(iirfilt_cccf_get_parallel(q1), 0);
+    iirfilt_cccf_destroy(q1);
+}
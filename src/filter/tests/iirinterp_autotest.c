@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// 
+// AUTOTEST: iirinterp_crcf block execution against zero-stuffing
+// and filter
+//
+void iirinterp_crcf_block_test(unsigned int _M,
+                               unsigned int _order,
+                               int          _parallel)
+{
+    float tol = _parallel ? 2e-3f : 1e-4f;
+    unsigned int num_inputs = 400;
+    unsigned int i;
+
+    // create interpolator and reference filter
+    iirinterp_crcf q = iirinterp_crcf_create_prototype(_M, LIQUID_IIRDES_BUTTER,
+            LIQUID_IIRDES_LOWPASS, LIQUID_IIRDES_SOS, _order, 0.5f/_M, 0.0f, 1.0f, 60.0f);
+    iirfilt_crcf f = iirfilt_crcf_create_prototype(LIQUID_IIRDES_BUTTER,
+            LIQUID_IIRDES_LOWPASS, LIQUID_IIRDES_SOS, _order, 0.5f/_M, 0.0f, 1.0f, 60.0f);
+    iirinterp_crcf_set_parallel(q, _parallel);
+
+    // generate input, copied to start of output for in-place run
+    float complex x[num_inputs];
+    float complex y[num_inputs*_M];
+    for (i=0; i<num_inputs; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        y[i] = x[i];
+    }
+
+    // first block in place, the rest in blocks of varying size
+    unsigned int n = 7;
+    iirinterp_crcf_execute_block(q, y, n, y);
+    unsigned int k = 1;
+    while (n < num_inputs) {
+        k = (k*5 + 1) % 71;
+        if (k > num_inputs - n) k = num_inputs - n;
+        iirinterp_crcf_execute_block(q, &x[n], k, &y[n*_M]);
+        n += k;
+    }
+
+    // compare with filtering zero-stuffed input
+    for (i=0; i<num_inputs*_M; i++) {
+        float complex v;
+        iirfilt_crcf_execute(f, (i % _M) == 0 ? x[i/_M] : 0.0f, &v);
+        CONTEND_DELTA(crealf(y[i]), crealf(v), tol);
+        CONTEND_DELTA(cimagf(y[i]), cimagf(v), tol);
+    }
+
+    iirinterp_crcf_destroy(q);
+    iirfilt_crcf_destroy(f);
+}
+void autotest_iirinterp_crcf_block_M2n5()          { iirinterp_crcf_block_test(2, 5, 0); }
+void autotest_iirinterp_crcf_block_M5n8()          { iirinterp_crcf_block_test(5, 8, 0); }
+void autotest_iirinterp_crcf_block_parallel_M4n8() { iirinterp_crcf_block_test(4, 8, 1); }
@@ -179,8 +179,8 @@ flexframesync flexframesync_create(framesync_callback _callback,
 #endif
 
     // create down-coverters for carrier phase tracking
-    q->mixer = nco_crcf_create(LIQUID_NCO);
-    q->pll   = nco_crcf_create(LIQUID_NCO);
+    q->mixer = nco_crcf_create(LIQUID_NCO_HIRES);
+    q->pll   = nco_crcf_create(LIQUID_NCO_HIRES);
     nco_crcf_pll_set_bandwidth(q->pll, 1e-4f); // very low bandwidth
     
     // header demodulator/decoder
@@ -122,7 +122,7 @@ SYMTRACK() SYMTRACK(_create)(int          _ftype,
     q->eq = EQLMS(_create_lowpass)(q->eq_len,0.45f);
 
     // nco and phase-locked loop
-    q->nco = NCO(_create)(LIQUID_VCO);
+    q->nco = NCO(_create)(LIQUID_NCO_HIRES);
 
     // demodulator
     q->demod = MODEM(_create)(q->mod_scheme);
@@ -0,0 +1,428 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// modem_demodsoft_block.c : block soft-decision demodulation
+//
+// Log-likelihood ratios are computed with the max-log
+// approximation, LLR[k] = gamma*(dmin_0[k] - dmin_1[k]) where
+// dmin_b[k] is the minimum squared distance from the received
+// sample to any constellation point with bit k equal to b.
+//  - square/rectangular QAM and ASK separate into independent
+//    Gray-coded amplitude axes; the nearest point with the
+//    opposite value of each bit is adjacent to the run of levels
+//    sharing that bit, giving a closed-form solution
+//  - PSK uses the same run structure around the circle
+//  - other constellations search all points (SSE3 when
+//    available)
+//  - differential PSK is stateful and falls back to per-sample
+//    soft demodulation
+//
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#if HAVE_PMMINTRIN_H && defined(__SSE3__)
+#  include <pmmintrin.h>
+#  define MODEM_DEMODSOFT_SSE 1
+#else
+#  define MODEM_DEMODSOFT_SSE 0
+#endif
+
+// number of samples demodulated per pass when quantizing soft bits
+#define MODEM_DEMODSOFT_BLOCK_LEN   (64)
+
+// four-quadrant arctangent approximation, |error| < 1e-5 radians
+static inline float modem_demodsoft_atan2f(float _y, float _x)
+{
+    float ax = fabsf(_x);
+    float ay = fabsf(_y);
+    float mx = ax > ay ? ax : ay;
+    float mn = ax > ay ? ay : ax;
+    float z  = mx > 0.0f ? mn / mx : 0.0f;
+    float z2 = z*z;
+    float t  = z*(0.99997726f + z2*(-0.33262347f + z2*(0.19354346f +
+                  z2*(-0.11643287f + z2*(0.05265332f + z2*(-0.01172120f))))));
+    if (ay > ax)   t = (float)M_PI_2 - t;
+    if (_x < 0.0f) t = (float)M_PI   - t;
+    return _y < 0.0f ? -t : t;
+}
+
+// block soft-decision demodulation
+//  _q          :   modem object
+//  _x          :   input samples [size: _n x 1]
+//  _n          :   number of input samples
+//  _s          :   output hard symbols [size: _n x 1]
+//  _soft_bits  :   output soft bits [size: _n*bps x 1]
+void MODEM(_demodulate_soft_block)(MODEM()         _q,
+                                   TC *            _x,
+                                   unsigned int    _n,
+                                   unsigned int *  _s,
+                                   unsigned char * _soft_bits)
+{
+    T llr[MODEM_DEMODSOFT_BLOCK_LEN*MAX_MOD_BITS_PER_SYMBOL];
+    unsigned int bps = _q->m;
+    unsigned int i;
+
+    // differential: demodulate one sample at a time, keeping state
+    if (liquid_modem_is_dpsk(_q->scheme)) {
+        for (i=0; i<_n; i++)
+            MODEM(_demodulate_soft)(_q, _x[i], &_s[i], &_soft_bits[i*bps]);
+        return;
+    }
+
+    for (i=0; i<_n; i+=MODEM_DEMODSOFT_BLOCK_LEN) {
+        unsigned int n = _n - i < MODEM_DEMODSOFT_BLOCK_LEN ? _n - i : MODEM_DEMODSOFT_BLOCK_LEN;
+
+        // compute log-likelihood ratios
+        MODEM(_demodulate_llr_block)(_q, &_x[i], n, &_s[i], llr);
+
+        // quantize to soft bits
+        unsigned char * soft_bits = &_soft_bits[i*bps];
+        unsigned int k;
+        for (k=0; k<n*bps; k++) {
+            T v = llr[k]*16 + 127;
+            v = v > 255.0f ? 255.0f : v;
+            v = v <   0.0f ?   0.0f : v;
+            soft_bits[k] = (unsigned char) v;
+        }
+    }
+}
+
+// block soft-decision demodulation, log-likelihood ratio output
+//  _q      :   modem object
+//  _x      :   input samples [size: _n x 1]
+//  _n      :   number of input samples
+//  _s      :   output hard symbols [size: _n x 1]
+//  _llr    :   output log-likelihood ratios [size: _n*bps x 1]
+void MODEM(_demodulate_llr_block)(MODEM()        _q,
+                                  TC *           _x,
+                                  unsigned int   _n,
+                                  unsigned int * _s,
+                                  T *            _llr)
+{
+    if (_n == 0)
+        return;
+
+    unsigned int i;
+    unsigned int k;
+    unsigned int bps = _q->m;
+
+    if (liquid_modem_is_dpsk(_q->scheme)) {
+        // differential: demodulate one sample at a time, keeping state
+        unsigned char soft_bits[MAX_MOD_BITS_PER_SYMBOL];
+        for (i=0; i<_n; i++) {
+            MODEM(_demodulate_soft)(_q, _x[i], &_s[i], soft_bits);
+            for (k=0; k<bps; k++)
+                _llr[i*bps+k] = ((T)soft_bits[k] - 127.0f) / 16.0f;
+        }
+        return;
+    }
+
+    switch (_q->scheme) {
+    case LIQUID_MODEM_BPSK:
+        // gamma = 4 (see modem_demodulate_soft_bpsk)
+        for (i=0; i<_n; i++) {
+            T xi = crealf(_x[i]);
+            _llr[i] = -8.0f * xi;
+            _s[i]   = xi > 0 ? 0 : 1;
+        }
+        break;
+    case LIQUID_MODEM_QPSK:
+        // gamma = 5.8 (see modem_demodulate_soft_qpsk)
+        for (i=0; i<_n; i++) {
+            T xi = crealf(_x[i]);
+            T xq = cimagf(_x[i]);
+            _llr[2*i  ] = -11.6f * xq;
+            _llr[2*i+1] = -11.6f * xi;
+            _s[i] = (xi > 0 ? 0 : 1) + (xq > 0 ? 0 : 2);
+        }
+        break;
+    default:
+        if (liquid_modem_is_qam(_q->scheme)) {
+            MODEM(_demodsoft_block_qam)(_q, _x, _n, _s, _llr);
+        } else if (liquid_modem_is_ask(_q->scheme)) {
+            T gamma = 1.2f*_q->M;
+            for (i=0; i<_n; i++)
+                MODEM(_demodsoft_pam)(crealf(_x[i]), bps, _q->data.ask.alpha, gamma,
+                                      &_s[i], &_llr[i*bps]);
+        } else if (liquid_modem_is_psk(_q->scheme)) {
+            MODEM(_demodsoft_block_psk)(_q, _x, _n, _s, _llr);
+        } else {
+            // generate symbol map if modem does not already have one
+            // (does not change how modem modulates)
+            if (_q->symbol_map == NULL) {
+                _q->symbol_map = (TC*)malloc(_q->M*sizeof(TC));
+                MODEM(_init_map)(_q);
+            }
+            MODEM(_demodsoft_block_search)(_q, _x, _n, _s, _llr);
+        }
+    }
+
+    // store state of last sample
+    _q->r = _x[_n-1];
+    _q->modulate_func(_q, _s[_n-1], &_q->x_hat);
+}
+
+// max-log soft demodulation of Gray-coded pulse-amplitude axis
+// with levels (2*l - 2^m + 1)*alpha, l = 0,...,2^m-1
+//  _v      :   received value
+//  _m      :   bits on this axis
+//  _alpha  :   level spacing/2
+//  _gamma  :   log-likelihood scaling
+//  _s      :   output hard (Gray-encoded) symbol
+//  _llr    :   output log-likelihood ratios (msb first) [size: _m x 1]
+void MODEM(_demodsoft_pam)(T              _v,
+                           unsigned int   _m,
+                           T              _alpha,
+                           T              _gamma,
+                           unsigned int * _s,
+                           T *            _llr)
+{
+    int M = 1 << _m;
+
+    // nearest level
+    int l0 = (int)floorf(0.5f*(_v/_alpha + M));
+    l0 = l0 < 0 ? 0 : (l0 > M-1 ? M-1 : l0);
+    unsigned int s = gray_encode(l0);
+    T e0 = _v - (2*l0 - M + 1)*_alpha;
+    T d0 = e0*e0;
+
+    unsigned int j;
+    for (j=0; j<_m; j++) {
+        // run [a,b] of levels around l0 sharing bit j; bit j of
+        // gray(l) changes when l crosses 2^j + t*2^(j+1), and the
+        // msb changes only at 2^(m-1)
+        int a, b;
+        if (j == _m-1) {
+            a = l0 < M/2 ? 0 : M/2;
+            b = a + M/2 - 1;
+        } else {
+            int h = 1 << j;
+            int L = 2*h;
+            a = l0 < h ? 0 : ((l0 - h) & ~(L-1)) + h;
+            b = l0 < h ? h - 1 : a + L - 1;
+            b = b > M-1 ? M-1 : b;
+        }
+
+        // nearest level with opposite bit lies just outside the run
+        T d1 = 1e9f;
+        if (a > 0) {
+            T e = _v - (2*(a-1) - M + 1)*_alpha;
+            d1 = e*e;
+        }
+        if (b < M-1) {
+            T e = _v - (2*(b+1) - M + 1)*_alpha;
+            d1 = e*e < d1 ? e*e : d1;
+        }
+
+        T llr = _gamma*(d1 - d0);
+        _llr[_m-j-1] = (s >> j) & 1 ? llr : -llr;
+    }
+    *_s = s;
+}
+
+// max-log soft demodulation of QAM block; in-phase and quadrature
+// axes are independent
+void MODEM(_demodsoft_block_qam)(MODEM()        _q,
+                                 TC *           _x,
+                                 unsigned int   _n,
+                                 unsigned int * _s,
+                                 T *            _llr)
+{
+    unsigned int m_i   = _q->data.qam.m_i;
+    unsigned int m_q   = _q->data.qam.m_q;
+    T            alpha = _q->data.qam.alpha;
+    T            gamma = 1.2f*_q->M;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned int s_i, s_q;
+        MODEM(_demodsoft_pam)(crealf(_x[i]), m_i, alpha, gamma, &s_i, &_llr[i*_q->m]);
+        MODEM(_demodsoft_pam)(cimagf(_x[i]), m_q, alpha, gamma, &s_q, &_llr[i*_q->m + m_i]);
+        _s[i] = (s_i << m_q) | s_q;
+    }
+}
+
+// max-log soft demodulation of PSK block; point at position l
+// on the circle carries symbol gray(l), so the runs of positions
+// sharing a bit are the same as for the amplitude axis but wrap
+void MODEM(_demodsoft_block_psk)(MODEM()        _q,
+                                 TC *           _x,
+                                 unsigned int   _n,
+                                 unsigned int * _s,
+                                 T *            _llr)
+{
+    unsigned int m     = _q->m;
+    int          M     = _q->M;
+    T            scale = 0.5f / _q->data.psk.alpha;  // positions/radian
+    T            gamma = 1.2f*_q->M;
+    TC *         map   = _q->symbol_map;
+    unsigned int i, j;
+    for (i=0; i<_n; i++) {
+        T xr = crealf(_x[i]);
+        T xi = cimagf(_x[i]);
+
+        // nearest position, resolving by distance near decision
+        // boundaries where the arctangent approximation matters
+        T   p  = modem_demodsoft_atan2f(xi,xr)*scale;
+        int l0 = (int)floorf(p + 0.5f);
+        T   f  = p - (T)l0;
+        l0 = (l0 + M) & (M-1);
+        unsigned int s = gray_encode(l0);
+        T er = xr - crealf(map[s]);
+        T ei = xi - cimagf(map[s]);
+        T d0 = er*er + ei*ei;
+        if (fabsf(f) > 0.499f) {
+            int          l1 = (l0 + (f > 0 ? 1 : -1)) & (M-1);
+            unsigned int s1 = gray_encode(l1);
+            T e1r = xr - crealf(map[s1]);
+            T e1i = xi - cimagf(map[s1]);
+            T d1  = e1r*e1r + e1i*e1i;
+            if (d1 < d0 || (d1 == d0 && s1 < s)) {
+                l0 = l1;
+                s  = s1;
+                d0 = d1;
+            }
+        }
+
+        for (j=0; j<m; j++) {
+            // run [a, a+L-1] (modulo M) of positions around l0 sharing bit j
+            int a, L;
+            if (j == m-1) {
+                L = M/2;
+                a = l0 & ~(L-1);
+            } else {
+                int h = 1 << j;
+                L = 2*h;
+                a = (((l0 - h) & (M-1) & ~(L-1)) + h) & (M-1);
+            }
+
+            // nearest position with opposite bit is just outside the run
+            unsigned int s1 = gray_encode((a - 1)     & (M-1));
+            unsigned int s2 = gray_encode((a + L)     & (M-1));
+            T e1r = xr - crealf(map[s1]), e1i = xi - cimagf(map[s1]);
+            T e2r = xr - crealf(map[s2]), e2i = xi - cimagf(map[s2]);
+            T d1 = e1r*e1r + e1i*e1i;
+            T d2 = e2r*e2r + e2i*e2i;
+            d1 = d2 < d1 ? d2 : d1;
+
+            T llr = gamma*(d1 - d0);
+            _llr[i*m + m-j-1] = (s >> j) & 1 ? llr : -llr;
+        }
+        _s[i] = s;
+    }
+}
+
+// max-log soft demodulation by searching all constellation points
+void MODEM(_demodsoft_block_search)(MODEM()        _q,
+                                    TC *           _x,
+                                    unsigned int   _n,
+                                    unsigned int * _s,
+                                    T *            _llr)
+{
+    unsigned int m     = _q->m;
+    unsigned int M     = _q->M;
+    T            gamma = 1.2f*_q->M;
+    const T *    map   = (const T*) _q->symbol_map;
+    unsigned int i, j, b;
+
+    for (i=0; i<_n; i++) {
+        T xr = crealf(_x[i]);
+        T xi = cimagf(_x[i]);
+        T dmin_0[MAX_MOD_BITS_PER_SYMBOL];
+        T dmin_1[MAX_MOD_BITS_PER_SYMBOL];
+        unsigned int s = 0;
+
+#if MODEM_DEMODSOFT_SSE
+        if (M >= 4) {
+            // distances to groups of four points
+            __m128 vx = _mm_setr_ps(xr, xi, xr, xi);
+            __m128 dv[(1<<MAX_MOD_BITS_PER_SYMBOL)/4];
+            for (j=0; j<M; j+=4) {
+                __m128 e0 = _mm_sub_ps(_mm_loadu_ps(&map[2*j  ]), vx);
+                __m128 e1 = _mm_sub_ps(_mm_loadu_ps(&map[2*j+4]), vx);
+                dv[j/4] = _mm_hadd_ps(_mm_mul_ps(e0,e0), _mm_mul_ps(e1,e1));
+            }
+
+            // bits above the second are constant across each group;
+            // take minimum of each half, then fold halves together
+            // (folding does not mix values of the lower bits)
+            unsigned int n = M/4;
+            T t[4];
+            for (b=m-1; b>=2; b--) {
+                unsigned int h = n/2;
+                __m128 a0 = dv[0];
+                __m128 a1 = dv[h];
+                dv[0] = _mm_min_ps(a0, a1);
+                for (j=1; j<h; j++) {
+                    a0 = _mm_min_ps(a0, dv[j]);
+                    a1 = _mm_min_ps(a1, dv[j+h]);
+                    dv[j] = _mm_min_ps(dv[j], dv[j+h]);
+                }
+                _mm_storeu_ps(t, _mm_min_ps(a0, _mm_shuffle_ps(a0, a0, _MM_SHUFFLE(1,0,3,2))));
+                dmin_0[b] = t[0] < t[1] ? t[0] : t[1];
+                _mm_storeu_ps(t, _mm_min_ps(a1, _mm_shuffle_ps(a1, a1, _MM_SHUFFLE(1,0,3,2))));
+                dmin_1[b] = t[0] < t[1] ? t[0] : t[1];
+                n = h;
+            }
+
+            // lane l holds minimum over points j = l (mod 4)
+            _mm_storeu_ps(t, dv[0]);
+            dmin_0[0] = t[0] < t[2] ? t[0] : t[2];
+            dmin_1[0] = t[1] < t[3] ? t[1] : t[3];
+            dmin_0[1] = t[0] < t[1] ? t[0] : t[1];
+            dmin_1[1] = t[2] < t[3] ? t[2] : t[3];
+
+            // hard decision: each bit of the nearest point takes
+            // the value with the smaller minimum distance
+            for (b=0; b<m; b++)
+                s |= (dmin_1[b] < dmin_0[b]) << b;
+        } else
+#endif
+        {
+            T dmin = 0.0f;
+            for (b=0; b<m; b++) {
+                dmin_0[b] = 1e9f;
+                dmin_1[b] = 1e9f;
+            }
+            for (j=0; j<M; j++) {
+                T er = xr - map[2*j  ];
+                T ei = xi - map[2*j+1];
+                T d  = er*er + ei*ei;
+                if (d < dmin || j==0) {
+                    s    = j;
+                    dmin = d;
+                }
+                for (b=0; b<m; b++) {
+                    if ((j >> b) & 1) { if (d < dmin_1[b]) dmin_1[b] = d; }
+                    else              { if (d < dmin_0[b]) dmin_0[b] = d; }
+                }
+            }
+        }
+
+        // bit b (from lsb) is soft bit m-b-1
+        for (b=0; b<m; b++)
+            _llr[i*m + m-b-1] = gamma*(dmin_0[b] - dmin_1[b]);
+        _s[i] = s;
+    }
+}
@@ -59,6 +59,9 @@
 // arbitary modems
 #include "modem_arb.c"
 
+// block soft-decision demodulation
+#include "modem_demodsoft_block.c"
+
 // analog modems
 #include "freqmod.c"
 #include "freqdem.c"
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// block soft demodulation tests
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// Help function to keep code base small; compares block soft
+// demodulation against exhaustive max-log reference (or against
+// per-sample soft demodulation for schemes with their own
+// closed-form or stateful soft demodulators)
+void modem_test_demodsoft_block(modulation_scheme _ms)
+{
+    unsigned int num_samples = 400;
+    float        nstd        = 0.1f;
+
+    // generate mod/demod
+    modem mod   = modem_create(_ms);
+    modem demod = modem_create(_ms);
+    modem ref   = modem_create(_ms);
+
+    unsigned int bps = modem_get_bps(demod);
+    unsigned int M   = 1 << bps;
+    float        gamma = 1.2f*M;
+
+    // generate noisy symbols
+    unsigned int i, j, k;
+    unsigned int  sym_in[num_samples];
+    float complex x[num_samples];
+    for (i=0; i<num_samples; i++) {
+        sym_in[i] = modem_gen_rand_sym(mod);
+        modem_modulate(mod, sym_in[i], &x[i]);
+        x[i] += nstd*(randnf() + _Complex_I*randnf());
+    }
+
+    // run block demodulation in uneven pieces
+    unsigned int  sym_out[num_samples];
+    unsigned int  sym_llr[num_samples];
+    float         llr[num_samples*bps];
+    unsigned char soft_bits[num_samples*bps];
+    modem_demodulate_soft_block(demod, x,      37,              sym_out,      soft_bits);
+    modem_demodulate_soft_block(demod, x+37,   num_samples-37,  sym_out+37,   soft_bits+37*bps);
+    modem_reset(demod);
+    modem_demodulate_llr_block (demod, x,      num_samples,     sym_llr,      llr);
+
+    int closed_form = liquid_modem_is_dpsk(_ms) ||
+                      _ms == LIQUID_MODEM_BPSK  ||
+                      _ms == LIQUID_MODEM_QPSK;
+
+    for (i=0; i<num_samples; i++) {
+        CONTEND_EQUALITY(sym_out[i], sym_llr[i]);
+
+        if (closed_form) {
+            // compare against per-sample soft demodulation
+            unsigned int  s;
+            unsigned char b[bps];
+            modem_demodulate_soft(ref, x[i], &s, b);
+            CONTEND_EQUALITY(sym_out[i], s);
+            for (k=0; k<bps; k++)
+                CONTEND_DELTA((float)soft_bits[i*bps+k], (float)b[k], 1.0f);
+            continue;
+        }
+
+        // exhaustive max-log reference
+        float dmin_0[bps];
+        float dmin_1[bps];
+        float dmin = 0.0f;
+        unsigned int s = 0;
+        for (k=0; k<bps; k++) {
+            dmin_0[k] = 1e9f;
+            dmin_1[k] = 1e9f;
+        }
+        for (j=0; j<M; j++) {
+            float complex y;
+            modem_modulate(ref, j, &y);
+            float d = crealf((x[i]-y)*conjf(x[i]-y));
+            if (j==0 || d < dmin) {
+                dmin = d;
+                s = j;
+            }
+            for (k=0; k<bps; k++) {
+                if ((j >> (bps-k-1)) & 1) { if (d < dmin_1[k]) dmin_1[k] = d; }
+                else                      { if (d < dmin_0[k]) dmin_0[k] = d; }
+            }
+        }
+        CONTEND_EQUALITY(sym_out[i], s);
+        for (k=0; k<bps; k++) {
+            float llr_ref = gamma*(dmin_0[k] - dmin_1[k]);
+            CONTEND_DELTA(llr[i*bps+k], llr_ref, 2e-3f + 1e-4f*fabsf(llr_ref));
+
+            float b = llr_ref*16 + 127;
+            b = b > 255 ? 255 : (b < 0 ? 0 : b);
+            CONTEND_DELTA((float)soft_bits[i*bps+k], b, 1.0f);
+        }
+    }
+
+    // clean it up
+    modem_destroy(mod);
+    modem_destroy(demod);
+    modem_destroy(ref);
+}
+
+// AUTOTESTS: generic PSK
+void autotest_demodsoft_block_psk2()      { modem_test_demodsoft_block(LIQUID_MODEM_PSK2);      }
+void autotest_demodsoft_block_psk4()      { modem_test_demodsoft_block(LIQUID_MODEM_PSK4);      }
+void autotest_demodsoft_block_psk8()      { modem_test_demodsoft_block(LIQUID_MODEM_PSK8);      }
+void autotest_demodsoft_block_psk16()     { modem_test_demodsoft_block(LIQUID_MODEM_PSK16);     }
+void autotest_demodsoft_block_psk32()     { modem_test_demodsoft_block(LIQUID_MODEM_PSK32);     }
+void autotest_demodsoft_block_psk64()     { modem_test_demodsoft_block(LIQUID_MODEM_PSK64);     }
+void autotest_demodsoft_block_psk128()    { modem_test_demodsoft_block(LIQUID_MODEM_PSK128);    }
+void autotest_demodsoft_block_psk256()    { modem_test_demodsoft_block(LIQUID_MODEM_PSK256);    }
+
+// AUTOTESTS: generic DPSK
+void autotest_demodsoft_block_dpsk2()     { modem_test_demodsoft_block(LIQUID_MODEM_DPSK2);     }
+void autotest_demodsoft_block_dpsk16()    { modem_test_demodsoft_block(LIQUID_MODEM_DPSK16);    }
+
+// AUTOTESTS: generic ASK
+void autotest_demodsoft_block_ask2()      { modem_test_demodsoft_block(LIQUID_MODEM_ASK2);      }
+void autotest_demodsoft_block_ask4()      { modem_test_demodsoft_block(LIQUID_MODEM_ASK4);      }
+void autotest_demodsoft_block_ask8()      { modem_test_demodsoft_block(LIQUID_MODEM_ASK8);      }
+void autotest_demodsoft_block_ask16()     { modem_test_demodsoft_block(LIQUID_MODEM_ASK16);     }
+void autotest_demodsoft_block_ask32()     { modem_test_demodsoft_block(LIQUID_MODEM_ASK32);     }
+void autotest_demodsoft_block_ask64()     { modem_test_demodsoft_block(LIQUID_MODEM_ASK64);     }
+void autotest_demodsoft_block_ask128()    { modem_test_demodsoft_block(LIQUID_MODEM_ASK128);    }
+void autotest_demodsoft_block_ask256()    { modem_test_demodsoft_block(LIQUID_MODEM_ASK256);    }
+
+// AUTOTESTS: generic QAM
+void autotest_demodsoft_block_qam4()      { modem_test_demodsoft_block(LIQUID_MODEM_QAM4);      }
+void autotest_demodsoft_block_qam8()      { modem_test_demodsoft_block(LIQUID_MODEM_QAM8);      }
+void autotest_demodsoft_block_qam16()     { modem_test_demodsoft_block(LIQUID_MODEM_QAM16);     }
+void autotest_demodsoft_block_qam32()     { modem_test_demodsoft_block(LIQUID_MODEM_QAM32);     }
+void autotest_demodsoft_block_qam64()     { modem_test_demodsoft_block(LIQUID_MODEM_QAM64);     }
+void autotest_demodsoft_block_qam128()    { modem_test_demodsoft_block(LIQUID_MODEM_QAM128);    }
+void autotest_demodsoft_block_qam256()    { modem_test_demodsoft_block(LIQUID_MODEM_QAM256);    }
+
+// AUTOTESTS: generic APSK (maps to specific APSK modems internally)
+void autotest_demodsoft_block_apsk4()     { modem_test_demodsoft_block(LIQUID_MODEM_APSK4);     }
+void autotest_demodsoft_block_apsk8()     { modem_test_demodsoft_block(LIQUID_MODEM_APSK8);     }
+void autotest_demodsoft_block_apsk16()    { modem_test_demodsoft_block(LIQUID_MODEM_APSK16);    }
+void autotest_demodsoft_block_apsk32()    { modem_test_demodsoft_block(LIQUID_MODEM_APSK32);    }
+void autotest_demodsoft_block_apsk64()    { modem_test_demodsoft_block(LIQUID_MODEM_APSK64);    }
+void autotest_demodsoft_block_apsk128()   { modem_test_demodsoft_block(LIQUID_MODEM_APSK128);   }
+void autotest_demodsoft_block_apsk256()   { modem_test_demodsoft_block(LIQUID_MODEM_APSK256);   }
+
+// AUTOTESTS: Specific modems
+void autotest_demodsoft_block_bpsk()      { modem_test_demodsoft_block(LIQUID_MODEM_BPSK);      }
+void autotest_demodsoft_block_qpsk()      { modem_test_demodsoft_block(LIQUID_MODEM_QPSK);      }
+void autotest_demodsoft_block_ook()       { modem_test_demodsoft_block(LIQUID_MODEM_OOK);       }
+void autotest_demodsoft_block_sqam32()    { modem_test_demodsoft_block(LIQUID_MODEM_SQAM32);    }
+void autotest_demodsoft_block_sqam128()   { modem_test_demodsoft_block(LIQUID_MODEM_SQAM128);   }
+void autotest_demodsoft_block_V29()       { modem_test_demodsoft_block(LIQUID_MODEM_V29);       }
+void autotest_demodsoft_block_arb16opt()  { modem_test_demodsoft_block(LIQUID_MODEM_ARB16OPT);  }
+void autotest_demodsoft_block_arb32opt()  { modem_test_demodsoft_block(LIQUID_MODEM_ARB32OPT);  }
+void autotest_demodsoft_block_arb64opt()  { modem_test_demodsoft_block(LIQUID_MODEM_ARB64OPT);  }
+void autotest_demodsoft_block_arb128opt() { modem_test_demodsoft_block(LIQUID_MODEM_ARB128OPT); }
+void autotest_demodsoft_block_arb256opt() { modem_test_demodsoft_block(LIQUID_MODEM_ARB256OPT); }
+void autotest_demodsoft_block_arb64vt()   { modem_test_demodsoft_block(LIQUID_MODEM_ARB64VT);   }
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+#define FIRPFBCH_BLOCK_BENCH_API(NUM_CHANNELS,TYPE,NUM_THREADS) \
+(   struct rusage *_start,                                      \
+    struct rusage *_finish,                                     \
+    unsigned long int *_num_iterations)                         \
+{ firpfbch_crcf_block_bench(_start, _finish, _num_iterations, NUM_CHANNELS, TYPE, NUM_THREADS); }
+
+#define FIRPFBCH2_BLOCK_BENCH_API(NUM_CHANNELS,TYPE,NUM_THREADS)\
+(   struct rusage *_start,                                      \
+    struct rusage *_finish,                                     \
+    unsigned long int *_num_iterations)                         \
+{ firpfbch2_crcf_block_bench(_start, _finish, _num_iterations, NUM_CHANNELS, TYPE, NUM_THREADS); }
+
+// number of channelizer steps per block call
+#define FIRPFBCH_BENCH_BLOCK_LEN (64)
+
+// Helper function to keep code base small
+void firpfbch_crcf_block_bench(struct rusage *     _start,
+                               struct rusage *     _finish,
+                               unsigned long int * _num_iterations,
+                               unsigned int        _num_channels,
+                               int                 _type,
+                               unsigned int        _num_threads)
+{
+    // initialize channelizer
+    firpfbch_crcf q = firpfbch_crcf_create_kaiser(_type, _num_channels, 2, 60.0f);
+    firpfbch_crcf_set_num_threads(q, _num_threads);
+
+    unsigned long int i;
+    unsigned int n = FIRPFBCH_BENCH_BLOCK_LEN * _num_channels;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    for (i=0; i<n; i++)
+        x[i] = 1.0f + _Complex_I*1.0f;
+
+    // scale number of iterations to keep execution time
+    // relatively linear; each trial is one channelizer step
+    *_num_iterations /= _num_channels * FIRPFBCH_BENCH_BLOCK_LEN;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        if (_type == LIQUID_SYNTHESIZER)
+            firpfbch_crcf_synthesizer_execute_block(q, x, FIRPFBCH_BENCH_BLOCK_LEN, y);
+        else
+            firpfbch_crcf_analyzer_execute_block(q, x, FIRPFBCH_BENCH_BLOCK_LEN, y);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= FIRPFBCH_BENCH_BLOCK_LEN;
+
+    firpfbch_crcf_destroy(q);
+    free(x);
+    free(y);
+}
+
+// Helper function to keep code base small
+void firpfbch2_crcf_block_bench(struct rusage *     _start,
+                                struct rusage *     _finish,
+                                unsigned long int * _num_iterations,
+                                unsigned int        _num_channels,
+                                int                 _type,
+                                unsigned int        _num_threads)
+{
+    // initialize channelizer
+    firpfbch2_crcf q = firpfbch2_crcf_create_kaiser(_type, _num_channels, 2, 60.0f);
+    firpfbch2_crcf_set_num_threads(q, _num_threads);
+
+    unsigned long int i;
+    unsigned int n = FIRPFBCH_BENCH_BLOCK_LEN * _num_channels;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    for (i=0; i<n; i++)
+        x[i] = 1.0f + _Complex_I*1.0f;
+
+    // scale number of iterations to keep execution time
+    // relatively linear; each trial is one channelizer step
+    *_num_iterations /= _num_channels * FIRPFBCH_BENCH_BLOCK_LEN;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        firpfbch2_crcf_execute_block(q, x, FIRPFBCH_BENCH_BLOCK_LEN, y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= FIRPFBCH_BENCH_BLOCK_LEN;
+
+    firpfbch2_crcf_destroy(q);
+    free(x);
+    free(y);
+}
+
+// firpfbch analysis, 1024 channels
+void benchmark_firpfbch_crcf_block_a1024_t1  FIRPFBCH_BLOCK_BENCH_API(1024, LIQUID_ANALYZER,    1)
+void benchmark_firpfbch_crcf_block_a1024_t2  FIRPFBCH_BLOCK_BENCH_API(1024, LIQUID_ANALYZER,    2)
+void benchmark_firpfbch_crcf_block_a1024_t4  FIRPFBCH_BLOCK_BENCH_API(1024, LIQUID_ANALYZER,    4)
+
+// firpfbch synthesis, 1024 channels
+void benchmark_firpfbch_crcf_block_s1024_t1  FIRPFBCH_BLOCK_BENCH_API(1024, LIQUID_SYNTHESIZER, 1)
+void benchmark_firpfbch_crcf_block_s1024_t2  FIRPFBCH_BLOCK_BENCH_API(1024, LIQUID_SYNTHESIZER, 2)
+void benchmark_firpfbch_crcf_block_s1024_t4  FIRPFBCH_BLOCK_BENCH_API(1024, LIQUID_SYNTHESIZER, 4)
+
+// firpfbch2 analysis, 1024 channels
+void benchmark_firpfbch2_crcf_block_a1024_t1 FIRPFBCH2_BLOCK_BENCH_API(1024, LIQUID_ANALYZER,   1)
+void benchmark_firpfbch2_crcf_block_a1024_t2 FIRPFBCH2_BLOCK_BENCH_API(1024, LIQUID_ANALYZER,   2)
+void benchmark_firpfbch2_crcf_block_a1024_t4 FIRPFBCH2_BLOCK_BENCH_API(1024, LIQUID_ANALYZER,   4)
+
+// firpfbch2 synthesis, 1024 channels
+void benchmark_firpfbch2_crcf_block_s1024_t1 FIRPFBCH2_BLOCK_BENCH_API(1024, LIQUID_SYNTHESIZER,1)
+void benchmark_firpfbch2_crcf_block_s1024_t2 FIRPFBCH2_BLOCK_BENCH_API(1024, LIQUID_SYNTHESIZER,2)
+void benchmark_firpfbch2_crcf_block_s1024_t4 FIRPFBCH2_BLOCK_BENCH_API(1024, LIQUID_SYNTHESIZER,4)
+
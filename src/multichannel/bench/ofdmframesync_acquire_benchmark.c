@@ -26,7 +26,7 @@
 #include <math.h>
 #include <assert.h>
 #include <sys/resource.h>
-#include "liquid.h"
+#include "liquid.internal.h"
 
 #define OFDMFRAMESYNC_ACQUIRE_BENCH_API(M,CP_LEN)   \
 (   struct rusage *_start,                          \
@@ -103,3 +103,52 @@ void benchmark_ofdmframesync_acquire_n128   OFDMFRAMESYNC_ACQUIRE_BENCH_API(128,
 void benchmark_ofdmframesync_acquire_n256   OFDMFRAMESYNC_ACQUIRE_BENCH_API(256,32)
 void benchmark_ofdmframesync_acquire_n512   OFDMFRAMESYNC_ACQUIRE_BENCH_API(512,64)
 
+
+#define OFDMFRAMESYNC_EQGAIN_BENCH_API(M,NTAPS)     \
+(   struct rusage *_start,                          \
+    struct rusage *_finish,                         \
+    unsigned long int *_num_iterations)             \
+{ ofdmframesync_eqgain_bench(_start, _finish, _num_iterations, M, NTAPS); }
+
+// Helper function to keep code base small: equalizer gain smoothing
+// (acquisition itself uses the polynomial fit, not this path)
+void ofdmframesync_eqgain_bench(struct rusage *     _start,
+                                struct rusage *     _finish,
+                                unsigned long int * _num_iterations,
+                                unsigned int        _M,
+                                unsigned int        _ntaps)
+{
+    unsigned int cp_len = _M/8;
+    ofdmframegen  fg = ofdmframegen_create (_M, cp_len, 0, NULL);
+    ofdmframesync fs = ofdmframesync_create(_M, cp_len, 0, NULL, NULL, NULL);
+
+    // acquire frame to initialize subcarrier gain estimates
+    unsigned int i;
+    unsigned int num_samples = 3*(_M + cp_len);
+    float complex * y = (float complex*) malloc(num_samples*sizeof(float complex));
+    ofdmframegen_write_S0a(fg, &y[0]);
+    ofdmframegen_write_S0b(fg, &y[  _M + cp_len ]);
+    ofdmframegen_write_S1( fg, &y[2*(_M + cp_len)]);
+    for (i=0; i<num_samples; i++)
+        y[i] += 0.02f*randnf()*cexpf(_Complex_I*2*M_PI*randf());
+    ofdmframesync_execute(fs, y, num_samples);
+
+    // start trials
+    *_num_iterations /= _M;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        ofdmframesync_estimate_eqgain(fs, _ntaps);
+    getrusage(RUSAGE_SELF, _finish);
+
+    ofdmframegen_destroy(fg);
+    ofdmframesync_destroy(fs);
+    free(y);
+}
+
+void benchmark_ofdmframesync_eqgain_n64     OFDMFRAMESYNC_EQGAIN_BENCH_API(64,  8)
+void benchmark_ofdmframesync_eqgain_n256    OFDMFRAMESYNC_EQGAIN_BENCH_API(256, 8)
+void benchmark_ofdmframesync_eqgain_n1024   OFDMFRAMESYNC_EQGAIN_BENCH_API(1024,8)
+void benchmark_ofdmframesync_eqgain_n2048   OFDMFRAMESYNC_EQGAIN_BENCH_API(2048,8)
+void benchmark_ofdmframesync_eqgain_n4096   OFDMFRAMESYNC_EQGAIN_BENCH_API(4096,8)
+
@@ -52,6 +52,22 @@ struct FIRPFBCH(_s) {
     FFT_PLAN fft;               // fft|ifft object
     TO * x;                     // fft|ifft transform input array
     TO * X;                     // fft|ifft transform output array
+
+    // block execution across worker pool (worker 0 is the calling
+    // thread and shares the transform plan and arrays above)
+    liquid_workers workers;     // worker pool (NULL if serial)
+    unsigned int num_workers;   // number of workers
+    FFT_PLAN * fft_w;           // per-worker transform plans
+    T ** X_w;                   // per-worker transform input arrays
+    T ** x_w;                   // per-worker transform output arrays
+    T ** hist;                  // per-worker branch history [size: p+block_len]
+    T * block;                  // intermediate block [size: block_len*M]
+    unsigned int block_len;     // allocated block length (time steps)
+
+    // arguments to current block call
+    TI * block_x;               // block input
+    TO * block_y;               // block output
+    unsigned int block_n;       // number of time steps
 };
 
 // 
@@ -64,6 +80,10 @@ void FIRPFBCH(_analyzer_run)(FIRPFBCH()   _q,
                              unsigned int _k,
                              TO *         _X);
 
+void FIRPFBCH(_workers_create)(FIRPFBCH() _q, unsigned int _num_workers);
+void FIRPFBCH(_workers_destroy)(FIRPFBCH() _q);
+void FIRPFBCH(_block_reserve)(FIRPFBCH() _q, unsigned int _n);
+
 
 // create FIR polyphase filterbank channelizer object
 //  _type   : channelizer type (LIQUID_ANALYZER | LIQUID_SYNTHESIZER)
@@ -134,6 +154,11 @@ FIRPFBCH() FIRPFBCH(_create)(int          _type,
     else
         q->fft = FFT_CREATE_PLAN(q->num_channels, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD);
 
+    // block execution runs serially by default
+    q->block     = NULL;
+    q->block_len = 0;
+    FIRPFBCH(_workers_create)(q, 1);
+
     // reset filterbank object
     FIRPFBCH(_reset)(q);
 
@@ -268,6 +293,10 @@ void FIRPFBCH(_destroy)(FIRPFBCH() _q)
     free(_q->dp);
     free(_q->w);
 
+    // free worker pool and block execution buffers
+    FIRPFBCH(_workers_destroy)(_q);
+    free(_q->block);
+
     // free transform object
     FFT_DESTROY_PLAN(_q->fft);
 
@@ -303,6 +332,23 @@ void FIRPFBCH(_print)(FIRPFBCH() _q)
         printf("  h[%3u] = %12.8f + %12.8f*j\n", i, crealf(_q->h[i]), cimagf(_q->h[i]));
 }
 
+// set number of threads used by block execution methods; a value of 1
+// (default) processes blocks on the calling thread only
+//  _q              :   filterbank channelizer object
+//  _num_threads    :   number of threads, > 0
+void FIRPFBCH(_set_num_threads)(FIRPFBCH()   _q,
+                                unsigned int _num_threads)
+{
+    if (_num_threads == 0) {
+        fprintf(stderr,"error: firpfbch_%s_set_num_threads(), number of threads must be greater than 0\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // re-create worker pool and per-worker buffers
+    FIRPFBCH(_workers_destroy)(_q);
+    FIRPFBCH(_workers_create)(_q, _num_threads);
+}
+
 // 
 // SYNTHESIZER
 //
@@ -335,6 +381,73 @@ void FIRPFBCH(_synthesizer_execute)(FIRPFBCH() _q,
     }
 }
 
+// synthesizer block task: inverse transforms for time steps [_start,_end)
+static void FIRPFBCH(_synthesizer_block_fft)(void *       _context,
+                                             unsigned int _worker,
+                                             unsigned int _start,
+                                             unsigned int _end)
+{
+    FIRPFBCH() q = (FIRPFBCH()) _context;
+    unsigned int M = q->num_channels;
+    unsigned int t;
+    for (t=_start; t<_end; t++) {
+        memmove(q->X_w[_worker], &q->block_x[t*M], M*sizeof(TI));
+        FFT_EXECUTE(q->fft_w[_worker]);
+        memmove(&q->block[t*M], q->x_w[_worker], M*sizeof(T));
+    }
+}
+
+// synthesizer block task: filter branches [_start,_end) over all steps
+static void FIRPFBCH(_synthesizer_block_filter)(void *       _context,
+                                                unsigned int _worker,
+                                                unsigned int _start,
+                                                unsigned int _end)
+{
+    FIRPFBCH() q = (FIRPFBCH()) _context;
+    unsigned int M = q->num_channels;
+    unsigned int n = q->block_n;
+    T * h = q->hist[_worker];
+    T * r;
+    unsigned int i, t;
+    for (i=_start; i<_end; i++) {
+        // branch history: current window followed by new samples
+        WINDOW(_read)(q->w[i], &r);
+        memmove(h, r, q->p*sizeof(T));
+        for (t=0; t<n; t++)
+            h[q->p+t] = q->block[t*M + i];
+
+        // window after step t is h[t+1 .. t+p]
+        for (t=0; t<n; t++)
+            DOTPROD(_execute)(q->dp[i], &h[t+1], &q->block_y[t*M + i]);
+
+        // retain most recent samples in window
+        WINDOW(_write)(q->w[i], h, q->p + n);
+    }
+}
+
+// execute filterbank as synthesizer on consecutive blocks of samples,
+// splitting the work across the worker pool; output is identical to
+// calling _synthesizer_execute() on each block in turn
+//  _q      :   filterbank channelizer object
+//  _x      :   channelized input, [size: _n*num_channels x 1]
+//  _n      :   number of blocks
+//  _y      :   output time series, [size: _n*num_channels x 1]
+void FIRPFBCH(_synthesizer_execute_block)(FIRPFBCH()   _q,
+                                          TI *         _x,
+                                          unsigned int _n,
+                                          TO *         _y)
+{
+    FIRPFBCH(_block_reserve)(_q, _n);
+    _q->block_x = _x;
+    _q->block_y = _y;
+    _q->block_n = _n;
+
+    // transforms are independent across time steps; filters are
+    // independent across branches
+    liquid_workers_run(_q->workers, FIRPFBCH(_synthesizer_block_fft),    _q, _n);
+    liquid_workers_run(_q->workers, FIRPFBCH(_synthesizer_block_filter), _q, _q->num_channels);
+}
+
 // 
 // ANALYZER
 //
@@ -358,10 +471,142 @@ void FIRPFBCH(_analyzer_execute)(FIRPFBCH() _q,
     FIRPFBCH(_analyzer_run)(_q, 0, _y);
 }
 
+// analyzer block task: filter branches [_start,_end) over all steps
+static void FIRPFBCH(_analyzer_block_filter)(void *       _context,
+                                             unsigned int _worker,
+                                             unsigned int _start,
+                                             unsigned int _end)
+{
+    FIRPFBCH() q = (FIRPFBCH()) _context;
+    unsigned int M = q->num_channels;
+    unsigned int n = q->block_n;
+    T * h = q->hist[_worker];
+    T * r;
+    unsigned int i, t;
+    for (i=_start; i<_end; i++) {
+        // branch history: current window followed by new samples (input
+        // sample M-1-i of each block is pushed into branch i)
+        WINDOW(_read)(q->w[i], &r);
+        memmove(h, r, q->p*sizeof(T));
+        for (t=0; t<n; t++)
+            h[q->p+t] = q->block_x[t*M + M-i-1];
+
+        // window after step t is h[t+1 .. t+p]
+        for (t=0; t<n; t++)
+            DOTPROD(_execute)(q->dp[i], &h[t+1], &q->block[t*M + M-i-1]);
+
+        // retain most recent samples in window
+        WINDOW(_write)(q->w[i], h, q->p + n);
+    }
+}
+
+// analyzer block task: transforms for time steps [_start,_end)
+static void FIRPFBCH(_analyzer_block_fft)(void *       _context,
+                                          unsigned int _worker,
+                                          unsigned int _start,
+                                          unsigned int _end)
+{
+    FIRPFBCH() q = (FIRPFBCH()) _context;
+    unsigned int M = q->num_channels;
+    unsigned int t;
+    for (t=_start; t<_end; t++) {
+        memmove(q->X_w[_worker], &q->block[t*M], M*sizeof(T));
+        FFT_EXECUTE(q->fft_w[_worker]);
+        memmove(&q->block_y[t*M], q->x_w[_worker], M*sizeof(TO));
+    }
+}
+
+// execute filterbank as analyzer on consecutive blocks of samples,
+// splitting the work across the worker pool; output is identical to
+// calling _analyzer_execute() on each block in turn
+//  _q      :   filterbank channelizer object
+//  _x      :   input time series, [size: _n*num_channels x 1]
+//  _n      :   number of blocks
+//  _y      :   channelized output, [size: _n*num_channels x 1]
+void FIRPFBCH(_analyzer_execute_block)(FIRPFBCH()   _q,
+                                       TI *         _x,
+                                       unsigned int _n,
+                                       TO *         _y)
+{
+    FIRPFBCH(_block_reserve)(_q, _n);
+    _q->block_x = _x;
+    _q->block_y = _y;
+    _q->block_n = _n;
+
+    // filters are independent across branches; transforms are
+    // independent across time steps
+    liquid_workers_run(_q->workers, FIRPFBCH(_analyzer_block_filter), _q, _q->num_channels);
+    liquid_workers_run(_q->workers, FIRPFBCH(_analyzer_block_fft),    _q, _n);
+}
+
 // 
 // internal methods
 //
 
+// create worker pool and per-worker transform plans and buffers
+//  _q              :   filterbank channelizer object
+//  _num_workers    :   number of workers (including calling thread)
+void FIRPFBCH(_workers_create)(FIRPFBCH()   _q,
+                               unsigned int _num_workers)
+{
+    _q->workers     = _num_workers > 1 ? liquid_workers_create(_num_workers) : NULL;
+    _q->num_workers = liquid_workers_get_num_workers(_q->workers);
+
+    unsigned int W = _q->num_workers;
+    _q->fft_w = (FFT_PLAN*) malloc(W*sizeof(FFT_PLAN));
+    _q->X_w   = (T**)       malloc(W*sizeof(T*));
+    _q->x_w   = (T**)       malloc(W*sizeof(T*));
+    _q->hist  = (T**)       malloc(W*sizeof(T*));
+
+    // worker 0 shares main transform
+    _q->fft_w[0] = _q->fft;
+    _q->X_w[0]   = _q->X;
+    _q->x_w[0]   = _q->x;
+
+    unsigned int i;
+    int dir = _q->type == LIQUID_ANALYZER ? FFT_DIR_FORWARD : FFT_DIR_BACKWARD;
+    for (i=1; i<W; i++) {
+        _q->X_w[i]   = (T*) malloc(_q->num_channels*sizeof(T));
+        _q->x_w[i]   = (T*) malloc(_q->num_channels*sizeof(T));
+        _q->fft_w[i] = FFT_CREATE_PLAN(_q->num_channels, _q->X_w[i], _q->x_w[i], dir, FFT_METHOD);
+    }
+    for (i=0; i<W; i++)
+        _q->hist[i] = (T*) malloc((_q->p + _q->block_len)*sizeof(T));
+}
+
+// destroy worker pool and per-worker transform plans and buffers
+void FIRPFBCH(_workers_destroy)(FIRPFBCH() _q)
+{
+    liquid_workers_destroy(_q->workers);
+
+    unsigned int i;
+    for (i=1; i<_q->num_workers; i++) {
+        FFT_DESTROY_PLAN(_q->fft_w[i]);
+        free(_q->X_w[i]);
+        free(_q->x_w[i]);
+    }
+    for (i=0; i<_q->num_workers; i++)
+        free(_q->hist[i]);
+    free(_q->fft_w);
+    free(_q->X_w);
+    free(_q->x_w);
+    free(_q->hist);
+}
+
+// ensure block buffers can hold _n time steps
+void FIRPFBCH(_block_reserve)(FIRPFBCH() _q,
+                              unsigned int _n)
+{
+    if (_n <= _q->block_len)
+        return;
+
+    _q->block_len = _n;
+    _q->block = (T*) realloc(_q->block, _q->block_len*_q->num_channels*sizeof(T));
+    unsigned int i;
+    for (i=0; i<_q->num_workers; i++)
+        _q->hist[i] = (T*) realloc(_q->hist[i], (_q->p + _q->block_len)*sizeof(T));
+}
+
 // push single sample into analysis filterbank, updating index
 // counter appropriately
 //  _q      :   filterbank channelizer object
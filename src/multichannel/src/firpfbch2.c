@@ -55,8 +55,29 @@ struct FIRPFBCH2(_s) {
     WINDOW() * w0;      // window buffer object array
     WINDOW() * w1;      // window buffer object array (synthesizer only)
     int flag;           // flag indicating filter/buffer alignment
+
+    // block execution across worker pool (worker 0 is the calling
+    // thread and shares the transform plan and arrays above)
+    liquid_workers workers;     // worker pool (NULL if serial)
+    unsigned int num_workers;   // number of workers
+    FFT_PLAN * ifft_w;          // per-worker transform plans
+    T ** X_w;                   // per-worker transform input arrays
+    T ** x_w;                   // per-worker transform output arrays
+    T ** hist;                  // per-worker window histories [size: 4*(2*m+block_len)]
+    T * block;                  // intermediate block [size: block_len*M]
+    unsigned int block_len;     // allocated block length (time steps)
+
+    // arguments to current block call
+    TI * block_x;               // block input
+    TO * block_y;               // block output
+    unsigned int block_n;       // number of time steps
+    int block_flag;             // alignment flag at start of block
 };
 
+void FIRPFBCH2(_workers_create)(FIRPFBCH2() _q, unsigned int _num_workers);
+void FIRPFBCH2(_workers_destroy)(FIRPFBCH2() _q);
+void FIRPFBCH2(_block_reserve)(FIRPFBCH2() _q, unsigned int _n);
+
 // create firpfbch2 object
 //  _type   :   channelizer type (e.g. LIQUID_ANALYZER)
 //  _M      :   number of channels (must be even)
@@ -122,6 +143,11 @@ FIRPFBCH2() FIRPFBCH2(_create)(int          _type,
         q->w1[i] = WINDOW(_create)(h_sub_len);
     }
 
+    // block execution runs serially by default
+    q->block     = NULL;
+    q->block_len = 0;
+    FIRPFBCH2(_workers_create)(q, 1);
+
     // reset filterbank object and return
     FIRPFBCH2(_reset)(q);
     return q;
@@ -192,6 +218,10 @@ void FIRPFBCH2(_destroy)(FIRPFBCH2() _q)
         DOTPROD(_destroy)(_q->dp[i]);
     free(_q->dp);
 
+    // free worker pool and block execution buffers
+    FIRPFBCH2(_workers_destroy)(_q);
+    free(_q->block);
+
     // free transform object and arrays
     FFT_DESTROY_PLAN(_q->ifft);
     free(_q->X);
@@ -238,6 +268,23 @@ void FIRPFBCH2(_print)(FIRPFBCH2() _q)
         DOTPROD(_print)(_q->dp[i]);
 }
 
+// set number of threads used by block execution; a value of 1
+// (default) processes blocks on the calling thread only
+//  _q              :   filterbank channelizer object
+//  _num_threads    :   number of threads, > 0
+void FIRPFBCH2(_set_num_threads)(FIRPFBCH2()  _q,
+                                 unsigned int _num_threads)
+{
+    if (_num_threads == 0) {
+        fprintf(stderr,"error: firpfbch2_%s_set_num_threads(), number of threads must be greater than 0\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // re-create worker pool and per-worker buffers
+    FIRPFBCH2(_workers_destroy)(_q);
+    FIRPFBCH2(_workers_create)(_q, _num_threads);
+}
+
 // execute filterbank channelizer (analyzer)
 //  _x      :   channelizer input,  [size: M/2 x 1]
 //  _y      :   channelizer output, [size: M   x 1]
@@ -356,3 +403,231 @@ void FIRPFBCH2(_execute)(FIRPFBCH2() _q,
     }
 }
 
+
+// analyzer block task: filter branches [_start,_end) over all steps
+static void FIRPFBCH2(_analyzer_block_filter)(void *       _context,
+                                              unsigned int _worker,
+                                              unsigned int _start,
+                                              unsigned int _end)
+{
+    FIRPFBCH2() q = (FIRPFBCH2()) _context;
+    unsigned int M  = q->M;
+    unsigned int M2 = q->M2;
+    unsigned int p  = 2*q->m;
+    unsigned int n  = q->block_n;
+    T * h = q->hist[_worker];
+    T * r;
+    unsigned int b, t;
+    for (b=_start; b<_end; b++) {
+        // branch history: current window followed by new samples; the
+        // lower half of the bank receives samples when the flag is
+        // clear, the upper half when it is set
+        WINDOW(_read)(q->w0[b], &r);
+        memmove(h, r, p*sizeof(T));
+        unsigned int c = 0;
+        int push_flag = b < M2 ? 0 : 1;
+        unsigned int base = b < M2 ? M2 : M;
+        for (t=0; t<n; t++) {
+            int flag = q->block_flag ^ (t & 1);
+            if (flag == push_flag)
+                h[p + c++] = q->block_x[t*M2 + base-b-1];
+
+            // filter index aligned with this buffer
+            unsigned int offset = flag ? M2 : 0;
+            unsigned int i = (b + M - offset) % M;
+            DOTPROD(_execute)(q->dp[i], &h[c], &q->block[t*M + b]);
+        }
+
+        // retain most recent samples in window
+        WINDOW(_write)(q->w0[b], h, p + c);
+    }
+}
+
+// analyzer block task: transforms for time steps [_start,_end)
+static void FIRPFBCH2(_analyzer_block_fft)(void *       _context,
+                                           unsigned int _worker,
+                                           unsigned int _start,
+                                           unsigned int _end)
+{
+    FIRPFBCH2() q = (FIRPFBCH2()) _context;
+    unsigned int i, t;
+    for (t=_start; t<_end; t++) {
+        memmove(q->X_w[_worker], &q->block[t*q->M], q->M*sizeof(T));
+        FFT_EXECUTE(q->ifft_w[_worker]);
+
+        // scale result by 1/num_channels (C transform)
+        for (i=0; i<q->M; i++)
+            q->block_y[t*q->M + i] = q->x_w[_worker][i] / (float)(q->M);
+    }
+}
+
+// synthesizer block task: transforms for time steps [_start,_end)
+static void FIRPFBCH2(_synthesizer_block_fft)(void *       _context,
+                                              unsigned int _worker,
+                                              unsigned int _start,
+                                              unsigned int _end)
+{
+    FIRPFBCH2() q = (FIRPFBCH2()) _context;
+    unsigned int i, t;
+    for (t=_start; t<_end; t++) {
+        memmove(q->X_w[_worker], &q->block_x[t*q->M], q->M*sizeof(TI));
+        FFT_EXECUTE(q->ifft_w[_worker]);
+
+        // same scaling as _execute_synthesizer()
+        T * x = q->x_w[_worker];
+        for (i=0; i<q->M; i++)
+            x[i] *= 1.0f / (float)(q->M);
+        for (i=0; i<q->M; i++)
+            x[i] *= (float)(q->M2);
+        memmove(&q->block[t*q->M], x, q->M*sizeof(T));
+    }
+}
+
+// synthesizer block task: outputs [_start,_end) over all steps; output i
+// depends only on buffers i and i+M/2 of each bank
+static void FIRPFBCH2(_synthesizer_block_filter)(void *       _context,
+                                                 unsigned int _worker,
+                                                 unsigned int _start,
+                                                 unsigned int _end)
+{
+    FIRPFBCH2() q = (FIRPFBCH2()) _context;
+    unsigned int M  = q->M;
+    unsigned int M2 = q->M2;
+    unsigned int p  = 2*q->m;
+    unsigned int n  = q->block_n;
+    unsigned int i, k, t;
+    for (i=_start; i<_end; i++) {
+        // histories of buffers w0[i], w0[i+M2], w1[i], w1[i+M2]
+        WINDOW() w[4] = {q->w0[i], q->w0[i+M2], q->w1[i], q->w1[i+M2]};
+        T * h[4];
+        unsigned int c[4] = {0, 0, 0, 0};
+        T * r;
+        for (k=0; k<4; k++) {
+            h[k] = q->hist[_worker] + k*(p + q->block_len);
+            WINDOW(_read)(w[k], &r);
+            memmove(h[k], r, p*sizeof(T));
+        }
+
+        for (t=0; t<n; t++) {
+            int flag = q->block_flag ^ (t & 1);
+
+            // push transform outputs into w1 (flag clear) or w0 (flag set)
+            unsigned int k0 = flag ? 0 : 2;
+            h[k0  ][p + c[k0  ]++] = q->block[t*M + i];
+            h[k0+1][p + c[k0+1]++] = q->block[t*M + i + M2];
+
+            // read buffers at index i (flag clear) or i+M2 (flag set),
+            // swapping outputs on alternating runs
+            T * r0 = flag ? &h[1][c[1]] : &h[0][c[0]];
+            T * r1 = flag ? &h[3][c[3]] : &h[2][c[2]];
+            TO y0, y1;
+            DOTPROD(_execute)(q->dp[i],    flag ? r0 : r1, &y0);
+            DOTPROD(_execute)(q->dp[i+M2], flag ? r1 : r0, &y1);
+            q->block_y[t*M2 + i] = y0 + y1;
+        }
+
+        // retain most recent samples in windows
+        for (k=0; k<4; k++)
+            WINDOW(_write)(w[k], h[k], p + c[k]);
+    }
+}
+
+// execute filterbank channelizer on consecutive blocks, splitting the
+// work across the worker pool; output is identical to calling
+// _execute() on each block in turn
+// LIQUID_ANALYZER:     input: _n*M/2, output: _n*M
+// LIQUID_SYNTHESIZER:  input: _n*M,   output: _n*M/2
+//  _x      :   channelizer input
+//  _n      :   number of blocks
+//  _y      :   channelizer output
+void FIRPFBCH2(_execute_block)(FIRPFBCH2()  _q,
+                               TI *         _x,
+                               unsigned int _n,
+                               TO *         _y)
+{
+    FIRPFBCH2(_block_reserve)(_q, _n);
+    _q->block_x    = _x;
+    _q->block_y    = _y;
+    _q->block_n    = _n;
+    _q->block_flag = _q->flag;
+
+    switch (_q->type) {
+    case LIQUID_ANALYZER:
+        liquid_workers_run(_q->workers, FIRPFBCH2(_analyzer_block_filter), _q, _q->M);
+        liquid_workers_run(_q->workers, FIRPFBCH2(_analyzer_block_fft),    _q, _n);
+        break;
+    case LIQUID_SYNTHESIZER:
+        liquid_workers_run(_q->workers, FIRPFBCH2(_synthesizer_block_fft),    _q, _n);
+        liquid_workers_run(_q->workers, FIRPFBCH2(_synthesizer_block_filter), _q, _q->M2);
+        break;
+    default:
+        fprintf(stderr,"error: firpfbch2_%s_execute_block(), invalid type\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // update flag
+    _q->flag = _q->block_flag ^ (_n & 1);
+}
+
+// create worker pool and per-worker transform plans and buffers
+//  _q              :   filterbank channelizer object
+//  _num_workers    :   number of workers (including calling thread)
+void FIRPFBCH2(_workers_create)(FIRPFBCH2()  _q,
+                                unsigned int _num_workers)
+{
+    _q->workers     = _num_workers > 1 ? liquid_workers_create(_num_workers) : NULL;
+    _q->num_workers = liquid_workers_get_num_workers(_q->workers);
+
+    unsigned int W = _q->num_workers;
+    _q->ifft_w = (FFT_PLAN*) malloc(W*sizeof(FFT_PLAN));
+    _q->X_w    = (T**)       malloc(W*sizeof(T*));
+    _q->x_w    = (T**)       malloc(W*sizeof(T*));
+    _q->hist   = (T**)       malloc(W*sizeof(T*));
+
+    // worker 0 shares main transform
+    _q->ifft_w[0] = _q->ifft;
+    _q->X_w[0]    = _q->X;
+    _q->x_w[0]    = _q->x;
+
+    unsigned int i;
+    for (i=1; i<W; i++) {
+        _q->X_w[i]    = (T*) malloc(_q->M*sizeof(T));
+        _q->x_w[i]    = (T*) malloc(_q->M*sizeof(T));
+        _q->ifft_w[i] = FFT_CREATE_PLAN(_q->M, _q->X_w[i], _q->x_w[i], FFT_DIR_BACKWARD, FFT_METHOD);
+    }
+    for (i=0; i<W; i++)
+        _q->hist[i] = (T*) malloc(4*(2*_q->m + _q->block_len)*sizeof(T));
+}
+
+// destroy worker pool and per-worker transform plans and buffers
+void FIRPFBCH2(_workers_destroy)(FIRPFBCH2() _q)
+{
+    liquid_workers_destroy(_q->workers);
+
+    unsigned int i;
+    for (i=1; i<_q->num_workers; i++) {
+        FFT_DESTROY_PLAN(_q->ifft_w[i]);
+        free(_q->X_w[i]);
+        free(_q->x_w[i]);
+    }
+    for (i=0; i<_q->num_workers; i++)
+        free(_q->hist[i]);
+    free(_q->ifft_w);
+    free(_q->X_w);
+    free(_q->x_w);
+    free(_q->hist);
+}
+
+// ensure block buffers can hold _n time steps
+void FIRPFBCH2(_block_reserve)(FIRPFBCH2()  _q,
+                               unsigned int _n)
+{
+    if (_n <= _q->block_len)
+        return;
+
+    _q->block_len = _n;
+    _q->block = (T*) realloc(_q->block, _q->block_len*_q->M*sizeof(T));
+    unsigned int i;
+    for (i=0; i<_q->num_workers; i++)
+        _q->hist[i] = (T*) realloc(_q->hist[i], 4*(2*_q->m + _q->block_len)*sizeof(T));
+}
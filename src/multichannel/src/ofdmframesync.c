@@ -235,7 +235,7 @@ ofdmframesync ofdmframesync_create(unsigned int           _M,
     //
 
     // numerically-controlled oscillator
-    q->nco_rx = nco_crcf_create(LIQUID_NCO);
+    q->nco_rx = nco_crcf_create(LIQUID_NCO_HIRES);
 
     // set pilot sequence
     q->ms_pilot = msequence_create_default(8);
@@ -419,6 +419,24 @@ float ofdmframesync_get_cfo(ofdmframesync _q)
 // internal methods
 //
 
+// get complex subcarrier gain estimate
+//  _q      :   ofdmframesync object
+//  _G      :   output gain array [size: M x 1]
+void ofdmframesync_get_eqgain(ofdmframesync   _q,
+                              float complex * _G)
+{
+    memmove(_G, _q->G, _q->M*sizeof(float complex));
+}
+
+// set complex subcarrier gain estimate (e.g. before smoothing)
+//  _q      :   ofdmframesync object
+//  _G      :   input gain array [size: M x 1]
+void ofdmframesync_set_eqgain(ofdmframesync   _q,
+                              float complex * _G)
+{
+    memmove(_q->G, _G, _q->M*sizeof(float complex));
+}
+
 // frame detection
 void ofdmframesync_execute_seekplcp(ofdmframesync _q)
 {
@@ -861,45 +879,54 @@ void ofdmframesync_estimate_eqgain(ofdmframesync _q,
     }
 
     unsigned int i;
+    unsigned int M = _q->M;
 
-    // generate smoothing window (fft of temporal window)
-    for (i=0; i<_q->M; i++)
-        _q->x[i] = (i < _ntaps) ? 1.0f : 0.0f;
+    // The gains on the non-null subcarriers are smoothed by circular
+    // convolution with W, the transform of a rectangular temporal window
+    // of ntaps samples, and normalized by the same convolution of the
+    // non-null subcarrier mask:
+    //
+    //   G[i] = sum_j W[i-j] a[j] G0[j] / sum_j W[i-j] a[j]
+    //
+    // Because the transform of W is M times the time-reversed window,
+    // each convolution reduces to a forward transform, retaining bins k
+    // with (M-k) mod M < ntaps, and an inverse transform (computed with
+    // the forward plan as conj(fft(conj(.))), unnormalized).
+    memmove(_q->G0, _q->G, M*sizeof(float complex));
+
+    // numerator: convolve gains on non-null subcarriers
+    for (i=0; i<M; i++)
+        _q->x[i] = (_q->p[i] == OFDMFRAME_SCTYPE_NULL) ? 0.0f : _q->G0[i];
+    FFT_EXECUTE(_q->fft);
+    for (i=0; i<M; i++)
+        _q->x[i] = ((M-i)%M < _ntaps) ? conjf(_q->X[i]) : 0.0f;
     FFT_EXECUTE(_q->fft);
+    for (i=0; i<M; i++)
+        _q->G[i] = conjf(_q->X[i]);
 
-    memmove(_q->G0, _q->G, _q->M*sizeof(float complex));
+    // denominator: convolve non-null subcarrier mask
+    for (i=0; i<M; i++)
+        _q->x[i] = (_q->p[i] == OFDMFRAME_SCTYPE_NULL) ? 0.0f : 1.0f;
+    FFT_EXECUTE(_q->fft);
+    for (i=0; i<M; i++)
+        _q->x[i] = ((M-i)%M < _ntaps) ? conjf(_q->X[i]) : 0.0f;
+    FFT_EXECUTE(_q->fft);
 
-    // smooth complex equalizer gains
-    for (i=0; i<_q->M; i++) {
+    // normalize gains
+    for (i=0; i<M; i++) {
         // set gain to zero for null subcarriers
         if (_q->p[i] == OFDMFRAME_SCTYPE_NULL) {
             _q->G[i] = 0.0f;
             continue;
         }
 
-        float complex w;
-        float complex w0 = 0.0f;
-        float complex G_hat = 0.0f;
-
-        unsigned int j;
-        for (j=0; j<_q->M; j++) {
-            if (_q->p[j] == OFDMFRAME_SCTYPE_NULL) continue;
-
-            // select window sample from array
-            w = _q->X[(i + _q->M - j) % _q->M];
-
-            // accumulate gain
-            //G_hat += w * 0.5f * (_q->G0[j] + _q->G1[j]);
-            G_hat += w * _q->G0[j];
-            w0 += w;
-        }
-
         // eliminate divide-by-zero issues
+        float complex w0 = conjf(_q->X[i]);
         if (cabsf(w0) < 1e-4f) {
             fprintf(stderr,"error: ofdmframesync_estimate_eqgain(), weighting factor is zero\n");
             w0 = 1.0f;
         }
-        _q->G[i] = G_hat / w0;
+        _q->G[i] /= w0;
     }
 }
 
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// block sizes used to exercise channelizers (odd sizes toggle the
+// firpfbch2 alignment flag between calls)
+static unsigned int firpfbch_block_sizes[] = {1, 3, 8, 5, 16, 2, 7};
+#define FIRPFBCH_NUM_BLOCK_SIZES (sizeof(firpfbch_block_sizes)/sizeof(unsigned int))
+
+// Helper function to keep code base small: compare block execution of
+// firpfbch analyzer/synthesizer against serial execution
+void firpfbch_crcf_block_runtest(int          _type,
+                                 unsigned int _M,
+                                 unsigned int _m,
+                                 unsigned int _num_threads)
+{
+    float tol = 1e-5f;
+    unsigned int i, j;
+
+    // total number of blocks
+    unsigned int num_blocks = 0;
+    for (i=0; i<FIRPFBCH_NUM_BLOCK_SIZES; i++)
+        num_blocks += firpfbch_block_sizes[i];
+    unsigned int num_samples = num_blocks * _M;
+
+    // generate random input
+    float complex * x  = (float complex*) malloc(num_samples*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(num_samples*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(num_samples*sizeof(float complex));
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // create channelizers
+    firpfbch_crcf q0 = firpfbch_crcf_create_kaiser(_type, _M, _m, 60.0f);
+    firpfbch_crcf q1 = firpfbch_crcf_create_kaiser(_type, _M, _m, 60.0f);
+    firpfbch_crcf_set_num_threads(q1, _num_threads);
+
+    // run serial channelizer one block at a time
+    for (i=0; i<num_blocks; i++) {
+        if (_type == LIQUID_ANALYZER)
+            firpfbch_crcf_analyzer_execute(q0, &x[i*_M], &y0[i*_M]);
+        else
+            firpfbch_crcf_synthesizer_execute(q0, &x[i*_M], &y0[i*_M]);
+    }
+
+    // run block channelizer with varying block sizes
+    unsigned int n = 0;
+    for (i=0; i<FIRPFBCH_NUM_BLOCK_SIZES; i++) {
+        unsigned int b = firpfbch_block_sizes[i];
+        if (_type == LIQUID_ANALYZER)
+            firpfbch_crcf_analyzer_execute_block(q1, &x[n*_M], b, &y1[n*_M]);
+        else
+            firpfbch_crcf_synthesizer_execute_block(q1, &x[n*_M], b, &y1[n*_M]);
+        n += b;
+    }
+
+    // compare results
+    for (j=0; j<num_samples; j++) {
+        CONTEND_DELTA( crealf(y1[j]), crealf(y0[j]), tol );
+        CONTEND_DELTA( cimagf(y1[j]), cimagf(y0[j]), tol );
+    }
+
+    // clean up
+    firpfbch_crcf_destroy(q0);
+    firpfbch_crcf_destroy(q1);
+    free(x);
+    free(y0);
+    free(y1);
+}
+
+// Helper function to keep code base small: compare block execution of
+// firpfbch2 analyzer/synthesizer against serial execution
+void firpfbch2_crcf_block_runtest(int          _type,
+                                  unsigned int _M,
+                                  unsigned int _m,
+                                  unsigned int _num_threads)
+{
+    float tol = 1e-5f;
+    unsigned int i, j;
+
+    // input/output sizes for each block
+    unsigned int len_in  = _type == LIQUID_ANALYZER ? _M/2 : _M;
+    unsigned int len_out = _type == LIQUID_ANALYZER ? _M   : _M/2;
+
+    // total number of blocks
+    unsigned int num_blocks = 0;
+    for (i=0; i<FIRPFBCH_NUM_BLOCK_SIZES; i++)
+        num_blocks += firpfbch_block_sizes[i];
+
+    // generate random input
+    float complex * x  = (float complex*) malloc(num_blocks*len_in *sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(num_blocks*len_out*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(num_blocks*len_out*sizeof(float complex));
+    for (i=0; i<num_blocks*len_in; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // create channelizers
+    firpfbch2_crcf q0 = firpfbch2_crcf_create_kaiser(_type, _M, _m, 60.0f);
+    firpfbch2_crcf q1 = firpfbch2_crcf_create_kaiser(_type, _M, _m, 60.0f);
+    firpfbch2_crcf_set_num_threads(q1, _num_threads);
+
+    // run serial channelizer one block at a time
+    for (i=0; i<num_blocks; i++)
+        firpfbch2_crcf_execute(q0, &x[i*len_in], &y0[i*len_out]);
+
+    // run block channelizer with varying block sizes
+    unsigned int n = 0;
+    for (i=0; i<FIRPFBCH_NUM_BLOCK_SIZES; i++) {
+        unsigned int b = firpfbch_block_sizes[i];
+        firpfbch2_crcf_execute_block(q1, &x[n*len_in], b, &y1[n*len_out]);
+        n += b;
+    }
+
+    // compare results
+    for (j=0; j<num_blocks*len_out; j++) {
+        CONTEND_DELTA( crealf(y1[j]), crealf(y0[j]), tol );
+        CONTEND_DELTA( cimagf(y1[j]), cimagf(y0[j]), tol );
+    }
+
+    // clean up
+    firpfbch2_crcf_destroy(q0);
+    firpfbch2_crcf_destroy(q1);
+    free(x);
+    free(y0);
+    free(y1);
+}
+
+// firpfbch
+void autotest_firpfbch_crcf_block_analyzer_t1()     { firpfbch_crcf_block_runtest(LIQUID_ANALYZER,    16, 4, 1); }
+void autotest_firpfbch_crcf_block_analyzer_t4()     { firpfbch_crcf_block_runtest(LIQUID_ANALYZER,    16, 4, 4); }
+void autotest_firpfbch_crcf_block_synthesizer_t1()  { firpfbch_crcf_block_runtest(LIQUID_SYNTHESIZER, 16, 4, 1); }
+void autotest_firpfbch_crcf_block_synthesizer_t4()  { firpfbch_crcf_block_runtest(LIQUID_SYNTHESIZER, 16, 4, 4); }
+
+// firpfbch2
+void autotest_firpfbch2_crcf_block_analyzer_t1()    { firpfbch2_crcf_block_runtest(LIQUID_ANALYZER,    16, 4, 1); }
+void autotest_firpfbch2_crcf_block_analyzer_t4()    { firpfbch2_crcf_block_runtest(LIQUID_ANALYZER,    16, 4, 4); }
+void autotest_firpfbch2_crcf_block_synthesizer_t1() { firpfbch2_crcf_block_runtest(LIQUID_SYNTHESIZER, 16, 4, 1); }
+void autotest_firpfbch2_crcf_block_synthesizer_t4() { firpfbch2_crcf_block_runtest(LIQUID_SYNTHESIZER, 16, 4, 4); }
+
@@ -28,7 +28,7 @@
 #include <assert.h>
 
 #include "autotest/autotest.h"
-#include "liquid.h"
+#include "liquid.internal.h"
 
 
 // internal callback
@@ -143,3 +143,65 @@ void autotest_ofdmframesync_acquire_n128()  { ofdmframesync_acquire_test(128, 16
 void autotest_ofdmframesync_acquire_n256()  { ofdmframesync_acquire_test(256, 32, 0); }
 void autotest_ofdmframesync_acquire_n512()  { ofdmframesync_acquire_test(512, 64, 0); }
 
+// 
+// AUTOTEST: equalizer gain smoothing against direct computation of the
+// circular convolution with the transform of the temporal window
+//
+void ofdmframesync_eqgain_test(unsigned int _M,
+                               unsigned int _ntaps)
+{
+    float tol = 1e-3f;
+    unsigned int i, j, n;
+
+    // subcarrier allocation (initialize to default)
+    unsigned char p[_M];
+    ofdmframe_init_default_sctype(_M, p);
+    ofdmframesync fs = ofdmframesync_create(_M, _M/8, 0, p, NULL, NULL);
+
+    // random gains
+    float complex G0[_M];
+    float complex G[_M];
+    for (i=0; i<_M; i++)
+        G0[i] = randnf() + _Complex_I*randnf();
+    ofdmframesync_set_eqgain(fs, G0);
+    ofdmframesync_estimate_eqgain(fs, _ntaps);
+    ofdmframesync_get_eqgain(fs, G);
+
+    // smoothing window: transform of rectangular temporal window
+    double complex W[_M];
+    for (i=0; i<_M; i++) {
+        W[i] = 0.0;
+        for (n=0; n<_ntaps; n++)
+            W[i] += cexp(-_Complex_I*2*M_PI*(double)(i*n % _M)/(double)_M);
+    }
+
+    // direct O(M^2) smoothing over non-null subcarriers
+    for (i=0; i<_M; i++) {
+        if (p[i] == OFDMFRAME_SCTYPE_NULL) {
+            CONTEND_EQUALITY(crealf(G[i]), 0.0f);
+            CONTEND_EQUALITY(cimagf(G[i]), 0.0f);
+            continue;
+        }
+        double complex G_hat = 0.0;
+        double complex w0    = 0.0;
+        for (j=0; j<_M; j++) {
+            if (p[j] == OFDMFRAME_SCTYPE_NULL) continue;
+            double complex w = W[(i + _M - j) % _M];
+            G_hat += w * G0[j];
+            w0    += w;
+        }
+        if (cabs(w0) < 1e-4)
+            w0 = 1.0;
+        G_hat /= w0;
+        CONTEND_DELTA(crealf(G[i]), creal(G_hat), tol);
+        CONTEND_DELTA(cimagf(G[i]), cimag(G_hat), tol);
+    }
+
+    ofdmframesync_destroy(fs);
+}
+void autotest_ofdmframesync_eqgain_n16t1()     { ofdmframesync_eqgain_test(16,    1); }
+void autotest_ofdmframesync_eqgain_n64t8()     { ofdmframesync_eqgain_test(64,    8); }
+void autotest_ofdmframesync_eqgain_n64t64()    { ofdmframesync_eqgain_test(64,   64); }
+void autotest_ofdmframesync_eqgain_n100t13()   { ofdmframesync_eqgain_test(100,  13); }
+void autotest_ofdmframesync_eqgain_n256t2()    { ofdmframesync_eqgain_test(256,   2); }
+void autotest_ofdmframesync_eqgain_n1024t8()   { ofdmframesync_eqgain_test(1024,  8); }
@@ -33,6 +33,18 @@
 #define NCO_PLL_BANDWIDTH_DEFAULT   (0.1)
 #define NCO_PLL_GAIN_DEFAULT        (1000)
 
+// 32-bit phase accumulator units per radian, 2^32 / (2 pi)
+#define NCO_PHASE_SCALE             (683565275.576431632)
+
+// SSE3 block mixing is available only if the baseline architecture
+// supports it
+#if HAVE_PMMINTRIN_H && defined(__SSE3__)
+#  include <pmmintrin.h>
+#  define NCO_MIX_SSE 1
+#else
+#  define NCO_MIX_SSE 0
+#endif
+
 #define LIQUID_DEBUG_NCO            (0)
 
 struct NCO(_s) {
@@ -45,6 +57,10 @@ struct NCO(_s) {
     T cosine;
     void (*compute_sincos)(NCO() _q);
 
+    // 32-bit phase accumulator (LIQUID_NCO_HIRES)
+    uint32_t theta_u;   // phase
+    uint32_t d_theta_u; // frequency
+
     // phase-locked loop
     T alpha;
     T beta;
@@ -69,6 +85,8 @@ NCO() NCO(_create)(liquid_ncotype _type)
         q->compute_sincos = &NCO(_compute_sincos_nco);
     } else if (q->type == LIQUID_VCO) {
         q->compute_sincos = &NCO(_compute_sincos_vco);
+    } else if (q->type == LIQUID_NCO_HIRES) {
+        q->compute_sincos = &NCO(_compute_sincos_hires);
     } else {
         fprintf(stderr,"error: NCO(_create)(), unknown type : %u\n", q->type);
         exit(1);
@@ -90,6 +108,8 @@ void NCO(_reset)(NCO() _q)
 {
     _q->theta = 0;
     _q->d_theta = 0;
+    _q->theta_u = 0;
+    _q->d_theta_u = 0;
 
     // reset sine table index
     _q->index = 0;
@@ -107,6 +127,7 @@ void NCO(_set_frequency)(NCO() _q,
                          T _f)
 {
     _q->d_theta = _f;
+    _q->d_theta_u = NCO(_angle_to_phase)(_q->d_theta);
 }
 
 // adjust frequency of nco object
@@ -114,11 +135,16 @@ void NCO(_adjust_frequency)(NCO() _q,
                             T _df)
 {
     _q->d_theta += _df;
+    _q->d_theta_u = NCO(_angle_to_phase)(_q->d_theta);
 }
 
 // set phase of nco object, constraining phase
 void NCO(_set_phase)(NCO() _q, T _phi)
 {
+    if (_q->type == LIQUID_NCO_HIRES) {
+        _q->theta_u = NCO(_angle_to_phase)(_phi);
+        return;
+    }
     _q->theta = _phi;
     NCO(_constrain_phase)(_q);
 }
@@ -126,6 +152,10 @@ void NCO(_set_phase)(NCO() _q, T _phi)
 // adjust phase of nco object, constraining phase
 void NCO(_adjust_phase)(NCO() _q, T _dphi)
 {
+    if (_q->type == LIQUID_NCO_HIRES) {
+        _q->theta_u += NCO(_angle_to_phase)(_dphi);
+        return;
+    }
     _q->theta += _dphi;
     NCO(_constrain_phase)(_q);
 }
@@ -133,6 +163,11 @@ void NCO(_adjust_phase)(NCO() _q, T _dphi)
 // increment internal phase of nco object
 void NCO(_step)(NCO() _q)
 {
+    if (_q->type == LIQUID_NCO_HIRES) {
+        // accumulator wraps naturally at 2 pi
+        _q->theta_u += _q->d_theta_u;
+        return;
+    }
     _q->theta += _q->d_theta;
     NCO(_constrain_phase)(_q);
 }
@@ -140,6 +175,8 @@ void NCO(_step)(NCO() _q)
 // get phase
 T NCO(_get_phase)(NCO() _q)
 {
+    if (_q->type == LIQUID_NCO_HIRES)
+        return NCO(_phase_to_angle)(_q->theta_u);
     return _q->theta;
 }
 
@@ -266,7 +303,6 @@ void NCO(_mix_down)(NCO() _q,
 
 // Rotate input vector array up by NCO angle:
 //      y(t) = x(t) exp{+j (f*t + theta)}
-// TODO : implement NCO/VCO-specific versions
 //  _q      :   nco object
 //  _x      :   input array [size: _n x 1]
 //  _y      :   output sample [size: _n x 1]
@@ -276,34 +312,11 @@ void NCO(_mix_block_up)(NCO() _q,
                         TC *_y,
                         unsigned int _n)
 {
-    unsigned int i;
-    // FIXME: this method should be more efficient but is causing occasional
-    //        errors so instead favor slower but more reliable algorithm
-#if 0
-    T theta =   _q->theta;
-    T d_theta = _q->d_theta;
-    for (i=0; i<_n; i++) {
-        // multiply _x[i] by [cos(theta) + _Complex_I*sin(theta)]
-        _y[i] = _x[i] * liquid_cexpjf(theta);
-        
-        theta += d_theta;
-    }
-
-    NCO(_set_phase)(_q, theta);
-#else
-    for (i=0; i<_n; i++) {
-        // mix single sample up
-        NCO(_mix_up)(_q, _x[i], &_y[i]);
-
-        // step NCO phase
-        NCO(_step)(_q);
-    }
-#endif
+    NCO(_mix_block)(_q, _x, _y, _n, 0);
 }
 
 // Rotate input vector array down by NCO angle:
 //      y(t) = x(t) exp{-j (f*t + theta)}
-// TODO : implement NCO/VCO-specific versions
 //  _q      :   nco object
 //  _x      :   input array [size: _n x 1]
 //  _y      :   output sample [size: _n x 1]
@@ -313,29 +326,7 @@ void NCO(_mix_block_down)(NCO() _q,
                           TC *_y,
                           unsigned int _n)
 {
-    unsigned int i;
-    // FIXME: this method should be more efficient but is causing occasional
-    //        errors so instead favor slower but more reliable algorithm
-#if 0
-    T theta =   _q->theta;
-    T d_theta = _q->d_theta;
-    for (i=0; i<_n; i++) {
-        // multiply _x[i] by [cos(-theta) + _Complex_I*sin(-theta)]
-        _y[i] = _x[i] * liquid_cexpjf(-theta);
-        
-        theta += d_theta;
-    }
-
-    NCO(_set_phase)(_q, theta);
-#else
-    for (i=0; i<_n; i++) {
-        // mix single sample down
-        NCO(_mix_down)(_q, _x[i], &_y[i]);
-
-        // step NCO phase
-        NCO(_step)(_q);
-    }
-#endif
+    NCO(_mix_block)(_q, _x, _y, _n, 1);
 }
 
 //
@@ -383,3 +374,135 @@ void NCO(_compute_sincos_vco)(NCO() _q)
     _q->cosine = COS(_q->theta);
 }
 
+// compute sin, cos of internal phase of high-resolution nco from
+// the sine table with third-order Taylor correction:
+//   sin(t0+d) = sin(t0)(1 - d^2/2) + cos(t0)(d - d^3/6)
+//   cos(t0+d) = cos(t0)(1 - d^2/2) - sin(t0)(d - d^3/6)
+// where t0 is the table phase (upper 8 bits of accumulator) and
+// 0 <= d < 2 pi/256 is the residual; worst-case error ~d^4/24 < 2e-8
+void NCO(_compute_sincos_hires)(NCO() _q)
+{
+    unsigned int index = _q->theta_u >> 24;
+    T d  = (T)(_q->theta_u & 0x00ffffff) * (T)(1.0 / NCO_PHASE_SCALE);
+    T d2 = d*d;
+    T a  = 1 - 0.5f*d2;
+    T b  = d*(1 - d2*(1.0f/6.0f));
+    T s  = _q->sintab[index];
+    T c  = _q->sintab[(index+64)&0xff];
+
+    _q->sine   = s*a + c*b;
+    _q->cosine = c*a - s*b;
+}
+
+// convert angle [radians] to 32-bit phase accumulator units
+uint32_t NCO(_angle_to_phase)(T _theta)
+{
+    // reduce to (-2 pi, 2 pi) and scale; wraps modulo 2^32
+    double theta = fmod((double)_theta, 2*M_PI);
+    return (uint32_t)(int64_t)llrint(theta * NCO_PHASE_SCALE);
+}
+
+// convert 32-bit phase accumulator units to angle in [-pi,pi)
+T NCO(_phase_to_angle)(uint32_t _theta)
+{
+    return (T)((double)(int32_t)_theta / NCO_PHASE_SCALE);
+}
+
+// rotate input vector array by oscillator phase, stepping the
+// oscillator once per sample; every oscillator type runs on the
+// 32-bit phase accumulator with the high-resolution sine/cosine
+//  _q      :   nco object
+//  _x      :   input array [size: _n x 1]
+//  _y      :   output array [size: _n x 1], may be the same as _x
+//  _n      :   number of input, output samples
+//  _down   :   rotate down (conjugate phasor)?
+void NCO(_mix_block)(NCO()        _q,
+                     TC *         _x,
+                     TC *         _y,
+                     unsigned int _n,
+                     int          _down)
+{
+    // phase accumulator state
+    uint32_t theta   = _q->type == LIQUID_NCO_HIRES ? _q->theta_u :
+                                                      NCO(_angle_to_phase)(_q->theta);
+    uint32_t d_theta = _q->d_theta_u;
+
+    // sine sign for mixing direction
+    T sgn = _down ? -1.0f : 1.0f;
+
+    const T *   tab = _q->sintab;
+    const T *   x   = (const T*) _x;
+    T *         y   = (T*) _y;
+    unsigned int i = 0;
+
+#if NCO_MIX_SSE
+    // four samples per iteration: phases, table look-up, Taylor
+    // correction, and complex multiply all in SSE registers
+    __m128i vtheta = _mm_setr_epi32(theta, theta+d_theta, theta+2*d_theta, theta+3*d_theta);
+    __m128i vstep  = _mm_set1_epi32((int)(4*d_theta));
+    __m128i vmask  = _mm_set1_epi32(0x00ffffff);
+    __m128  vscale = _mm_set1_ps((float)(1.0 / NCO_PHASE_SCALE));
+    __m128  vhalf  = _mm_set1_ps(0.5f);
+    __m128  vsixth = _mm_set1_ps(1.0f/6.0f);
+    __m128  vone   = _mm_set1_ps(1.0f);
+    __m128  vsgn   = _mm_set1_ps(sgn);
+    for ( ; i+4 <= _n; i+=4) {
+        // table indices and residual phase
+        uint32_t idx[4];
+        _mm_storeu_si128((__m128i*)idx, _mm_srli_epi32(vtheta, 24));
+        __m128 d  = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(vtheta, vmask)), vscale);
+        __m128 s0 = _mm_setr_ps(tab[idx[0]], tab[idx[1]], tab[idx[2]], tab[idx[3]]);
+        __m128 c0 = _mm_setr_ps(tab[(idx[0]+64)&0xff], tab[(idx[1]+64)&0xff],
+                                tab[(idx[2]+64)&0xff], tab[(idx[3]+64)&0xff]);
+        vtheta = _mm_add_epi32(vtheta, vstep);
+
+        // Taylor correction
+        __m128 d2 = _mm_mul_ps(d, d);
+        __m128 a  = _mm_sub_ps(vone, _mm_mul_ps(vhalf, d2));
+        __m128 b  = _mm_mul_ps(d, _mm_sub_ps(vone, _mm_mul_ps(d2, vsixth)));
+        __m128 c  = _mm_sub_ps(_mm_mul_ps(c0, a), _mm_mul_ps(s0, b));
+        __m128 s  = _mm_mul_ps(vsgn, _mm_add_ps(_mm_mul_ps(s0, a), _mm_mul_ps(c0, b)));
+
+        // interleave phasors: [c0 s0 c1 s1], [c2 s2 c3 s3]
+        __m128 p0 = _mm_unpacklo_ps(c, s);
+        __m128 p1 = _mm_unpackhi_ps(c, s);
+
+        // complex multiply: re = xr*pr - xi*pi, im = xi*pr + xr*pi
+        __m128 x0 = _mm_loadu_ps(&x[2*i  ]);
+        __m128 x1 = _mm_loadu_ps(&x[2*i+4]);
+        __m128 y0 = _mm_addsub_ps(_mm_mul_ps(x0, _mm_moveldup_ps(p0)),
+                                  _mm_mul_ps(_mm_shuffle_ps(x0, x0, _MM_SHUFFLE(2,3,0,1)),
+                                             _mm_movehdup_ps(p0)));
+        __m128 y1 = _mm_addsub_ps(_mm_mul_ps(x1, _mm_moveldup_ps(p1)),
+                                  _mm_mul_ps(_mm_shuffle_ps(x1, x1, _MM_SHUFFLE(2,3,0,1)),
+                                             _mm_movehdup_ps(p1)));
+        _mm_storeu_ps(&y[2*i  ], y0);
+        _mm_storeu_ps(&y[2*i+4], y1);
+    }
+    theta += i*d_theta;
+#endif
+
+    // remaining samples
+    for ( ; i<_n; i++) {
+        unsigned int index = theta >> 24;
+        T d  = (T)(theta & 0x00ffffff) * (T)(1.0 / NCO_PHASE_SCALE);
+        T d2 = d*d;
+        T a  = 1 - 0.5f*d2;
+        T b  = d*(1 - d2*(1.0f/6.0f));
+        T s0 = tab[index];
+        T c0 = tab[(index+64)&0xff];
+        T c  = c0*a - s0*b;
+        T s  = sgn*(s0*a + c0*b);
+        T xr = x[2*i  ];
+        T xi = x[2*i+1];
+        y[2*i  ] = xr*c - xi*s;
+        y[2*i+1] = xi*c + xr*s;
+        theta += d_theta;
+    }
+
+    // store resulting phase
+    if (_q->type == LIQUID_NCO_HIRES)
+        _q->theta_u = theta;
+    else
+        _q->theta = NCO(_phase_to_angle)(theta);
+}
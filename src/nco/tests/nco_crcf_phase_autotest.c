@@ -21,6 +21,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <complex.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
@@ -112,6 +113,34 @@ void autotest_vco_crcf_phase()
     nco_crcf_phase_test( 6.283185307f,  1.000000000f, -0.000000000f, LIQUID_VCO, tol);
 }
 
+// test high-resolution nco phase
+void autotest_nco_hires_crcf_phase()
+{
+    // error tolerance
+    float tol = 0.00001f;
+
+    nco_crcf_phase_test(-6.283185307f,  1.000000000f,  0.000000000f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test(-6.195739393f,  0.996179042f,  0.087334510f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test(-5.951041106f,  0.945345356f,  0.326070787f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test(-5.131745978f,  0.407173250f,  0.913350943f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test(-4.748043551f,  0.035647016f,  0.999364443f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test(-3.041191113f, -0.994963998f, -0.100232943f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test(-1.947799864f, -0.368136099f, -0.929771914f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test(-1.143752030f,  0.414182352f, -0.910193924f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test(-1.029377689f,  0.515352252f, -0.856978446f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test(-0.174356887f,  0.984838307f, -0.173474811f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test(-0.114520496f,  0.993449692f, -0.114270338f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test( 0.000000000f,  1.000000000f,  0.000000000f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test( 1.436080000f,  0.134309213f,  0.990939471f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test( 2.016119855f, -0.430749878f,  0.902471353f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test( 2.996498473f, -0.989492293f,  0.144585621f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test( 3.403689755f, -0.965848729f, -0.259106603f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test( 3.591162483f, -0.900634128f, -0.434578148f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test( 5.111428476f,  0.388533479f, -0.921434607f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test( 5.727585681f,  0.849584319f, -0.527452828f, LIQUID_NCO_HIRES, tol);
+    nco_crcf_phase_test( 6.283185307f,  1.000000000f, -0.000000000f, LIQUID_NCO_HIRES, tol);
+}
+
 //
 // test floating point precision nco
 //
@@ -258,3 +287,117 @@ void autotest_nco_block_mixing()
     nco_crcf_destroy(p);
 }
 
+// test high-resolution nco accuracy over a long run against
+// double-precision reference
+void autotest_nco_hires_accuracy()
+{
+    // error tolerance (~100 dB)
+    float tol = 1e-5f;
+
+    unsigned int i;
+    unsigned int num_samples = 100000;
+
+    // irrational-ish frequency to exercise all residual phases
+    float f = 0.0123456789f * 2.0f * M_PI;
+
+    nco_crcf p = nco_crcf_create(LIQUID_NCO_HIRES);
+    nco_crcf_set_frequency(p, f);
+
+    // reference uses quantized frequency: phase step is an exact
+    // integer number of accumulator units
+    double dphi = nco_crcf_get_frequency(p);
+    uint32_t step = (uint32_t)(int64_t)llrint(fmod(dphi, 2*M_PI) * 4294967296.0 / (2*M_PI));
+    uint32_t theta = 0;
+
+    float s, c;
+    float max_err = 0.0f;
+    for (i=0; i<num_samples; i++) {
+        nco_crcf_sincos(p, &s, &c);
+        double phi = (double)theta * 2*M_PI / 4294967296.0;
+        float err_s = fabsf(s - (float)sin(phi));
+        float err_c = fabsf(c - (float)cos(phi));
+        if (err_s > max_err) max_err = err_s;
+        if (err_c > max_err) max_err = err_c;
+        nco_crcf_step(p);
+        theta += step;
+    }
+
+    if (liquid_autotest_verbose)
+        printf("nco hires max error : %12.4e (%8.2f dB)\n", max_err, 20*log10f(max_err));
+    CONTEND_LESS_THAN( max_err, tol );
+
+    // phase should match accumulated value
+    CONTEND_DELTA( nco_crcf_get_phase(p),
+                   (float)((double)(int32_t)theta * 2*M_PI / 4294967296.0), 1e-6f );
+
+    nco_crcf_destroy(p);
+}
+
+// compare block mixing against per-sample mixing for each oscillator type
+void nco_crcf_block_mixing_test(int _type, float _tol)
+{
+    // frequency, phase
+    float f   = -0.7312f;
+    float phi = 1.234f;
+
+    unsigned int i;
+    unsigned int num_samples = 259;
+
+    float complex * x  = (float complex*)malloc(num_samples*sizeof(float complex));
+    float complex * y0 = (float complex*)malloc(num_samples*sizeof(float complex));
+    float complex * y1 = (float complex*)malloc(num_samples*sizeof(float complex));
+    for (i=0; i<num_samples; i++)
+        x[i] = cosf(0.1f*i) + _Complex_I*sinf(0.37f*i + 0.2f);
+
+    nco_crcf p0 = nco_crcf_create(_type);
+    nco_crcf p1 = nco_crcf_create(_type);
+    nco_crcf_set_frequency(p0, f);
+    nco_crcf_set_frequency(p1, f);
+    nco_crcf_set_phase(p0, phi);
+    nco_crcf_set_phase(p1, phi);
+
+    // up: per-sample reference, block in uneven pieces
+    for (i=0; i<num_samples; i++) {
+        nco_crcf_mix_up(p0, x[i], &y0[i]);
+        nco_crcf_step(p0);
+    }
+    nco_crcf_mix_block_up(p1, &x[  0], &y1[  0],  13);
+    nco_crcf_mix_block_up(p1, &x[ 13], &y1[ 13], 200);
+    nco_crcf_mix_block_up(p1, &x[213], &y1[213],  46);
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), _tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), _tol );
+    }
+
+    // down, continuing from current phase
+    for (i=0; i<num_samples; i++) {
+        nco_crcf_mix_down(p0, x[i], &y0[i]);
+        nco_crcf_step(p0);
+    }
+    nco_crcf_mix_block_down(p1, x, y1, num_samples);
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), _tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), _tol );
+    }
+
+    // in-place operation
+    memmove(y1, x, num_samples*sizeof(float complex));
+    nco_crcf_set_phase(p1, phi);
+    nco_crcf_mix_block_up(p1, y1, y1, num_samples);
+    nco_crcf_set_phase(p1, phi);
+    nco_crcf_mix_block_up(p1, x, y0, num_samples);
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), 1e-6f );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), 1e-6f );
+    }
+
+    free(x);
+    free(y0);
+    free(y1);
+    nco_crcf_destroy(p0);
+    nco_crcf_destroy(p1);
+}
+
+void autotest_nco_block_mixing_nco()   { nco_crcf_block_mixing_test(LIQUID_NCO,       0.05f); }
+void autotest_nco_block_mixing_vco()   { nco_crcf_block_mixing_test(LIQUID_VCO,       1e-3f); }
+void autotest_nco_block_mixing_hires() { nco_crcf_block_mixing_test(LIQUID_NCO_HIRES, 1e-5f); }
@@ -145,3 +145,30 @@ void autotest_nco_crcf_pll_phase()
     nco_crcf_pll_test(LIQUID_VCO,  0.0f,       1.6f, 0.1f, 256, tol);
 }
 
+//
+// AUTOTEST: test frequency and phase offsets
+//
+void autotest_nco_hires_crcf_pll_phase()
+{
+    float tol = 1e-4f;
+
+    // test various phase offsets
+    nco_crcf_pll_test(LIQUID_NCO_HIRES, -M_PI/1.1f,  0.0f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES, -M_PI/2.0f,  0.0f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES, -M_PI/4.0f,  0.0f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES, -M_PI/8.0f,  0.0f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  M_PI/8.0f,  0.0f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  M_PI/4.0f,  0.0f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  M_PI/2.0f,  0.0f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  M_PI/1.1f,  0.0f, 0.1f, 256, tol);
+    
+    // test various frequency offsets
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  0.0f,      -1.6f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  0.0f,      -0.8f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  0.0f,      -0.4f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  0.0f,      -0.2f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  0.0f,       0.2f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  0.0f,       0.4f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  0.0f,       0.8f, 0.1f, 256, tol);
+    nco_crcf_pll_test(LIQUID_NCO_HIRES,  0.0f,       1.6f, 0.1f, 256, tol);
+}
@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdio.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -153,3 +154,66 @@ void benchmark_random_ricek(struct rusage *_start,
     *_num_iterations *= 4;
 }
 
+
+// 
+// BENCHMARK: randgen object, scalar and block generation
+//
+
+#define RANDGEN_BENCH_API(TYPE,BLOCK)                   \
+(   struct rusage *_start,                              \
+    struct rusage *_finish,                             \
+    unsigned long int *_num_iterations)                 \
+{ randgen_bench(_start, _finish, _num_iterations, TYPE, BLOCK); }
+
+// Helper function to keep code base small
+//  _type   :   0 (uniform), 1 (Gauss), 2 (complex Gauss)
+//  _block  :   block length (0 for scalar calls)
+void randgen_bench(struct rusage *     _start,
+                   struct rusage *     _finish,
+                   unsigned long int * _num_iterations,
+                   int                 _type,
+                   unsigned int        _block)
+{
+    randgen q = randgen_create(1);
+    float         x[1024];
+    float complex y[1024];
+    float complex v;
+    float acc = 0.0f;
+    unsigned long int i;
+
+    // normalize number of iterations (one trial per sample)
+    *_num_iterations *= 10;
+    unsigned long int num_calls = _block == 0 ? *_num_iterations : *_num_iterations / _block;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<num_calls; i++) {
+        switch (_type) {
+        case 0:
+            if (_block) randgen_randf_block(q, x, _block);
+            else        acc += randgen_randf(q);
+            break;
+        case 1:
+            if (_block) randgen_randnf_block(q, x, _block);
+            else        acc += randgen_randnf(q);
+            break;
+        default:
+            if (_block) randgen_crandnf_block(q, y, _block);
+            else      { randgen_crandnf(q, &v); acc += crealf(v); }
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = _block == 0 ? num_calls : num_calls * _block;
+
+    // keep result live
+    if (acc == 1.234f) printf("%f\n", acc + x[0] + crealf(y[0]));
+    randgen_destroy(q);
+}
+
+void benchmark_randgen_uniform              RANDGEN_BENCH_API(0,    0)
+void benchmark_randgen_uniform_block1024    RANDGEN_BENCH_API(0, 1024)
+void benchmark_randgen_normal               RANDGEN_BENCH_API(1,    0)
+void benchmark_randgen_normal_block1024     RANDGEN_BENCH_API(1, 1024)
+void benchmark_randgen_complex_normal       RANDGEN_BENCH_API(2,    0)
+void benchmark_randgen_complex_normal_block1024 RANDGEN_BENCH_API(2, 1024)
+
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// randgen.c : random number generator object
+//
+// Per-instance generator state for thread-safe, fast block generation.
+// Uniform integers come from eight interleaved xoshiro128+ streams so a
+// single step produces eight outputs with independent lanes that the
+// compiler maps onto SIMD registers; outputs are consumed in lane order,
+// so block fills and repeated scalar calls produce the same sequence.
+// Gauss variates use the Ziggurat method (Marsaglia & Tsang, 2000) with
+// 128 layers, drawing the layer index and the value from disjoint bits
+// (Doornik, 2005).
+//
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+// number of interleaved streams
+#define RANDGEN_LANES   (8)
+
+// number of samples per pass in block Gauss generation
+#define RANDGEN_BLOCK   (256)
+
+// number of Ziggurat layers and right-most layer boundary
+#define RANDGEN_ZIG_N   (128)
+#define RANDGEN_ZIG_R   (3.442619855899)
+#define RANDGEN_ZIG_V   (9.91256303526217e-3)
+
+struct randgen_s {
+    // xoshiro128+ state, lane-major [size: 4 x RANDGEN_LANES]
+    uint32_t s0[RANDGEN_LANES];
+    uint32_t s1[RANDGEN_LANES];
+    uint32_t s2[RANDGEN_LANES];
+    uint32_t s3[RANDGEN_LANES];
+
+    // buffered outputs of most recent step
+    uint32_t     buf[RANDGEN_LANES];
+    unsigned int buf_index;     // next unread output in buffer
+
+    // Ziggurat tables
+    uint32_t kn[RANDGEN_ZIG_N]; // fast-path acceptance thresholds
+    float    wn[RANDGEN_ZIG_N]; // layer widths (scaled by 2^-31)
+    float    fn[RANDGEN_ZIG_N]; // density at layer boundaries
+
+    uint64_t seed;              // seed value
+};
+
+// advance all streams by one step, writing outputs to _y
+static inline void randgen_step(randgen    _q,
+                                uint32_t * _y)
+{
+    unsigned int i;
+    for (i=0; i<RANDGEN_LANES; i++) {
+        uint32_t s0 = _q->s0[i];
+        uint32_t s1 = _q->s1[i];
+        uint32_t s2 = _q->s2[i];
+        uint32_t s3 = _q->s3[i];
+        _y[i] = s0 + s3;
+        uint32_t t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = (s3 << 11) | (s3 >> 21);
+        _q->s0[i] = s0;
+        _q->s1[i] = s1;
+        _q->s2[i] = s2;
+        _q->s3[i] = s3;
+    }
+}
+
+// next 32-bit output in sequence
+static inline uint32_t randgen_next(randgen _q)
+{
+    if (_q->buf_index == RANDGEN_LANES) {
+        randgen_step(_q, _q->buf);
+        _q->buf_index = 0;
+    }
+    return _q->buf[_q->buf_index++];
+}
+
+// uniform in [0,1) from upper 24 bits
+static inline float randgen_u2f(uint32_t _u)
+{
+    return (float)(_u >> 8) * 0x1.0p-24f;
+}
+
+// uniform in (0,1) for logarithms in the Ziggurat tail
+static inline float randgen_u2f_open(uint32_t _u)
+{
+    return ((float)(_u >> 8) + 0.5f) * 0x1.0p-24f;
+}
+
+// splitmix64 generator used to expand seed into stream states
+static uint64_t randgen_splitmix64(uint64_t * _x)
+{
+    uint64_t z = (*_x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Ziggurat outside fast path: tail (layer 0) or wedge test for value
+// drawn from _u, continuing with new draws on rejection
+static float randgen_zig_slow(randgen  _q,
+                              uint32_t _u)
+{
+    while (1) {
+        unsigned int iz = _u & (RANDGEN_ZIG_N-1);
+        int32_t      hz = (int32_t)(_u & ~(uint32_t)(RANDGEN_ZIG_N-1));
+        uint32_t     az = hz < 0 ? -(uint32_t)hz : (uint32_t)hz;
+
+        // fast path: inside rectangle
+        float x = (float)hz * _q->wn[iz];
+        if (az < _q->kn[iz])
+            return x;
+
+        if (iz == 0) {
+            // base layer: sample from tail beyond R
+            float xt, yt;
+            do {
+                xt = -logf(randgen_u2f_open(randgen_next(_q))) / (float)RANDGEN_ZIG_R;
+                yt = -logf(randgen_u2f_open(randgen_next(_q)));
+            } while (yt + yt < xt*xt);
+            return hz > 0 ? (float)RANDGEN_ZIG_R + xt : -(float)RANDGEN_ZIG_R - xt;
+        }
+
+        // wedge: accept with probability of density under curve
+        float v = randgen_u2f(randgen_next(_q));
+        if (_q->fn[iz] + v*(_q->fn[iz-1] - _q->fn[iz]) < expf(-0.5f*x*x))
+            return x;
+
+        _u = randgen_next(_q);
+    }
+}
+
+// Gauss variate from Ziggurat; the low seven bits select the layer and
+// the upper 25 bits (as a signed 32-bit value) the abscissa
+static inline float randgen_zig(randgen _q)
+{
+    return randgen_zig_slow(_q, randgen_next(_q));
+}
+
+// create random number generator object
+//  _seed   :   seed value
+randgen randgen_create(uint64_t _seed)
+{
+    randgen q = (randgen) malloc(sizeof(struct randgen_s));
+
+    // compute Ziggurat tables
+    double m1 = 2147483648.0;   // 2^31
+    double dn = RANDGEN_ZIG_R;
+    double tn = dn;
+    double vn = RANDGEN_ZIG_V;
+    double r  = vn / exp(-0.5*dn*dn);
+    q->kn[0] = (uint32_t)((dn/r)*m1);
+    q->kn[1] = 0;
+    q->wn[0] = (float)(r/m1);
+    q->wn[RANDGEN_ZIG_N-1] = (float)(dn/m1);
+    q->fn[0] = 1.0f;
+    q->fn[RANDGEN_ZIG_N-1] = (float)exp(-0.5*dn*dn);
+    int i;
+    for (i=RANDGEN_ZIG_N-2; i>=1; i--) {
+        dn = sqrt(-2.0*log(vn/dn + exp(-0.5*dn*dn)));
+        q->kn[i+1] = (uint32_t)((dn/tn)*m1);
+        tn = dn;
+        q->fn[i] = (float)exp(-0.5*dn*dn);
+        q->wn[i] = (float)(dn/m1);
+    }
+
+    // seed generator and return
+    randgen_seed(q, _seed);
+    return q;
+}
+
+// destroy random number generator object
+void randgen_destroy(randgen _q)
+{
+    free(_q);
+}
+
+// print random number generator object
+void randgen_print(randgen _q)
+{
+    printf("randgen [xoshiro128+ x %u, seed=0x%.16llx]\n",
+            RANDGEN_LANES, (unsigned long long int)_q->seed);
+}
+
+// re-seed generator, resetting its sequence
+//  _q      :   random number generator object
+//  _seed   :   seed value
+void randgen_seed(randgen  _q,
+                  uint64_t _seed)
+{
+    _q->seed = _seed;
+
+    // expand seed into stream states; all-zero state is invalid
+    uint64_t x = _seed;
+    unsigned int i;
+    for (i=0; i<RANDGEN_LANES; i++) {
+        uint64_t a = randgen_splitmix64(&x);
+        uint64_t b = randgen_splitmix64(&x);
+        _q->s0[i] = (uint32_t)(a      );
+        _q->s1[i] = (uint32_t)(a >> 32);
+        _q->s2[i] = (uint32_t)(b      );
+        _q->s3[i] = (uint32_t)(b >> 32);
+        if ((a | b) == 0)
+            _q->s0[i] = 1;
+    }
+    _q->buf_index = RANDGEN_LANES;
+}
+
+// generate uniform 32-bit integer
+uint32_t randgen_uint32(randgen _q)
+{
+    return randgen_next(_q);
+}
+
+// generate uniform random number in [0,1)
+float randgen_randf(randgen _q)
+{
+    return randgen_u2f(randgen_next(_q));
+}
+
+// generate Gauss random number, N(0,1)
+float randgen_randnf(randgen _q)
+{
+    return randgen_zig(_q);
+}
+
+// generate complex Gauss random number, each component N(0,1)
+//  _q      :   random number generator object
+//  _y      :   output sample pointer
+void randgen_crandnf(randgen         _q,
+                     float complex * _y)
+{
+    float yi = randgen_zig(_q);
+    float yq = randgen_zig(_q);
+    *_y = yi + _Complex_I*yq;
+}
+
+// fill array with uniform random numbers in [0,1)
+//  _q      :   random number generator object
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of samples
+void randgen_randf_block(randgen      _q,
+                         float *      _y,
+                         unsigned int _n)
+{
+    unsigned int i = 0;
+
+    // consume buffered outputs
+    while (i < _n && _q->buf_index < RANDGEN_LANES)
+        _y[i++] = randgen_u2f(_q->buf[_q->buf_index++]);
+
+    // full steps directly to output
+    uint32_t u[RANDGEN_LANES];
+    unsigned int k;
+    for ( ; i + RANDGEN_LANES <= _n; i += RANDGEN_LANES) {
+        randgen_step(_q, u);
+        for (k=0; k<RANDGEN_LANES; k++)
+            _y[i+k] = randgen_u2f(u[k]);
+    }
+
+    // remainder
+    for ( ; i<_n; i++)
+        _y[i] = randgen_randf(_q);
+}
+
+// fill array with Gauss random numbers, N(0,1); values are generated in
+// two passes (uniform draws and rectangle test for the whole block, then
+// the rare rejections) so the sequence differs from repeated calls to
+// randgen_randnf() but is reproducible for a given seed and call pattern
+//  _q      :   random number generator object
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of samples
+void randgen_randnf_block(randgen      _q,
+                          float *      _y,
+                          unsigned int _n)
+{
+    uint32_t     u  [RANDGEN_BLOCK];
+    unsigned int rej[RANDGEN_BLOCK];
+    unsigned int i, k;
+    while (_n > 0) {
+        unsigned int n = _n < RANDGEN_BLOCK ? _n : RANDGEN_BLOCK;
+
+        // uniform draws
+        i = 0;
+        while (i < n && _q->buf_index < RANDGEN_LANES)
+            u[i++] = _q->buf[_q->buf_index++];
+        for ( ; i + RANDGEN_LANES <= n; i += RANDGEN_LANES)
+            randgen_step(_q, &u[i]);
+        for ( ; i<n; i++)
+            u[i] = randgen_next(_q);
+
+        // fast path for all samples, recording rejections
+        unsigned int num_rej = 0;
+        for (i=0; i<n; i++) {
+            unsigned int iz = u[i] & (RANDGEN_ZIG_N-1);
+            int32_t      hz = (int32_t)(u[i] & ~(uint32_t)(RANDGEN_ZIG_N-1));
+            uint32_t     az = hz < 0 ? -(uint32_t)hz : (uint32_t)hz;
+            _y[i] = (float)hz * _q->wn[iz];
+            rej[num_rej] = i;
+            num_rej += az >= _q->kn[iz];
+        }
+
+        // resolve rejections
+        for (k=0; k<num_rej; k++)
+            _y[rej[k]] = randgen_zig_slow(_q, u[rej[k]]);
+
+        _y += n;
+        _n -= n;
+    }
+}
+
+// fill array with complex Gauss random numbers, each component N(0,1)
+//  _q      :   random number generator object
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of samples
+void randgen_crandnf_block(randgen         _q,
+                           float complex * _y,
+                           unsigned int    _n)
+{
+    randgen_randnf_block(_q, (float*)_y, 2*_n);
+}
+
+
+// draw seed for randgen object from global rand() state
+uint64_t liquid_randgen_seed_rand()
+{
+    // RAND_MAX is only guaranteed to span 15 bits
+    uint64_t seed = 0;
+    unsigned int i;
+    for (i=0; i<5; i++)
+        seed = (seed << 15) ^ (uint64_t)(rand() & 0x7fff);
+    return seed;
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+#define LIQUID_RANDGEN_AUTOTEST_NUM_TRIALS (200000)
+
+// uniform: moments and range
+void autotest_randgen_randf()
+{
+    unsigned int N = LIQUID_RANDGEN_AUTOTEST_NUM_TRIALS;
+    unsigned int i;
+    float x[N];
+    randgen q = randgen_create(1);
+    randgen_randf_block(q, x, N);
+    randgen_destroy(q);
+
+    double m1=0, m2=0;
+    float  xmin=1, xmax=0;
+    for (i=0; i<N; i++) {
+        m1 += x[i];
+        m2 += x[i]*x[i];
+        xmin = x[i] < xmin ? x[i] : xmin;
+        xmax = x[i] > xmax ? x[i] : xmax;
+    }
+    m1 /= (double)N;
+    m2 = m2 / (double)N - m1*m1;
+
+    CONTEND_DELTA(m1, 0.5,      0.01);
+    CONTEND_DELTA(m2, 1/12.0,   0.01);
+    CONTEND_GREATER_THAN(xmin, -1e-12f);
+    CONTEND_LESS_THAN   (xmax,  1.0f);
+}
+
+// Gauss: moments and tail probability
+void autotest_randgen_randnf()
+{
+    unsigned int N = LIQUID_RANDGEN_AUTOTEST_NUM_TRIALS;
+    unsigned int i;
+    float x[N];
+    randgen q = randgen_create(2);
+    randgen_randnf_block(q, x, N);
+    randgen_destroy(q);
+
+    double m1=0, m2=0, m3=0, m4=0;
+    unsigned int num_tail = 0;
+    for (i=0; i<N; i++) {
+        double v = x[i];
+        m1 += v;
+        m2 += v*v;
+        m3 += v*v*v;
+        m4 += v*v*v*v;
+        num_tail += fabsf(x[i]) > 3.0f;
+    }
+    m1 /= (double)N;
+    m2 /= (double)N;
+    m3 /= (double)N;
+    m4 /= (double)N;
+    float p_tail = (float)num_tail / (float)N;
+
+    if (liquid_autotest_verbose)
+        printf("randgen_randnf: m1=%8.5f, m2=%8.5f, m3=%8.5f, m4=%8.5f, P(|x|>3)=%10.3e\n",
+                m1, m2, m3, m4, p_tail);
+
+    CONTEND_DELTA(m1, 0.0, 0.01);
+    CONTEND_DELTA(m2, 1.0, 0.02);
+    CONTEND_DELTA(m3, 0.0, 0.05);
+    CONTEND_DELTA(m4, 3.0, 0.1);
+    CONTEND_DELTA(p_tail, 2.6998e-3f, 0.4e-3f);
+}
+
+// complex Gauss: unit-variance components, uncorrelated
+void autotest_randgen_crandnf()
+{
+    unsigned int N = LIQUID_RANDGEN_AUTOTEST_NUM_TRIALS / 2;
+    unsigned int i;
+    float complex x[N];
+    randgen q = randgen_create(3);
+    randgen_crandnf_block(q, x, N);
+    randgen_destroy(q);
+
+    double mi=0, mq=0, vi=0, vq=0, ciq=0;
+    for (i=0; i<N; i++) {
+        mi  += crealf(x[i]);
+        mq  += cimagf(x[i]);
+        vi  += crealf(x[i])*crealf(x[i]);
+        vq  += cimagf(x[i])*cimagf(x[i]);
+        ciq += crealf(x[i])*cimagf(x[i]);
+    }
+    CONTEND_DELTA(mi /(double)N, 0.0, 0.02);
+    CONTEND_DELTA(mq /(double)N, 0.0, 0.02);
+    CONTEND_DELTA(vi /(double)N, 1.0, 0.03);
+    CONTEND_DELTA(vq /(double)N, 1.0, 0.03);
+    CONTEND_DELTA(ciq/(double)N, 0.0, 0.02);
+}
+
+// sequences are reproducible; uniform sequences are independent of how
+// they are drawn (scalar calls or blocks of arbitrary length)
+void autotest_randgen_sequence()
+{
+    unsigned int n = 1000;
+    unsigned int i;
+    float y0[n], y1[n];
+
+    // uniform
+    randgen q0 = randgen_create(77);
+    randgen q1 = randgen_create(77);
+    for (i=0; i<n; i++)
+        y0[i] = randgen_randf(q0);
+    randgen_randf_block(q1, y1,       3);
+    randgen_randf_block(q1, y1+3,   100);
+    randgen_randf_block(q1, y1+103, n-103);
+    CONTEND_SAME_DATA(y0, y1, n*sizeof(float));
+
+    // Gauss, after re-seeding: scalar and block sequences are each
+    // reproducible
+    randgen_seed(q0, 5);
+    randgen_seed(q1, 5);
+    for (i=0; i<n; i++)
+        y0[i] = randgen_randnf(q0);
+    for (i=0; i<n; i++)
+        y1[i] = randgen_randnf(q1);
+    CONTEND_SAME_DATA(y0, y1, n*sizeof(float));
+    randgen_seed(q0, 5);
+    randgen_seed(q1, 5);
+    randgen_randnf_block(q0, y0, 17);
+    randgen_randnf_block(q0, y0+17, n-17);
+    randgen_randnf_block(q1, y1, 17);
+    randgen_randnf_block(q1, y1+17, n-17);
+    CONTEND_SAME_DATA(y0, y1, n*sizeof(float));
+
+    // different seeds give different sequences
+    randgen_seed(q1, 6);
+    randgen_randnf_block(q1, y1, n);
+    unsigned int num_equal = 0;
+    for (i=0; i<n; i++)
+        num_equal += y0[i] == y1[i];
+    CONTEND_LESS_THAN(num_equal, 2);
+
+    randgen_destroy(q0);
+    randgen_destroy(q1);
+}
+
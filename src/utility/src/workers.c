@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// workers.c
+//
+// fixed pool of worker threads for data-parallel block processing
+//
+// Each call to liquid_workers_run() publishes a task and bumps a
+// generation counter; helper threads wake, process their fixed range of
+// items and decrement the count of outstanding workers. The calling
+// thread processes range 0 and waits for the count to reach zero. Ranges
+// depend only on the number of items and workers so the partition (and
+// any per-worker state) is deterministic.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#  include <pthread.h>
+#  define LIQUID_WORKERS_THREADED 1
+#else
+#  define LIQUID_WORKERS_THREADED 0
+#endif
+
+struct liquid_workers_s {
+    unsigned int num_workers;   // number of workers (including caller)
+
+#if LIQUID_WORKERS_THREADED
+    pthread_t *  threads;       // helper threads [size: num_workers-1 x 1]
+    pthread_mutex_t mutex;      // lock protecting shared state below
+    pthread_cond_t  cond_start; // signalled when a task is published
+    pthread_cond_t  cond_done;  // signalled when last helper finishes
+
+    unsigned long int generation;   // task counter
+    unsigned int num_pending;       // helpers still running task
+    int          stop;              // flag to terminate helpers
+
+    // current task
+    liquid_workers_task task;
+    void *       context;
+    unsigned int n;
+#endif
+};
+
+// compute range of items for a particular worker
+static void liquid_workers_range(unsigned int   _n,
+                                 unsigned int   _num_workers,
+                                 unsigned int   _worker,
+                                 unsigned int * _start,
+                                 unsigned int * _end)
+{
+    *_start = (unsigned int)(((unsigned long long int)_n *  _worker   ) / _num_workers);
+    *_end   = (unsigned int)(((unsigned long long int)_n * (_worker+1)) / _num_workers);
+}
+
+#if LIQUID_WORKERS_THREADED
+// argument passed to each helper thread
+struct liquid_workers_arg_s {
+    liquid_workers q;
+    unsigned int   worker;
+};
+
+// helper thread main loop
+static void * liquid_workers_main(void * _arg)
+{
+    struct liquid_workers_arg_s * arg = (struct liquid_workers_arg_s *) _arg;
+    liquid_workers q = arg->q;
+    unsigned int worker = arg->worker;
+    free(arg);
+
+    unsigned long int generation = 0;
+    while (1) {
+        // wait for new task (or stop signal)
+        pthread_mutex_lock(&q->mutex);
+        while (!q->stop && q->generation == generation)
+            pthread_cond_wait(&q->cond_start, &q->mutex);
+        if (q->stop) {
+            pthread_mutex_unlock(&q->mutex);
+            break;
+        }
+        generation = q->generation;
+        liquid_workers_task task = q->task;
+        void *       context     = q->context;
+        unsigned int n           = q->n;
+        pthread_mutex_unlock(&q->mutex);
+
+        // process range
+        unsigned int start, end;
+        liquid_workers_range(n, q->num_workers, worker, &start, &end);
+        if (start < end)
+            task(context, worker, start, end);
+
+        // signal completion
+        pthread_mutex_lock(&q->mutex);
+        q->num_pending--;
+        if (q->num_pending == 0)
+            pthread_cond_signal(&q->cond_done);
+        pthread_mutex_unlock(&q->mutex);
+    }
+    return NULL;
+}
+#endif
+
+// create worker pool
+//  _num_workers    :   number of workers (including calling thread), > 0
+liquid_workers liquid_workers_create(unsigned int _num_workers)
+{
+    // validate input
+    if (_num_workers == 0) {
+        fprintf(stderr,"error: liquid_workers_create(), number of workers must be greater than zero\n");
+        exit(1);
+    }
+
+    liquid_workers q = (liquid_workers) malloc(sizeof(struct liquid_workers_s));
+#if LIQUID_WORKERS_THREADED
+    q->num_workers = _num_workers;
+    q->generation  = 0;
+    q->num_pending = 0;
+    q->stop        = 0;
+    q->task        = NULL;
+    q->context     = NULL;
+    q->n           = 0;
+    pthread_mutex_init(&q->mutex, NULL);
+    pthread_cond_init(&q->cond_start, NULL);
+    pthread_cond_init(&q->cond_done,  NULL);
+
+    // start helper threads
+    q->threads = (pthread_t*) malloc((q->num_workers-1)*sizeof(pthread_t));
+    unsigned int i;
+    for (i=1; i<q->num_workers; i++) {
+        struct liquid_workers_arg_s * arg = (struct liquid_workers_arg_s*) malloc(sizeof(struct liquid_workers_arg_s));
+        arg->q      = q;
+        arg->worker = i;
+        if (pthread_create(&q->threads[i-1], NULL, liquid_workers_main, arg) != 0) {
+            fprintf(stderr,"error: liquid_workers_create(), could not create thread\n");
+            exit(1);
+        }
+    }
+#else
+    // no thread support: all work runs on the calling thread
+    q->num_workers = 1;
+#endif
+    return q;
+}
+
+// destroy worker pool, joining all helper threads
+void liquid_workers_destroy(liquid_workers _q)
+{
+    if (_q == NULL)
+        return;
+
+#if LIQUID_WORKERS_THREADED
+    // signal helpers to stop and wait for them
+    pthread_mutex_lock(&_q->mutex);
+    _q->stop = 1;
+    pthread_cond_broadcast(&_q->cond_start);
+    pthread_mutex_unlock(&_q->mutex);
+
+    unsigned int i;
+    for (i=1; i<_q->num_workers; i++)
+        pthread_join(_q->threads[i-1], NULL);
+    free(_q->threads);
+
+    pthread_mutex_destroy(&_q->mutex);
+    pthread_cond_destroy(&_q->cond_start);
+    pthread_cond_destroy(&_q->cond_done);
+#endif
+    free(_q);
+}
+
+// get number of workers in pool (1 if _q is NULL)
+unsigned int liquid_workers_get_num_workers(liquid_workers _q)
+{
+    return _q == NULL ? 1 : _q->num_workers;
+}
+
+// run task on [0,_n) split into contiguous ranges, one per worker
+void liquid_workers_run(liquid_workers      _q,
+                        liquid_workers_task _task,
+                        void *              _context,
+                        unsigned int        _n)
+{
+    if (_n == 0)
+        return;
+
+    // run directly on calling thread
+    if (_q == NULL || _q->num_workers == 1) {
+        _task(_context, 0, 0, _n);
+        return;
+    }
+
+#if LIQUID_WORKERS_THREADED
+    // publish task and wake helpers
+    pthread_mutex_lock(&_q->mutex);
+    _q->task        = _task;
+    _q->context     = _context;
+    _q->n           = _n;
+    _q->num_pending = _q->num_workers - 1;
+    _q->generation++;
+    pthread_cond_broadcast(&_q->cond_start);
+    pthread_mutex_unlock(&_q->mutex);
+
+    // process first range on calling thread
+    unsigned int start, end;
+    liquid_workers_range(_n, _q->num_workers, 0, &start, &end);
+    if (start < end)
+        _task(_context, 0, start, end);
+
+    // wait for helpers to finish
+    pthread_mutex_lock(&_q->mutex);
+    while (_q->num_pending > 0)
+        pthread_cond_wait(&_q->cond_done, &_q->mutex);
+    pthread_mutex_unlock(&_q->mutex);
+#endif
+}
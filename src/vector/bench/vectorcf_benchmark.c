@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// operation under test
+enum {
+    VECTORCF_MUL=0,
+    VECTORCF_NORM,
+    VECTORCF_ABS,
+    VECTORCF_CEXPJ,
+    VECTORCF_CARG,
+};
+
+// Helper function to keep code base small
+void vectorcf_bench(struct rusage *     _start,
+                    struct rusage *     _finish,
+                    unsigned long int * _num_iterations,
+                    unsigned int        _n,
+                    int                 _op,
+                    liquid_simd_type    _simd)
+{
+    // normalize number of iterations
+    *_num_iterations *= 100;
+    *_num_iterations /= _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float complex x[_n];
+    float complex y[_n];
+    float complex z[_n];
+    float         r[_n];
+    float         norm = 0.0f;
+    unsigned long int i;
+    for (i=0; i<_n; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        y[i] = randnf() + _Complex_I*randnf();
+        r[i] = 2*M_PI*randf();
+    }
+
+    // run using specified SIMD type (falls back to best available if
+    // unsupported by host)
+    liquid_simd_type simd = liquid_simd_get_type();
+    liquid_simd_set_type(_simd);
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    switch (_op) {
+    case VECTORCF_MUL:
+        for (i=0; i<(*_num_iterations); i++)
+            liquid_vectorcf_mul(x, y, _n, z);
+        break;
+    case VECTORCF_NORM:
+        for (i=0; i<(*_num_iterations); i++)
+            norm += liquid_vectorcf_norm(x, _n);
+        break;
+    case VECTORCF_ABS:
+        for (i=0; i<(*_num_iterations); i++)
+            liquid_vectorcf_abs(x, _n, r);
+        break;
+    case VECTORCF_CEXPJ:
+        for (i=0; i<(*_num_iterations); i++)
+            liquid_vectorcf_cexpj(r, _n, z);
+        break;
+    case VECTORCF_CARG:
+        for (i=0; i<(*_num_iterations); i++)
+            liquid_vectorcf_carg(x, _n, r);
+        break;
+    default:;
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    // restore original SIMD type
+    liquid_simd_set_type(simd);
+    if (norm < 0.0f) printf("unexpected norm\n");
+}
+
+#define VECTORCF_BENCHMARK_API(N,OP,SIMD)   \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ vectorcf_bench(_start, _finish, _num_iterations, N, OP, SIMD); }
+
+void benchmark_vectorcf_mul_256         VECTORCF_BENCHMARK_API(256, VECTORCF_MUL,   LIQUID_SIMD_AUTO)
+void benchmark_vectorcf_norm_256        VECTORCF_BENCHMARK_API(256, VECTORCF_NORM,  LIQUID_SIMD_AUTO)
+void benchmark_vectorcf_abs_256         VECTORCF_BENCHMARK_API(256, VECTORCF_ABS,   LIQUID_SIMD_AUTO)
+void benchmark_vectorcf_cexpj_256       VECTORCF_BENCHMARK_API(256, VECTORCF_CEXPJ, LIQUID_SIMD_AUTO)
+void benchmark_vectorcf_carg_256        VECTORCF_BENCHMARK_API(256, VECTORCF_CARG,  LIQUID_SIMD_AUTO)
+
+// compare against portable C versions
+void benchmark_vectorcf_mul_portable_256    VECTORCF_BENCHMARK_API(256, VECTORCF_MUL,   LIQUID_SIMD_PORTABLE)
+void benchmark_vectorcf_norm_portable_256   VECTORCF_BENCHMARK_API(256, VECTORCF_NORM,  LIQUID_SIMD_PORTABLE)
+void benchmark_vectorcf_abs_portable_256    VECTORCF_BENCHMARK_API(256, VECTORCF_ABS,   LIQUID_SIMD_PORTABLE)
+void benchmark_vectorcf_cexpj_portable_256  VECTORCF_BENCHMARK_API(256, VECTORCF_CEXPJ, LIQUID_SIMD_PORTABLE)
+void benchmark_vectorcf_carg_portable_256   VECTORCF_BENCHMARK_API(256, VECTORCF_CARG,  LIQUID_SIMD_PORTABLE)
+
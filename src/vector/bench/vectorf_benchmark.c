@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// operation under test
+enum {
+    VECTORF_ADD=0,
+    VECTORF_MUL,
+    VECTORF_NORM,
+    VECTORF_ABS,
+};
+
+// Helper function to keep code base small
+void vectorf_bench(struct rusage *     _start,
+                   struct rusage *     _finish,
+                   unsigned long int * _num_iterations,
+                   unsigned int        _n,
+                   int                 _op,
+                   liquid_simd_type    _simd)
+{
+    // normalize number of iterations
+    *_num_iterations *= 100;
+    *_num_iterations /= _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float x[_n];
+    float y[_n];
+    float z[_n];
+    float norm = 0.0f;
+    unsigned long int i;
+    for (i=0; i<_n; i++) {
+        x[i] = randnf();
+        y[i] = randnf();
+    }
+
+    // run using specified SIMD type (falls back to best available if
+    // unsupported by host)
+    liquid_simd_type simd = liquid_simd_get_type();
+    liquid_simd_set_type(_simd);
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    switch (_op) {
+    case VECTORF_ADD:
+        for (i=0; i<(*_num_iterations); i++)
+            liquid_vectorf_add(x, y, _n, z);
+        break;
+    case VECTORF_MUL:
+        for (i=0; i<(*_num_iterations); i++)
+            liquid_vectorf_mul(x, y, _n, z);
+        break;
+    case VECTORF_NORM:
+        for (i=0; i<(*_num_iterations); i++)
+            norm += liquid_vectorf_norm(x, _n);
+        break;
+    case VECTORF_ABS:
+        for (i=0; i<(*_num_iterations); i++)
+            liquid_vectorf_abs(x, _n, z);
+        break;
+    default:;
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    // restore original SIMD type
+    liquid_simd_set_type(simd);
+    if (norm < 0.0f) printf("unexpected norm\n");
+}
+
+#define VECTORF_BENCHMARK_API(N,OP,SIMD)    \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ vectorf_bench(_start, _finish, _num_iterations, N, OP, SIMD); }
+
+void benchmark_vectorf_add_256          VECTORF_BENCHMARK_API(256, VECTORF_ADD,  LIQUID_SIMD_AUTO)
+void benchmark_vectorf_mul_256          VECTORF_BENCHMARK_API(256, VECTORF_MUL,  LIQUID_SIMD_AUTO)
+void benchmark_vectorf_norm_256         VECTORF_BENCHMARK_API(256, VECTORF_NORM, LIQUID_SIMD_AUTO)
+void benchmark_vectorf_abs_256          VECTORF_BENCHMARK_API(256, VECTORF_ABS,  LIQUID_SIMD_AUTO)
+
+// compare against portable C versions
+void benchmark_vectorf_add_portable_256     VECTORF_BENCHMARK_API(256, VECTORF_ADD,  LIQUID_SIMD_PORTABLE)
+void benchmark_vectorf_mul_portable_256     VECTORF_BENCHMARK_API(256, VECTORF_MUL,  LIQUID_SIMD_PORTABLE)
+void benchmark_vectorf_norm_portable_256    VECTORF_BENCHMARK_API(256, VECTORF_NORM, LIQUID_SIMD_PORTABLE)
+void benchmark_vectorf_abs_portable_256     VECTORF_BENCHMARK_API(256, VECTORF_ABS,  LIQUID_SIMD_PORTABLE)
+
@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// SIMD vector kernels
+//
+// Kernels operate on arrays of floats; complex arrays are processed as
+// interleaved (real, imaginary) pairs. This file is included once for
+// each instruction set with the following defined:
+//  VSIMD(name)     :   name-mangling macro
+//  VTARGET         :   function attributes (target instruction set)
+//  VT, VN          :   register type, number of floats per register
+//  VMASK           :   comparison result type
+//  VLOAD(p), VSTORE(p,v), VSET1(a), VSETPAIR(a,b)
+//  VADD, VSUB, VMUL, VDIV, VMIN, VMAX, VSQRT
+//  VAND, VANDNOT (~a & b), VXOR
+//  VCMPLT, VCMPEQ, VMOR, VSEL(m,a,b) (m ? a : b), VSIGN(a) (sign bit set)
+//  VSUM(a)         :   horizontal sum
+//  VSWAP(a)        :   swap real and imaginary components of each pair
+//  VDUPRE(a)       :   duplicate real components of each pair
+//  VDUPIM(a)       :   duplicate imaginary components of each pair
+//  VDEINTERLEAVE(a,b,re,im) :  split 2*VN floats into VN pairs
+//  VINTERLEAVE(re,im,a,b)   :  combine VN pairs into 2*VN floats
+//
+// Element-wise arithmetic is exact up to contraction of multiplies and
+// adds; sin/cos and atan2 use single-precision minimax polynomials
+// (Cephes) and are accurate to a few units in the last place for phase
+// values with magnitude less than about 8192.
+//
+
+#include <math.h>
+
+// add each element: z[i] = x[i] + y[i]
+VTARGET
+void VSIMD(_add)(float *      _x,
+                 float *      _y,
+                 unsigned int _n,
+                 float *      _z)
+{
+    unsigned int t = (_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN)
+        VSTORE(&_z[i], VADD(VLOAD(&_x[i]), VLOAD(&_y[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _z[i] = _x[i] + _y[i];
+}
+
+// add scalar to each element: y[i] = x[i] + v
+VTARGET
+void VSIMD(_addscalar)(float *      _x,
+                       unsigned int _n,
+                       float        _v,
+                       float *      _y)
+{
+    VT v = VSET1(_v);
+    unsigned int t = (_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN)
+        VSTORE(&_y[i], VADD(VLOAD(&_x[i]), v));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] + _v;
+}
+
+// add complex scalar to each complex element: y[i] = x[i] + (vr + j*vi)
+VTARGET
+void VSIMD(_caddscalar)(float *      _x,
+                        unsigned int _n,
+                        float        _vr,
+                        float        _vi,
+                        float *      _y)
+{
+    VT v = VSETPAIR(_vr, _vi);
+    unsigned int t = (2*_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN)
+        VSTORE(&_y[i], VADD(VLOAD(&_x[i]), v));
+
+    // clean up remaining (t is even)
+    for ( ; i<2*_n; i+=2) {
+        _y[i  ] = _x[i  ] + _vr;
+        _y[i+1] = _x[i+1] + _vi;
+    }
+}
+
+// multiply each element: z[i] = x[i] * y[i]
+VTARGET
+void VSIMD(_mul)(float *      _x,
+                 float *      _y,
+                 unsigned int _n,
+                 float *      _z)
+{
+    unsigned int t = (_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN)
+        VSTORE(&_z[i], VMUL(VLOAD(&_x[i]), VLOAD(&_y[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _z[i] = _x[i] * _y[i];
+}
+
+// multiply each element with scalar: y[i] = x[i] * v
+VTARGET
+void VSIMD(_mulscalar)(float *      _x,
+                       unsigned int _n,
+                       float        _v,
+                       float *      _y)
+{
+    VT v = VSET1(_v);
+    unsigned int t = (_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN)
+        VSTORE(&_y[i], VMUL(VLOAD(&_x[i]), v));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] * _v;
+}
+
+// multiply each complex element: z[i] = x[i] * y[i]
+VTARGET
+void VSIMD(_cmul)(float *      _x,
+                  float *      _y,
+                  unsigned int _n,
+                  float *      _z)
+{
+    // negate products of imaginary components
+    VT sign = VSETPAIR(-0.0f, 0.0f);
+
+    unsigned int t = (2*_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN) {
+        VT x  = VLOAD(&_x[i]);
+        VT y  = VLOAD(&_y[i]);
+        VT zr = VMUL(VDUPRE(y), x);                     // (yr*xr,  yr*xi)
+        VT zi = VXOR(VMUL(VDUPIM(y), VSWAP(x)), sign);  // (-yi*xi, yi*xr)
+        VSTORE(&_z[i], VADD(zr, zi));
+    }
+
+    // clean up remaining (t is even)
+    for ( ; i<2*_n; i+=2) {
+        float xr = _x[i], xi = _x[i+1];
+        float yr = _y[i], yi = _y[i+1];
+        _z[i  ] = xr*yr - xi*yi;
+        _z[i+1] = xr*yi + xi*yr;
+    }
+}
+
+// multiply each complex element with complex scalar:
+// y[i] = x[i] * (vr + j*vi)
+VTARGET
+void VSIMD(_cmulscalar)(float *      _x,
+                        unsigned int _n,
+                        float        _vr,
+                        float        _vi,
+                        float *      _y)
+{
+    VT vr = VSET1(_vr);
+    VT vi = VSETPAIR(-_vi, _vi);
+
+    unsigned int t = (2*_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN) {
+        VT x = VLOAD(&_x[i]);
+        VSTORE(&_y[i], VADD(VMUL(vr, x), VMUL(vi, VSWAP(x))));
+    }
+
+    // clean up remaining (t is even)
+    for ( ; i<2*_n; i+=2) {
+        float xr = _x[i], xi = _x[i+1];
+        _y[i  ] = xr*_vr - xi*_vi;
+        _y[i+1] = xr*_vi + xi*_vr;
+    }
+}
+
+// compute sum of squares: sum{ x[i]^2 }
+VTARGET
+float VSIMD(_sumsq)(float *      _x,
+                    unsigned int _n)
+{
+    // two independent accumulators
+    VT sum0 = VSET1(0.0f);
+    VT sum1 = VSET1(0.0f);
+
+    unsigned int r = (_n / (2*VN)) * (2*VN);
+    unsigned int i;
+    for (i=0; i<r; i+=2*VN) {
+        VT x0 = VLOAD(&_x[i   ]);
+        VT x1 = VLOAD(&_x[i+VN]);
+        sum0 = VADD(sum0, VMUL(x0,x0));
+        sum1 = VADD(sum1, VMUL(x1,x1));
+    }
+
+    unsigned int t = (_n / VN) * VN;
+    for ( ; i<t; i+=VN) {
+        VT x0 = VLOAD(&_x[i]);
+        sum0 = VADD(sum0, VMUL(x0,x0));
+    }
+
+    // fold down to single value
+    float sum = VSUM(VADD(sum0, sum1));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        sum += _x[i] * _x[i];
+
+    return sum;
+}
+
+// compute absolute value of each element: y[i] = |x[i]|
+VTARGET
+void VSIMD(_abs)(float *      _x,
+                 unsigned int _n,
+                 float *      _y)
+{
+    VT sign = VSET1(-0.0f);
+    unsigned int t = (_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN)
+        VSTORE(&_y[i], VANDNOT(sign, VLOAD(&_x[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = fabsf(_x[i]);
+}
+
+// compute magnitude of each complex element: y[i] = |x[i]|
+VTARGET
+void VSIMD(_cabs)(float *      _x,
+                  unsigned int _n,
+                  float *      _y)
+{
+    unsigned int t = (_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN) {
+        VT re, im;
+        VDEINTERLEAVE(VLOAD(&_x[2*i]), VLOAD(&_x[2*i+VN]), re, im);
+        VSTORE(&_y[i], VSQRT(VADD(VMUL(re,re), VMUL(im,im))));
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = sqrtf(_x[2*i]*_x[2*i] + _x[2*i+1]*_x[2*i+1]);
+}
+
+// compute squared magnitude of each complex element: y[i] = |x[i]|^2
+VTARGET
+void VSIMD(_cabs2)(float *      _x,
+                   unsigned int _n,
+                   float *      _y)
+{
+    unsigned int t = (_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN) {
+        VT re, im;
+        VDEINTERLEAVE(VLOAD(&_x[2*i]), VLOAD(&_x[2*i+VN]), re, im);
+        VSTORE(&_y[i], VADD(VMUL(re,re), VMUL(im,im)));
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[2*i]*_x[2*i] + _x[2*i+1]*_x[2*i+1];
+}
+
+// compute sine and cosine of each element
+static inline VTARGET
+void VSIMD(_sincos_kernel)(VT   _theta,
+                           VT * _s,
+                           VT * _c)
+{
+    // quadrant: j = round(theta*2/pi), using the 1.5*2^23 rounding
+    // constant, and q = j mod 4
+    VT magic = VSET1(12582912.0f);
+    VT j = VSUB(VADD(VMUL(_theta, VSET1(0.636619772367581f)), magic), magic);
+    VT q = VSUB(VADD(VSUB(VMUL(j, VSET1(0.25f)), VSET1(0.375f)), magic), magic);
+    q = VSUB(j, VMUL(q, VSET1(4.0f)));
+
+    // reduce to [-pi/4, pi/4] with extended-precision pi/2
+    VT r = VSUB(_theta, VMUL(j, VSET1(1.5703125f)));
+    r = VSUB(r, VMUL(j, VSET1(4.837512969970703125e-4f)));
+    r = VSUB(r, VMUL(j, VSET1(7.54978995489188216e-8f)));
+    VT z = VMUL(r, r);
+
+    // sin(r)
+    VT s = VADD(VMUL(z, VSET1(-1.9515295891e-4f)), VSET1( 8.3321608736e-3f));
+    s = VADD(VMUL(z, s), VSET1(-1.6666654611e-1f));
+    s = VADD(VMUL(VMUL(z, r), s), r);
+
+    // cos(r)
+    VT c = VADD(VMUL(z, VSET1( 2.443315711809948e-5f)), VSET1(-1.388731625493765e-3f));
+    c = VADD(VMUL(z, c), VSET1( 4.166664568298827e-2f));
+    c = VADD(VSUB(VMUL(VMUL(z, z), c), VMUL(z, VSET1(0.5f))), VSET1(1.0f));
+
+    // map back to quadrant
+    VMASK q1 = VCMPEQ(q, VSET1(1.0f));
+    VMASK q2 = VCMPEQ(q, VSET1(2.0f));
+    VMASK q3 = VCMPEQ(q, VSET1(3.0f));
+    VMASK odd = VMOR(q1, q3);
+    VT sign = VSET1(-0.0f);
+    VT so = VSEL(odd, c, s);
+    VT co = VSEL(odd, s, c);
+    *_s = VSEL(VMOR(q2, q3), VXOR(so, sign), so);
+    *_c = VSEL(VMOR(q1, q2), VXOR(co, sign), co);
+}
+
+// compute four-quadrant arctangent of each element
+static inline VTARGET
+VT VSIMD(_atan2_kernel)(VT _y,
+                        VT _x)
+{
+    VT sign = VSET1(-0.0f);
+    VT ax = VANDNOT(sign, _x);
+    VT ay = VANDNOT(sign, _y);
+
+    // reduce to ratio in [0,1], avoiding 0/0
+    VT mx = VMAX(ax, ay);
+    VT mn = VMIN(ax, ay);
+    VT a  = VDIV(mn, VSEL(VCMPEQ(mx, VSET1(0.0f)), VSET1(1.0f), mx));
+
+    // reduce to [-tan(pi/8), tan(pi/8)]
+    VMASK big = VCMPLT(VSET1(0.414213562373095f), a);
+    VT t = VSEL(big, VDIV(VSUB(a, VSET1(1.0f)), VADD(a, VSET1(1.0f))), a);
+    VT z = VMUL(t, t);
+
+    // arctan(t)
+    VT p = VADD(VMUL(z, VSET1( 8.05374449538e-2f)), VSET1(-1.38776856032e-1f));
+    p = VADD(VMUL(z, p), VSET1( 1.99777106478e-1f));
+    p = VADD(VMUL(z, p), VSET1(-3.33329491539e-1f));
+    p = VADD(VMUL(VMUL(z, t), p), t);
+    p = VADD(p, VSEL(big, VSET1(M_PI/4), VSET1(0.0f)));
+
+    // map back to four quadrants
+    p = VSEL(VCMPLT(ax, ay), VSUB(VSET1(M_PI/2), p), p);
+    p = VSEL(VSIGN(_x),      VSUB(VSET1(M_PI),   p), p);
+    return VXOR(p, VAND(sign, _y));
+}
+
+// compute complex phase rotation: x[i] = exp{ j theta[i] }
+VTARGET
+void VSIMD(_cexpj)(float *      _theta,
+                   unsigned int _n,
+                   float *      _x)
+{
+    unsigned int t = (_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN) {
+        VT s, c, x0, x1;
+        VSIMD(_sincos_kernel)(VLOAD(&_theta[i]), &s, &c);
+        VINTERLEAVE(c, s, x0, x1);
+        VSTORE(&_x[2*i   ], x0);
+        VSTORE(&_x[2*i+VN], x1);
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++) {
+        _x[2*i  ] = cosf(_theta[i]);
+        _x[2*i+1] = sinf(_theta[i]);
+    }
+}
+
+// compute angle of each complex element: theta[i] = arg{ x[i] }
+VTARGET
+void VSIMD(_carg)(float *      _x,
+                  unsigned int _n,
+                  float *      _theta)
+{
+    unsigned int t = (_n / VN) * VN;
+    unsigned int i;
+    for (i=0; i<t; i+=VN) {
+        VT re, im;
+        VDEINTERLEAVE(VLOAD(&_x[2*i]), VLOAD(&_x[2*i+VN]), re, im);
+        VSTORE(&_theta[i], VSIMD(_atan2_kernel)(im, re));
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _theta[i] = atan2f(_x[2*i+1], _x[2*i]);
+}
+
@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// SIMD vector kernels for x86 processors: SSE (baseline architecture
+// flags), AVX2 and AVX-512 (per-function target attributes)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_XMMINTRIN_H
+#include <xmmintrin.h>  // SSE
+#endif
+
+#if HAVE_EMMINTRIN_H
+#include <emmintrin.h>  // SSE2
+#endif
+
+#if LIQUID_SIMD_X86_TARGETS
+#include <immintrin.h>  // AVX2, AVX-512
+#endif
+
+//
+// SSE/SSE2
+//
+#define VSIMD(name)     LIQUID_VECTOR_SSE(name)
+#define VTARGET
+#define VT              __m128
+#define VN              4
+#define VMASK           __m128
+#define VLOAD(p)        _mm_loadu_ps(p)
+#define VSTORE(p,v)     _mm_storeu_ps(p,v)
+#define VSET1(a)        _mm_set1_ps(a)
+#define VSETPAIR(a,b)   _mm_setr_ps(a,b,a,b)
+#define VADD(a,b)       _mm_add_ps(a,b)
+#define VSUB(a,b)       _mm_sub_ps(a,b)
+#define VMUL(a,b)       _mm_mul_ps(a,b)
+#define VDIV(a,b)       _mm_div_ps(a,b)
+#define VMIN(a,b)       _mm_min_ps(a,b)
+#define VMAX(a,b)       _mm_max_ps(a,b)
+#define VSQRT(a)        _mm_sqrt_ps(a)
+#define VAND(a,b)       _mm_and_ps(a,b)
+#define VANDNOT(a,b)    _mm_andnot_ps(a,b)
+#define VXOR(a,b)       _mm_xor_ps(a,b)
+#define VCMPLT(a,b)     _mm_cmplt_ps(a,b)
+#define VCMPEQ(a,b)     _mm_cmpeq_ps(a,b)
+#define VMOR(a,b)       _mm_or_ps(a,b)
+#define VSEL(m,a,b)     _mm_or_ps(_mm_and_ps(m,a), _mm_andnot_ps(m,b))
+#define VSIGN(a)        _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(a),31))
+#define VSWAP(a)        _mm_shuffle_ps(a,a,_MM_SHUFFLE(2,3,0,1))
+#define VDUPRE(a)       _mm_shuffle_ps(a,a,_MM_SHUFFLE(2,2,0,0))
+#define VDUPIM(a)       _mm_shuffle_ps(a,a,_MM_SHUFFLE(3,3,1,1))
+#define VDEINTERLEAVE(a,b,re,im)                                \
+    { VT _a = (a), _b = (b);                                    \
+      re = _mm_shuffle_ps(_a,_b,_MM_SHUFFLE(2,0,2,0));          \
+      im = _mm_shuffle_ps(_a,_b,_MM_SHUFFLE(3,1,3,1)); }
+#define VINTERLEAVE(re,im,a,b)                                  \
+    { a = _mm_unpacklo_ps(re,im);                               \
+      b = _mm_unpackhi_ps(re,im); }
+
+// horizontal sum
+static inline float liquid_vector_sse_hsum(__m128 _v)
+{
+    _v = _mm_add_ps(_v, _mm_movehl_ps(_v,_v));
+    _v = _mm_add_ss(_v, _mm_shuffle_ps(_v,_v,_MM_SHUFFLE(1,1,1,1)));
+    return _mm_cvtss_f32(_v);
+}
+#define VSUM(a)         liquid_vector_sse_hsum(a)
+
+#include "vector_simd.c"
+
+#undef VSIMD
+#undef VTARGET
+#undef VT
+#undef VN
+#undef VMASK
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VSETPAIR
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VDIV
+#undef VMIN
+#undef VMAX
+#undef VSQRT
+#undef VAND
+#undef VANDNOT
+#undef VXOR
+#undef VCMPLT
+#undef VCMPEQ
+#undef VMOR
+#undef VSEL
+#undef VSIGN
+#undef VSWAP
+#undef VDUPRE
+#undef VDUPIM
+#undef VDEINTERLEAVE
+#undef VINTERLEAVE
+#undef VSUM
+
+#if LIQUID_SIMD_X86_TARGETS
+//
+// AVX2
+//
+#define VSIMD(name)     LIQUID_VECTOR_AVX2(name)
+#define VTARGET         __attribute__((target("avx2,fma")))
+#define VT              __m256
+#define VN              8
+#define VMASK           __m256
+#define VLOAD(p)        _mm256_loadu_ps(p)
+#define VSTORE(p,v)     _mm256_storeu_ps(p,v)
+#define VSET1(a)        _mm256_set1_ps(a)
+#define VSETPAIR(a,b)   _mm256_setr_ps(a,b,a,b,a,b,a,b)
+#define VADD(a,b)       _mm256_add_ps(a,b)
+#define VSUB(a,b)       _mm256_sub_ps(a,b)
+#define VMUL(a,b)       _mm256_mul_ps(a,b)
+#define VDIV(a,b)       _mm256_div_ps(a,b)
+#define VMIN(a,b)       _mm256_min_ps(a,b)
+#define VMAX(a,b)       _mm256_max_ps(a,b)
+#define VSQRT(a)        _mm256_sqrt_ps(a)
+#define VAND(a,b)       _mm256_and_ps(a,b)
+#define VANDNOT(a,b)    _mm256_andnot_ps(a,b)
+#define VXOR(a,b)       _mm256_xor_ps(a,b)
+#define VCMPLT(a,b)     _mm256_cmp_ps(a,b,_CMP_LT_OQ)
+#define VCMPEQ(a,b)     _mm256_cmp_ps(a,b,_CMP_EQ_OQ)
+#define VMOR(a,b)       _mm256_or_ps(a,b)
+#define VSEL(m,a,b)     _mm256_blendv_ps(b,a,m)
+#define VSIGN(a)        (a)
+#define VSWAP(a)        _mm256_permute_ps(a,_MM_SHUFFLE(2,3,0,1))
+#define VDUPRE(a)       _mm256_moveldup_ps(a)
+#define VDUPIM(a)       _mm256_movehdup_ps(a)
+#define VDEINTERLEAVE(a,b,re,im)                                \
+    { VT _a = (a), _b = (b);                                    \
+      re = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd( \
+           _mm256_shuffle_ps(_a,_b,_MM_SHUFFLE(2,0,2,0))), 0xd8));  \
+      im = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd( \
+           _mm256_shuffle_ps(_a,_b,_MM_SHUFFLE(3,1,3,1))), 0xd8)); }
+#define VINTERLEAVE(re,im,a,b)                                  \
+    { VT _lo = _mm256_unpacklo_ps(re,im);                       \
+      VT _hi = _mm256_unpackhi_ps(re,im);                       \
+      a = _mm256_permute2f128_ps(_lo,_hi,0x20);                 \
+      b = _mm256_permute2f128_ps(_lo,_hi,0x31); }
+
+// horizontal sum
+static inline __attribute__((target("avx2,fma")))
+float liquid_vector_avx2_hsum(__m256 _v)
+{
+    return liquid_vector_sse_hsum(_mm_add_ps(_mm256_castps256_ps128(_v),
+                                             _mm256_extractf128_ps(_v,1)));
+}
+#define VSUM(a)         liquid_vector_avx2_hsum(a)
+
+#include "vector_simd.c"
+
+#undef VSIMD
+#undef VTARGET
+#undef VT
+#undef VN
+#undef VMASK
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VSETPAIR
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VDIV
+#undef VMIN
+#undef VMAX
+#undef VSQRT
+#undef VAND
+#undef VANDNOT
+#undef VXOR
+#undef VCMPLT
+#undef VCMPEQ
+#undef VMOR
+#undef VSEL
+#undef VSIGN
+#undef VSWAP
+#undef VDUPRE
+#undef VDUPIM
+#undef VDEINTERLEAVE
+#undef VINTERLEAVE
+#undef VSUM
+
+//
+// AVX-512F (bitwise operations on floats and sign tests use integer
+// instructions; AVX-512DQ is not required)
+//
+#define VSIMD(name)     LIQUID_VECTOR_AVX512(name)
+#define VTARGET         __attribute__((target("avx512f")))
+#define VT              __m512
+#define VN              16
+#define VMASK           __mmask16
+#define VLOAD(p)        _mm512_loadu_ps(p)
+#define VSTORE(p,v)     _mm512_storeu_ps(p,v)
+#define VSET1(a)        _mm512_set1_ps(a)
+#define VSETPAIR(a,b)   _mm512_set4_ps(b,a,b,a)
+#define VADD(a,b)       _mm512_add_ps(a,b)
+#define VSUB(a,b)       _mm512_sub_ps(a,b)
+#define VMUL(a,b)       _mm512_mul_ps(a,b)
+#define VDIV(a,b)       _mm512_div_ps(a,b)
+#define VMIN(a,b)       _mm512_min_ps(a,b)
+#define VMAX(a,b)       _mm512_max_ps(a,b)
+#define VSQRT(a)        _mm512_sqrt_ps(a)
+#define VAND(a,b)       _mm512_castsi512_ps(_mm512_and_si512   (_mm512_castps_si512(a),_mm512_castps_si512(b)))
+#define VANDNOT(a,b)    _mm512_castsi512_ps(_mm512_andnot_si512(_mm512_castps_si512(a),_mm512_castps_si512(b)))
+#define VXOR(a,b)       _mm512_castsi512_ps(_mm512_xor_si512   (_mm512_castps_si512(a),_mm512_castps_si512(b)))
+#define VCMPLT(a,b)     _mm512_cmp_ps_mask(a,b,_CMP_LT_OQ)
+#define VCMPEQ(a,b)     _mm512_cmp_ps_mask(a,b,_CMP_EQ_OQ)
+#define VMOR(a,b)       ((__mmask16)((a)|(b)))
+#define VSEL(m,a,b)     _mm512_mask_blend_ps(m,b,a)
+#define VSIGN(a)        _mm512_cmplt_epi32_mask(_mm512_castps_si512(a),_mm512_setzero_si512())
+#define VSWAP(a)        _mm512_permute_ps(a,_MM_SHUFFLE(2,3,0,1))
+#define VDUPRE(a)       _mm512_moveldup_ps(a)
+#define VDUPIM(a)       _mm512_movehdup_ps(a)
+#define VDEINTERLEAVE(a,b,re,im)                                \
+    { VT _a = (a), _b = (b);                                    \
+      re = _mm512_permutex2var_ps(_a, _mm512_setr_epi32( 0, 2, 4, 6, 8,10,12,14,16,18,20,22,24,26,28,30), _b); \
+      im = _mm512_permutex2var_ps(_a, _mm512_setr_epi32( 1, 3, 5, 7, 9,11,13,15,17,19,21,23,25,27,29,31), _b); }
+#define VINTERLEAVE(re,im,a,b)                                  \
+    { a = _mm512_permutex2var_ps(re, _mm512_setr_epi32( 0,16, 1,17, 2,18, 3,19, 4,20, 5,21, 6,22, 7,23), im); \
+      b = _mm512_permutex2var_ps(re, _mm512_setr_epi32( 8,24, 9,25,10,26,11,27,12,28,13,29,14,30,15,31), im); }
+#define VSUM(a)         _mm512_reduce_add_ps(a)
+
+#include "vector_simd.c"
+#endif
+
+
+//
+// bank of second-order sections (see liquid_vectorf_sosbank); the
+// eight lanes occupy two SSE registers or one AVX2 register
+//
+
+// SSE/SSE2
+void LIQUID_VECTOR_SSE(_sosbank)(float *      _h,
+                                 float *      _w1,
+                                 float *      _w2,
+                                 unsigned int _nc,
+                                 float *      _x,
+                                 unsigned int _n,
+                                 float *      _y)
+{
+    __m128 b0a = _mm_loadu_ps(_h +  0), b0b = _mm_loadu_ps(_h +  4);
+    __m128 b1a = _mm_loadu_ps(_h +  8), b1b = _mm_loadu_ps(_h + 12);
+    __m128 a1a = _mm_loadu_ps(_h + 16), a1b = _mm_loadu_ps(_h + 20);
+    __m128 a2a = _mm_loadu_ps(_h + 24), a2b = _mm_loadu_ps(_h + 28);
+    __m128 w1a = _mm_loadu_ps(_w1),     w1b = _mm_loadu_ps(_w1 + 4);
+    __m128 w2a = _mm_loadu_ps(_w2),     w2b = _mm_loadu_ps(_w2 + 4);
+
+    // negate feed-back coefficients: w2 = -a2*t
+    __m128 sign = _mm_set1_ps(-0.0f);
+    a2a = _mm_xor_ps(a2a, sign);
+    a2b = _mm_xor_ps(a2b, sign);
+
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        // broadcast sample (one channel) or pair (two channels)
+        __m128 v = _nc == 1 ? _mm_set1_ps(_x[i]) :
+                   _mm_castpd_ps(_mm_load1_pd((double*)&_x[2*i]));
+
+        // w1 = (b1*v + w2) - a1*t keeps a single multiply and
+        // subtract on the recursion between samples
+        __m128 ta = _mm_add_ps(_mm_mul_ps(b0a, v), w1a);
+        __m128 tb = _mm_add_ps(_mm_mul_ps(b0b, v), w1b);
+        w1a = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(b1a, v), w2a), _mm_mul_ps(a1a, ta));
+        w1b = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(b1b, v), w2b), _mm_mul_ps(a1b, tb));
+        w2a = _mm_mul_ps(a2a, ta);
+        w2b = _mm_mul_ps(a2b, tb);
+
+        // sum lanes of each channel
+        __m128 s = _mm_add_ps(ta, tb);
+        s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        if (_nc == 1) {
+            s = _mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1,1,1,1)));
+            _y[i] += _mm_cvtss_f32(s);
+        } else {
+            __m128 y = _mm_castpd_ps(_mm_load_sd((double*)&_y[2*i]));
+            _mm_store_sd((double*)&_y[2*i], _mm_castps_pd(_mm_add_ps(y, s)));
+        }
+    }
+
+    _mm_storeu_ps(_w1, w1a);    _mm_storeu_ps(_w1 + 4, w1b);
+    _mm_storeu_ps(_w2, w2a);    _mm_storeu_ps(_w2 + 4, w2b);
+}
+
+#if LIQUID_SIMD_X86_TARGETS
+// AVX2 with fused multiply-add
+__attribute__((target("avx2,fma")))
+void LIQUID_VECTOR_AVX2(_sosbank)(float *      _h,
+                                  float *      _w1,
+                                  float *      _w2,
+                                  unsigned int _nc,
+                                  float *      _x,
+                                  unsigned int _n,
+                                  float *      _y)
+{
+    __m256 b0 = _mm256_loadu_ps(_h +  0);
+    __m256 b1 = _mm256_loadu_ps(_h +  8);
+    __m256 a1 = _mm256_loadu_ps(_h + 16);
+    __m256 a2 = _mm256_xor_ps(_mm256_loadu_ps(_h + 24), _mm256_set1_ps(-0.0f));
+    __m256 w1 = _mm256_loadu_ps(_w1);
+    __m256 w2 = _mm256_loadu_ps(_w2);
+
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        __m256 v = _nc == 1 ? _mm256_set1_ps(_x[i]) :
+                   _mm256_castpd_ps(_mm256_broadcast_sd((double*)&_x[2*i]));
+
+        __m256 t = _mm256_fmadd_ps(b0, v, w1);
+        w1 = _mm256_fnmadd_ps(a1, t, _mm256_fmadd_ps(b1, v, w2));
+        w2 = _mm256_mul_ps(a2, t);
+
+        // sum lanes of each channel
+        __m128 s = _mm_add_ps(_mm256_castps256_ps128(t), _mm256_extractf128_ps(t,1));
+        s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        if (_nc == 1) {
+            s = _mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1,1,1,1)));
+            _y[i] += _mm_cvtss_f32(s);
+        } else {
+            __m128 y = _mm_castpd_ps(_mm_load_sd((double*)&_y[2*i]));
+            _mm_store_sd((double*)&_y[2*i], _mm_castps_pd(_mm_add_ps(y, s)));
+        }
+    }
+
+    _mm256_storeu_ps(_w1, w1);
+    _mm256_storeu_ps(_w2, w2);
+}
+#endif
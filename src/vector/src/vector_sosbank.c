@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Generic bank of second-order sections (see liquid.internal.h)
+//
+
+// run bank of second-order sections over block of samples
+//  _h      :   coefficients {b0, b1, a1, a2} [size: 4*LANES x 1]
+//  _w1     :   state [size: LANES x 1]
+//  _w2     :   state [size: LANES x 1]
+//  _nc     :   number of interleaved channels (1 or 2)
+//  _x      :   input array [size: _nc*_n x 1]
+//  _n      :   number of samples in each channel
+//  _y      :   output accumulator [size: _nc*_n x 1]
+void VECTOR(_sosbank)(float *      _h,
+                      float *      _w1,
+                      float *      _w2,
+                      unsigned int _nc,
+                      float *      _x,
+                      unsigned int _n,
+                      float *      _y)
+{
+    float * b0 = _h;
+    float * b1 = _h +   LIQUID_VECTOR_SOSBANK_LANES;
+    float * a1 = _h + 2*LIQUID_VECTOR_SOSBANK_LANES;
+    float * a2 = _h + 3*LIQUID_VECTOR_SOSBANK_LANES;
+
+    unsigned int i, k;
+    for (i=0; i<_n; i++) {
+        for (k=0; k<LIQUID_VECTOR_SOSBANK_LANES; k++) {
+            float v = _x[i*_nc + k%_nc];
+            float t = b0[k]*v + _w1[k];
+            _w1[k] = b1[k]*v + _w2[k] - a1[k]*t;
+            _w2[k] = -a2[k]*t;
+            _y[i*_nc + k%_nc] += t;
+        }
+    }
+}
+
@@ -124,10 +124,10 @@ void VECTOR(_abs)(T *          _x,
         _y[i+2] = cabsf(_x[i+2]);
         _y[i+3] = cabsf(_x[i+3]);
 #else
-        _x[i  ] = fabsf(_x[i  ]);
-        _x[i+1] = fabsf(_x[i+1]);
-        _x[i+2] = fabsf(_x[i+2]);
-        _x[i+3] = fabsf(_x[i+3]);
+        _y[i  ] = fabsf(_x[i  ]);
+        _y[i+1] = fabsf(_x[i+1]);
+        _y[i+2] = fabsf(_x[i+2]);
+        _y[i+3] = fabsf(_x[i+3]);
 #endif
     }
 
@@ -136,8 +136,45 @@ void VECTOR(_abs)(T *          _x,
 #if T_COMPLEX
         _y[i] = cabsf(_x[i]);
 #else
-        _x[i] = fabsf(_x[i]);
+        _y[i] = fabsf(_x[i]);
 #endif
     }
 }
 
+
+// compute squared magnitude of each element: y[i] = |x[i]|^2
+//  _x      :   input array [size: _n x 1]
+//  _n      :   array length
+//  _y      :   output primitive array pointer [size: _n x 1]
+void VECTOR(_abs2)(T *          _x,
+                   unsigned int _n,
+                   TP *         _y)
+{
+    // t = 4*(floor(_n/4))
+    unsigned int t=(_n>>2)<<2; 
+
+    // compute in groups of 4
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+#if T_COMPLEX
+        _y[i  ] = crealf(_x[i  ])*crealf(_x[i  ]) + cimagf(_x[i  ])*cimagf(_x[i  ]);
+        _y[i+1] = crealf(_x[i+1])*crealf(_x[i+1]) + cimagf(_x[i+1])*cimagf(_x[i+1]);
+        _y[i+2] = crealf(_x[i+2])*crealf(_x[i+2]) + cimagf(_x[i+2])*cimagf(_x[i+2]);
+        _y[i+3] = crealf(_x[i+3])*crealf(_x[i+3]) + cimagf(_x[i+3])*cimagf(_x[i+3]);
+#else
+        _y[i  ] = _x[i  ] * _x[i  ];
+        _y[i+1] = _x[i+1] * _x[i+1];
+        _y[i+2] = _x[i+2] * _x[i+2];
+        _y[i+3] = _x[i+3] * _x[i+3];
+#endif
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++) {
+#if T_COMPLEX
+        _y[i] = crealf(_x[i])*crealf(_x[i]) + cimagf(_x[i])*cimagf(_x[i]);
+#else
+        _y[i] = _x[i] * _x[i];
+#endif
+    }
+}
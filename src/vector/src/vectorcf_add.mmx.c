@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Vector addition (SIMD dispatch)
+//
+
+#include "liquid.internal.h"
+
+// portable versions
+#define VECTOR(name)    LIQUID_CONCAT(liquid_vectorcf_port,name)
+#define T               float complex
+#define TP              float
+
+#define T_COMPLEX       1
+
+#include "vector_add.c"
+
+// basic vector addition
+void liquid_vectorcf_add(float complex * _x,
+                         float complex * _y,
+                         unsigned int    _n,
+                         float complex * _z)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: LIQUID_VECTOR_AVX512(_add)((float*)_x, (float*)_y, 2*_n, (float*)_z); return;
+    case LIQUID_SIMD_AVX2:   LIQUID_VECTOR_AVX2(_add)((float*)_x, (float*)_y, 2*_n, (float*)_z); return;
+#endif
+    case LIQUID_SIMD_SSE:    LIQUID_VECTOR_SSE(_add)((float*)_x, (float*)_y, 2*_n, (float*)_z); return;
+    default:;
+    }
+    liquid_vectorcf_port_add(_x, _y, _n, _z);
+}
+
+// basic vector scalar addition
+void liquid_vectorcf_addscalar(float complex * _x,
+                               unsigned int    _n,
+                               float complex   _v,
+                               float complex * _y)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: LIQUID_VECTOR_AVX512(_caddscalar)((float*)_x, _n, crealf(_v), cimagf(_v), (float*)_y); return;
+    case LIQUID_SIMD_AVX2:   LIQUID_VECTOR_AVX2(_caddscalar)((float*)_x, _n, crealf(_v), cimagf(_v), (float*)_y); return;
+#endif
+    case LIQUID_SIMD_SSE:    LIQUID_VECTOR_SSE(_caddscalar)((float*)_x, _n, crealf(_v), cimagf(_v), (float*)_y); return;
+    default:;
+    }
+    liquid_vectorcf_port_addscalar(_x, _n, _v, _y);
+}
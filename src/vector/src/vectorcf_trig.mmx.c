@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Vector trigonometric operations (SIMD dispatch)
+//
+
+#include "liquid.internal.h"
+
+// portable versions
+#define VECTOR(name)    LIQUID_CONCAT(liquid_vectorcf_port,name)
+#define T               float complex
+#define TP              float
+
+#define T_COMPLEX       1
+
+#include "vector_trig.c"
+
+// compute complex phase rotation: x[i] = exp{ j theta[i] }
+void liquid_vectorcf_cexpj(float *         _theta,
+                           unsigned int    _n,
+                           float complex * _x)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: LIQUID_VECTOR_AVX512(_cexpj)(_theta, _n, (float*)_x); return;
+    case LIQUID_SIMD_AVX2:   LIQUID_VECTOR_AVX2(_cexpj)(_theta, _n, (float*)_x); return;
+#endif
+    case LIQUID_SIMD_SSE:    LIQUID_VECTOR_SSE(_cexpj)(_theta, _n, (float*)_x); return;
+    default:;
+    }
+    liquid_vectorcf_port_cexpj(_theta, _n, _x);
+}
+
+// compute angle of each element: theta[i] = arg{ x[i] }
+void liquid_vectorcf_carg(float complex * _x,
+                          unsigned int    _n,
+                          float *         _theta)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: LIQUID_VECTOR_AVX512(_carg)((float*)_x, _n, _theta); return;
+    case LIQUID_SIMD_AVX2:   LIQUID_VECTOR_AVX2(_carg)((float*)_x, _n, _theta); return;
+#endif
+    case LIQUID_SIMD_SSE:    LIQUID_VECTOR_SSE(_carg)((float*)_x, _n, _theta); return;
+    default:;
+    }
+    liquid_vectorcf_port_carg(_x, _n, _theta);
+}
+
+// compute absolute value of each element: y[i] = |x[i]|
+void liquid_vectorcf_abs(float complex * _x,
+                         unsigned int    _n,
+                         float *         _y)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: LIQUID_VECTOR_AVX512(_cabs)((float*)_x, _n, _y); return;
+    case LIQUID_SIMD_AVX2:   LIQUID_VECTOR_AVX2(_cabs)((float*)_x, _n, _y); return;
+#endif
+    case LIQUID_SIMD_SSE:    LIQUID_VECTOR_SSE(_cabs)((float*)_x, _n, _y); return;
+    default:;
+    }
+    liquid_vectorcf_port_abs(_x, _n, _y);
+}
+
+// compute squared magnitude of each element: y[i] = |x[i]|^2
+void liquid_vectorcf_abs2(float complex * _x,
+                          unsigned int    _n,
+                          float *         _y)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: LIQUID_VECTOR_AVX512(_cabs2)((float*)_x, _n, _y); return;
+    case LIQUID_SIMD_AVX2:   LIQUID_VECTOR_AVX2(_cabs2)((float*)_x, _n, _y); return;
+#endif
+    case LIQUID_SIMD_SSE:    LIQUID_VECTOR_SSE(_cabs2)((float*)_x, _n, _y); return;
+    default:;
+    }
+    liquid_vectorcf_port_abs2(_x, _n, _y);
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Vector multiplication (SIMD dispatch)
+//
+
+#include "liquid.internal.h"
+
+// portable versions
+#define VECTOR(name)    LIQUID_CONCAT(liquid_vectorf_port,name)
+#define T               float
+#define TP              float
+
+#include "vector_mul.c"
+
+// basic vector multiplication
+void liquid_vectorf_mul(float *      _x,
+                        float *      _y,
+                        unsigned int _n,
+                        float *      _z)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: LIQUID_VECTOR_AVX512(_mul)(_x, _y, _n, _z); return;
+    case LIQUID_SIMD_AVX2:   LIQUID_VECTOR_AVX2(_mul)(_x, _y, _n, _z); return;
+#endif
+    case LIQUID_SIMD_SSE:    LIQUID_VECTOR_SSE(_mul)(_x, _y, _n, _z); return;
+    default:;
+    }
+    liquid_vectorf_port_mul(_x, _y, _n, _z);
+}
+
+// basic vector scalar multiplication
+void liquid_vectorf_mulscalar(float *      _x,
+                              unsigned int _n,
+                              float        _v,
+                              float *      _y)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: LIQUID_VECTOR_AVX512(_mulscalar)(_x, _n, _v, _y); return;
+    case LIQUID_SIMD_AVX2:   LIQUID_VECTOR_AVX2(_mulscalar)(_x, _n, _v, _y); return;
+#endif
+    case LIQUID_SIMD_SSE:    LIQUID_VECTOR_SSE(_mulscalar)(_x, _n, _v, _y); return;
+    default:;
+    }
+    liquid_vectorf_port_mulscalar(_x, _n, _v, _y);
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Vector norm computation (SIMD dispatch)
+//
+
+#include "liquid.internal.h"
+
+// portable versions
+#define VECTOR(name)    LIQUID_CONCAT(liquid_vectorf_port,name)
+#define T               float
+#define TP              float
+
+#include "vector_norm.c"
+
+// compute l2-norm on vector
+float liquid_vectorf_norm(float *      _x,
+                          unsigned int _n)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: return sqrtf(LIQUID_VECTOR_AVX512(_sumsq)(_x, _n));
+    case LIQUID_SIMD_AVX2:   return sqrtf(LIQUID_VECTOR_AVX2(_sumsq)(_x, _n));
+#endif
+    case LIQUID_SIMD_SSE:    return sqrtf(LIQUID_VECTOR_SSE(_sumsq)(_x, _n));
+    default:;
+    }
+    return liquid_vectorf_port_norm(_x, _n);
+}
+
+// scale vector to its l2-norm
+void liquid_vectorf_normalize(float *      _x,
+                              unsigned int _n,
+                              float *      _y)
+{
+    // scale by inverse of l2-norm
+    float norm_inv = 1.0f / liquid_vectorf_norm(_x, _n);
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: LIQUID_VECTOR_AVX512(_mulscalar)(_x, _n, norm_inv, _y); return;
+    case LIQUID_SIMD_AVX2:   LIQUID_VECTOR_AVX2(_mulscalar)(_x, _n, norm_inv, _y); return;
+#endif
+    case LIQUID_SIMD_SSE:    LIQUID_VECTOR_SSE(_mulscalar)(_x, _n, norm_inv, _y); return;
+    default:;
+    }
+
+    // portable version
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _y[i] = _x[i] * norm_inv;
+}
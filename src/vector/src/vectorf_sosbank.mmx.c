@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Bank of second-order sections (SIMD dispatch)
+//
+
+#include "liquid.internal.h"
+
+// portable version
+#define VECTOR(name)    LIQUID_CONCAT(liquid_vectorf_port,name)
+
+#include "vector_sosbank.c"
+
+// run bank of second-order sections over block of samples
+void liquid_vectorf_sosbank(float *      _h,
+                            float *      _w1,
+                            float *      _w2,
+                            unsigned int _nc,
+                            float *      _x,
+                            unsigned int _n,
+                            float *      _y)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX2)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX2: LIQUID_VECTOR_AVX2(_sosbank)(_h, _w1, _w2, _nc, _x, _n, _y); return;
+#endif
+    case LIQUID_SIMD_SSE:  LIQUID_VECTOR_SSE(_sosbank)(_h, _w1, _w2, _nc, _x, _n, _y); return;
+    default:;
+    }
+    liquid_vectorf_port_sosbank(_h, _w1, _w2, _nc, _x, _n, _y);
+}
+
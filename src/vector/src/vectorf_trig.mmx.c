@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Vector trigonometric operations (SIMD dispatch)
+//
+
+#include "liquid.internal.h"
+
+// portable versions
+#define VECTOR(name)    LIQUID_CONCAT(liquid_vectorf_port,name)
+#define T               float
+#define TP              float
+
+#include "vector_trig.c"
+
+// compute sign of each element: x[i] = theta[i] > 0 ? 1 : -1
+void liquid_vectorf_cexpj(float *      _theta,
+                          unsigned int _n,
+                          float *      _x)
+{
+    liquid_vectorf_port_cexpj(_theta, _n, _x);
+}
+
+// compute angle of each element: theta[i] = x[i] > 0 ? 0 : pi
+void liquid_vectorf_carg(float *      _x,
+                         unsigned int _n,
+                         float *      _theta)
+{
+    liquid_vectorf_port_carg(_x, _n, _theta);
+}
+
+// compute absolute value of each element: y[i] = |x[i]|
+void liquid_vectorf_abs(float *      _x,
+                        unsigned int _n,
+                        float *      _y)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: LIQUID_VECTOR_AVX512(_abs)(_x, _n, _y); return;
+    case LIQUID_SIMD_AVX2:   LIQUID_VECTOR_AVX2(_abs)(_x, _n, _y); return;
+#endif
+    case LIQUID_SIMD_SSE:    LIQUID_VECTOR_SSE(_abs)(_x, _n, _y); return;
+    default:;
+    }
+    liquid_vectorf_port_abs(_x, _n, _y);
+}
+
+// compute squared magnitude of each element: y[i] = |x[i]|^2
+void liquid_vectorf_abs2(float *      _x,
+                         unsigned int _n,
+                         float *      _y)
+{
+    switch (liquid_simd_select(LIQUID_SIMD_AVX512)) {
+#if LIQUID_SIMD_X86_TARGETS
+    case LIQUID_SIMD_AVX512: LIQUID_VECTOR_AVX512(_mul)(_x, _x, _n, _y); return;
+    case LIQUID_SIMD_AVX2:   LIQUID_VECTOR_AVX2(_mul)(_x, _x, _n, _y); return;
+#endif
+    case LIQUID_SIMD_SSE:    LIQUID_VECTOR_SSE(_mul)(_x, _x, _n, _y); return;
+    default:;
+    }
+    liquid_vectorf_port_abs2(_x, _n, _y);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// compare vector operations against ordinal computation for each SIMD
+// type supported by the host
+void autotest_vectorcf_simd()
+{
+    float tol = 1e-5f;
+    liquid_simd_type simd = liquid_simd_get_type();
+
+    unsigned int t;
+    for (t=LIQUID_SIMD_PORTABLE; t<LIQUID_SIMD_NUM_TYPES; t++) {
+        if (!liquid_simd_is_supported(t)) {
+            if (liquid_autotest_verbose)
+                printf("  vectorcf [%-8s] : not supported\n", liquid_simd_type_str[t][0]);
+            continue;
+        }
+        liquid_simd_set_type(t);
+
+        // test lengths covering all vector widths and cleanup paths
+        unsigned int n;
+        for (n=1; n<=80; n++) {
+            float complex x[n], y[n], z[n];
+            float theta[n], r[n];
+            float complex v = randnf() + _Complex_I*randnf();
+            float norm_test = 0.0f;
+            unsigned int i;
+            for (i=0; i<n; i++) {
+                x[i] = randnf() + _Complex_I*randnf();
+                y[i] = randnf() + _Complex_I*randnf();
+
+                // phase spanning several periods
+                theta[i] = 16*M_PI*(randf() - 0.5f);
+            }
+
+            // include zero and values on each axis
+            if (n > 4) {
+                x[0] =  0.0f;
+                x[1] = -1.0f;
+                x[2] =  _Complex_I;
+                x[3] = -_Complex_I;
+            }
+            for (i=0; i<n; i++)
+                norm_test += crealf(x[i]*conjf(x[i]));
+            norm_test = sqrtf(norm_test);
+
+            liquid_vectorcf_add(x, y, n, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(cabsf(z[i] - (x[i] + y[i])), 0.0f, tol);
+
+            liquid_vectorcf_addscalar(x, n, v, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(cabsf(z[i] - (x[i] + v)), 0.0f, tol);
+
+            liquid_vectorcf_mul(x, y, n, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(cabsf(z[i] - x[i]*y[i]), 0.0f, tol);
+
+            liquid_vectorcf_mulscalar(x, n, v, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(cabsf(z[i] - x[i]*v), 0.0f, tol);
+
+            CONTEND_DELTA(liquid_vectorcf_norm(x, n), norm_test, tol*norm_test);
+
+            liquid_vectorcf_normalize(x, n, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(cabsf(z[i] - x[i]/norm_test), 0.0f, tol);
+
+            liquid_vectorcf_abs(x, n, r);
+            for (i=0; i<n; i++) CONTEND_DELTA(r[i], cabsf(x[i]), tol);
+
+            liquid_vectorcf_abs2(x, n, r);
+            for (i=0; i<n; i++) CONTEND_DELTA(r[i], crealf(x[i]*conjf(x[i])), tol);
+
+            liquid_vectorcf_cexpj(theta, n, z);
+            for (i=0; i<n; i++) {
+                CONTEND_DELTA(crealf(z[i]), cosf(theta[i]), tol);
+                CONTEND_DELTA(cimagf(z[i]), sinf(theta[i]), tol);
+            }
+
+            liquid_vectorcf_carg(x, n, r);
+            for (i=0; i<n; i++) CONTEND_DELTA(r[i], cargf(x[i]), tol);
+        }
+        if (liquid_autotest_verbose)
+            printf("  vectorcf [%-8s] : pass\n", liquid_simd_type_str[t][0]);
+    }
+
+    // restore original SIMD type
+    liquid_simd_set_type(simd);
+}
+
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2007 - 2017 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// compare vector operations against ordinal computation for each SIMD
+// type supported by the host
+void autotest_vectorf_simd()
+{
+    float tol = 1e-5f;
+    liquid_simd_type simd = liquid_simd_get_type();
+
+    unsigned int t;
+    for (t=LIQUID_SIMD_PORTABLE; t<LIQUID_SIMD_NUM_TYPES; t++) {
+        if (!liquid_simd_is_supported(t)) {
+            if (liquid_autotest_verbose)
+                printf("  vectorf [%-8s] : not supported\n", liquid_simd_type_str[t][0]);
+            continue;
+        }
+        liquid_simd_set_type(t);
+
+        // test lengths covering all vector widths and cleanup paths
+        unsigned int n;
+        for (n=1; n<=80; n++) {
+            float x[n], y[n], z[n], x0[n];
+            float v = randnf();
+            float norm_test = 0.0f;
+            unsigned int i;
+            for (i=0; i<n; i++) {
+                x[i]  = randnf();
+                y[i]  = randnf();
+                x0[i] = x[i];
+                norm_test += x[i]*x[i];
+            }
+            norm_test = sqrtf(norm_test);
+
+            liquid_vectorf_add(x, y, n, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(z[i], x[i] + y[i], tol);
+
+            liquid_vectorf_addscalar(x, n, v, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(z[i], x[i] + v, tol);
+
+            liquid_vectorf_mul(x, y, n, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(z[i], x[i] * y[i], tol);
+
+            liquid_vectorf_mulscalar(x, n, v, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(z[i], x[i] * v, tol);
+
+            CONTEND_DELTA(liquid_vectorf_norm(x, n), norm_test, tol*norm_test);
+
+            liquid_vectorf_normalize(x, n, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(z[i], x[i] / norm_test, tol);
+
+            liquid_vectorf_abs(x, n, z);
+            for (i=0; i<n; i++) CONTEND_EQUALITY(z[i], fabsf(x[i]));
+
+            liquid_vectorf_abs2(x, n, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(z[i], x[i]*x[i], tol);
+
+            liquid_vectorf_cexpj(x, n, z);
+            for (i=0; i<n; i++) CONTEND_EQUALITY(z[i], x[i] > 0 ? 1.0f : -1.0f);
+
+            liquid_vectorf_carg(x, n, z);
+            for (i=0; i<n; i++) CONTEND_DELTA(z[i], x[i] > 0 ? 0.0f : M_PI, tol);
+
+            // input is left unmodified
+            for (i=0; i<n; i++) CONTEND_EQUALITY(x[i], x0[i]);
+        }
+        if (liquid_autotest_verbose)
+            printf("  vectorf [%-8s] : pass\n", liquid_simd_type_str[t][0]);
+    }
+
+    // restore original SIMD type
+    liquid_simd_set_type(simd);
+}
+
+
+// compare bank of second-order sections against direct computation for
+// each SIMD type supported by the host
+void autotest_vectorf_sosbank()
+{
+    float tol = 1e-4f;
+    liquid_simd_type simd = liquid_simd_get_type();
+    unsigned int L = LIQUID_VECTOR_SOSBANK_LANES;
+
+    // stable sections: |a2| < 1, |a1| < 1 + a2
+    float h[4*L];
+    unsigned int k;
+    for (k=0; k<L; k++) {
+        h[0*L+k] = randnf();
+        h[1*L+k] = randnf();
+        h[3*L+k] = 0.9f*randf();
+        h[2*L+k] = 0.9f*(1.0f + h[3*L+k])*(2.0f*randf() - 1.0f);
+    }
+
+    unsigned int t;
+    for (t=LIQUID_SIMD_PORTABLE; t<LIQUID_SIMD_NUM_TYPES; t++) {
+        if (!liquid_simd_is_supported(t)) {
+            if (liquid_autotest_verbose)
+                printf("  sosbank [%-8s] : not supported\n", liquid_simd_type_str[t][0]);
+            continue;
+        }
+        liquid_simd_set_type(t);
+
+        unsigned int nc, n;
+        for (nc=1; nc<=2; nc++) {
+            for (n=1; n<=40; n+=13) {
+                float x[nc*n], y[nc*n], y_test[nc*n];
+                float w1[L], w2[L], v1[L], v2[L];
+                unsigned int i;
+                for (i=0; i<nc*n; i++) {
+                    x[i]      = randnf();
+                    y[i]      = randnf();
+                    y_test[i] = y[i];
+                }
+                for (k=0; k<L; k++) {
+                    w1[k] = v1[k] = randnf();
+                    w2[k] = v2[k] = randnf();
+                }
+
+                // direct computation; lane k filters channel k % nc
+                for (i=0; i<n; i++) {
+                    for (k=0; k<L; k++) {
+                        float v = x[i*nc + k%nc];
+                        float s = h[0*L+k]*v + v1[k];
+                        v1[k] = h[1*L+k]*v + v2[k] - h[2*L+k]*s;
+                        v2[k] = -h[3*L+k]*s;
+                        y_test[i*nc + k%nc] += s;
+                    }
+                }
+
+                liquid_vectorf_sosbank(h, w1, w2, nc, x, n, y);
+                for (i=0; i<nc*n; i++) CONTEND_DELTA(y[i], y_test[i], tol);
+                for (k=0; k<L; k++) {
+                    CONTEND_DELTA(w1[k], v1[k], tol);
+                    CONTEND_DELTA(w2[k], v2[k], tol);
+                }
+            }
+        }
+        if (liquid_autotest_verbose)
+            printf("  sosbank [%-8s] : pass\n", liquid_simd_type_str[t][0]);
+    }
+
+    // restore original SIMD type
+    liquid_simd_set_type(simd);
+}